@@ -25,6 +25,7 @@
 
 #if defined(__linux__) || defined(__LINUX__)
 #include <condition_variable>
+#include <future>
 #include <mutex>
 #include <boost/thread.hpp>
 //add json logic
@@ -57,13 +58,17 @@ using namespace nlohmann;
 #include "libslic3r/Format/AMF.hpp"
 #include "libslic3r/Format/3mf.hpp"
 #include "libslic3r/Format/STL.hpp"
+#include "libslic3r/Format/GLTF.hpp"
 #include "libslic3r/Format/OBJ.hpp"
 #include "libslic3r/Format/SL1.hpp"
 #include "libslic3r/Utils.hpp"
 #include "libslic3r/Time.hpp"
+#include "libslic3r/ChromeTrace.hpp"
 #include "libslic3r/Thread.hpp"
 #include "libslic3r/BlacklistedLibraryCheck.hpp"
 
+#include <Shiny/Shiny.h>
+
 #include "libslic3r/Orient.hpp"
 
 #include "OrcaSlicer.hpp"
@@ -402,6 +407,25 @@ int CLI::run(int argc, char **argv)
     m_extra_config.apply(m_config, true);
     m_extra_config.normalize_fdm();
 
+    if (ConfigOptionString* trace_output_option = m_config.option<ConfigOptionString>("trace_output");
+        trace_output_option && !trace_output_option->value.empty()) {
+        // Collect a chrome://tracing timeline of the whole run, written out at the end of run().
+        ChromeTrace::begin();
+        BOOST_LOG_TRIVIAL(info) << "pipeline tracing enabled, timeline will be written to " << trace_output_option->value;
+    }
+
+    if (ConfigOptionString* checkpoint_dir_option = m_config.option<ConfigOptionString>("checkpoint_dir");
+        checkpoint_dir_option && !checkpoint_dir_option->value.empty()) {
+        set_checkpoint_dir(checkpoint_dir_option->value);
+        BOOST_LOG_TRIVIAL(info) << "slicing checkpoints enabled in " << checkpoint_dir_option->value;
+    }
+
+    if (ConfigOptionString* telemetry_log_option = m_config.option<ConfigOptionString>("telemetry_log");
+        telemetry_log_option && !telemetry_log_option->value.empty()) {
+        telemetry_set_log(telemetry_log_option->value);
+        BOOST_LOG_TRIVIAL(info) << "performance telemetry enabled, logging to " << telemetry_log_option->value;
+    }
+
     PrinterTechnology printer_technology = get_printer_technology(m_config);
 
     bool							start_gui			= m_actions.empty();
@@ -1815,6 +1839,11 @@ int CLI::run(int argc, char **argv)
                 model.add_default_instances();
             if (! this->export_models(IO::OBJ))
                 flush_and_exit(CLI_EXPORT_OBJ_ERROR);
+        } else if (opt_key == "export_gltf") {
+            for (auto &model : m_models)
+                model.add_default_instances();
+            if (! this->export_models(IO::GLTF))
+                flush_and_exit(CLI_EXPORT_GLTF_ERROR);
         }/* else if (opt_key == "export_amf") {
             if (! this->export_models(IO::AMF))
                 return 1;
@@ -1886,6 +1915,15 @@ int CLI::run(int argc, char **argv)
                     PrintBase  *print=NULL;
                     Slic3r::GUI::GCodeResult *gcode_result = NULL;
                     int print_index;
+                    // When slicing all plates, the G-code export of the previous plate may still run
+                    // while the next plate is being processed. Each plate exports from its own Print
+                    // and GCodeResult, so the only synchronization needed is joining the export before
+                    // starting this plate's export and before leaving the plate loop.
+                    std::future<void> pending_gcode_export;
+                    auto join_pending_gcode_export = [&pending_gcode_export]() {
+                        if (pending_gcode_export.valid())
+                            pending_gcode_export.get();
+                    };
                     for (int index = 0; index < partplate_list.get_plate_count(); index ++)
                     {
                         if ((plate_to_slice != 0) && (plate_to_slice != (index + 1))) {
@@ -1997,6 +2035,9 @@ int CLI::run(int argc, char **argv)
                         print->apply(model, new_print_config);
                         BOOST_LOG_TRIVIAL(info) << boost::format("set no_check to %1%:")%no_check;
                         print->set_no_check_flag(no_check);//BBS
+                        // Batch slicing never re-processes a plate incrementally, so intermediate
+                        // layer data may be dropped once consumed - unless it is to be exported.
+                        print->set_conserve_memory_flag(!export_slicedata);
                         StringObjectException warning;
                         auto err = print->validate(&warning);
                         if (!err.string.empty()) {
@@ -2074,6 +2115,23 @@ int CLI::run(int argc, char **argv)
                                         part_plate->set_tmp_gcode_path(outfile);
                                     }
                                     BOOST_LOG_TRIVIAL(info) << "process finished, will export gcode temporily to " << outfile << std::endl;
+                                    // Join the export of the previous plate before reusing the export slot.
+                                    join_pending_gcode_export();
+                                    // Overlap the export of this plate with the processing of the next one when
+                                    // slicing all plates. Disabled when per-plate status reporting, slicing data
+                                    // export or the per-plate time limit needs the export to finish in-loop.
+                                    bool overlap_gcode_export = plate_to_slice == 0 && !export_slicedata && max_slicing_time_per_plate == 0;
+#if defined(__linux__) || defined(__LINUX__)
+                                    if (g_cli_callback_mgr.is_started())
+                                        overlap_gcode_export = false;
+#endif
+                                    if (overlap_gcode_export) {
+                                        pending_gcode_export = std::async(std::launch::async, [print, gcode_result, outfile, part_plate, index]() {
+                                            std::string exported = dynamic_cast<Print*>(print)->export_gcode(outfile, gcode_result, nullptr);
+                                            BOOST_LOG_TRIVIAL(info) << "Slicing result exported to " << exported << " for plate " << index + 1;
+                                            part_plate->update_slice_result_valid_state(true);
+                                        });
+                                    } else
                                     outfile = (dynamic_cast<Print*>(print))->export_gcode(outfile, gcode_result, nullptr);
                                     //outfile_final = (dynamic_cast<Print*>(print))->print_statistics().finalize_output_path(outfile);
                                     //m_fff_print->export_gcode(m_temp_output_path, m_gcode_result, [this](const ThumbnailsParams& params) { return this->render_thumbnails(params); });
@@ -2092,8 +2150,11 @@ int CLI::run(int argc, char **argv)
                                 }*/
                                 // Run the post-processing scripts if defined.
                                 //run_post_process_scripts(outfile, print->full_print_config());
-                                BOOST_LOG_TRIVIAL(info) << "Slicing result exported to " << outfile << std::endl;
-                                part_plate->update_slice_result_valid_state(true);
+                                if (!pending_gcode_export.valid()) {
+                                    // With an overlapped export the async task logs and validates the result itself.
+                                    BOOST_LOG_TRIVIAL(info) << "Slicing result exported to " << outfile << std::endl;
+                                    part_plate->update_slice_result_valid_state(true);
+                                }
 #if defined(__linux__) || defined(__LINUX__)
                                 if (g_cli_callback_mgr.is_started()) {
                                     PrintBase::SlicingStatus slicing_status{100, "Slicing finished"};
@@ -2129,6 +2190,13 @@ int CLI::run(int argc, char **argv)
                             }
                         }
                     }
+                    try {
+                        join_pending_gcode_export();
+                    } catch (const std::exception &ex) {
+                        BOOST_LOG_TRIVIAL(error) << "found gcode export error for the last sliced partplate" << std::endl;
+                        boost::nowide::cerr << ex.what() << std::endl;
+                        flush_and_exit(CLI_SLICING_ERROR);
+                    }
                     if (pre_check)
                         pre_check = false;
                     else
@@ -2713,6 +2781,25 @@ int CLI::run(int argc, char **argv)
     for (Model &model : m_models) {
 	model.remove_backup_path_if_exist();
     }
+
+    if (ConfigOptionString* profile_output_option = m_config.option<ConfigOptionString>("profile_output");
+        profile_output_option && !profile_output_option->value.empty()) {
+#ifdef SLIC3R_PROFILE
+        // Dump the zone tree accumulated by the Shiny profiler over the whole run.
+        PROFILE_UPDATE();
+        PROFILE_OUTPUT(profile_output_option->value.c_str());
+        BOOST_LOG_TRIVIAL(info) << "profiler zone tree dumped to " << profile_output_option->value;
+#else
+        BOOST_LOG_TRIVIAL(warning) << "--profile-output ignored: this build was not configured with SLIC3R_PROFILE";
+#endif
+    }
+
+    if (ConfigOptionString* trace_output_option = m_config.option<ConfigOptionString>("trace_output");
+        trace_output_option && !trace_output_option->value.empty() && ChromeTrace::enabled()) {
+        if (ChromeTrace::end_and_write(trace_output_option->value))
+            BOOST_LOG_TRIVIAL(info) << "pipeline trace written to " << trace_output_option->value;
+    }
+
     //BBS: flush logs
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ", Finished" << std::endl;
     boost::nowide::cout.flush();
@@ -2817,6 +2904,11 @@ void CLI::print_help(bool include_print_options, PrinterTechnology printer_techn
         << SLIC3R_APP_KEY <<"-"<< SoftFever_VERSION << ":"
         << std::endl
         << "Usage: orca-slicer [ OPTIONS ] [ file.3mf/file.stl ... ]" << std::endl
+        << "       orca-slicer --batch" << std::endl
+        << "           Batch mode for farms: read one job per line from the standard input" << std::endl
+        << "           (regular CLI arguments, double quotes protect spaces), slice each in" << std::endl
+        << "           this warm process and acknowledge it with \"job <n> done <exit code>\"" << std::endl
+        << "           on the standard output. Exits on EOF or an \"exit\" line." << std::endl
         << std::endl
         << "OPTIONS:" << std::endl;
     cli_misc_config_def.print_cli_help(boost::nowide::cout, false);
@@ -2850,6 +2942,7 @@ bool CLI::export_models(IO::ExportFormat format)
             //case IO::AMF: success = Slic3r::store_amf(path.c_str(), &model, nullptr, false); break;
             case IO::OBJ: success = Slic3r::store_obj(path.c_str(), &model);          break;
             case IO::STL: success = Slic3r::store_stl(path.c_str(), &model, true);    break;
+            case IO::GLTF: success = Slic3r::store_gltf(path.c_str(), &model);        break;
             //BBS: use bbs 3mf instead of original
             //case IO::TMF: success = Slic3r::store_bbs_3mf(path.c_str(), &model, nullptr, false); break;
             default: assert(false); break;
@@ -2903,6 +2996,7 @@ std::string CLI::output_filepath(const Model &model, IO::ExportFormat format) co
         case IO::AMF: ext = ".zip.amf"; break;
         case IO::OBJ: ext = ".obj"; break;
         case IO::STL: ext = ".stl"; break;
+        case IO::GLTF: ext = ".glb"; break;
         case IO::TMF: ext = ".3mf"; break;
         default: assert(false); break;
     };
@@ -2977,6 +3071,64 @@ LONG WINAPI VectoredExceptionHandler(PEXCEPTION_POINTERS pExceptionInfo)
     return EXCEPTION_CONTINUE_SEARCH;
 }*/
 
+// Warm batch mode for render farms: one process accepts slicing jobs over the standard
+// input, one job per line holding the regular CLI arguments (split on whitespace, double
+// quotes protect spaces, lines starting with # are skipped). Every job runs through the
+// regular CLI code path, so config definitions, preset parsing tables and the TBB thread
+// pool are paid for once per process instead of once per job. Each finished job is
+// acknowledged on the standard output with a line "job <n> done <exit code>", letting a
+// farm wrapper drive the process through a pipe or a local socket relay. The process
+// exits on EOF or on an "exit" line.
+static int run_batch_jobs(const char *argv0)
+{
+    std::string line;
+    int         job_id = 0;
+    while (std::getline(boost::nowide::cin, line)) {
+        // Trim trailing CR of files with Windows line endings and surrounding spaces.
+        while (! line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t'))
+            line.pop_back();
+        size_t begin = line.find_first_not_of(" \t");
+        if (begin == std::string::npos || line[begin] == '#')
+            continue;
+        line.erase(0, begin);
+        if (line == "exit" || line == "quit")
+            break;
+        // Split the job line into arguments.
+        std::vector<std::string> args;
+        args.emplace_back(argv0);
+        std::string current;
+        bool        in_quotes = false;
+        bool        has_token = false;
+        for (char c : line) {
+            if (c == '"') {
+                in_quotes = ! in_quotes;
+                has_token = true;
+            } else if (! in_quotes && (c == ' ' || c == '\t')) {
+                if (has_token || ! current.empty()) {
+                    args.emplace_back(std::move(current));
+                    current.clear();
+                    has_token = false;
+                }
+            } else {
+                current += c;
+                has_token = true;
+            }
+        }
+        if (has_token || ! current.empty())
+            args.emplace_back(std::move(current));
+        std::vector<char*> argv_job;
+        argv_job.reserve(args.size() + 1);
+        for (std::string &arg : args)
+            argv_job.emplace_back(arg.data());
+        argv_job.emplace_back(nullptr);
+        ++ job_id;
+        int ret = CLI().run(int(args.size()), argv_job.data());
+        boost::nowide::cout << "job " << job_id << " done " << ret << std::endl;
+        boost::nowide::cout.flush();
+    }
+    return 0;
+}
+
 #if defined(_MSC_VER) || defined(__MINGW32__)
 extern "C" {
     __declspec(dllexport) int __stdcall orcaslicer_main(int argc, wchar_t **argv)
@@ -2996,12 +3148,16 @@ extern "C" {
         AddVectoredExceptionHandler(1, CBaseException::UnhandledExceptionFilter);
 #endif
         // Call the UTF8 main.
+        if (argc >= 2 && argv_narrow[1] == "--batch")
+            return run_batch_jobs(argv_ptrs[0]);
         return CLI().run(argc, argv_ptrs.data());
     }
 }
 #else /* _MSC_VER */
 int main(int argc, char **argv)
 {
+    if (argc >= 2 && strcmp(argv[1], "--batch") == 0)
+        return run_batch_jobs(argv[0]);
     return CLI().run(argc, argv);
 }
 #endif /* _MSC_VER */
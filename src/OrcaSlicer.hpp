@@ -11,6 +11,7 @@ namespace IO {
         AMF,
         OBJ,
         STL,
+        GLTF,
         // SVG,
         TMF,
         Gcode
@@ -25,10 +25,15 @@
 #include <string.h>
 #include <math.h>
 
+#include <atomic>
+
 // Boost pool: Don't use mutexes to synchronize memory allocation.
 #define BOOST_POOL_NO_MT
 #include <boost/pool/object_pool.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include "stl.h"
 
 static void reverse_facet(stl_file *stl, int facet_num)
@@ -65,8 +70,9 @@ static void reverse_facet(stl_file *stl, int facet_num)
 	stl->neighbors_start[facet_num].which_vertex_not[2] = (stl->neighbors_start[facet_num].which_vertex_not[2] + 3) % 6;
 }
 
-// Returns true if the normal was flipped.
-static bool check_normal_vector(stl_file *stl, int facet_num, int normal_fix_flag)
+// Returns true if the normal was flipped. Increments normals_fixed instead of the global
+// statistics, so that the facets may be checked in parallel.
+static bool check_normal_vector(stl_file *stl, int facet_num, int normal_fix_flag, int &normals_fixed)
 {
 	stl_facet *facet = &stl->facet_start[facet_num];
 
@@ -89,7 +95,7 @@ static bool check_normal_vector(stl_file *stl, int facet_num, int normal_fix_fla
 		// The normal is not within tolerance, but direction is OK.
 		if (normal_fix_flag) {
 	  		facet->normal = normal;
-	  		++ stl->stats.normals_fixed;
+	  		++ normals_fixed;
 		}
 		return false;
 	}
@@ -100,13 +106,13 @@ static bool check_normal_vector(stl_file *stl, int facet_num, int normal_fix_fla
 		// The normal is not within tolerance and backwards.
 		if (normal_fix_flag) {
 	  		facet->normal = normal;
-	  		++ stl->stats.normals_fixed;
+	  		++ normals_fixed;
 		}
 		return true;
 	}
 	if (normal_fix_flag) {
 		facet->normal = normal;
-		++ stl->stats.normals_fixed;
+		++ normals_fixed;
 	}
 	// Status is unknown.
 	return false;
@@ -140,7 +146,7 @@ void stl_fix_normal_directions(stl_file *stl)
   	// If normal vector is not within tolerance and backwards:
     // Arbitrarily starts at face 0.  If this one is wrong, we're screwed. Thankfully, the chances
     // of it being wrong randomly are low if most of the triangles are right:
-  	if (check_normal_vector(stl, 0, 0)) {
+  	if (check_normal_vector(stl, 0, 0, stl->stats.normals_fixed)) {
     	reverse_facet(stl, 0);
       	reversed_ids.emplace_back(0);
   	}
@@ -206,7 +212,7 @@ void stl_fix_normal_directions(stl_file *stl)
       			if (norm_sw[i] == 0) {
         			// This is the first facet of the next part.
         			facet_num = i;
-        			if (check_normal_vector(stl, i, 0)) {
+        			if (check_normal_vector(stl, i, 0, stl->stats.normals_fixed)) {
             			reverse_facet(stl, i);
             			reversed_ids.emplace_back(i);
         			}
@@ -223,8 +229,16 @@ void stl_fix_normal_directions(stl_file *stl)
 
 void stl_fix_normal_values(stl_file *stl)
 {
-	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i)
-    	check_normal_vector(stl, i, 1);
+	// Each facet is checked against its own vertices only, thus the facets may be fixed in parallel.
+	std::atomic<int> normals_fixed(0);
+	tbb::parallel_for(tbb::blocked_range<uint32_t>(0, stl->stats.number_of_facets),
+		[stl, &normals_fixed](const tbb::blocked_range<uint32_t> &range) {
+			int fixed = 0;
+			for (uint32_t i = range.begin(); i < range.end(); ++ i)
+				check_normal_vector(stl, i, 1, fixed);
+			normals_fixed.fetch_add(fixed, std::memory_order_relaxed);
+		});
+	stl->stats.normals_fixed += normals_fixed.load(std::memory_order_relaxed);
 }
 
 void stl_reverse_all_facets(stl_file *stl)
@@ -159,6 +159,42 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first, Impor
 
 	uint32_t facets_num = stl->stats.number_of_facets;
 	uint32_t unit = facets_num / LOAD_STL_UNIT_NUM + 1;
+
+	if (stl->stats.type == binary) {
+		// BBS: read the facets in large slabs instead of one 50 byte fread per facet,
+		// the per-call overhead used to dominate the import time of big binary files.
+		static constexpr const uint32_t FACETS_PER_SLAB = 8192;
+		std::vector<char> slab(size_t(FACETS_PER_SLAB) * SIZEOF_STL_FACET);
+		for (uint32_t i = first_facet; i < facets_num;) {
+			const uint32_t cnt = std::min(FACETS_PER_SLAB, facets_num - i);
+			if (fread(slab.data(), SIZEOF_STL_FACET, cnt, fp) != cnt)
+				return false;
+			for (uint32_t j = 0; j < cnt; ++j, ++i) {
+				if ((i % unit) == 0) {
+					bool cb_cancel = false;
+					if (stlFn) {
+						stlFn(i, facets_num, cb_cancel);
+						if (cb_cancel)
+							return false;
+					}
+				}
+				stl_facet facet;
+				// We assume little-endian architecture!
+				memcpy(&facet, slab.data() + size_t(j) * SIZEOF_STL_FACET, SIZEOF_STL_FACET);
+#if BOOST_ENDIAN_BIG_BYTE
+				// Convert the loaded little endian data to big endian.
+				stl_internal_reverse_quads((char*)&facet, 48);
+#endif /* BOOST_ENDIAN_BIG_BYTE */
+				// Write the facet into memory.
+				stl->facet_start[i] = facet;
+				stl_facet_stats(stl, facet, first);
+			}
+		}
+		stl->stats.size = stl->stats.max - stl->stats.min;
+		stl->stats.bounding_diameter = stl->stats.size.norm();
+		return true;
+	}
+
     for (uint32_t i = first_facet; i < facets_num; ++ i) {
 		if ((i % unit) == 0) {
 				bool cb_cancel = false;
@@ -171,15 +207,7 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first, Impor
 
   	  	stl_facet facet;
 
-    	if (stl->stats.type == binary) {
-      		// Read a single facet from a binary .STL file. We assume little-endian architecture!
-      		if (fread(&facet, 1, SIZEOF_STL_FACET, fp) != SIZEOF_STL_FACET)
-      			return false;
-#if BOOST_ENDIAN_BIG_BYTE
-      		// Convert the loaded little endian data to big endian.
-      		stl_internal_reverse_quads((char*)&facet, 48);
-#endif /* BOOST_ENDIAN_BIG_BYTE */
-    	} else {
+    	{
 			// Read a single facet from an ASCII .STL file
 			// skip solid/endsolid
 			// (in this order, otherwise it won't work when they are paired in the middle of a file)
@@ -25,45 +25,58 @@
 #include <string.h>
 #include <math.h>
 
+#include <atomic>
+#include <functional>
+
 #include <boost/log/trivial.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
 #include "stl.h"
 
 void stl_verify_neighbors(stl_file *stl)
 {
-	stl->stats.backwards_edges = 0;
-
-	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i) {
-		for (int j = 0; j < 3; ++ j) {
-			struct stl_edge {
-				stl_vertex p1;
-				stl_vertex p2;
-				int        facet_number;
-			};
-			stl_edge edge_a;
-			edge_a.p1 = stl->facet_start[i].vertex[j];
-			edge_a.p2 = stl->facet_start[i].vertex[(j + 1) % 3];
-			int neighbor = stl->neighbors_start[i].neighbor[j];
-			if (neighbor == -1)
-				continue; // this edge has no neighbor... Continue.
-			int vnot = stl->neighbors_start[i].which_vertex_not[j];
-			stl_edge edge_b;
-			if (vnot < 3) {
-				edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
-				edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
-			} else {
-				stl->stats.backwards_edges += 1;
-				edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
-				edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
-			}
-			if (edge_a.p1 != edge_b.p1 || edge_a.p2 != edge_b.p2) {
-				// These edges should match but they don't.  Print results.
-				BOOST_LOG_TRIVIAL(info) << "edge " << j << " of facet " << i << " doesn't match edge " << (vnot + 1) << " of facet " << neighbor;
-				stl_write_facet(stl, (char*)"first facet", i);
-				stl_write_facet(stl, (char*)"second facet", neighbor);
+	// The verification only reads the facets and their neighbors, thus it may run in parallel.
+	std::atomic<int> backwards_edges(0);
+	tbb::parallel_for(tbb::blocked_range<uint32_t>(0, stl->stats.number_of_facets),
+		[stl, &backwards_edges](const tbb::blocked_range<uint32_t> &range) {
+		int backwards = 0;
+		for (uint32_t i = range.begin(); i < range.end(); ++ i) {
+			for (int j = 0; j < 3; ++ j) {
+				struct stl_edge {
+					stl_vertex p1;
+					stl_vertex p2;
+					int        facet_number;
+				};
+				stl_edge edge_a;
+				edge_a.p1 = stl->facet_start[i].vertex[j];
+				edge_a.p2 = stl->facet_start[i].vertex[(j + 1) % 3];
+				int neighbor = stl->neighbors_start[i].neighbor[j];
+				if (neighbor == -1)
+					continue; // this edge has no neighbor... Continue.
+				int vnot = stl->neighbors_start[i].which_vertex_not[j];
+				stl_edge edge_b;
+				if (vnot < 3) {
+					edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
+					edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
+				} else {
+					backwards += 1;
+					edge_b.p1 = stl->facet_start[neighbor].vertex[(vnot + 1) % 3];
+					edge_b.p2 = stl->facet_start[neighbor].vertex[(vnot + 2) % 3];
+				}
+				if (edge_a.p1 != edge_b.p1 || edge_a.p2 != edge_b.p2) {
+					// These edges should match but they don't.  Print results.
+					BOOST_LOG_TRIVIAL(info) << "edge " << j << " of facet " << i << " doesn't match edge " << (vnot + 1) << " of facet " << neighbor;
+					stl_write_facet(stl, (char*)"first facet", i);
+					stl_write_facet(stl, (char*)"second facet", neighbor);
+				}
 			}
 		}
-	}
+		backwards_edges.fetch_add(backwards, std::memory_order_relaxed);
+	});
+	stl->stats.backwards_edges = backwards_edges.load(std::memory_order_relaxed);
 }
 
 void stl_translate(stl_file *stl, float x, float y, float z)
@@ -275,16 +288,22 @@ float get_area(stl_facet *facet)
 
 static float get_volume(stl_file *stl)
 {
+	if (stl->stats.number_of_facets == 0)
+		return 0.f;
   	// Choose a point, any point as the reference.
-  	stl_vertex p0 = stl->facet_start[0].vertex[0];
-  	float volume = 0.f;
-  	for (uint32_t i = 0; i < stl->stats.number_of_facets; ++ i) {
-    	// Do dot product to get distance from point to plane.
-    	float height = stl->facet_start[i].normal.dot(stl->facet_start[i].vertex[0] - p0);
-    	float area   = get_area(&stl->facet_start[i]);
-    	volume += (area * height) / 3.0f;
-  	}
-  	return volume;
+  	const stl_vertex p0 = stl->facet_start[0].vertex[0];
+  	// The volume is a sum of independent per-facet tetrahedron contributions, accumulate them in parallel.
+  	return tbb::parallel_reduce(tbb::blocked_range<uint32_t>(0, stl->stats.number_of_facets), 0.f,
+  		[stl, &p0](const tbb::blocked_range<uint32_t> &range, float volume) {
+  			for (uint32_t i = range.begin(); i < range.end(); ++ i) {
+		    	// Do dot product to get distance from point to plane.
+		    	float height = stl->facet_start[i].normal.dot(stl->facet_start[i].vertex[0] - p0);
+		    	float area   = get_area(&stl->facet_start[i]);
+		    	volume += (area * height) / 3.0f;
+  			}
+  			return volume;
+  		},
+  		std::plus<float>());
 }
 
 void stl_calculate_volume(stl_file *stl)
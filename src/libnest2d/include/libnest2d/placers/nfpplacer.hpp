@@ -8,6 +8,8 @@
 #include <iterator>
 #include <future>
 #include <atomic>
+#include <mutex>
+#include <unordered_map>
 
 #ifndef NDEBUG
 #include <iostream>
@@ -371,6 +373,93 @@ inline void correctNfpPosition(nfp::NfpResult<RawShape>& nfp,
     shapelike::translate(nfp.first, dnfp);
 }
 
+// Session-wide cache of no-fit polygons. The nfp of an outline pair depends
+// only on the two shapes and their rotations, never on their positions:
+// correctNfpPosition() anchors the result to the current items afterwards
+// using the cached reference vertex. The cache key is therefore the pair of
+// contours normalized to their first vertex, which makes repeat arrangements
+// of the same part designs hit the cache for every pair.
+template<class RawShape>
+class NfpCache {
+    using Vertex = TPoint<RawShape>;
+    using Coord  = TCoord<Vertex>;
+    using NfpR   = nfp::NfpResult<RawShape>;
+
+    struct Key {
+        std::vector<Vertex> stationary, orbiter;
+        size_t hash = 0;
+        bool operator==(const Key &o) const {
+            return hash == o.hash && stationary == o.stationary &&
+                   orbiter == o.orbiter;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &k) const { return k.hash; }
+    };
+
+    // Keep the cache from growing without bounds within very long sessions.
+    static const size_t MaxEntries = 4096;
+
+    std::unordered_map<Key, NfpR, KeyHash> cache_;
+    std::mutex mtx_;
+
+    static void combine(size_t &seed, Coord v)
+    {
+        seed ^= std::hash<long long>()(static_cast<long long>(v)) +
+                size_t(0x9e3779b97f4a7c15ull) + (seed << 6) + (seed >> 2);
+    }
+
+    // Store the contour with the first vertex subtracted from every vertex,
+    // making the key invariant to the translation of the shape.
+    static void normalize(const RawShape &sh, std::vector<Vertex> &out, size_t &seed)
+    {
+        const auto &ctr = sl::contour(sh);
+        out.reserve(ctr.size());
+        combine(seed, static_cast<Coord>(ctr.size()));
+        if (ctr.empty()) return;
+        const Coord x0 = getX(ctr.front()), y0 = getY(ctr.front());
+        for (const Vertex &p : ctr) {
+            Coord x = getX(p) - x0, y = getY(p) - y0;
+            out.emplace_back(x, y);
+            combine(seed, x);
+            combine(seed, y);
+        }
+    }
+
+public:
+
+    static NfpCache& instance()
+    {
+        static NfpCache cache;
+        return cache;
+    }
+
+    // Return the cached nfp of the outline pair, or compute and cache it.
+    template<class Fn>
+    NfpR get(const RawShape &stationary, const RawShape &orbiter, Fn &&compute)
+    {
+        Key key;
+        normalize(stationary, key.stationary, key.hash);
+        normalize(orbiter, key.orbiter, key.hash);
+
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            auto it = cache_.find(key);
+            if (it != cache_.end()) return it->second;
+        }
+
+        NfpR result = compute();
+
+        {
+            std::lock_guard<std::mutex> lk(mtx_);
+            if (cache_.size() >= MaxEntries) cache_.clear();
+            cache_.emplace(std::move(key), result);
+        }
+
+        return result;
+    }
+};
+
 template<class RawShape, class Circle = _Circle<TPoint<RawShape>> >
 Circle minimizeCircle(const RawShape& sh) {
     using Point = TPoint<RawShape>;
@@ -603,7 +692,10 @@ private:
         {
             auto& fixedp = sh.transformedShape();
             auto& orbp = trsh.transformedShape();
-            auto subnfp_r = noFitPolygon<NfpLevel::CONVEX_ONLY>(fixedp, orbp);
+            auto subnfp_r = NfpCache<RawShape>::instance().get(fixedp, orbp,
+                [&fixedp, &orbp] {
+                    return noFitPolygon<NfpLevel::CONVEX_ONLY>(fixedp, orbp);
+                });
             correctNfpPosition(subnfp_r, sh, trsh);
             nfps[n] = subnfp_r.first;
         });
@@ -620,7 +712,10 @@ private:
         Item   slidingItem(sliding);
         slidingItem.transformedShape();
         __parallel::enumerate(stationarys.begin(), stationarys.end(), [&nfps, sliding, &slidingItem](const RawShape &stationary, size_t n) {
-            auto subnfp_r = noFitPolygon<NfpLevel::CONVEX_ONLY>(stationary, sliding);
+            auto subnfp_r = NfpCache<RawShape>::instance().get(stationary, sliding,
+                [&stationary, &sliding] {
+                    return noFitPolygon<NfpLevel::CONVEX_ONLY>(stationary, sliding);
+                });
             correctNfpPosition(subnfp_r, stationary, slidingItem);
             nfps[n] = subnfp_r.first;
         });
@@ -767,10 +862,47 @@ private:
         }
         if (can_pack == false) {
 
-            Pile merged_pile = merged_pile_;
+            // Evaluate the candidate rotations concurrently. Each candidate
+            // works on its own copy of the item and of the merged pile and
+            // reports its best placement into its own slot; the slots are
+            // merged in rotation order afterwards, so the result is identical
+            // to the former serial rotation loop.
+            struct RotationResult {
+                bool   can_pack = false;
+                double score    = std::numeric_limits<double>::max();
+                double overfit  = std::numeric_limits<double>::max();
+                Vertex tr       = {0, 0};
+            };
+            std::vector<RotationResult> rotation_results(config_.rotations.size());
+
+            // The callback is fed the same arguments for every rotation,
+            // call it once for this item instead of once per rotation.
+            if(config_.before_packing)
+                config_.before_packing(merged_pile_, items_, remlist);
+
+            // Fill the lazy caches of the stationary items up front: calcnfp()
+            // is entered concurrently from the rotation candidates below and
+            // the cached getters are not guarded by any lock.
+            for(Item& itm : items_) {
+                itm.transformedShape();
+                itm.referenceVertex();
+                itm.rightmostTopVertex();
+                itm.leftmostBottomVertex();
+            }
+
+            std::launch rot_policy = std::launch::deferred;
+            if(config_.parallel) rot_policy |= std::launch::async;
 
-            for(auto rot : config_.rotations) {
+            __parallel::enumerate(config_.rotations.begin(),
+                                  config_.rotations.end(),
+                [this, shared_item = &item, &rotation_results, &bin,
+                 &binbb, initial_tr, initial_rot, &_objfunc]
+                (Radians rot, size_t rot_idx)
+            {
+                RotationResult &rres = rotation_results[rot_idx];
+                Pile merged_pile = merged_pile_;
 
+                Item item = *shared_item;
                 item.translation(initial_tr);
                 item.rotation(initial_rot + rot);
                 item.boundingBox(); // fill the bb cache
@@ -779,7 +911,7 @@ private:
                 // it is disjunct from the current merged pile
                 placeOutsideOfBin(item);
 
-                nfps = calcnfp(item, binbb, Lvl<MaxNfpLevel::value>());
+                Shapes nfps = calcnfp(item, binbb, Lvl<MaxNfpLevel::value>());
 
 
                 auto iv = item.referenceVertex();
@@ -835,9 +967,6 @@ private:
                 std::launch policy = std::launch::deferred;
                 if(config_.parallel) policy |= std::launch::async;
 
-                if(config_.before_packing)
-                    config_.before_packing(merged_pile, items_, remlist);
-
                 using OptResult = opt::Result<double>;
                 using OptResults = std::vector<OptResult>;
 
@@ -893,7 +1022,7 @@ private:
                             best_score = mr.score;
                             optimum = o;
                         } else {
-                            best_overfit = std::min(miss, best_overfit);
+                            rres.overfit = std::min(miss, rres.overfit);
                         }
                     }
 
@@ -942,18 +1071,29 @@ private:
                                 best_score = hmr.score;
                                 optimum = o;
                             } else {
-                                best_overfit = std::min(miss, best_overfit);
+                                rres.overfit = std::min(miss, rres.overfit);
                             }
                         }
                     }
                 }
 
-                if( best_score < global_score) {
-                    auto d = (getNfpPoint(optimum) - iv) + startpos;
-                    final_tr = d;
-                    final_rot = initial_rot + rot;
+                if( best_score < std::numeric_limits<double>::max()) {
+                    rres.can_pack = true;
+                    rres.score    = best_score;
+                    rres.tr       = (getNfpPoint(optimum) - iv) + startpos;
+                }
+            }, rot_policy);
+
+            // Merge the per-rotation candidates in rotation order, keeping
+            // the strict-less-than comparison of the former serial loop.
+            for(size_t rot_idx = 0; rot_idx < rotation_results.size(); ++rot_idx) {
+                const RotationResult &rres = rotation_results[rot_idx];
+                best_overfit = std::min(rres.overfit, best_overfit);
+                if(rres.can_pack && rres.score < global_score) {
+                    final_tr = rres.tr;
+                    final_rot = initial_rot + config_.rotations[rot_idx];
                     can_pack = true;
-                    global_score = best_score;
+                    global_score = rres.score;
                 }
             }
 
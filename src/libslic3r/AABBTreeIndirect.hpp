@@ -13,6 +13,8 @@
 
 #include <Eigen/Geometry>
 
+#include <tbb/parallel_invoke.h>
+
 #include "BoundingBox.hpp"
 #include "Utils.hpp" // for next_highest_power_of_2()
 
@@ -145,8 +147,17 @@ private:
 		// Insert an inner node into the tree. Inner node does not reference any input entity (triangle, line segment etc).
 		m_nodes[node].idx  = inner;
 		m_nodes[node].bbox = bbox;
-        build_recursive(input, node * 2 + 1, left, center);
-		build_recursive(input, node * 2 + 2, center + 1, right);
+		// The left / right subtrees span disjoint ranges of both the input and m_nodes,
+		// thus they may be built in parallel. Only spawn tasks for subtrees large enough
+		// to amortize the scheduling overhead, recurse serially below that.
+		if (right - left > 4096)
+			tbb::parallel_invoke(
+				[this, &input, node, left, center]() { this->build_recursive(input, node * 2 + 1, left, center); },
+				[this, &input, node, center, right]() { this->build_recursive(input, node * 2 + 2, center + 1, right); });
+		else {
+			build_recursive(input, node * 2 + 1, left, center);
+			build_recursive(input, node * 2 + 2, center + 1, right);
+		}
 	}
 
 	// Partition the input m_nodes <left, right> at "k" and "dimension" using the QuickSelect method:
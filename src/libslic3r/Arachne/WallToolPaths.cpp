@@ -2,6 +2,9 @@
 // CuraEngine is released under the terms of the AGPLv3 or higher.
 
 #include <algorithm> //For std::partition_copy and std::min_element.
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "WallToolPaths.hpp"
@@ -16,6 +19,7 @@
 #include "SVG.hpp"
 #include "Utils.hpp"
 
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
 
 //#define ARACHNE_STITCH_PATCH_DEBUG
@@ -47,6 +51,7 @@ WallToolPathsParams make_paths_params(const int layer_id, const PrintObjectConfi
 
         input_params.wall_transition_angle   = print_object_config.wall_transition_angle.value;
         input_params.wall_distribution_count = print_object_config.wall_distribution_count.value;
+        input_params.resolution              = float(print_config.resolution.value);
     }
 
     return input_params;
@@ -461,11 +466,151 @@ void removeColinearEdges(Polygons &thiss, const double max_deviation_angle = 0.0
     }
 }
 
+// Bounded LRU cache of generated toolpaths, keyed by the input outline and all parameters
+// influencing the result. The Voronoi based SkeletalTrapezoidation dominates make_perimeters()
+// with variable-width walls enabled, thus re-slices which left a layer's slices untouched
+// (e.g. tweaking an infill only setting) and repeated identical islands reuse the toolpaths
+// instead of rebuilding the skeletal graph.
+namespace {
+
+struct WallToolPathsCacheKey
+{
+    Polygons outline;
+    coord_t  bead_width_0;
+    coord_t  bead_width_x;
+    size_t   inset_count;
+    coord_t  wall_0_inset;
+    coordf_t layer_height;
+    bool     print_thin_walls;
+    coord_t  min_feature_size;
+    coord_t  min_bead_width;
+    double   small_area_length;
+    coord_t  wall_transition_filter_deviation;
+    float    wall_transition_length;
+    float    wall_transition_angle;
+    int      wall_distribution_count;
+    float    resolution;
+
+    bool operator==(const WallToolPathsCacheKey &rhs) const
+    {
+        if (bead_width_0 != rhs.bead_width_0 || bead_width_x != rhs.bead_width_x || inset_count != rhs.inset_count ||
+            wall_0_inset != rhs.wall_0_inset || layer_height != rhs.layer_height || print_thin_walls != rhs.print_thin_walls ||
+            min_feature_size != rhs.min_feature_size || min_bead_width != rhs.min_bead_width ||
+            small_area_length != rhs.small_area_length || wall_transition_filter_deviation != rhs.wall_transition_filter_deviation ||
+            wall_transition_length != rhs.wall_transition_length || wall_transition_angle != rhs.wall_transition_angle ||
+            wall_distribution_count != rhs.wall_distribution_count || resolution != rhs.resolution ||
+            outline.size() != rhs.outline.size())
+            return false;
+        for (size_t i = 0; i < outline.size(); ++ i)
+            if (outline[i] != rhs.outline[i])
+                return false;
+        return true;
+    }
+
+    size_t hash() const
+    {
+        size_t seed = 0;
+        for (const Polygon &poly : outline) {
+            boost::hash_combine(seed, poly.points.size());
+            for (const Point &pt : poly.points) {
+                boost::hash_combine(seed, pt.x());
+                boost::hash_combine(seed, pt.y());
+            }
+        }
+        boost::hash_combine(seed, bead_width_0);
+        boost::hash_combine(seed, bead_width_x);
+        boost::hash_combine(seed, inset_count);
+        boost::hash_combine(seed, wall_0_inset);
+        boost::hash_combine(seed, layer_height);
+        boost::hash_combine(seed, print_thin_walls);
+        boost::hash_combine(seed, min_feature_size);
+        boost::hash_combine(seed, min_bead_width);
+        boost::hash_combine(seed, small_area_length);
+        boost::hash_combine(seed, wall_transition_filter_deviation);
+        boost::hash_combine(seed, wall_transition_length);
+        boost::hash_combine(seed, wall_transition_angle);
+        boost::hash_combine(seed, wall_distribution_count);
+        boost::hash_combine(seed, resolution);
+        return seed;
+    }
+};
+
+class WallToolPathsCache
+{
+    struct Entry
+    {
+        size_t                          hash;
+        WallToolPathsCacheKey           key;
+        std::vector<VariableWidthLines> toolpaths;
+        Polygons                        inner_contour;
+    };
+
+public:
+    bool lookup(const WallToolPathsCacheKey &key, size_t hash, std::vector<VariableWidthLines> &toolpaths, Polygons &inner_contour)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto range = m_map.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++ it)
+            if (it->second->key == key) {
+                // Promote the entry to the most recently used position.
+                m_lru.splice(m_lru.begin(), m_lru, it->second);
+                toolpaths     = it->second->toolpaths;
+                inner_contour = it->second->inner_contour;
+                return true;
+            }
+        return false;
+    }
+
+    void insert(WallToolPathsCacheKey &&key, size_t hash, const std::vector<VariableWidthLines> &toolpaths, const Polygons &inner_contour)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto range = m_map.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++ it)
+            if (it->second->key == key)
+                // Inserted by another thread in the meantime.
+                return;
+        while (m_lru.size() >= capacity) {
+            auto last = std::prev(m_lru.end());
+            auto evict_range = m_map.equal_range(last->hash);
+            for (auto it = evict_range.first; it != evict_range.second; ++ it)
+                if (it->second == last) {
+                    m_map.erase(it);
+                    break;
+                }
+            m_lru.pop_back();
+        }
+        m_lru.push_front(Entry { hash, std::move(key), toolpaths, inner_contour });
+        m_map.emplace(hash, m_lru.begin());
+    }
+
+private:
+    // Upper bound on the number of cached layers' toolpaths, to keep the memory footprint bounded.
+    static constexpr size_t capacity = 128;
+
+    std::mutex m_mutex;
+    std::list<Entry> m_lru;
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> m_map;
+};
+
+static WallToolPathsCache s_toolpaths_cache;
+
+} // namespace
+
 const std::vector<VariableWidthLines> &WallToolPaths::generate()
 {
     if (this->inset_count < 1)
         return toolpaths;
 
+    WallToolPathsCacheKey cache_key { outline, bead_width_0, bead_width_x, inset_count, wall_0_inset, layer_height,
+                                      print_thin_walls, min_feature_size, min_bead_width, small_area_length,
+                                      wall_transition_filter_deviation, m_params.wall_transition_length,
+                                      m_params.wall_transition_angle, m_params.wall_distribution_count, m_params.resolution };
+    const size_t cache_hash = cache_key.hash();
+    if (s_toolpaths_cache.lookup(cache_key, cache_hash, toolpaths, inner_contour)) {
+        toolpaths_generated = true;
+        return toolpaths;
+    }
+
     const coord_t smallest_segment = Slic3r::Arachne::meshfix_maximum_resolution;
     const coord_t allowed_distance = Slic3r::Arachne::meshfix_maximum_deviation;
     const coord_t epsilon_offset = (allowed_distance / 2) - 1;
@@ -540,7 +685,7 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
 
     separateOutInnerContour();
 
-    simplifyToolPaths(toolpaths);
+    simplifyToolPaths(toolpaths, scaled<coord_t>(this->m_params.resolution));
 
     removeEmptyToolPaths(toolpaths);
     assert(std::is_sorted(toolpaths.cbegin(), toolpaths.cend(),
@@ -549,6 +694,7 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
                               return l.front().inset_idx < r.front().inset_idx;
                           }) && "WallToolPaths should be sorted from the outer 0th to inner_walls");
     toolpaths_generated = true;
+    s_toolpaths_cache.insert(std::move(cache_key), cache_hash, toolpaths, inner_contour);
     return toolpaths;
 }
 
@@ -680,12 +826,14 @@ void WallToolPaths::removeSmallLines(std::vector<VariableWidthLines> &toolpaths)
     }
 }
 
-void WallToolPaths::simplifyToolPaths(std::vector<VariableWidthLines> &toolpaths)
+void WallToolPaths::simplifyToolPaths(std::vector<VariableWidthLines> &toolpaths, coord_t resolution)
 {
     for (size_t toolpaths_idx = 0; toolpaths_idx < toolpaths.size(); ++toolpaths_idx)
     {
         const int64_t maximum_resolution = Slic3r::Arachne::meshfix_maximum_resolution;
-        const int64_t maximum_deviation = Slic3r::Arachne::meshfix_maximum_deviation;
+        // The printer resolution may only coarsen the deviation budget, never tighten it below
+        // the built-in limit which keeps the Arachne output geometrically sound.
+        const int64_t maximum_deviation = std::max<int64_t>(Slic3r::Arachne::meshfix_maximum_deviation, resolution);
         const int64_t maximum_extrusion_area_deviation = Slic3r::Arachne::meshfix_maximum_extrusion_area_deviation; // unit: μm²
         for (auto& line : toolpaths[toolpaths_idx])
         {
@@ -29,6 +29,10 @@ public:
     float   wall_transition_angle;
     float   wall_transition_filter_deviation;
     int     wall_distribution_count;
+    // Printer G-code resolution, unscaled. Used as the deviation budget when simplifying
+    // the generated toolpaths, so the oversampled junction chains of the skeletal
+    // trapezoidation are never emitted at a resolution the printer cannot reproduce.
+    float   resolution { 0.f };
 };
 
 WallToolPathsParams make_paths_params(const int layer_id, const PrintObjectConfig &print_object_config, const PrintConfig &print_config);
@@ -112,10 +116,10 @@ protected:
     /*!
      * Simplifies the variable-width toolpaths by calling the simplify on every line in the toolpath using the provided
      * settings.
-     * \param settings The settings as provided by the user
+     * \param resolution The scaled printer resolution, raising the deviation budget when coarser than the built-in limits
      * \return
      */
-    static void simplifyToolPaths(std::vector<VariableWidthLines>  &toolpaths);
+    static void simplifyToolPaths(std::vector<VariableWidthLines>  &toolpaths, coord_t resolution);
 
 private:
     const Polygons& outline; //<! A reference to the outline polygon that is the designated area
@@ -40,15 +40,20 @@ void ArcFitter::do_arc_fitting(const Points& points, std::vector<PathFittingData
     bool can_fit = false;
     Points current_segment;
     current_segment.reserve(points.size());
+    // Length of current_segment, updated incrementally: recomputing it for every grown
+    // window made the fitting quadratic on smooth curves.
+    double current_length = 0.;
     ArcSegment target_arc;
     for (size_t i = 0; i < points.size(); i++) {
         //BBS: point in stack is not enough, build stack first
         back_index = i;
+        if (! current_segment.empty())
+            current_length += (points[i] - current_segment.back()).cast<double>().norm();
         current_segment.push_back(points[i]);
         if (back_index - front_index < 2)
             continue;
 
-        can_fit = ArcSegment::try_create_arc(current_segment, target_arc, Polyline(current_segment).length(),
+        can_fit = ArcSegment::try_create_arc(current_segment, target_arc, current_length,
                                              DEFAULT_SCALED_MAX_RADIUS,
                                              tolerance,
                                              DEFAULT_ARC_LENGTH_PERCENT_TOLERANCE);
@@ -81,6 +86,7 @@ void ArcFitter::do_arc_fitting(const Points& points, std::vector<PathFittingData
             current_segment.clear();
             current_segment.push_back(points[front_index]);
             current_segment.push_back(points[front_index + 1]);
+            current_length = (points[front_index + 1] - points[front_index]).cast<double>().norm();
         }
     }
 	//BBS: handle the remain data
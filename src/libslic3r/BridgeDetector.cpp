@@ -2,6 +2,7 @@
 #include "ClipperUtils.hpp"
 #include "Geometry.hpp"
 #include <algorithm>
+#include <tbb/parallel_for.h>
 
 namespace Slic3r {
 
@@ -91,13 +92,22 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
         we'll use this one to clip our test lines and be sure that their endpoints
         are inside the anchors and not on their contours leading to false negatives. */
     Polygons clip_area = offset(this->expolygons, 0.5f * float(this->spacing));
-    
+
+    //BBS: the anchor regions are queried for both endpoints of every test line of every
+    // candidate angle, bucket their segments once instead of rasterizing all the contours
+    // on each query
+    BatchedPointLocator anchor_regions_locator(this->_anchor_regions);
+
     /*  we'll now try several directions using a rudimentary visibility check:
         bridge in several directions and then sum the length of lines having both
         endpoints within anchors */
-        
-    bool have_coverage = false;
-    for (size_t i_angle = 0; i_angle < candidates.size(); ++ i_angle)
+
+    //BBS: the candidate directions are independent of each other, they only read the
+    // shared clip area and anchor locator and each fills its own score slot, so they
+    // are evaluated in parallel.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, candidates.size()),
+        [this, &candidates, &clip_area, &anchor_regions_locator](const tbb::blocked_range<size_t> &range) {
+    for (size_t i_angle = range.begin(); i_angle < range.end(); ++ i_angle)
     {
         const double angle = candidates[i_angle].angle;
 
@@ -125,7 +135,7 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
             size_t archored_line_num = 0;
             for (size_t i = 0; i < clipped_lines.size(); ++i) {
                 const Line &line = clipped_lines[i];
-                if (expolygons_contain(this->_anchor_regions, line.a) && expolygons_contain(this->_anchor_regions, line.b)) {
+                if (anchor_regions_locator.contains(line.a) && anchor_regions_locator.contains(line.b)) {
                     // This line could be anchored.
                     double len = line.length();
                     total_length += len;
@@ -140,7 +150,6 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
         if (total_length == 0.)
             continue;
 
-        have_coverage = true;
         // Sum length of bridged lines.
         candidates[i_angle].coverage = total_length;
         /*  The following produces more correct results in some cases and more broken in others.
@@ -149,9 +158,11 @@ bool BridgeDetector::detect_angle(double bridge_direction_override)
         // max length of bridged lines
         candidates[i_angle].max_length = max_length;
     }
+        });
 
     // if no direction produced coverage, then there's no bridge direction
-    if (! have_coverage)
+    if (std::none_of(candidates.begin(), candidates.end(),
+                     [](const BridgeDirection &c) { return c.coverage > 0.; }))
         return false;
     
     // sort directions by coverage - most coverage first
@@ -1510,13 +1510,24 @@ static void make_inner_brim(const Print                   &print,
 
     Polygons   loops;
     islands_ex      = offset_ex(islands_ex, -0.5f * float(flow.scaled_spacing()));// jtSquare seems not working when expandign the holes
-    for (size_t i = 0; !islands_ex.empty(); ++i) {
-        for (ExPolygon &poly_ex : islands_ex)
-            poly_ex.douglas_peucker(scaled_resolution);
-        polygons_append(loops, to_polygons(islands_ex));// jtSquare seems not working when expandign the holes
-        islands_ex = offset_ex(islands_ex, -1.3f * float(flow.scaled_spacing()));
-        islands_ex = offset_ex(islands_ex, .3f * float(flow.scaled_spacing()));
-    }
+    // BBS: the iterative shrinking is local to each island, see tryExPolygonOffset().
+    std::vector<Polygons> loops_per_island(islands_ex.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, islands_ex.size()),
+        [&islands_ex, &loops_per_island, &flow, &scaled_resolution](const tbb::blocked_range<size_t>& range) {
+            for (size_t island_idx = range.begin(); island_idx < range.end(); ++island_idx) {
+                ExPolygons island{std::move(islands_ex[island_idx])};
+                Polygons& island_loops = loops_per_island[island_idx];
+                for (size_t i = 0; !island.empty(); ++i) {
+                    for (ExPolygon &poly_ex : island)
+                        poly_ex.douglas_peucker(scaled_resolution);
+                    polygons_append(island_loops, to_polygons(island));// jtSquare seems not working when expandign the holes
+                    island = offset_ex(island, -1.3f * float(flow.scaled_spacing()));
+                    island = offset_ex(island, .3f * float(flow.scaled_spacing()));
+                }
+            }
+        });
+    for (Polygons& island_loops : loops_per_island)
+        polygons_append(loops, std::move(island_loops));
 
     loops = union_pt_chained_outside_in(loops);
     std::reverse(loops.begin(), loops.end());
@@ -1597,15 +1608,29 @@ Polygons tryExPolygonOffset(const ExPolygons islandAreaEx, const Print& print)
     for (ExPolygon& poly_ex : islands_ex)
         poly_ex.douglas_peucker(resolution);
     islands_ex = offset_ex(std::move(islands_ex), -0.5f * float(flow.scaled_spacing()), jtRound, resolution);
-    for (size_t i = 0; !islands_ex.empty(); ++i) {
-        for (ExPolygon& poly_ex : islands_ex)
-            poly_ex.douglas_peucker(resolution);
-        polygons_append(loops, to_polygons(islands_ex));
-        islands_ex = offset_ex(std::move(islands_ex), -1.3f*float(flow.scaled_spacing()), jtRound, resolution);
-        for (ExPolygon& poly_ex : islands_ex)
-            poly_ex.douglas_peucker(resolution);
-        islands_ex = offset_ex(std::move(islands_ex), 0.3f*float(flow.scaled_spacing()), jtRound, resolution);
-    }
+    // BBS: inward offsets can never make disjoint islands interact, so instead of
+    // shrinking the whole plate over and over, each island extracts its loops
+    // independently and the islands run in parallel. On plates with many objects
+    // this replaces the repeated global Clipper passes with small local ones.
+    std::vector<Polygons> loops_per_island(islands_ex.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, islands_ex.size()),
+        [&islands_ex, &loops_per_island, &flow, &resolution](const tbb::blocked_range<size_t>& range) {
+            for (size_t island_idx = range.begin(); island_idx < range.end(); ++island_idx) {
+                ExPolygons island{std::move(islands_ex[island_idx])};
+                Polygons& island_loops = loops_per_island[island_idx];
+                for (size_t i = 0; !island.empty(); ++i) {
+                    for (ExPolygon& poly_ex : island)
+                        poly_ex.douglas_peucker(resolution);
+                    polygons_append(island_loops, to_polygons(island));
+                    island = offset_ex(std::move(island), -1.3f*float(flow.scaled_spacing()), jtRound, resolution);
+                    for (ExPolygon& poly_ex : island)
+                        poly_ex.douglas_peucker(resolution);
+                    island = offset_ex(std::move(island), 0.3f*float(flow.scaled_spacing()), jtRound, resolution);
+                }
+            }
+        });
+    for (Polygons& island_loops : loops_per_island)
+        polygons_append(loops, std::move(island_loops));
     return loops;
 }
 //BBS: a function creates the ExtrusionEntityCollection from the brim area defined by ExPolygons
@@ -1,6 +1,8 @@
 #ifndef PERFORMCSGMESHBOOLEANS_HPP
 #define PERFORMCSGMESHBOOLEANS_HPP
 
+#include <memory>
+#include <mutex>
 #include <stack>
 #include <vector>
 
@@ -12,6 +14,121 @@
 
 namespace Slic3r { namespace csg {
 
+// Session-wide cache of per-part cgal evaluations. The csg part list is
+// rebuilt from the model for every evaluation, but between two evaluations
+// most parts are unchanged -- adjusting one negative volume only gives that
+// part a new transform while the (usually much bigger) object mesh stays
+// identical. An unchanged part can reuse the exact-kernel conversion through
+// a structural copy and skip its geometry validation entirely, both of which
+// are far cheaper than redoing them from the raw mesh.
+class CSGConversionCache {
+public:
+    struct Key {
+        const indexed_triangle_set *its = nullptr;
+        size_t n_vertices = 0, n_faces = 0;
+        Transform3f trafo = Transform3f::Identity();
+
+        bool operator==(const Key &o) const
+        {
+            return its == o.its && n_vertices == o.n_vertices &&
+                   n_faces == o.n_faces && trafo.matrix() == o.trafo.matrix();
+        }
+    };
+
+    template<class CSGPartT> static Key key_of(const CSGPartT &csgpart)
+    {
+        Key k;
+        if (const indexed_triangle_set *its = csg::get_mesh(csgpart)) {
+            k.its        = its;
+            k.n_vertices = its->vertices.size();
+            k.n_faces    = its->indices.size();
+            k.trafo      = get_transform(csgpart);
+        }
+
+        return k;
+    }
+
+    static CSGConversionCache& instance()
+    {
+        static CSGConversionCache cache;
+        return cache;
+    }
+
+    // Returns a private copy of the cached conversion, nullptr on cache miss.
+    MeshBoolean::cgal::CGALMeshPtr lookup(const Key &k)
+    {
+        std::shared_ptr<MeshBoolean::cgal::CGALMesh> m;
+        {
+            std::lock_guard<std::mutex> lk{m_mtx};
+            if (Entry *e = find(k)) m = e->mesh;
+        }
+
+        return m ? MeshBoolean::cgal::clone(*m) : nullptr;
+    }
+
+    void store(const Key &k, MeshBoolean::cgal::CGALMeshPtr m)
+    {
+        std::shared_ptr<MeshBoolean::cgal::CGALMesh> sp{
+            m.release(), MeshBoolean::cgal::CGALMeshDeleter{}};
+
+        std::lock_guard<std::mutex> lk{m_mtx};
+        Entry &e = find_or_insert(k);
+        e.mesh   = std::move(sp);
+    }
+
+    // The geometry checks (volume boundedness, self intersections) depend
+    // only on the part, so their verdict can be replayed without converting
+    // the mesh at all.
+    bool lookup_validity(const Key &k, bool &valid)
+    {
+        std::lock_guard<std::mutex> lk{m_mtx};
+        Entry *e = find(k);
+        if (!e || e->validity < 0) return false;
+
+        valid = e->validity > 0;
+        return true;
+    }
+
+    void store_validity(const Key &k, bool valid)
+    {
+        std::lock_guard<std::mutex> lk{m_mtx};
+        find_or_insert(k).validity = valid ? 1 : 0;
+    }
+
+private:
+    struct Entry {
+        Key key;
+        std::shared_ptr<MeshBoolean::cgal::CGALMesh> mesh;
+        int validity = -1; // -1 unknown, 0 invalid, 1 valid
+    };
+
+    // Enough for an object with a handful of modifier meshes without
+    // hoarding exact-kernel copies of stale geometry.
+    static const size_t MaxEntries = 16;
+
+    std::vector<Entry> m_entries;
+    std::mutex         m_mtx;
+
+    Entry * find(const Key &k)
+    {
+        for (Entry &e : m_entries)
+            if (e.key == k) return &e;
+
+        return nullptr;
+    }
+
+    Entry & find_or_insert(const Key &k)
+    {
+        if (Entry *e = find(k)) return *e;
+
+        if (m_entries.size() >= MaxEntries)
+            m_entries.erase(m_entries.begin());
+
+        m_entries.push_back({k, nullptr, -1});
+        return m_entries.back();
+    }
+};
+
 // This method can be overriden when a specific CSGPart type supports caching
 // of the voxel grid
 template<class CSGPartT>
@@ -20,6 +137,12 @@ MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartT &csgpart)
     const indexed_triangle_set *its = csg::get_mesh(csgpart);
     indexed_triangle_set dummy;
 
+    auto key = CSGConversionCache::key_of(csgpart);
+    if (its) {
+        if (auto cached = CSGConversionCache::instance().lookup(key))
+            return cached;
+    }
+
     if (!its)
         its = &dummy;
 
@@ -35,6 +158,9 @@ MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartT &csgpart)
         ret = nullptr;
     }
 
+    if (ret && key.its)
+        CSGConversionCache::instance().store(key, MeshBoolean::cgal::clone(*ret));
+
     return ret;
 }
 
@@ -266,7 +392,6 @@ It check_csgmesh_booleans(const Range<It> &csgrange, Visitor &&vfn)
         auto it = csgrange.begin();
         std::advance(it, i);
         auto &csgpart = *it;
-        auto m = get_cgalmesh(csgpart);
 
         // mesh can be nullptr if this is a stack push or pull
         if (!get_mesh(csgpart) && get_stack_operation(csgpart) != CSGStackOp::Continue) {
@@ -274,18 +399,35 @@ It check_csgmesh_booleans(const Range<It> &csgrange, Visitor &&vfn)
             return;
         }
 
+        // A part already validated in a previous evaluation can replay the
+        // verdict without converting or checking it again.
+        auto key = CSGConversionCache::key_of(csgpart);
+        if (bool valid = false;
+            key.its && CSGConversionCache::instance().lookup_validity(key, valid)) {
+            if (valid)
+                cgalmeshes[i] = MeshBoolean::cgal::triangle_mesh_to_cgal(indexed_triangle_set{});
+            return;
+        }
+
+        auto m = get_cgalmesh(csgpart);
+
         try {
             if (!m || MeshBoolean::cgal::empty(*m))
                 return;
 
-            if (!MeshBoolean::cgal::does_bound_a_volume(*m))
+            if (!MeshBoolean::cgal::does_bound_a_volume(*m)) {
+                if (key.its) CSGConversionCache::instance().store_validity(key, false);
                 return;
+            }
 
-            if (MeshBoolean::cgal::does_self_intersect(*m))
+            if (MeshBoolean::cgal::does_self_intersect(*m)) {
+                if (key.its) CSGConversionCache::instance().store_validity(key, false);
                 return;
+            }
         }
         catch (...) { return; }
 
+        if (key.its) CSGConversionCache::instance().store_validity(key, true);
         cgalmeshes[i] = std::move(m);
     };
     execution::for_each(ex_tbb, size_t(0), csgrange.size(), check_part);
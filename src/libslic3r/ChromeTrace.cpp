@@ -0,0 +1,133 @@
+#include "ChromeTrace.hpp"
+#include "Thread.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdio.hpp>
+
+namespace Slic3r {
+
+namespace ChromeTrace {
+
+namespace {
+
+struct TraceEvent
+{
+    std::string name;
+    uint64_t    start_us;
+    uint64_t    duration_us;
+};
+
+// Event buffer of a single thread. Owned jointly by the thread local pointer and
+// the registry, so events of threads that already terminated still get written.
+struct ThreadEvents
+{
+    size_t                  tid;
+    std::string             thread_name;
+    std::vector<TraceEvent> events;
+};
+
+std::atomic<bool>                           s_enabled { false };
+std::chrono::steady_clock::time_point       s_epoch;
+std::mutex                                  s_registry_mutex;
+std::vector<std::shared_ptr<ThreadEvents>>  s_registry;
+
+ThreadEvents& thread_events()
+{
+    static thread_local std::shared_ptr<ThreadEvents> buffer;
+    if (! buffer) {
+        buffer = std::make_shared<ThreadEvents>();
+        if (auto name = get_current_thread_name(); name.has_value())
+            buffer->thread_name = *name;
+        std::lock_guard<std::mutex> lock(s_registry_mutex);
+        buffer->tid = s_registry.size();
+        s_registry.emplace_back(buffer);
+    }
+    return *buffer;
+}
+
+uint64_t now_us()
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_epoch).count());
+}
+
+void write_escaped(FILE *file, const std::string &str)
+{
+    for (char c : str)
+        if (c == '"' || c == '\\')
+            fprintf(file, "\\%c", c);
+        else if ((unsigned char)c >= 0x20)
+            fputc(c, file);
+}
+
+} // namespace
+
+bool enabled()
+{
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+void begin()
+{
+    std::lock_guard<std::mutex> lock(s_registry_mutex);
+    for (const std::shared_ptr<ThreadEvents> &thread : s_registry)
+        thread->events.clear();
+    s_epoch = std::chrono::steady_clock::now();
+    s_enabled.store(true, std::memory_order_release);
+}
+
+bool end_and_write(const std::string &path)
+{
+    s_enabled.store(false, std::memory_order_release);
+
+    FILE *file = boost::nowide::fopen(path.c_str(), "w");
+    if (file == nullptr) {
+        BOOST_LOG_TRIVIAL(error) << "ChromeTrace: failed to open " << path << " for writing";
+        return false;
+    }
+
+    fprintf(file, "{\"traceEvents\":[");
+    bool first = true;
+    std::lock_guard<std::mutex> lock(s_registry_mutex);
+    for (const std::shared_ptr<ThreadEvents> &thread : s_registry) {
+        if (! thread->thread_name.empty()) {
+            fprintf(file, "%s\n{\"ph\":\"M\",\"pid\":0,\"tid\":%zu,\"name\":\"thread_name\",\"args\":{\"name\":\"", first ? "" : ",", thread->tid);
+            write_escaped(file, thread->thread_name);
+            fprintf(file, "\"}}");
+            first = false;
+        }
+        for (const TraceEvent &event : thread->events) {
+            fprintf(file, "%s\n{\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%llu,\"dur\":%llu,\"name\":\"",
+                    first ? "" : ",", thread->tid, (unsigned long long)event.start_us, (unsigned long long)event.duration_us);
+            write_escaped(file, event.name);
+            fprintf(file, "\"}");
+            first = false;
+        }
+    }
+    fprintf(file, "\n]}\n");
+    return fclose(file) == 0;
+}
+
+} // namespace ChromeTrace
+
+void ChromeTraceSpan::open(const char *name)
+{
+    m_name  = name;
+    m_start = ChromeTrace::now_us();
+}
+
+void ChromeTraceSpan::close()
+{
+    // Spans closing after tracing stopped are dropped, the writer may already be running.
+    if (ChromeTrace::enabled()) {
+        ChromeTrace::ThreadEvents &buffer = ChromeTrace::thread_events();
+        buffer.events.push_back({ std::move(m_name), m_start, ChromeTrace::now_us() - m_start });
+    }
+}
+
+} // namespace Slic3r
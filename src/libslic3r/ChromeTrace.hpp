@@ -0,0 +1,45 @@
+#ifndef slic3r_ChromeTrace_hpp_
+#define slic3r_ChromeTrace_hpp_
+
+#include <cstdint>
+#include <string>
+
+namespace Slic3r {
+
+// Lightweight runtime tracer emitting a chrome://tracing compatible JSON timeline.
+// Unlike the compile-time Shiny zones, which aggregate totals, this records per
+// thread spans with wall-clock timestamps, so a slow job can be opened as a
+// timeline and the bottleneck stage read off directly. While tracing is disabled
+// a span costs a single relaxed atomic load.
+namespace ChromeTrace {
+
+bool enabled();
+// Discards previously collected events and starts collecting.
+void begin();
+// Stops collecting and writes the timeline to path, chrome://tracing JSON format.
+bool end_and_write(const std::string &path);
+
+} // namespace ChromeTrace
+
+// RAII span covering the lifetime of the object, recorded on the current thread.
+// The name should be a stable literal naming the pipeline stage.
+class ChromeTraceSpan
+{
+public:
+    ChromeTraceSpan(const char *name) { if (ChromeTrace::enabled()) this->open(name); }
+    ChromeTraceSpan(const std::string &name) { if (ChromeTrace::enabled()) this->open(name.c_str()); }
+    ChromeTraceSpan(const ChromeTraceSpan &) = delete;
+    ChromeTraceSpan& operator=(const ChromeTraceSpan &) = delete;
+    ~ChromeTraceSpan() { if (! m_name.empty()) this->close(); }
+
+private:
+    void open(const char *name);
+    void close();
+
+    std::string m_name;
+    uint64_t    m_start { 0 };
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_ChromeTrace_hpp_
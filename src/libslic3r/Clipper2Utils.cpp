@@ -1,4 +1,5 @@
 #include "Clipper2Utils.hpp"
+#include "ClipperUtils.hpp"
 
 namespace Slic3r {
 
@@ -52,9 +53,45 @@ Polylines _clipper2_pl_open(Clipper2Lib::ClipType clipType, const Slic3r::Polyli
     return out;
 }
 
+Polylines _clipper2_pl_closed(Clipper2Lib::ClipType clipType, const Slic3r::Polygons& subject, const Slic3r::Polygons& clip)
+{
+    //BBS: emplace every polygon as an open path with its first point duplicated,
+    // the same transformation _clipper_pl_closed applies for the legacy clipper
+    Clipper2Lib::Paths64 paths;
+    paths.reserve(subject.size());
+    for (const Slic3r::Polygon& poly : subject) {
+        Clipper2Lib::Path64 path;
+        path.reserve(poly.size() + 1);
+        for (const Slic3r::Point& point : poly.points)
+            path.emplace_back(Clipper2Lib::Point64(point.x(), point.y()));
+        path.emplace_back(Clipper2Lib::Point64(poly.points.front().x(), poly.points.front().y()));
+        paths.emplace_back(std::move(path));
+    }
+
+    Clipper2Lib::Clipper64 c;
+    c.AddOpenSubject(paths);
+    c.AddClip(Slic3rPoints_to_Paths64(clip));
+
+    Clipper2Lib::Paths64 solution, solution_open;
+    c.Execute(clipType, Clipper2Lib::FillRule::NonZero, solution, solution_open);
+
+    Slic3r::Polylines out;
+    out.reserve(solution.size() + solution_open.size());
+    polylines_append(out, std::move(Paths64_to_polylines(solution)));
+    polylines_append(out, std::move(Paths64_to_polylines(solution_open)));
+    //BBS: merge the polylines split at the duplicated seam point back together
+    _clipper_pl_recombine(out);
+
+    return out;
+}
+
 Slic3r::Polylines intersection_pl_2(const Slic3r::Polylines& subject, const Slic3r::Polygons& clip)
     { return _clipper2_pl_open(Clipper2Lib::ClipType::Intersection, subject, clip); }
 Slic3r::Polylines  diff_pl_2(const Slic3r::Polylines& subject, const Slic3r::Polygons& clip)
     { return _clipper2_pl_open(Clipper2Lib::ClipType::Difference, subject, clip); }
+Slic3r::Polylines intersection_pl_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip)
+    { return _clipper2_pl_closed(Clipper2Lib::ClipType::Intersection, subject, clip); }
+Slic3r::Polylines  diff_pl_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip)
+    { return _clipper2_pl_closed(Clipper2Lib::ClipType::Difference, subject, clip); }
 
 }
\ No newline at end of file
@@ -10,6 +10,9 @@ namespace Slic3r {
 
 Slic3r::Polylines  intersection_pl_2(const Slic3r::Polylines& subject, const Slic3r::Polygons& clip);
 Slic3r::Polylines  diff_pl_2(const Slic3r::Polylines& subject, const Slic3r::Polygons& clip);
+//BBS: closed subjects, clipped into polylines like the _clipper_pl_closed based overloads in ClipperUtils
+Slic3r::Polylines  intersection_pl_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip);
+Slic3r::Polylines  diff_pl_2(const Slic3r::Polygons& subject, const Slic3r::Polygons& clip);
 
 }
 
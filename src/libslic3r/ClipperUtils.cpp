@@ -167,7 +167,8 @@ void clip_clipper_polygon_with_subject_bbox(const Polygon &src, const BoundingBo
     out.reserve(number_polygons(src));
     for (const ExPolygon &p : src) {
         Polygons temp = clip_clipper_polygons_with_subject_bbox(p, bbox, get_entire_polygons);
-        out.insert(out.end(), temp.begin(), temp.end());
+        //BBS: move the freshly clipped contours, don't copy their point vectors again
+        append(out, std::move(temp));
     }
 
     out.erase(std::remove_if(out.begin(), out.end(), [](const Polygon &polygon) {return polygon.empty(); }), out.end());
@@ -275,6 +276,7 @@ bool has_duplicate_points(const ClipperLib::PolyTree &polytree)
 template<typename PathsProvider, ClipperLib::EndType endType = ClipperLib::etClosedPolygon>
 static ClipperLib::Paths raw_offset(PathsProvider &&paths, float offset, ClipperLib::JoinType joinType, double miterLimit)
 {
+    CLIPPERUTILS_PROFILE_FUNC();
     ClipperLib::ClipperOffset co;
     ClipperLib::Paths out;
     out.reserve(paths.size());
@@ -316,6 +318,7 @@ TResult clipper_do(
     TClip &&                       clip,
     const ClipperLib::PolyFillType fillType)
 {
+    CLIPPERUTILS_PROFILE_FUNC();
     ClipperLib::Clipper clipper;
     clipper.AddPaths(std::forward<TSubj>(subject), ClipperLib::ptSubject, true);
     clipper.AddPaths(std::forward<TClip>(clip),    ClipperLib::ptClip,    true);
@@ -345,6 +348,7 @@ TResult clipper_union(
     // fillType pftNonZero and pftPositive "should" produce the same result for "normalized with implicit union" set of polygons
     const ClipperLib::PolyFillType fillType = ClipperLib::pftNonZero)
 {
+    CLIPPERUTILS_PROFILE_FUNC();
     ClipperLib::Clipper clipper;
     clipper.AddPaths(std::forward<TSubj>(subject), ClipperLib::ptSubject, true);
     TResult retval;
@@ -824,7 +828,8 @@ Polylines _clipper_pl_open(ClipperLib::ClipType clipType, PathsProvider1 &&subje
 // If the split_at_first_point() call above happens to split the polygon inside the clipping area
 // we would get two consecutive polylines instead of a single one, so we go through them in order
 // to recombine continuous polylines.
-static void _clipper_pl_recombine(Polylines &polylines)
+//BBS: also used by the Clipper2 based closed subject clipping in Clipper2Utils.cpp
+void _clipper_pl_recombine(Polylines &polylines)
 {
     for (size_t i = 0; i < polylines.size(); ++i) {
         for (size_t j = i+1; j < polylines.size(); ++j) {
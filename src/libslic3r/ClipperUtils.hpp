@@ -453,6 +453,8 @@ Slic3r::Polylines  diff_pl(const Slic3r::Polyline &subject, const Slic3r::ExPoly
 Slic3r::Polylines  diff_pl(const Slic3r::Polylines &subject, const Slic3r::ExPolygon &clip);
 Slic3r::Polylines  diff_pl(const Slic3r::Polylines &subject, const Slic3r::ExPolygons &clip);
 Slic3r::Polylines  diff_pl(const Slic3r::Polygons &subject, const Slic3r::Polygons &clip);
+// Merge polylines that touch at their endpoints back together, undoing the seam split of closed subjects.
+void               _clipper_pl_recombine(Slic3r::Polylines &polylines);
 
 // BBS
 inline Slic3r::ExPolygons diff_ex(const Slic3r::ExPolygon& subject, const Slic3r::ExPolygon& clip, ApplySafetyOffset do_safety_offset = ApplySafetyOffset::No)
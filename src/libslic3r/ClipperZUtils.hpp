@@ -141,6 +141,49 @@ private:
     std::vector<std::pair<coord_t, coord_t>> &m_intersections;
 };
 
+// Execute a single boolean operation on Z-tagged paths. The Z coordinate of each input
+// vertex carries the index of its source contour, vertices created at intersections of
+// differently tagged contours receive a negative 1-based index into "intersections"
+// storing both source tags (see ClipperZIntersectionVisitor). This way the output
+// contours can be correlated with their source contours after one Clipper execution
+// instead of running one boolean per source contour and matching the results.
+// Open subjects are clipped through a PolyTree, thus the output paths of open subjects
+// remain open polylines.
+inline ZPaths tagged_boolean(
+    ClipperLib_Z::ClipType                      op,
+    const ZPaths                               &subjects,
+    bool                                        subjects_closed,
+    const ZPaths                               &clips,
+    ClipperZIntersectionVisitor::Intersections &intersections)
+{
+    ClipperLib_Z::Clipper zclipper;
+    ClipperZIntersectionVisitor visitor(intersections);
+    zclipper.ZFillFunction(visitor.clipper_callback());
+    zclipper.AddPaths(subjects, ClipperLib_Z::ptSubject, subjects_closed);
+    zclipper.AddPaths(clips, ClipperLib_Z::ptClip, true);
+    ZPaths out;
+    if (subjects_closed) {
+        zclipper.Execute(op, out, ClipperLib_Z::pftNonZero, ClipperLib_Z::pftNonZero);
+    } else {
+        ClipperLib_Z::PolyTree polytree;
+        zclipper.Execute(op, polytree, ClipperLib_Z::pftNonZero, ClipperLib_Z::pftNonZero);
+        ClipperLib_Z::PolyTreeToPaths(std::move(polytree), out);
+    }
+    return out;
+}
+
+// Tag of the source contour of an output contour of tagged_boolean().
+// Returns the first non-negative Z found, thus the tag of a contour that was not
+// clipped away completely. Returns -1 if the contour consists of intersection
+// points only, in that case the caller has to consult "intersections".
+inline coord_t source_tag(const ZPath &path)
+{
+    for (const ZPoint &pt : path)
+        if (pt.z() >= 0)
+            return coord_t(pt.z());
+    return -1;
+}
+
 } // namespace ClipperZUtils
 } // namespace Slic3r
 
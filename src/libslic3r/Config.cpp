@@ -319,11 +319,13 @@ ConfigOption* ConfigOptionDef::create_default_option() const
 ConfigOptionDef* ConfigDef::add(const t_config_option_key &opt_key, ConfigOptionType type)
 {
 	static size_t serialization_key_ordinal_last = 0;
-    ConfigOptionDef *opt = &this->options[opt_key];
+    ConfigOptionDef *opt = &this->options.try_emplace(opt_key).first->second;
     opt->opt_key = opt_key;
     opt->type = type;
     opt->serialization_key_ordinal = ++ serialization_key_ordinal_last;
-    this->by_serialization_key_ordinal[opt->serialization_key_ordinal] = opt;
+    // Serialization key ordinals are assigned in a strictly increasing order, thus the new entry
+    // always lands at the end of the ordinal map and the insertion is amortized constant time.
+    this->by_serialization_key_ordinal.emplace_hint(this->by_serialization_key_ordinal.end(), opt->serialization_key_ordinal, opt);
     return opt;
 }
 
@@ -1327,6 +1329,16 @@ ConfigSubstitutions ConfigBase::load_from_gcode_file(const std::string &file, Fo
 
 //BBS: add json support
 void ConfigBase::save_to_json(const std::string &file, const std::string &name, const std::string &from, const std::string &version, const std::string is_custom) const
+{
+    boost::nowide::ofstream c;
+    c.open(file, std::ios::out | std::ios::trunc);
+    c << to_json_string(name, from, version, is_custom);
+    c.close();
+
+    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" <<__LINE__ << boost::format(", saved config to %1%\n")%file;
+}
+
+std::string ConfigBase::to_json_string(const std::string &name, const std::string &from, const std::string &version, const std::string is_custom) const
 {
     json j;
     //record the headers
@@ -1363,12 +1375,9 @@ void ConfigBase::save_to_json(const std::string &file, const std::string &name,
         }
     }
 
-    boost::nowide::ofstream c;
-    c.open(file, std::ios::out | std::ios::trunc);
+    std::ostringstream c;
     c << std::setw(4) << j << std::endl;
-    c.close();
-
-    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" <<__LINE__ << boost::format(", saved config to %1%\n")%file;
+    return c.str();
 }
 
 void ConfigBase::save(const std::string &file) const
@@ -2163,6 +2163,8 @@ public:
 
     //BBS: add json support
     void save_to_json(const std::string &file, const std::string &name, const std::string &from, const std::string &version, const std::string is_custom = "") const;
+    //BBS: serialize to the same json format without touching the disk, so callers can skip rewriting unchanged files
+    std::string to_json_string(const std::string &name, const std::string &from, const std::string &version, const std::string is_custom = "") const;
 
 	// Set all the nullable values to nils.
     void null_nullables();
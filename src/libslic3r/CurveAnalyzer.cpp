@@ -1,5 +1,6 @@
 #include "CurveAnalyzer.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cassert>
 
@@ -63,26 +64,30 @@ void CurveAnalyzer::calculate_curvatures(ExtrusionPaths& paths, ECurveAnalyseMod
         }
     }
     else {
+        // The sampling window is a fixed arc length around every point, so the
+        // windowed angle sums are taken from prefix sums over the cyclically
+        // doubled contour instead of re-walking the whole window per point,
+        // which made this step quadratic on densely sampled contours.
+        const double half_width = scale_(curvatures_sampling_width / 2);
+        std::vector<double> len_prefix(2 * point_num + 1, 0.);
+        std::vector<double> angle_prefix(2 * point_num + 1, 0.);
+        for (size_t m = 0; m < 2 * point_num; m++) {
+            size_t curr = m % point_num;
+            size_t next = (curr + 1 == point_num) ? 0 : curr + 1;
+            len_prefix[m + 1] = len_prefix[m] + (polygon.points[next] - polygon.points[curr]).cast<float>().norm();
+            angle_prefix[m + 1] = angle_prefix[m] + angles[curr];
+        }
         for (size_t i = 0; i < point_num; i++) {
-            // right segment
-            size_t j = i;
-            float right_length = 0;
-            while (right_length < scale_(curvatures_sampling_width / 2)) {
-                int next_j = (j + 1 >= point_num) ? 0 : j + 1;
-                sum_angles[i] += angles[j];
-                right_length += (polygon.points[next_j] - polygon.points[j]).cast<float>().norm();
-                j = next_j;
-            }
-            // left segment
-            size_t k = i;
-            float left_length = 0;
-            while (left_length < scale_(curvatures_sampling_width / 2)) {
-                size_t next_k = (k < 1) ? point_num - 1 : k - 1;
-                sum_angles[i] += angles[k];
-                left_length += (polygon.points[k] - polygon.points[next_k]).cast<float>().norm();
-                k = next_k;
-            }
-            sum_angles[i] = sum_angles[i] - angles[i];
+            // Right side: angles[i..r] with r the first index accumulating half_width of contour.
+            auto it_r = std::lower_bound(len_prefix.begin() + i + 1, len_prefix.end(), len_prefix[i] + half_width);
+            double sum = angle_prefix[it_r - len_prefix.begin()] - angle_prefix[i];
+            // Left side: angles[l..i] with l the last index still accumulating half_width,
+            // evaluated at the shifted index b = i + point_num of the doubled contour.
+            size_t b = i + point_num;
+            auto it_l = std::upper_bound(len_prefix.begin(), len_prefix.begin() + b, len_prefix[b] - half_width);
+            sum += angle_prefix[b + 1] - angle_prefix[it_l - len_prefix.begin()];
+            // The center angle was counted by both sides.
+            sum_angles[i] = float(sum - angles[i]);
             average_curvatures[i] = (1000.0 * (double)abs(sum_angles[i]) / (double)curvatures_sampling_width);
         }
     }
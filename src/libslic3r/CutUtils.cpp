@@ -324,17 +324,30 @@ const ModelObjectPtrs& Cut::perform_with_plane()
     const Transformation    cut_transformation = Transformation(m_cut_matrix);
     const Transform3d       inverse_cut_matrix = cut_transformation.get_rotation_matrix().inverse() * translation_transform(-1. * cut_transformation.get_offset());
 
-    for (ModelVolume* volume : mo->volumes) {
-        volume->reset_extra_facets();
+    try {
+        for (ModelVolume* volume : mo->volumes) {
+            // The volumes are cut one by one, check for cancellation in between.
+            m_throw_on_cancel();
+            volume->reset_extra_facets();
 
-        if (!volume->is_model_part()) {
-            if (volume->cut_info.is_processed)
-                process_modifier_cut(volume, instance_matrix, inverse_cut_matrix, m_attributes, upper, lower);
-            else
-                process_connector_cut(volume, instance_matrix, m_cut_matrix, m_attributes, upper, lower, dowels);
+            if (!volume->is_model_part()) {
+                if (volume->cut_info.is_processed)
+                    process_modifier_cut(volume, instance_matrix, inverse_cut_matrix, m_attributes, upper, lower);
+                else
+                    process_connector_cut(volume, instance_matrix, m_cut_matrix, m_attributes, upper, lower, dowels);
+            }
+            else if (!volume->mesh().empty())
+                process_solid_part_cut(volume, instance_matrix, m_cut_matrix, m_attributes, upper, lower);
         }
-        else if (!volume->mesh().empty())
-            process_solid_part_cut(volume, instance_matrix, m_cut_matrix, m_attributes, upper, lower);
+    }
+    catch (...) {
+        // Canceled. Hand the temporary clones over to m_model, so they are deleted in m_model.clear_objects().
+        for (ModelObject* object : { upper, lower })
+            if (object)
+                m_model.objects.push_back(object);
+        for (ModelObject* dowel : dowels)
+            m_model.objects.push_back(dowel);
+        throw;
     }
 
     // Post-process cut parts
@@ -487,7 +500,19 @@ const ModelObjectPtrs& Cut::perform_by_contour(std::vector<Part> parts, int dowe
 
         // Perform cut just to get connectors
         Cut cut(cut_mo, m_instance, m_cut_matrix, m_attributes);
-        const ModelObjectPtrs& cut_connectors_obj = cut.perform_with_plane();
+        cut.set_throw_on_cancel(m_throw_on_cancel);
+        const ModelObjectPtrs* cut_connectors_obj_ptr = nullptr;
+        try {
+            cut_connectors_obj_ptr = &cut.perform_with_plane();
+        }
+        catch (...) {
+            // Canceled. Hand the clones over to m_model, so they are deleted in m_model.clear_objects().
+            for (ModelObject* object : { upper, lower })
+                if (object)
+                    m_model.objects.push_back(object);
+            throw;
+        }
+        const ModelObjectPtrs& cut_connectors_obj = *cut_connectors_obj_ptr;
         assert(dowels_count > 0 ? cut_connectors_obj.size() >= 3 : cut_connectors_obj.size() == 2);
 
         // Connectors from upper object
@@ -550,6 +575,7 @@ const ModelObjectPtrs& Cut::perform_with_groove(const Groove& groove, const Tran
     auto cut = [this, add_volumes_from_cut]
                 (ModelObject* object, const Transform3d& cut_matrix, const ModelObjectCutAttribute add_volumes_attribute, Model& tmp_model_for_cut) {
         Cut cut(object, m_instance, cut_matrix);
+        cut.set_throw_on_cancel(m_throw_on_cancel);
 
         tmp_model_for_cut = Model();
         tmp_model_for_cut.add_object(*cut.perform_with_plane().front());
@@ -560,6 +586,8 @@ const ModelObjectPtrs& Cut::perform_with_groove(const Groove& groove, const Tran
         reset_instance_transformation(object, m_instance);
     };
 
+    try {
+
     // cut by upper plane
 
     const Transform3d cut_matrix_upper = translation_transform(rotation_m * (groove_half_depth * Vec3d::UnitZ())) * m_cut_matrix;
@@ -615,6 +643,14 @@ const ModelObjectPtrs& Cut::perform_with_groove(const Groove& groove, const Tran
     // this part can be added to the upper object now
     add_volumes_from_cut(upper, ModelObjectCutAttribute::KeepLower, tmp_model_for_cut);
 
+    }
+    catch (...) {
+        // Canceled. Hand the clones over to m_model, so they are deleted in m_model.clear_objects().
+        m_model.objects.push_back(upper);
+        m_model.objects.push_back(lower);
+        throw;
+    }
+
     ModelObjectPtrs cut_object_ptrs;
 
     if (keep_as_parts) {
@@ -9,6 +9,7 @@
 #include "Point.hpp"
 #include "Model.hpp"
 
+#include <functional>
 #include <vector>
 
 namespace Slic3r {
@@ -26,6 +27,7 @@ class Cut {
     int                         m_instance;
     const Transform3d           m_cut_matrix;
     ModelObjectCutAttributes    m_attributes;
+    std::function<void()>       m_throw_on_cancel{ []() {} };
 
     void post_process(ModelObject* object, ModelObjectPtrs& objects, bool keep, bool place_on_cut, bool flip);
     void post_process(ModelObject* upper_object, ModelObject* lower_object, ModelObjectPtrs& objects);
@@ -59,6 +61,11 @@ public:
         bool is_modifier;
     };
 
+    // The callback is invoked between the per-volume plane cuts and may throw to cancel the operation.
+    // The Cut works on its own copy of the model object, therefore a canceled cut leaves the original
+    // Model untouched; the temporary clones are released by this Cut.
+    void set_throw_on_cancel(std::function<void()> throw_on_cancel) { m_throw_on_cancel = std::move(throw_on_cancel); }
+
     const ModelObjectPtrs& perform_with_plane();
     const ModelObjectPtrs& perform_by_contour(std::vector<Part> parts, int dowels_count);
     const ModelObjectPtrs& perform_with_groove(const Groove& groove, const Transform3d& rotation_m, bool keep_as_parts = false);
@@ -292,7 +292,7 @@ void EdgeGrid::Grid::create_from_m_contours(coord_t resolution)
 	}
 
 	// 4) Prefix sum the numbers of hits per cells to get an index into m_cell_data.
-	size_t cnt = m_cells.front().end;
+	uint32_t cnt = m_cells.front().end;
 	for (size_t i = 1; i < m_cells.size(); ++ i) {
 		m_cells[i].begin = cnt;
 		cnt += m_cells[i].end;
@@ -300,23 +300,23 @@ void EdgeGrid::Grid::create_from_m_contours(coord_t resolution)
 	}
 
 	// 5) Allocate the cell data.
-	m_cell_data.assign(cnt, std::pair<size_t, size_t>(size_t(-1), size_t(-1)));
+	m_cell_data.assign(cnt, std::pair<uint32_t, uint32_t>(uint32_t(-1), uint32_t(-1)));
 
 	// 6) Finally fill in m_cell_data by rasterizing the lines once again.
 	for (size_t i = 0; i < m_cells.size(); ++i)
 		m_cells[i].end = m_cells[i].begin;
 
 	struct Visitor {
-		Visitor(std::vector<std::pair<size_t, size_t>> &cell_data, std::vector<Cell> &cells, size_t cols) :
+		Visitor(std::vector<std::pair<uint32_t, uint32_t>> &cell_data, std::vector<Cell> &cells, size_t cols) :
 			cell_data(cell_data), cells(cells), cols(cols), i(0), j(0) {}
 
 		inline bool operator()(coord_t iy, coord_t ix) {
-			cell_data[cells[iy*cols + ix].end++] = std::pair<size_t, size_t>(i, j);
+			cell_data[cells[iy*cols + ix].end++] = std::pair<uint32_t, uint32_t>(uint32_t(i), uint32_t(j));
 			// Continue traversing the grid along the edge.
 			return true;
 		}
 
-		std::vector<std::pair<size_t, size_t>> &cell_data;
+		std::vector<std::pair<uint32_t, uint32_t>> &cell_data;
 		std::vector<Cell> 					   &cells;
 		size_t									cols;
 		size_t 									i;
@@ -7,6 +7,7 @@
 #include "Point.hpp"
 #include "BoundingBox.hpp"
 #include "ExPolygon.hpp"
+#include "Line.hpp"
 
 namespace Slic3r {
 namespace EdgeGrid {
@@ -314,6 +315,73 @@ public:
 		}
 	}
 
+	// Visit all cells intersecting a thick line, that is a line segment (p1, p2) inflated by radius (a stadium shape).
+	// In contrast to tracing a pair of lines offsetted to both sides of the source segment, every cell is visited
+	// exactly once and the coverage does not depend on the ratio of radius to the grid resolution.
+	template<typename VISITOR> void visit_cells_intersecting_thick_line(const Slic3r::Point &p1, const Slic3r::Point &p2, const coord_t radius, VISITOR &visitor) const
+	{
+		// Range of cells overlapping the bounding box of the thick line.
+		BoundingBox bbox(p1, p1);
+		bbox.merge(p2);
+		bbox.offset(radius);
+		bbox.min -= m_bbox.min;
+		bbox.max -= m_bbox.min + Point(1, 1);
+		bbox.min /= m_resolution;
+		bbox.max /= m_resolution;
+		// Trim with the cells.
+		bbox.min.x() = std::max<coord_t>(bbox.min.x(), 0);
+		bbox.min.y() = std::max<coord_t>(bbox.min.y(), 0);
+		bbox.max.x() = std::min<coord_t>(bbox.max.x(), (coord_t)m_cols - 1);
+		bbox.max.y() = std::min<coord_t>(bbox.max.y(), (coord_t)m_rows - 1);
+		const Vec2d  a  = (p1 - m_bbox.min).cast<double>();
+		const Vec2d  b  = (p2 - m_bbox.min).cast<double>();
+		const Vec2d  v  = b - a;
+		const double r2 = double(radius) * double(radius);
+		for (coord_t iy = bbox.min.y(); iy <= bbox.max.y(); ++ iy)
+			for (coord_t ix = bbox.min.x(); ix <= bbox.max.x(); ++ ix) {
+				// Cell rectangle.
+				const Vec2d rmin(double(ix) * m_resolution, double(iy) * m_resolution);
+				const Vec2d rmax(rmin.x() + m_resolution, rmin.y() + m_resolution);
+				// 1) Clip the segment with the cell rectangle (Liang-Barsky). A non-empty clip means the segment
+				// enters the cell, thus the cell certainly intersects the thick line.
+				double tmin = 0.;
+				double tmax = 1.;
+				bool   intersects = true;
+				for (int axis = 0; axis < 2 && intersects; ++ axis) {
+					if (v(axis) == 0.) {
+						if (a(axis) < rmin(axis) || a(axis) > rmax(axis))
+							intersects = false;
+					} else {
+						double t1 = (rmin(axis) - a(axis)) / v(axis);
+						double t2 = (rmax(axis) - a(axis)) / v(axis);
+						if (t1 > t2)
+							std::swap(t1, t2);
+						tmin = std::max(tmin, t1);
+						tmax = std::min(tmax, t2);
+						if (tmin > tmax)
+							intersects = false;
+					}
+				}
+				if (! intersects) {
+					// 2) The segment does not enter the cell. The closest pair of features is then either a cell
+					// corner against the segment, or a segment end point against the cell rectangle.
+					auto dist2_point_rect = [&rmin, &rmax](const Vec2d &pt) {
+						return (pt - Vec2d(std::clamp(pt.x(), rmin.x(), rmax.x()), std::clamp(pt.y(), rmin.y(), rmax.y()))).squaredNorm();
+					};
+					const Linef line { a, b };
+					double d2 = std::min(dist2_point_rect(a), dist2_point_rect(b));
+					d2 = std::min(d2, line_alg::distance_to_squared(line, Vec2d(rmin.x(), rmin.y())));
+					d2 = std::min(d2, line_alg::distance_to_squared(line, Vec2d(rmax.x(), rmin.y())));
+					d2 = std::min(d2, line_alg::distance_to_squared(line, Vec2d(rmin.x(), rmax.y())));
+					d2 = std::min(d2, line_alg::distance_to_squared(line, Vec2d(rmax.x(), rmax.y())));
+					if (d2 > r2)
+						continue;
+				}
+				if (! visitor(iy, ix))
+					return;
+			}
+	}
+
 	template<typename VISITOR> void visit_cells_intersecting_box(BoundingBox bbox, VISITOR &visitor) const
 	{
 		// End points of the line segment.
@@ -333,7 +401,7 @@ public:
 					return;
 	}
 
-    std::pair<std::vector<std::pair<size_t, size_t>>::const_iterator, std::vector<std::pair<size_t, size_t>>::const_iterator> cell_data_range(coord_t row, coord_t col) const
+    std::pair<std::vector<std::pair<uint32_t, uint32_t>>::const_iterator, std::vector<std::pair<uint32_t, uint32_t>>::const_iterator> cell_data_range(coord_t row, coord_t col) const
 	{
         assert(row >= 0 && size_t(row) < m_rows);
         assert(col >= 0 && size_t(col) < m_cols);
@@ -358,8 +426,10 @@ public:
 protected:
 	struct Cell {
 		Cell() : begin(0), end(0) {}
-		size_t begin;
-		size_t end;
+		//BBS: 32 bits are enough to index m_cell_data. Half sized cells let the dense
+		// grid cover large build plates at a fine resolution without wasting memory.
+		uint32_t begin;
+		uint32_t end;
 	};
 
 	void create_from_m_contours(coord_t resolution);
@@ -392,7 +462,7 @@ protected:
 	std::vector<Contour>						m_contours;
 
 	// Referencing a contour and a line segment of m_contours.
-	std::vector<std::pair<size_t, size_t> >		m_cell_data;
+	std::vector<std::pair<uint32_t, uint32_t> >	m_cell_data;
 
 	// Full grid of cells.
 	std::vector<Cell> 							m_cells;
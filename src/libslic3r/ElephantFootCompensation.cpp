@@ -13,6 +13,8 @@
 #include <cmath>
 #include <cassert>
 
+#include <tbb/parallel_for.h>
+
 // #define CONTOUR_DISTANCE_DEBUG_SVG
 
 namespace Slic3r {
@@ -627,19 +629,21 @@ ExPolygon  elephant_foot_compensation(const ExPolygon  &input, const Flow &exter
 
 ExPolygons elephant_foot_compensation(const ExPolygons &input, const Flow &external_perimeter_flow, const double compensation)
 {
-	ExPolygons out;
-	out.reserve(input.size());
-	for (const ExPolygon &expoly : input)
-		out.emplace_back(elephant_foot_compensation(expoly, external_perimeter_flow, compensation));
-	return out;
+    // The contour shall be wide enough to apply the external perimeter plus compensation on both sides.
+    double min_contour_width = double(external_perimeter_flow.width() + external_perimeter_flow.spacing());
+    return elephant_foot_compensation(input, min_contour_width, compensation);
 }
 
 ExPolygons elephant_foot_compensation(const ExPolygons &input, double min_contour_width, const double compensation)
 {
-	ExPolygons out;
-	out.reserve(input.size());
-	for (const ExPolygon &expoly : input)
-		out.emplace_back(elephant_foot_compensation(expoly, min_contour_width, compensation));
+	// Each island builds its own edge grid and measures only its own contours,
+	// so on plates with many first layer islands they compensate in parallel.
+	ExPolygons out(input.size());
+	tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size()),
+		[&input, &out, min_contour_width, compensation](const tbb::blocked_range<size_t> &range) {
+			for (size_t idx = range.begin(); idx < range.end(); ++ idx)
+				out[idx] = elephant_foot_compensation(input[idx], min_contour_width, compensation);
+		});
 	return out;
 }
 
@@ -520,4 +520,128 @@ void keep_largest_contour_only(ExPolygons &polygons)
 	}
 }
 
+void BatchedPointLocator::build(const ExPolygons &expolygons)
+{
+    m_rows.clear();
+    m_poly_expolygon.clear();
+    m_poly_is_hole.clear();
+
+    BoundingBox bbox = get_extents(expolygons);
+    size_t num_edges = 0;
+    for (const ExPolygon &expoly : expolygons) {
+        num_edges += expoly.contour.points.size();
+        for (const Polygon &hole : expoly.holes)
+            num_edges += hole.points.size();
+    }
+    if (num_edges == 0 || ! bbox.defined)
+        return;
+    m_bbox_min = bbox.min;
+    m_bbox_max = bbox.max;
+
+    // Aim at a handful of segments per bucket. The number of buckets is capped so that
+    // near vertical segments, which land in every bucket their y span covers, cannot
+    // blow up the memory on degenerate inputs.
+    size_t num_rows = std::clamp(num_edges / 4, size_t(1), size_t(4096));
+    m_row_height    = std::max<coord_t>(1, (m_bbox_max.y() - m_bbox_min.y()) / coord_t(num_rows) + 1);
+    m_rows.assign(size_t((m_bbox_max.y() - m_bbox_min.y()) / m_row_height) + 1, {});
+
+    auto add_polygon = [this](const Points &points, uint32_t expolygon_idx, bool is_hole) {
+        if (points.size() < 3)
+            // ClipperLib::PointInPolygon() reports such a polygon as containing nothing.
+            return;
+        uint32_t poly_id = uint32_t(m_poly_expolygon.size());
+        m_poly_expolygon.emplace_back(expolygon_idx);
+        m_poly_is_hole.push_back(is_hole);
+        for (size_t i = 0; i < points.size(); ++ i) {
+            const Point &a = points[i];
+            const Point &b = points[i + 1 == points.size() ? 0 : i + 1];
+            size_t row_min = size_t((std::min(a.y(), b.y()) - m_bbox_min.y()) / m_row_height);
+            size_t row_max = size_t((std::max(a.y(), b.y()) - m_bbox_min.y()) / m_row_height);
+            for (size_t row = row_min; row <= row_max; ++ row)
+                m_rows[row].push_back({ a, b, poly_id });
+        }
+    };
+    for (size_t i = 0; i < expolygons.size(); ++ i) {
+        add_polygon(expolygons[i].contour.points, uint32_t(i), false);
+        for (const Polygon &hole : expolygons[i].holes)
+            add_polygon(hole.points, uint32_t(i), true);
+    }
+}
+
+int BatchedPointLocator::locate(const Point &pt, bool border_result) const
+{
+    if (m_rows.empty() ||
+        pt.x() < m_bbox_min.x() || pt.x() > m_bbox_max.x() ||
+        pt.y() < m_bbox_min.y() || pt.y() > m_bbox_max.y())
+        return -1;
+
+    // Replay the per edge tests of ClipperLib::PointInPolygon() on the segments of this
+    // bucket, accumulating the crossing parity and boundary hits of each touched contour
+    // and hole separately. Only edges whose y span covers pt.y() may cross the horizontal
+    // ray or carry pt on their boundary and those all live in pt's bucket.
+    struct PolyState {
+        uint32_t poly_id;
+        uint32_t crossings;
+        bool     on_boundary;
+    };
+    std::vector<PolyState> states;
+    auto state_of = [&states](uint32_t poly_id) -> PolyState& {
+        for (PolyState &s : states)
+            if (s.poly_id == poly_id)
+                return s;
+        states.push_back({ poly_id, 0, false });
+        return states.back();
+    };
+    for (const Segment &seg : m_rows[size_t((pt.y() - m_bbox_min.y()) / m_row_height)]) {
+        const Point &ip     = seg.a;
+        const Point &ipNext = seg.b;
+        if (ipNext.y() == pt.y() && ((ipNext.x() == pt.x()) || (ip.y() == pt.y() && ((ipNext.x() > pt.x()) == (ip.x() < pt.x()))))) {
+            state_of(seg.poly_id).on_boundary = true;
+            continue;
+        }
+        if ((ip.y() < pt.y()) != (ipNext.y() < pt.y())) {
+            if (ip.x() >= pt.x()) {
+                if (ipNext.x() > pt.x())
+                    ++ state_of(seg.poly_id).crossings;
+                else {
+                    double d = (double)(ip.x() - pt.x()) * (ipNext.y() - pt.y()) - (double)(ipNext.x() - pt.x()) * (ip.y() - pt.y());
+                    if (d == 0.)
+                        state_of(seg.poly_id).on_boundary = true;
+                    else if ((d > 0) == (ipNext.y() > ip.y()))
+                        ++ state_of(seg.poly_id).crossings;
+                }
+            } else if (ipNext.x() > pt.x()) {
+                double d = (double)(ip.x() - pt.x()) * (ipNext.y() - pt.y()) - (double)(ipNext.x() - pt.x()) * (ip.y() - pt.y());
+                if (d == 0.)
+                    state_of(seg.poly_id).on_boundary = true;
+                else if ((d > 0) == (ipNext.y() > ip.y()))
+                    ++ state_of(seg.poly_id).crossings;
+            }
+        }
+    }
+
+    // Untouched contours and holes have even parity and no boundary hit, thus only the
+    // touched ones need to be evaluated.
+    int found = -1;
+    for (const PolyState &contour : states) {
+        if (m_poly_is_hole[contour.poly_id])
+            continue;
+        int expoly_idx = int(m_poly_expolygon[contour.poly_id]);
+        if (found != -1 && expoly_idx >= found)
+            continue;
+        if (! (contour.on_boundary ? border_result : (contour.crossings & 1) != 0))
+            continue;
+        bool in_hole = false;
+        for (const PolyState &hole : states)
+            if (m_poly_is_hole[hole.poly_id] && int(m_poly_expolygon[hole.poly_id]) == expoly_idx &&
+                (hole.on_boundary ? ! border_result : (hole.crossings & 1) != 0)) {
+                in_hole = true;
+                break;
+            }
+        if (! in_hole)
+            found = expoly_idx;
+    }
+    return found;
+}
+
 } // namespace Slic3r
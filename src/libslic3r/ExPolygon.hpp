@@ -80,6 +80,9 @@ public:
     size_t   		num_contours() const { return this->holes.size() + 1; }
     Polygon& 		contour_or_hole(size_t idx) 		{ return (idx == 0) ? this->contour : this->holes[idx - 1]; }
     const Polygon& 	contour_or_hole(size_t idx) const 	{ return (idx == 0) ? this->contour : this->holes[idx - 1]; }
+
+    // Serialization through the Cereal library, used by the slicing checkpoints.
+    template<class Archive> void serialize(Archive &archive) { archive(this->contour, this->holes); }
 };
 
 inline bool operator==(const ExPolygon &lhs, const ExPolygon &rhs) { return lhs.contour == rhs.contour && lhs.holes == rhs.holes; }
@@ -473,6 +476,42 @@ inline double      area(const ExPolygons &polys) { double s = 0.; for (auto &p :
 // Removes all expolygons smaller than min_area and also removes all holes smaller than min_area
 bool        remove_small_and_small_holes(ExPolygons &expolygons, double min_area);
 
+//BBS: Answers many point queries against the same set of ExPolygons. The contour and
+// hole segments are bucketed by the y range they span once, so a single query only
+// visits the few segments sharing the query point's y bucket instead of rasterizing
+// every contour point like expolygons_contain() does. The results match the
+// ClipperLib::PointInPolygon() based semantics of ExPolygon::contains() exactly,
+// including points lying on a boundary.
+class BatchedPointLocator
+{
+public:
+    BatchedPointLocator() = default;
+    explicit BatchedPointLocator(const ExPolygons &expolygons) { this->build(expolygons); }
+    void build(const ExPolygons &expolygons);
+
+    // Same result as expolygons_contain(expolygons, pt, border_result).
+    bool contains(const Point &pt, bool border_result = true) const { return this->locate(pt, border_result) != -1; }
+    // Index of the lowest indexed source ExPolygon containing pt, -1 if none contains it.
+    int  locate(const Point &pt, bool border_result = true) const;
+
+private:
+    struct Segment {
+        Point    a;
+        Point    b;
+        // Index into m_poly_expolygon / m_poly_is_hole of the contour or hole this segment belongs to.
+        uint32_t poly_id;
+    };
+    // Segments bucketed by the y range they span.
+    std::vector<std::vector<Segment>> m_rows;
+    // Source ExPolygon index of each contour / hole.
+    std::vector<uint32_t>             m_poly_expolygon;
+    std::vector<bool>                 m_poly_is_hole;
+    // Bounding box of the source ExPolygons (BoundingBox is incomplete here).
+    Point                             m_bbox_min;
+    Point                             m_bbox_max;
+    coord_t                           m_row_height { 1 };
+};
+
 } // namespace Slic3r
 
 // start Boost
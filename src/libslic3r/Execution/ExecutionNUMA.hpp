@@ -0,0 +1,191 @@
+#ifndef EXECUTIONNUMA_HPP
+#define EXECUTIONNUMA_HPP
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <tbb/info.h>
+#include <tbb/spin_mutex.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+#include "Execution.hpp"
+
+namespace Slic3r {
+
+struct ExecutionNUMA {};
+template<> struct IsExecutionPolicy_<ExecutionNUMA> : public std::true_type {};
+
+// Execution policy distributing the top level work items over one TBB task
+// arena per NUMA node. Nested parallel loops started by a work item are
+// confined to the arena that item was assigned to, thus the memory the item
+// allocates is first touched and later re-read by threads of the same socket,
+// which avoids the cross socket traffic of the flat ex_tbb scheduling on
+// multi socket machines. Requires a random access range. When the NUMA
+// topology cannot be resolved (single socket machine or TBB running without
+// the tbbbind / hwloc runtime), TBB reports a single unconstrained arena and
+// the policy degrades to the behavior of ex_tbb.
+static constexpr ExecutionNUMA ex_numa = {};
+
+namespace detail {
+
+class NumaArenas
+{
+public:
+    static NumaArenas& instance()
+    {
+        static NumaArenas arenas;
+        return arenas;
+    }
+
+    size_t           count() const { return m_arenas.size(); }
+    tbb::task_arena& arena(size_t idx) { return *m_arenas[idx]; }
+
+private:
+    NumaArenas()
+    {
+        for (tbb::numa_node_id node_id : tbb::info::numa_nodes())
+            m_arenas.emplace_back(std::make_unique<tbb::task_arena>(tbb::task_arena::constraints{node_id}));
+    }
+
+    // tbb::task_arena is neither copyable nor movable, thus the indirection.
+    std::vector<std::unique_ptr<tbb::task_arena>> m_arenas;
+};
+
+// Split the index range <0, total) into one contiguous chunk per NUMA node,
+// submit chunk_fn(node, chunk_begin, chunk_end) into the arena of each node
+// and block until all the chunks finish. A tbb::task_group must not be
+// destroyed while its tasks are running, therefore every group is drained
+// even on error and the first exception is rethrown afterwards.
+template<class ChunkFn>
+void spread_over_numa_nodes(size_t total, ChunkFn &&chunk_fn)
+{
+    NumaArenas &arenas    = NumaArenas::instance();
+    size_t      num_nodes = std::min(arenas.count(), total);
+    if (num_nodes <= 1) {
+        if (total > 0)
+            chunk_fn(size_t(0), size_t(0), total);
+        return;
+    }
+
+    std::vector<std::unique_ptr<tbb::task_group>> groups;
+    groups.reserve(num_nodes);
+    std::exception_ptr first_error;
+    tbb::spin_mutex    error_mutex;
+    size_t chunk_size = total / num_nodes;
+    size_t remainder  = total % num_nodes;
+    size_t chunk_begin = 0;
+    for (size_t node = 0; node < num_nodes; ++ node) {
+        size_t chunk_end = chunk_begin + chunk_size + (node < remainder ? 1 : 0);
+        groups.emplace_back(std::make_unique<tbb::task_group>());
+        tbb::task_group &group = *groups.back();
+        arenas.arena(node).execute([&group, &chunk_fn, &first_error, &error_mutex, node, chunk_begin, chunk_end]() {
+            group.run([&chunk_fn, &first_error, &error_mutex, node, chunk_begin, chunk_end]() {
+                try {
+                    chunk_fn(node, chunk_begin, chunk_end);
+                } catch (...) {
+                    tbb::spin_mutex::scoped_lock lock(error_mutex);
+                    if (! first_error)
+                        first_error = std::current_exception();
+                }
+            });
+        });
+        chunk_begin = chunk_end;
+    }
+    for (size_t node = 0; node < num_nodes; ++ node)
+        arenas.arena(node).execute([&groups, node]() { groups[node]->wait(); });
+    if (first_error)
+        std::rethrow_exception(first_error);
+}
+
+} // namespace detail
+
+template<> struct execution::Traits<ExecutionNUMA> {
+private:
+
+    template<class Fn, class It>
+    static IteratorOnly<It, void> loop_(const tbb::blocked_range<It> &range, Fn &&fn)
+    {
+        for (auto &el : range) fn(el);
+    }
+
+    template<class Fn, class I>
+    static IntegerOnly<I, void> loop_(const tbb::blocked_range<I> &range, Fn &&fn)
+    {
+        for (I i = range.begin(); i < range.end(); ++i) fn(i);
+    }
+
+    template<class It>
+    static IteratorOnly<It, It> advanced_(It it, size_t n)
+    {
+        return it + typename std::iterator_traits<It>::difference_type(n);
+    }
+
+    template<class I>
+    static IntegerOnly<I, I> advanced_(I from, size_t n) { return I(from + n); }
+
+public:
+    using SpinningMutex = tbb::spin_mutex;
+    using BlockingMutex = std::mutex;
+
+    template<class It, class Fn>
+    static void for_each(const ExecutionNUMA &,
+                         It from, It to, Fn &&fn, size_t granularity)
+    {
+        detail::spread_over_numa_nodes(size_t(to - from),
+            [from, &fn, granularity](size_t, size_t chunk_begin, size_t chunk_end) {
+                tbb::parallel_for(tbb::blocked_range{advanced_(from, chunk_begin), advanced_(from, chunk_end), granularity},
+                                  [&fn](const auto &range) {
+                    loop_(range, std::forward<Fn>(fn));
+                });
+            });
+    }
+
+    template<class I, class MergeFn, class T, class AccessFn>
+    static T reduce(const ExecutionNUMA &,
+                    I          from,
+                    I          to,
+                    const T   &init,
+                    MergeFn  &&mergefn,
+                    AccessFn &&access,
+                    size_t     granularity = 1
+                    )
+    {
+        // init is an identity element of mergefn (ex_tbb relies on that as
+        // well), thus the unused per node slots merge as no-ops.
+        std::vector<T> partials(detail::NumaArenas::instance().count(), init);
+        detail::spread_over_numa_nodes(size_t(to - from),
+            [from, &partials, &init, &mergefn, &access, granularity](size_t node, size_t chunk_begin, size_t chunk_end) {
+                partials[node] = tbb::parallel_reduce(
+                    tbb::blocked_range{advanced_(from, chunk_begin), advanced_(from, chunk_end), granularity}, init,
+                    [&](const auto &range, T subinit) {
+                        T acc = subinit;
+                        loop_(range, [&](auto &i) { acc = mergefn(acc, access(i)); });
+                        return acc;
+                    },
+                    mergefn);
+            });
+        T acc = init;
+        for (T &partial : partials)
+            acc = mergefn(acc, partial);
+        return acc;
+    }
+
+    static size_t max_concurrency(const ExecutionNUMA &)
+    {
+        detail::NumaArenas &arenas = detail::NumaArenas::instance();
+        size_t n = 0;
+        for (size_t node = 0; node < arenas.count(); ++ node)
+            n += size_t(arenas.arena(node).max_concurrency());
+        return n;
+    }
+};
+
+}
+
+#endif // EXECUTIONNUMA_HPP
@@ -149,13 +149,19 @@ void Fill3DHoneycomb::_fill_surface_single(
     // growing while the other $distance half-module is shrinking)
     bb.merge(align_to_grid(bb.min, Point(2*distance, 2*distance)));
     
+    // The grid is periodic along Z (the sawtooth wave of makeNormalisedGrid() reduces the
+    // normalised Z by an exact fmod), so the unclipped pattern is looked up in the tile cache
+    // keyed by the phase and only generated on a miss.
+    size_t   curve_type = ((this->layer_id/thickness_layers) % 2) + 1;
+    size_t   x_count    = ceil(bb.size()(0) / distance) + 1;
+    size_t   y_count    = ceil(bb.size()(1) / distance) + 1;
+    coordf_t z_phase    = fmod(coordf_t(scale_(this->z)) / coordf_t(distance), std::sqrt(coordf_t(2.)));
+
     // generate pattern
-    Polylines   polylines = makeGrid(
-        scale_(this->z),
-        distance,
-        ceil(bb.size()(0) / distance) + 1,
-        ceil(bb.size()(1) / distance) + 1,
-        ((this->layer_id/thickness_layers) % 2) + 1);
+    Polylines   polylines = fill_pattern_tile(
+        { ip3DHoneycomb, params.density, this->spacing, z_phase, double(curve_type),
+          Point(0, 0), Point(coord_t(x_count), coord_t(y_count)) },
+        [=]() { return makeGrid(scale_(this->z), distance, x_count, y_count, curve_type); });
     
     // move pattern in place
 	for (Polyline &pl : polylines)
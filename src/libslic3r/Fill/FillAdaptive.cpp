@@ -16,6 +16,9 @@
 #include <algorithm>
 #include <numeric>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 // Boost pool: Don't use mutexes to synchronize memory allocation.
 #define BOOST_POOL_NO_MT
 #include <boost/pool/object_pool.hpp>
@@ -259,6 +262,9 @@ struct Octree
     // Octree will allocate its Cubes from the pool. The pool only supports deletion of the complete pool,
     // perfect for building up our octree.
     boost::object_pool<Cube>    pool;
+    // The eight subtrees below the root are expanded in parallel by build_octree(). The pools are
+    // compiled without internal locking (BOOST_POOL_NO_MT), thus each subtree allocates from its own.
+    std::array<boost::object_pool<Cube>, 8> subtree_pools;
     Cube*                       root_cube { nullptr };
     Vec3d                       origin;
     std::vector<CubeProperties> cubes_properties;
@@ -266,7 +272,7 @@ struct Octree
     Octree(const Vec3d &origin, const std::vector<CubeProperties> &cubes_properties)
         : root_cube(pool.construct(origin)), origin(origin), cubes_properties(cubes_properties) {}
 
-    void insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth);
+    void insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, boost::object_pool<Cube> &pool);
 };
 
 void OctreeDeleter::operator()(Octree *p) {
@@ -1484,23 +1490,61 @@ OctreePtr build_octree(
         double edge_length_half = 0.5 * cubes_properties.back().edge_length;
         Vec3d  diag_half(edge_length_half, edge_length_half, edge_length_half);
         int    max_depth = int(cubes_properties.size()) - 1;
-        auto process_triangle = [octree_ptr, max_depth, diag_half](const Vec3d &a, const Vec3d &b, const Vec3d &c) {
-            octree_ptr->insert_triangle(
-                a, b, c,
-                octree_ptr->root_cube,
-                BoundingBoxf3(octree_ptr->root_cube->center - diag_half, octree_ptr->root_cube->center + diag_half),
-                max_depth);
-        };
+
+        // Collect the triangles to be inserted.
+        std::vector<std::array<Vec3d, 3>> triangles;
+        triangles.reserve(triangle_mesh.indices.size() + overhang_triangles.size() / 3);
         auto up_vector = support_overhangs_only ? Vec3d(transform_to_octree() * Vec3d(0., 0., 1.)) : Vec3d();
         for (auto &tri : triangle_mesh.indices) {
             auto a = triangle_mesh.vertices[tri[0]].cast<double>();
             auto b = triangle_mesh.vertices[tri[1]].cast<double>();
             auto c = triangle_mesh.vertices[tri[2]].cast<double>();
             if (! support_overhangs_only || is_overhang_triangle(a, b, c, up_vector))
-                process_triangle(a, b, c);
+                triangles.push_back({ a, b, c });
         }
         for (size_t i = 0; i < overhang_triangles.size(); i += 3)
-            process_triangle(overhang_triangles[i], overhang_triangles[i + 1], overhang_triangles[i + 2]);
+            triangles.push_back({ overhang_triangles[i], overhang_triangles[i + 1], overhang_triangles[i + 2] });
+
+        // Expand the first octree level serially, bucketing the triangles by the root children
+        // their bounding boxes intersect (a triangle may fall into several buckets). This mirrors
+        // the first recursion level of insert_triangle().
+        const Cube         *root = octree_ptr->root_cube;
+        const BoundingBoxf3 root_bbox(root->center - diag_half, root->center + diag_half);
+        std::array<BoundingBoxf3, 8>         child_bboxes;
+        std::array<std::vector<uint32_t>, 8> buckets;
+        for (size_t i = 0; i < 8; ++ i) {
+            BoundingBoxf3 &bbox = child_bboxes[i];
+            for (int k = 0; k < 3; ++ k) {
+                if (child_centers[i][k] == -1.) {
+                    bbox.min[k] = root_bbox.min[k];
+                    bbox.max[k] = root->center[k] + EPSILON;
+                } else {
+                    bbox.min[k] = root->center[k] - EPSILON;
+                    bbox.max[k] = root_bbox.max[k];
+                }
+            }
+        }
+        for (uint32_t triangle_idx = 0; triangle_idx < uint32_t(triangles.size()); ++ triangle_idx) {
+            const std::array<Vec3d, 3> &t = triangles[triangle_idx];
+            for (size_t i = 0; i < 8; ++ i)
+                if (triangle_AABB_intersects(t[0], t[1], t[2], child_bboxes[i])) {
+                    if (! octree_ptr->root_cube->children[i])
+                        octree_ptr->root_cube->children[i] = octree_ptr->pool.construct(
+                            Vec3d(root->center + child_centers[i] * (cubes_properties[max_depth - 1].edge_length / 2.)));
+                    buckets[i].emplace_back(triangle_idx);
+                }
+        }
+
+        // Expand the eight disjoint subtrees in parallel, each allocating from its own pool.
+        if (max_depth > 1)
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, 8, 1),
+                [octree_ptr, max_depth, &triangles, &child_bboxes, &buckets](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i < range.end(); ++ i)
+                    for (uint32_t triangle_idx : buckets[i]) {
+                        const std::array<Vec3d, 3> &t = triangles[triangle_idx];
+                        octree_ptr->insert_triangle(t[0], t[1], t[2], octree_ptr->root_cube->children[i], child_bboxes[i], max_depth - 1, octree_ptr->subtree_pools[i]);
+                    }
+            });
         {
             // Transform the octree to world coordinates to reduce computation when extracting infill lines.
             auto rot = transform_to_world().toRotationMatrix();
@@ -1512,7 +1556,7 @@ OctreePtr build_octree(
     return octree;
 }
 
-void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth)
+void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cube *current_cube, const BoundingBoxf3 &current_bbox, int depth, boost::object_pool<Cube> &pool)
 {
     assert(current_cube);
     assert(depth > 0);
@@ -1541,9 +1585,9 @@ void Octree::insert_triangle(const Vec3d &a, const Vec3d &b, const Vec3d &c, Cub
         // dist2_to_triangle and r2_cube are commented out too.
         if (triangle_AABB_intersects(a, b, c, bbox)) {
             if (! current_cube->children[i])
-                current_cube->children[i] = this->pool.construct(child_center);
+                current_cube->children[i] = pool.construct(child_center);
             if (depth > 0)
-                this->insert_triangle(a, b, c, current_cube->children[i], bbox, depth);
+                this->insert_triangle(a, b, c, current_cube->children[i], bbox, depth, pool);
         }
     }
 }
@@ -8,7 +8,12 @@
 ///|/ PrusaSlicer is released under the terms of the AGPLv3 or higher
 ///|/
 #include <stdio.h>
+#include <list>
+#include <mutex>
 #include <numeric>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
 
 #include "../ClipperUtils.hpp"
 #include "../EdgeGrid.hpp"
@@ -37,6 +42,91 @@
 
 namespace Slic3r {
 
+size_t FillPatternTileKey::hash() const
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, int(pattern));
+    boost::hash_combine(seed, density);
+    boost::hash_combine(seed, spacing);
+    boost::hash_combine(seed, z_phase);
+    boost::hash_combine(seed, extra);
+    boost::hash_combine(seed, tile_min.x());
+    boost::hash_combine(seed, tile_min.y());
+    boost::hash_combine(seed, tile_size.x());
+    boost::hash_combine(seed, tile_size.y());
+    return seed;
+}
+
+namespace {
+
+// Process wide cache of the unclipped periodic infill patterns. Infill of the layers runs
+// in parallel, thus the cache is guarded by a mutex. Bounded LRU to keep the memory
+// footprint in check; the patterns of the few phases cycling across layers stay hot.
+class FillPatternTileCache
+{
+    struct Entry
+    {
+        size_t             hash;
+        FillPatternTileKey key;
+        Polylines          pattern;
+    };
+
+public:
+    Polylines get_or_generate(const FillPatternTileKey &key, const std::function<Polylines()> &generate)
+    {
+        const size_t hash = key.hash();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto range = m_map.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++ it)
+                if (it->second->key == key) {
+                    // Promote the entry to the most recently used position.
+                    m_lru.splice(m_lru.begin(), m_lru, it->second);
+                    return it->second->pattern;
+                }
+        }
+        Polylines pattern = generate();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto range = m_map.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++ it)
+                if (it->second->key == key)
+                    // Inserted by another thread in the meantime.
+                    return pattern;
+            while (m_lru.size() >= capacity) {
+                auto last = std::prev(m_lru.end());
+                auto evict_range = m_map.equal_range(last->hash);
+                for (auto it = evict_range.first; it != evict_range.second; ++ it)
+                    if (it->second == last) {
+                        m_map.erase(it);
+                        break;
+                    }
+                m_lru.pop_back();
+            }
+            m_lru.push_front(Entry { hash, key, pattern });
+            m_map.emplace(hash, m_lru.begin());
+        }
+        return pattern;
+    }
+
+private:
+    // Upper bound on the number of cached pattern tiles.
+    static constexpr size_t capacity = 32;
+
+    std::mutex m_mutex;
+    std::list<Entry> m_lru;
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> m_map;
+};
+
+static FillPatternTileCache s_pattern_tile_cache;
+
+} // namespace
+
+Polylines fill_pattern_tile(const FillPatternTileKey &key, const std::function<Polylines()> &generate)
+{
+    return s_pattern_tile_cache.get_or_generate(key, generate);
+}
+
 //BBS: 0% of sparse_infill_line_width, no anchor at the start of sparse infill
 float Fill::infill_anchor = 400;
 //BBS: 20mm
@@ -1097,27 +1187,6 @@ void mark_boundary_segments_touching_infill(
             visitor.perimeter_overlaps.clear();
 #endif // INFILL_DEBUG_OUTPUT
 			for (size_t point_idx = start_point.idx_segment; point_idx <= end_point.idx_segment; ++ point_idx) {
-//FIXME extend the EdgeGrid to suport tracing a thick line.
-#if 0
-				Point pt1, pt2;
-				Vec2d pt1d, pt2d;
-				if (point_idx == start_point.idx_segment) {
-					pt1d = start_point.point;
-					pt1  = pt1d.cast<coord_t>();
-				} else {
-					pt1  = polyline.points[point_idx];
-					pt1d = pt1.cast<double>();
-				}
-				if (point_idx == start_point.idx_segment) {
-					pt2d = end_point.point;
-					pt2  = pt1d.cast<coord_t>();
-				} else {
-					pt2  = polyline.points[point_idx];
-					pt2d = pt2.cast<double>();
-				}
-				visitor.init(pt1d, pt2d);
-				grid.visit_cells_intersecting_thick_line(pt1, pt2, distance_colliding, visitor);
-#else
 				Vec2d pt1 = (point_idx == start_point.idx_segment) ? start_point.point : polyline.points[point_idx    ].cast<double>();
 				Vec2d pt2 = (point_idx == end_point  .idx_segment) ? end_point  .point : polyline.points[point_idx + 1].cast<double>();
 #if 0
@@ -1133,20 +1202,9 @@ void mark_boundary_segments_touching_infill(
 					}
 #endif
 				visitor.init(pt1, pt2);
-				// Simulate tracing of a thick line. This only works reliably if distance_colliding <= grid cell size.
-				Vec2d v = (pt2 - pt1).normalized() * distance_colliding;
-				Vec2d vperp = perp(v);
-				Vec2d a = pt1 - v - vperp;
-				Vec2d b = pt2 + v - vperp;
-                assert(grid.bbox().contains(a.cast<coord_t>()));
-                assert(grid.bbox().contains(b.cast<coord_t>()));
-				grid.visit_cells_intersecting_line(a.cast<coord_t>(), b.cast<coord_t>(), visitor);
-				a = pt1 - v + vperp;
-				b = pt2 + v + vperp;
-                assert(grid.bbox().contains(a.cast<coord_t>()));
-                assert(grid.bbox().contains(b.cast<coord_t>()));
-                grid.visit_cells_intersecting_line(a.cast<coord_t>(), b.cast<coord_t>(), visitor);
-#endif
+				// Resolve all boundary segments within distance_colliding of the infill segment in a single
+				// sweep of the grid; every candidate cell is visited exactly once.
+				grid.visit_cells_intersecting_thick_line(pt1.cast<coord_t>(), pt2.cast<coord_t>(), coord_t(distance_colliding), visitor);
 #ifdef INFILL_DEBUG_OUTPUT
 //                export_infill_to_svg(boundary, boundary_parameters, boundary_intersections, infill, distance_colliding * 2, debug_out_path("%s-%03d-%03d-%03d.svg", "FillBase-mark_boundary_segments_touching_infill-step", iRun, iStep, int(point_idx)), { polyline });
 #endif // INFILL_DEBUG_OUTPUT
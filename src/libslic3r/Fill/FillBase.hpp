@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include <stdexcept>
 
+#include <functional>
 #include <type_traits>
 
 #include "../libslic3r.h"
@@ -80,6 +81,35 @@ struct FillParams
 };
 static_assert(IsTriviallyCopyable<FillParams>::value, "FillParams class is not POD (and it should be - see constructor).");
 
+// Key identifying the unclipped pattern of a periodic filler (gyroid, honeycomb, 3D honeycomb)
+// covering a grid aligned bounding box. The pattern only depends on the phase along the Z axis,
+// the density / spacing and the aligned tile extents, all of which repeat across layers.
+struct FillPatternTileKey
+{
+    InfillPattern pattern;
+    double        density;
+    coordf_t      spacing;
+    // Phase of the pattern along the Z axis, in pattern specific units.
+    double        z_phase;
+    // Pattern specific extra parameter (honeycomb direction angle, 3D honeycomb curve type).
+    double        extra;
+    Point         tile_min;
+    Point         tile_size;
+
+    bool   operator==(const FillPatternTileKey &rhs) const {
+        return pattern == rhs.pattern && density == rhs.density && spacing == rhs.spacing &&
+               z_phase == rhs.z_phase && extra == rhs.extra &&
+               tile_min.x() == rhs.tile_min.x() && tile_min.y() == rhs.tile_min.y() &&
+               tile_size.x() == rhs.tile_size.x() && tile_size.y() == rhs.tile_size.y();
+    }
+    size_t hash() const;
+};
+
+// Returns the unclipped pattern polylines for \p key from a process wide cache, calling
+// \p generate on a miss. Only the clipping of the returned pattern to the fill surface
+// then has to run per layer.
+Polylines fill_pattern_tile(const FillPatternTileKey &key, const std::function<Polylines()> &generate);
+
 class Fill
 {
 public:
@@ -16,8 +16,111 @@
 #include "FillConcentric.hpp"
 #include <libslic3r/ShortestPath.hpp>
 
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
 namespace Slic3r {
 
+// Bounded LRU cache of the concentric loop ladders, keyed by the source expolygon and the loop
+// spacing. The perimeter generator's inward offset ladder stops at the infill boundary, therefore
+// it cannot seed these loops; caching the chain of offset2_ex() calls instead lets identical
+// top / bottom / solid islands repeated over many layers skip the Clipper offsets altogether.
+namespace {
+
+struct ConcentricLoopsCacheKey
+{
+    Polygons boundary;
+    coord_t  distance;
+    coord_t  min_spacing;
+
+    bool operator==(const ConcentricLoopsCacheKey &rhs) const
+    {
+        if (distance != rhs.distance || min_spacing != rhs.min_spacing || boundary.size() != rhs.boundary.size())
+            return false;
+        for (size_t i = 0; i < boundary.size(); ++ i)
+            if (boundary[i] != rhs.boundary[i])
+                return false;
+        return true;
+    }
+
+    size_t hash() const
+    {
+        size_t seed = 0;
+        for (const Polygon &poly : boundary) {
+            boost::hash_combine(seed, poly.points.size());
+            for (const Point &pt : poly.points) {
+                boost::hash_combine(seed, pt.x());
+                boost::hash_combine(seed, pt.y());
+            }
+        }
+        boost::hash_combine(seed, distance);
+        boost::hash_combine(seed, min_spacing);
+        return seed;
+    }
+};
+
+class ConcentricLoopsCache
+{
+    struct Entry
+    {
+        size_t                  hash;
+        ConcentricLoopsCacheKey key;
+        Polygons                loops;
+    };
+
+public:
+    bool lookup(const ConcentricLoopsCacheKey &key, size_t hash, Polygons &loops)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto range = m_map.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++ it)
+            if (it->second->key == key) {
+                // Promote the entry to the most recently used position.
+                m_lru.splice(m_lru.begin(), m_lru, it->second);
+                loops = it->second->loops;
+                return true;
+            }
+        return false;
+    }
+
+    void insert(ConcentricLoopsCacheKey &&key, size_t hash, const Polygons &loops)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto range = m_map.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++ it)
+            if (it->second->key == key)
+                // Inserted by another thread in the meantime.
+                return;
+        while (m_lru.size() >= capacity) {
+            auto last = std::prev(m_lru.end());
+            auto evict_range = m_map.equal_range(last->hash);
+            for (auto it = evict_range.first; it != evict_range.second; ++ it)
+                if (it->second == last) {
+                    m_map.erase(it);
+                    break;
+                }
+            m_lru.pop_back();
+        }
+        m_lru.push_front(Entry { hash, std::move(key), loops });
+        m_map.emplace(hash, m_lru.begin());
+    }
+
+private:
+    // Upper bound on the number of cached islands, to keep the memory footprint bounded.
+    static constexpr size_t capacity = 64;
+
+    std::mutex m_mutex;
+    std::list<Entry> m_lru;
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> m_map;
+};
+
+static ConcentricLoopsCache s_concentric_loops_cache;
+
+} // namespace
+
 void FillConcentric::_fill_surface_single(
     const FillParams                &params, 
     unsigned int                     thickness_layers,
@@ -36,16 +139,24 @@ void FillConcentric::_fill_surface_single(
         this->spacing = unscale<double>(distance);
     }
 
-    Polygons   loops = to_polygons(expolygon);
-    ExPolygons last { std::move(expolygon) };
-    while (! last.empty()) {
-        last = offset2_ex(last, -(distance + min_spacing/2), +min_spacing/2);
-        append(loops, to_polygons(last));
-    }
+    Polygons loops;
+    {
+        ConcentricLoopsCacheKey cache_key { to_polygons(expolygon), distance, min_spacing };
+        const size_t cache_hash = cache_key.hash();
+        if (! s_concentric_loops_cache.lookup(cache_key, cache_hash, loops)) {
+            loops = cache_key.boundary;
+            ExPolygons last { std::move(expolygon) };
+            while (! last.empty()) {
+                last = offset2_ex(last, -(distance + min_spacing/2), +min_spacing/2);
+                append(loops, to_polygons(last));
+            }
 
-    // generate paths from the outermost to the innermost, to avoid
-    // adhesion problems of the first central tiny loops
-    loops = union_pt_chained_outside_in(loops);
+            // generate paths from the outermost to the innermost, to avoid
+            // adhesion problems of the first central tiny loops
+            loops = union_pt_chained_outside_in(loops);
+            s_concentric_loops_cache.insert(std::move(cache_key), cache_hash, loops);
+        }
+    }
     
     // split paths using a nearest neighbor search
     size_t iPathFirst = polylines_out.size();
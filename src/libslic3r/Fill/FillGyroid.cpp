@@ -75,34 +75,56 @@ static std::vector<Vec2d> make_one_period(double width, double scaleFactor, doub
     points.emplace_back(Vec2d(limit, f(limit, z_sin, z_cos, vertical, flip)));
 
     // piecewise increase in resolution up to requested tolerance
+    // An interval which failed the tolerance test keeps failing until one of its end points
+    // changes, thus only the intervals bounded by a point inserted in the previous pass are
+    // evaluated again and the evaluations of f() stay proportional to the output size.
+    std::vector<char>  fresh(points.size(), true);
+    std::vector<Vec2d> inserted;
     for(;;)
     {
+        inserted.clear();
         size_t size = points.size();
         for (unsigned int i = 1;i < size; ++i) {
+            if (! fresh[i-1] && ! fresh[i])
+                continue;
             auto& lp = points[i-1]; // left point
             auto& rp = points[i];   // right point
             double x = lp(0) + (rp(0) - lp(0)) / 2;
             double y = f(x, z_sin, z_cos, vertical, flip);
             Vec2d ip = {x, y};
             if (std::abs(cross2(Vec2d(ip - lp), Vec2d(ip - rp))) > sqr(tolerance)) {
-                points.emplace_back(std::move(ip));
+                inserted.emplace_back(std::move(ip));
             }
         }
 
-        if (size == points.size())
+        if (inserted.empty())
             break;
-        else
-        {
-            // insert new points in order
-            std::sort(points.begin(), points.end(),
-                      [](const Vec2d &lhs, const Vec2d &rhs) { return lhs(0) < rhs(0); });
+
+        // Merge the new points into the sorted sequence. The midpoints were generated with
+        // increasing abscissa, so both sequences are sorted already.
+        std::vector<Vec2d> merged;
+        std::vector<char>  merged_fresh;
+        merged.reserve(points.size() + inserted.size());
+        merged_fresh.reserve(points.size() + inserted.size());
+        auto it_old = points.begin();
+        auto it_new = inserted.begin();
+        while (it_old != points.end() || it_new != inserted.end()) {
+            if (it_new == inserted.end() || (it_old != points.end() && (*it_old)(0) < (*it_new)(0))) {
+                merged.emplace_back(*it_old ++);
+                merged_fresh.emplace_back(false);
+            } else {
+                merged.emplace_back(*it_new ++);
+                merged_fresh.emplace_back(true);
+            }
         }
+        points.swap(merged);
+        fresh.swap(merged_fresh);
     }
 
     return points;
 }
 
-static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double line_spacing, double width, double height)
+static Polylines make_gyroid_waves(double z_phase, double density_adjusted, double line_spacing, double width, double height)
 {
     const double scaleFactor = scale_(line_spacing) / density_adjusted;
 
@@ -112,7 +134,7 @@ static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double
 
     //scale factor for 5% : 8 712 388
     // 1z = 10^-6 mm ?
-    const double z     = gridZ / scaleFactor;
+    const double z     = z_phase;
     const double z_sin = sin(z);
     const double z_cos = cos(z);
 
@@ -168,13 +190,17 @@ void FillGyroid::_fill_surface_single(
     // align bounding box to a multiple of our grid module
     bb.merge(align_to_grid(bb.min, Point(2*M_PI*distance, 2*M_PI*distance)));
 
+    // The waves only depend on the phase of Z within the gyroid period, which repeats across
+    // layers, so the unclipped pattern is looked up in the tile cache and only generated on a miss.
+    double z_phase = fmod(scale_(this->z) / (scale_(this->spacing) / density_adjusted), 2. * M_PI);
+    double width_count  = ceil(bb.size()(0) / distance) + 1.;
+    double height_count = ceil(bb.size()(1) / distance) + 1.;
+
     // generate pattern
-    Polylines polylines = make_gyroid_waves(
-        scale_(this->z),
-        density_adjusted,
-        this->spacing,
-        ceil(bb.size()(0) / distance) + 1.,
-        ceil(bb.size()(1) / distance) + 1.);
+    Polylines polylines = fill_pattern_tile(
+        { ipGyroid, density_adjusted, this->spacing, z_phase, 0.,
+          Point(0, 0), Point(coord_t(width_count), coord_t(height_count)) },
+        [=]() { return make_gyroid_waves(z_phase, density_adjusted, this->spacing, width_count, height_count); });
 
 	// shift the polyline to the grid origin
 	for (Polyline &pl : polylines)
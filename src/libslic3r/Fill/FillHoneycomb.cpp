@@ -50,27 +50,37 @@ void FillHoneycomb::_fill_surface_single(
             bounding_box.merge(align_to_grid(bounding_box.min, Point(m.hex_width, m.pattern_height)));
         }
 
-        coord_t x = bounding_box.min(0);
-        while (x <= bounding_box.max(0)) {
-            Polyline p;
-            coord_t ax[2] = { x + m.x_offset, x + m.distance - m.x_offset };
-            for (size_t i = 0; i < 2; ++ i) {
-                std::reverse(p.points.begin(), p.points.end()); // turn first half upside down
-                for (coord_t y = bounding_box.min(1); y <= bounding_box.max(1); y += m.y_short + m.hex_side + m.y_short + m.hex_side) {
-                    p.points.push_back(Point(ax[1], y + m.y_offset));
-                    p.points.push_back(Point(ax[0], y + m.y_short - m.y_offset));
-                    p.points.push_back(Point(ax[0], y + m.y_short + m.hex_side + m.y_offset));
-                    p.points.push_back(Point(ax[1], y + m.y_short + m.hex_side + m.y_short - m.y_offset));
-                    p.points.push_back(Point(ax[1], y + m.y_short + m.hex_side + m.y_short + m.hex_side + m.y_offset));
+        // The hexagon pattern is independent of Z and aligned to a world coordinate grid, so it
+        // repeats across layers with the same direction and tile; look it up in the tile cache
+        // and only generate it on a miss.
+        all_polylines = fill_pattern_tile(
+            { ipHoneycomb, params.density, this->spacing, 0., double(direction.first),
+              bounding_box.min, Point(bounding_box.size()) },
+            [&]() {
+                Polylines pattern;
+                coord_t x = bounding_box.min(0);
+                while (x <= bounding_box.max(0)) {
+                    Polyline p;
+                    coord_t ax[2] = { x + m.x_offset, x + m.distance - m.x_offset };
+                    for (size_t i = 0; i < 2; ++ i) {
+                        std::reverse(p.points.begin(), p.points.end()); // turn first half upside down
+                        for (coord_t y = bounding_box.min(1); y <= bounding_box.max(1); y += m.y_short + m.hex_side + m.y_short + m.hex_side) {
+                            p.points.push_back(Point(ax[1], y + m.y_offset));
+                            p.points.push_back(Point(ax[0], y + m.y_short - m.y_offset));
+                            p.points.push_back(Point(ax[0], y + m.y_short + m.hex_side + m.y_offset));
+                            p.points.push_back(Point(ax[1], y + m.y_short + m.hex_side + m.y_short - m.y_offset));
+                            p.points.push_back(Point(ax[1], y + m.y_short + m.hex_side + m.y_short + m.hex_side + m.y_offset));
+                        }
+                        ax[0] = ax[0] + m.distance;
+                        ax[1] = ax[1] + m.distance;
+                        std::swap(ax[0], ax[1]); // draw symmetrical pattern
+                        x += m.distance;
+                    }
+                    p.rotate(-direction.first, m.hex_center);
+                    pattern.push_back(p);
                 }
-                ax[0] = ax[0] + m.distance;
-                ax[1] = ax[1] + m.distance;
-                std::swap(ax[0], ax[1]); // draw symmetrical pattern
-                x += m.distance;
-            }
-            p.rotate(-direction.first, m.hex_center);
-            all_polylines.push_back(p);
-        }
+                return pattern;
+            });
     }
     
     all_polylines = intersection_pl(std::move(all_polylines), expolygon);
@@ -763,84 +763,139 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
         segs[i].idx = i;
         segs[i].pos = x0 + i * line_spacing;
     }
-    // For each contour
+    // Flatten the contour segments into a contiguous structure of arrays once per surface.
+    // The sweep below then runs over flat coordinate arrays instead of chasing the per contour
+    // point storage, the vertical line ranges are computed in a tight auto-vectorizable pass,
+    // and the intersection vectors are sized in a single counting pass before being filled.
+    size_t n_segments_total = 0;
+    for (size_t iContour = 0; iContour < poly_with_offset.n_contours; ++ iContour)
+        if (const Points &contour = poly_with_offset.contour(iContour).points; contour.size() >= 2)
+            n_segments_total += contour.size();
+    std::vector<coord_t>  seg_x1, seg_y1, seg_x2, seg_y2;
+    std::vector<int32_t>  seg_il, seg_ir;
+    std::vector<uint32_t> seg_contour, seg_index;
+    seg_x1.reserve(n_segments_total);
+    seg_y1.reserve(n_segments_total);
+    seg_x2.reserve(n_segments_total);
+    seg_y2.reserve(n_segments_total);
+    seg_contour.reserve(n_segments_total);
+    seg_index.reserve(n_segments_total);
     for (size_t iContour = 0; iContour < poly_with_offset.n_contours; ++ iContour) {
         const Points &contour = poly_with_offset.contour(iContour).points;
         if (contour.size() < 2)
             continue;
-        // For each segment
         for (size_t iSegment = 0; iSegment < contour.size(); ++ iSegment) {
             size_t iPrev = ((iSegment == 0) ? contour.size() : iSegment) - 1;
-            const Point &p1 = contour[iPrev];
-            const Point &p2 = contour[iSegment];
-            // Which of the equally spaced vertical lines is intersected by this segment?
-            coord_t l = p1(0);
-            coord_t r = p2(0);
-            if (l > r)
-                std::swap(l, r);
-            // il, ir are the left / right indices of vertical lines intersecting a segment
-            int il = (l - x0) / line_spacing;
-            while (il * line_spacing + x0 < l)
-                ++ il;
-            il = std::max(int(0), il);
-            int ir = (r - x0 + line_spacing) / line_spacing;
-            while (ir * line_spacing + x0 > r)
-                -- ir;
-            ir = std::min(int(segs.size()) - 1, ir);
-            if (il > ir)
-                // No vertical line intersects this segment.
-                continue;
-            assert(il >= 0 && size_t(il) < segs.size());
-            assert(ir >= 0 && size_t(ir) < segs.size());
-            for (int i = il; i <= ir; ++ i) {
-                coord_t this_x = segs[i].pos;
-				assert(this_x == i * line_spacing + x0);
-                SegmentIntersection is;
-                is.iContour = iContour;
-                is.iSegment = iSegment;
-                assert(l <= this_x);
-                assert(r >= this_x);
-                // Calculate the intersection position in y axis. x is known.
-                if (p1.x() == this_x) {
-                    if (p2.x() == this_x) {
-                        // Ignore strictly vertical segments.
-                        continue;
-                    }
-                    const Point &p0 = prev_value_modulo(iPrev, contour);
-                    if (int64_t(p0.x() - p1.x()) * int64_t(p2.x() - p1.x()) > 0) {
-                        // Ignore points of a contour touching the infill line from one side.
-                        continue;
-                    }
-                    is.pos_p = p1.y();
-                    is.pos_q = 1;
-                } else if (p2.x() == this_x) {
-                    const Point &p3 = next_value_modulo(iSegment, contour);
-                    if (int64_t(p3.x() - p2.x()) * int64_t(p1.x() - p2.x()) > 0) {
-                        // Ignore points of a contour touching the infill line from one side.
-                        continue;
-                    }
-                    is.pos_p = p2.y();
-                    is.pos_q = 1;
+            seg_x1.emplace_back(contour[iPrev].x());
+            seg_y1.emplace_back(contour[iPrev].y());
+            seg_x2.emplace_back(contour[iSegment].x());
+            seg_y2.emplace_back(contour[iSegment].y());
+            seg_contour.emplace_back(uint32_t(iContour));
+            seg_index.emplace_back(uint32_t(iSegment));
+        }
+    }
+
+    // il, ir are the left / right indices of vertical lines intersecting a segment.
+    seg_il.assign(n_segments_total, 0);
+    seg_ir.assign(n_segments_total, -1);
+    for (size_t i = 0; i < n_segments_total; ++ i) {
+        coord_t l = seg_x1[i];
+        coord_t r = seg_x2[i];
+        if (l > r)
+            std::swap(l, r);
+        int il = (l - x0) / line_spacing;
+        while (il * line_spacing + x0 < l)
+            ++ il;
+        il = std::max(int(0), il);
+        int ir = (r - x0 + line_spacing) / line_spacing;
+        while (ir * line_spacing + x0 > r)
+            -- ir;
+        ir = std::min(int(segs.size()) - 1, ir);
+        seg_il[i] = il;
+        seg_ir[i] = ir;
+    }
+
+    {
+        // Size the intersection vectors up front from a prefix summed histogram of the vertical
+        // line ranges, so that the fill pass below appends without reallocating.
+        std::vector<int32_t> counts(n_vlines + 1, 0);
+        for (size_t i = 0; i < n_segments_total; ++ i)
+            if (seg_il[i] <= seg_ir[i]) {
+                ++ counts[seg_il[i]];
+                -- counts[seg_ir[i] + 1];
+            }
+        int32_t covering = 0;
+        for (size_t i = 0; i < n_vlines; ++ i) {
+            covering += counts[i];
+            segs[i].intersections.reserve(size_t(covering));
+        }
+    }
+
+    // For each segment
+    for (size_t i_flat = 0; i_flat < n_segments_total; ++ i_flat) {
+        const int il = seg_il[i_flat];
+        const int ir = seg_ir[i_flat];
+        if (il > ir)
+            // No vertical line intersects this segment.
+            continue;
+        assert(il >= 0 && size_t(il) < segs.size());
+        assert(ir >= 0 && size_t(ir) < segs.size());
+        const size_t  iContour = seg_contour[i_flat];
+        const size_t  iSegment = seg_index[i_flat];
+        const coord_t p1x      = seg_x1[i_flat];
+        const coord_t p1y      = seg_y1[i_flat];
+        const coord_t p2x      = seg_x2[i_flat];
+        const coord_t p2y      = seg_y2[i_flat];
+        coord_t       this_x   = x0 + coord_t(il) * line_spacing;
+        for (int i = il; i <= ir; ++ i, this_x += line_spacing) {
+            assert(this_x == segs[i].pos);
+            SegmentIntersection is;
+            is.iContour = iContour;
+            is.iSegment = iSegment;
+            assert(std::min(p1x, p2x) <= this_x);
+            assert(std::max(p1x, p2x) >= this_x);
+            // Calculate the intersection position in y axis. x is known.
+            if (p1x == this_x) {
+                if (p2x == this_x) {
+                    // Ignore strictly vertical segments.
+                    continue;
+                }
+                const Points &contour = poly_with_offset.contour(iContour).points;
+                const Point  &p0      = prev_value_modulo(prev_idx_modulo(iSegment, contour), contour);
+                if (int64_t(p0.x() - p1x) * int64_t(p2x - p1x) > 0) {
+                    // Ignore points of a contour touching the infill line from one side.
+                    continue;
+                }
+                is.pos_p = p1y;
+                is.pos_q = 1;
+            } else if (p2x == this_x) {
+                const Points &contour = poly_with_offset.contour(iContour).points;
+                const Point  &p3      = next_value_modulo(iSegment, contour);
+                if (int64_t(p3.x() - p2x) * int64_t(p1x - p2x) > 0) {
+                    // Ignore points of a contour touching the infill line from one side.
+                    continue;
+                }
+                is.pos_p = p2y;
+                is.pos_q = 1;
+            } else {
+                // First calculate the intersection parameter 't' as a rational number with non negative denominator.
+                if (p2x > p1x) {
+                    is.pos_p = this_x - p1x;
+                    is.pos_q = p2x - p1x;
                 } else {
-                    // First calculate the intersection parameter 't' as a rational number with non negative denominator.
-                    if (p2.x() > p1.x()) {
-                        is.pos_p = this_x - p1.x();
-                        is.pos_q = p2.x() - p1.x();
-                    } else {
-                        is.pos_p = p1.x() - this_x;
-                        is.pos_q = p1.x() - p2.x();
-                    }
-                    assert(is.pos_q > 1);
-                    assert(is.pos_p > 0 && is.pos_p < is.pos_q);
-                    // Make an intersection point from the 't'.
-                    is.pos_p *= int64_t(p2.y() - p1.y());
-                    is.pos_p += p1.y() * int64_t(is.pos_q);
+                    is.pos_p = p1x - this_x;
+                    is.pos_q = p1x - p2x;
                 }
-                // +-1 to take rounding into account.
-                assert(is.pos() + 1 >= std::min(p1.y(), p2.y()));
-                assert(is.pos() <= std::max(p1.y(), p2.y()) + 1);
-                segs[i].intersections.push_back(is);
+                assert(is.pos_q > 1);
+                assert(is.pos_p > 0 && is.pos_p < is.pos_q);
+                // Make an intersection point from the 't'.
+                is.pos_p *= int64_t(p2y - p1y);
+                is.pos_p += p1y * int64_t(is.pos_q);
             }
+            // +-1 to take rounding into account.
+            assert(is.pos() + 1 >= std::min(p1y, p2y));
+            assert(is.pos() <= std::max(p1y, p2y) + 1);
+            segs[i].intersections.push_back(is);
         }
     }
 
@@ -0,0 +1,75 @@
+#include "FirstLayerRaster.hpp"
+
+#include "BoundingBox.hpp"
+#include "ClipperUtils.hpp"
+#include "ExtrusionEntityCollection.hpp"
+#include "Layer.hpp"
+#include "Print.hpp"
+
+#include <cmath>
+
+namespace Slic3r {
+
+sla::EncodedRaster rasterize_first_layer(const Print &print, size_t long_side_px)
+{
+    // Collect the polygons covered by the first layer extrusions in plate coordinates.
+    Polygons covered;
+    for (const PrintObject *object : print.objects()) {
+        // Object and support extrusions are stored in object local coordinates,
+        // they are stamped once per instance.
+        Polygons object_covered;
+        if (! object->layers().empty())
+            for (const LayerRegion *region : object->layers().front()->regions()) {
+                region->perimeters.polygons_covered_by_width(object_covered, float(SCALED_EPSILON));
+                region->fills.polygons_covered_by_width(object_covered, float(SCALED_EPSILON));
+            }
+        if (! object->support_layers().empty())
+            object->support_layers().front()->support_fills.polygons_covered_by_width(object_covered, float(SCALED_EPSILON));
+        for (const PrintInstance &instance : object->instances())
+            for (Polygon poly : object_covered) {
+                poly.translate(instance.shift);
+                covered.emplace_back(std::move(poly));
+            }
+    }
+    // Skirt and brim are generated in plate coordinates already.
+    print.skirt().polygons_covered_by_width(covered, float(SCALED_EPSILON));
+    for (const auto &brim : print.get_brimMap())
+        brim.second.polygons_covered_by_width(covered, float(SCALED_EPSILON));
+    for (const auto &brim : print.get_supportBrimMap())
+        brim.second.polygons_covered_by_width(covered, float(SCALED_EPSILON));
+
+    if (covered.empty())
+        return sla::EncodedRaster();
+
+    // Merge the overlapping extrusion footprints, so the anti-aliased edges of
+    // adjacent lines do not produce seams inside solid regions.
+    ExPolygons merged = union_ex(covered);
+
+    // Crop the raster to the extents of the first layer with a 1mm margin.
+    BoundingBox bbox = get_extents(merged);
+    bbox.offset(scale_(1.));
+    const Point sz = bbox.size();
+
+    size_t px_w, px_h;
+    if (sz.x() >= sz.y()) {
+        px_w = long_side_px;
+        px_h = std::max<size_t>(1, size_t(std::round(double(long_side_px) * double(sz.y()) / double(sz.x()))));
+    } else {
+        px_h = long_side_px;
+        px_w = std::max<size_t>(1, size_t(std::round(double(long_side_px) * double(sz.x()) / double(sz.y()))));
+    }
+
+    sla::RasterBase::Resolution res{px_w, px_h};
+    sla::RasterBase::PixelDim   pxdim{unscaled<double>(sz.x()) / double(px_w),
+                                      unscaled<double>(sz.y()) / double(px_h)};
+    // The default Trafo flips the Y axis, which puts the raster origin into the
+    // top left corner as expected from an image.
+    std::unique_ptr<sla::RasterBase> raster = sla::create_raster_grayscale_aa(res, pxdim);
+    for (ExPolygon &expoly : merged) {
+        expoly.translate(- bbox.min);
+        raster->draw(expoly);
+    }
+    return raster->encode(sla::PNGRasterEncoder{});
+}
+
+} // namespace Slic3r
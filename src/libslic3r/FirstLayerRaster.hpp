@@ -0,0 +1,19 @@
+#ifndef slic3r_FirstLayerRaster_hpp_
+#define slic3r_FirstLayerRaster_hpp_
+
+#include "SLA/RasterBase.hpp"
+
+namespace Slic3r {
+
+class Print;
+
+// Rasterize all first layer extrusions of a sliced FFF print (perimeters, infills,
+// supports, skirt and brim) into a single anti-aliased grayscale image, encoded as PNG.
+// The image is cropped to the bounding box of the first layer extrusions with a small
+// margin and the longer side of the bounding box is mapped to long_side_px pixels.
+// Returns an empty raster if no first layer extrusion exists.
+sla::EncodedRaster rasterize_first_layer(const Print &print, size_t long_side_px = 4096);
+
+} // namespace Slic3r
+
+#endif // slic3r_FirstLayerRaster_hpp_
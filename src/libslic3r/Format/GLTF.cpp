@@ -0,0 +1,239 @@
+#include "../libslic3r.h"
+#include "../Model.hpp"
+#include "../TriangleMesh.hpp"
+
+#include "GLTF.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdio.hpp>
+
+#include <tbb/parallel_for.h>
+
+#include "nlohmann/json.hpp"
+
+namespace Slic3r {
+
+using json = nlohmann::json;
+
+namespace {
+
+// Binary payload of a single object: quantized vertex positions followed by the
+// 4 byte aligned index buffer, with the metadata needed to emit the accessors
+// and the dequantization transform.
+struct ObjectBuffers
+{
+    std::vector<unsigned char> data;
+    size_t                     index_offset { 0 };
+    size_t                     vertex_count { 0 };
+    size_t                     index_count { 0 };
+    Vec3d                      decode_offset { Vec3d::Zero() };
+    Vec3d                      decode_scale { Vec3d::Ones() };
+    // Maximum quantized coordinate per axis, required by the POSITION accessor.
+    std::array<int, 3>         max_quantized { 0, 0, 0 };
+};
+
+ObjectBuffers encode_object(const indexed_triangle_set &its)
+{
+    ObjectBuffers out;
+    out.vertex_count = its.vertices.size();
+    out.index_count  = its.indices.size() * 3;
+
+    Vec3f bmin = its.vertices.front();
+    Vec3f bmax = bmin;
+    for (const Vec3f &v : its.vertices) {
+        bmin = bmin.cwiseMin(v);
+        bmax = bmax.cwiseMax(v);
+    }
+    out.decode_offset = bmin.cast<double>();
+    Vec3f extent = bmax - bmin;
+    Vec3f qscale;
+    for (int i = 0; i < 3; ++ i)
+        if (extent(i) > 0.f) {
+            qscale(i)           = 65535.f / extent(i);
+            out.decode_scale(i) = double(extent(i)) / 65535.;
+            out.max_quantized[i] = 65535;
+        } else {
+            // Degenerate axis, all the quantized coordinates collapse to zero.
+            qscale(i)           = 0.f;
+            out.decode_scale(i) = 1.;
+            out.max_quantized[i] = 0;
+        }
+
+    const size_t vertices_size = out.vertex_count * 3 * sizeof(uint16_t);
+    // Pad the vertex section to a 4 byte boundary in front of the index buffer.
+    out.index_offset = (vertices_size + 3) & ~size_t(3);
+    out.data.assign(out.index_offset + out.index_count * sizeof(uint32_t), 0);
+
+    uint16_t *qpos = reinterpret_cast<uint16_t*>(out.data.data());
+    for (const Vec3f &v : its.vertices) {
+        for (int i = 0; i < 3; ++ i)
+            *qpos ++ = uint16_t(std::clamp(int(std::lround((v(i) - bmin(i)) * qscale(i))), 0, 65535));
+    }
+    uint32_t *idx = reinterpret_cast<uint32_t*>(out.data.data() + out.index_offset);
+    for (const Vec3i &face : its.indices)
+        for (int i = 0; i < 3; ++ i)
+            *idx ++ = uint32_t(face(i));
+
+    return out;
+}
+
+json matrix_to_json(const Transform3d &trafo)
+{
+    // glTF stores matrices in column major order, same as Eigen.
+    json out = json::array();
+    const double *data = trafo.matrix().data();
+    for (int i = 0; i < 16; ++ i)
+        out.push_back(data[i]);
+    return out;
+}
+
+} // namespace
+
+bool store_gltf(const char *path, Model *model)
+{
+    // Collect the objects with printable geometry, one shared mesh per object.
+    std::vector<const ModelObject*>   objects;
+    std::vector<indexed_triangle_set> meshes(model->objects.size());
+    for (const ModelObject *object : model->objects) {
+        indexed_triangle_set its = object->raw_indexed_triangle_set();
+        if (! its.indices.empty()) {
+            meshes[objects.size()] = std::move(its);
+            objects.emplace_back(object);
+        }
+    }
+    meshes.resize(objects.size());
+    if (objects.empty()) {
+        BOOST_LOG_TRIVIAL(error) << "store_gltf: no geometry to export";
+        return false;
+    }
+
+    // Quantize and encode the object meshes in parallel.
+    std::vector<ObjectBuffers> buffers(objects.size());
+    tbb::parallel_for(size_t(0), objects.size(), [&meshes, &buffers](size_t idx) {
+        buffers[idx] = encode_object(meshes[idx]);
+    });
+
+    // Concatenate the per object payloads into the single glTF buffer.
+    size_t bin_size = 0;
+    for (const ObjectBuffers &b : buffers)
+        bin_size += (b.data.size() + 3) & ~size_t(3);
+    std::vector<unsigned char> bin;
+    bin.reserve(bin_size);
+
+    json json_buffer_views = json::array();
+    json json_accessors    = json::array();
+    json json_meshes       = json::array();
+    json json_nodes        = json::array();
+
+    // Root node converting the Z-up scene into the Y-up convention of glTF.
+    json_nodes.push_back({
+        { "name",     "plate" },
+        { "matrix",   json::array({ 1., 0., 0., 0.,  0., 0., -1., 0.,  0., 1., 0., 0.,  0., 0., 0., 1. }) },
+        { "children", json::array() }
+    });
+
+    for (size_t idx = 0; idx < objects.size(); ++ idx) {
+        const ModelObject   *object = objects[idx];
+        const ObjectBuffers &b      = buffers[idx];
+        const size_t         base   = bin.size();
+        bin.insert(bin.end(), b.data.begin(), b.data.end());
+        bin.resize((bin.size() + 3) & ~size_t(3), 0);
+
+        const int vertex_view = int(json_buffer_views.size());
+        json_buffer_views.push_back({
+            { "buffer", 0 },
+            { "byteOffset", base },
+            { "byteLength", b.vertex_count * 3 * sizeof(uint16_t) },
+            { "target", 34962 } // ARRAY_BUFFER
+        });
+        json_buffer_views.push_back({
+            { "buffer", 0 },
+            { "byteOffset", base + b.index_offset },
+            { "byteLength", b.index_count * sizeof(uint32_t) },
+            { "target", 34963 } // ELEMENT_ARRAY_BUFFER
+        });
+
+        const int position_accessor = int(json_accessors.size());
+        json_accessors.push_back({
+            { "bufferView", vertex_view },
+            { "componentType", 5123 }, // UNSIGNED_SHORT
+            { "count", b.vertex_count },
+            { "type", "VEC3" },
+            { "min", json::array({ 0, 0, 0 }) },
+            { "max", json::array({ b.max_quantized[0], b.max_quantized[1], b.max_quantized[2] }) }
+        });
+        json_accessors.push_back({
+            { "bufferView", vertex_view + 1 },
+            { "componentType", 5125 }, // UNSIGNED_INT
+            { "count", b.index_count },
+            { "type", "SCALAR" }
+        });
+
+        const int mesh_id = int(json_meshes.size());
+        json_meshes.push_back({
+            { "name", object->name },
+            { "primitives", json::array({ {
+                { "attributes", { { "POSITION", position_accessor } } },
+                { "indices", position_accessor + 1 },
+                { "mode", 4 } // TRIANGLES
+            } }) }
+        });
+
+        // One node per instance, the node transform dequantizes the mesh and places
+        // the instance on the plate.
+        const Transform3d dequant = Transform3d(Eigen::Translation3d(b.decode_offset)) *
+                                    Eigen::Scaling(b.decode_scale);
+        for (const ModelInstance *instance : object->instances) {
+            json_nodes[0]["children"].push_back(int(json_nodes.size()));
+            json_nodes.push_back({
+                { "name", object->name },
+                { "mesh", mesh_id },
+                { "matrix", matrix_to_json(instance->get_matrix() * dequant) }
+            });
+        }
+    }
+
+    json gltf = {
+        { "asset", { { "version", "2.0" }, { "generator", std::string(SLIC3R_APP_NAME) + " " + std::string(SLIC3R_VERSION) } } },
+        { "extensionsUsed", json::array({ "KHR_mesh_quantization" }) },
+        { "extensionsRequired", json::array({ "KHR_mesh_quantization" }) },
+        { "scene", 0 },
+        { "scenes", json::array({ { { "nodes", json::array({ 0 }) } } }) },
+        { "nodes", json_nodes },
+        { "meshes", json_meshes },
+        { "accessors", json_accessors },
+        { "bufferViews", json_buffer_views },
+        { "buffers", json::array({ { { "byteLength", bin.size() } } }) }
+    };
+
+    std::string json_text = gltf.dump();
+    // Chunks of a GLB container are 4 byte aligned, the JSON chunk is padded with spaces.
+    json_text.resize((json_text.size() + 3) & ~size_t(3), ' ');
+
+    FILE *file = boost::nowide::fopen(path, "wb");
+    if (file == nullptr) {
+        BOOST_LOG_TRIVIAL(error) << "store_gltf: failed to open " << path << " for writing";
+        return false;
+    }
+    auto write_u32 = [file](uint32_t value) { fwrite(&value, sizeof(value), 1, file); };
+    write_u32(0x46546C67); // "glTF"
+    write_u32(2);          // container version
+    write_u32(uint32_t(12 + 8 + json_text.size() + 8 + bin.size()));
+    write_u32(uint32_t(json_text.size()));
+    write_u32(0x4E4F534A); // "JSON"
+    fwrite(json_text.data(), 1, json_text.size(), file);
+    write_u32(uint32_t(bin.size()));
+    write_u32(0x004E4942); // "BIN"
+    bool success = fwrite(bin.data(), 1, bin.size(), file) == bin.size();
+    success &= fclose(file) == 0;
+    return success;
+}
+
+} // namespace Slic3r
@@ -0,0 +1,16 @@
+#ifndef slic3r_Format_GLTF_hpp_
+#define slic3r_Format_GLTF_hpp_
+
+namespace Slic3r {
+
+class Model;
+
+// Store the plated scene as a binary glTF 2.0 file (.glb) for lightweight preview.
+// Geometry is shared between instances of the same object and vertex positions are
+// quantized to 16 bit integers (KHR_mesh_quantization), dequantized by the node
+// transforms. Meshes of the individual objects are encoded in parallel.
+extern bool store_gltf(const char *path, Model *model);
+
+} // namespace Slic3r
+
+#endif /* slic3r_Format_GLTF_hpp_ */
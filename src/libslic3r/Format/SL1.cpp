@@ -505,8 +505,11 @@ void SL1Archive::export_print(Zipper& zipper,
 
             std::string imgname = project + string_printf("%.5d", i++) + "." +
                                   rst.extension();
-            
-            zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
+
+            // The layer images are already deflate compressed PNG payloads,
+            // store them verbatim instead of deflating them a second time.
+            zipper.add_entry(imgname.c_str(), rst.data(), rst.size(),
+                             Zipper::NO_COMPRESSION);
         }
     } catch(std::exception& e) {
         BOOST_LOG_TRIVIAL(error) << e.what();
@@ -1,11 +1,20 @@
 #include "../libslic3r.h"
 #include "../Model.hpp"
 #include "../TriangleMesh.hpp"
+#include "../Utils.hpp"
 
 #include "STEP.hpp"
 
+#include <map>
 #include <string>
 
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
 #ifdef _WIN32
 #define DIR_SEPARATOR '\\'
 #else
@@ -23,7 +32,6 @@
 #include "TopoDS_Builder.hxx"
 #include "TopoDS.hxx"
 #include "TDataStd_Name.hxx"
-#include "BRepBuilderAPI_Transform.hxx"
 #include "TopExp_Explorer.hxx"
 #include "TopExp_Explorer.hxx"
 #include "BRep_Tool.hxx"
@@ -193,16 +201,14 @@ static void getNamedSolids(const TopLoc_Location& location, const std::string& p
         TopoDS_Shape shape;
         shapeTool->GetShape(referredLabel, shape);
         TopAbs_ShapeEnum shape_type = shape.ShapeType();
-        BRepBuilderAPI_Transform transform(shape, localLocation, Standard_True);
         switch (shape_type) {
         case TopAbs_COMPOUND:
-            namedSolids.emplace_back(TopoDS::Compound(transform.Shape()), fullName);
-            break;
         case TopAbs_COMPSOLID:
-            namedSolids.emplace_back(TopoDS::CompSolid(transform.Shape()), fullName);
-            break;
         case TopAbs_SOLID:
-            namedSolids.emplace_back(TopoDS::Solid(transform.Shape()), fullName);
+            // BBS: move the shape to its location instead of deep-copying the transformed
+            // geometry; instances of the same part keep sharing the underlying TShape, so
+            // each part needs to be tessellated only once whatever its instance count is
+            namedSolids.emplace_back(shape.Moved(localLocation), fullName);
             break;
         default:
             break;
@@ -210,6 +216,86 @@ static void getNamedSolids(const TopLoc_Location& location, const std::string& p
     }
 }
 
+//BBS: on-disk cache of tessellated step models under the data dir, keyed by the
+// md5 of the file content. PLM systems regenerate byte-identical exports, so
+// re-importing those can skip the whole read/transfer/tessellate pipeline.
+static constexpr const unsigned int STEP_IMPORT_CACHE_VERSION = 1;
+
+static std::string step_import_cache_path(const char *path)
+{
+    if (data_dir().empty())
+        return std::string();
+    std::string filename(path);
+    std::string md5;
+    if (!bbl_calc_md5(filename, md5))
+        return std::string();
+    boost::filesystem::path dir = boost::filesystem::path(data_dir()) / "import_cache";
+    boost::system::error_code ec;
+    if (!boost::filesystem::exists(dir, ec))
+        boost::filesystem::create_directories(dir, ec);
+    if (ec)
+        return std::string();
+    return (dir / (md5 + ".step")).string();
+}
+
+static bool load_step_import_cache(const std::string &cache_file, const char *path, Model *model)
+{
+    boost::system::error_code ec;
+    if (!boost::filesystem::exists(cache_file, ec))
+        return false;
+    ModelObject *new_object = nullptr;
+    try {
+        boost::nowide::ifstream ifs(cache_file, std::ios::binary);
+        cereal::BinaryInputArchive archive(ifs);
+        unsigned int version       = 0;
+        size_t       volumes_count = 0;
+        archive(version, volumes_count);
+        if (version != STEP_IMPORT_CACHE_VERSION || volumes_count == 0)
+            return false;
+        new_object = model->add_object();
+        const char *last_slash = strrchr(path, DIR_SEPARATOR);
+        new_object->name.assign((last_slash == nullptr) ? path : last_slash + 1);
+        new_object->input_file = path;
+        for (size_t i = 0; i < volumes_count; ++i) {
+            std::string  name;
+            TriangleMesh mesh;
+            archive(name, mesh);
+            ModelVolume *new_volume       = new_object->add_volume(std::move(mesh));
+            new_volume->name              = name;
+            new_volume->source.input_file = path;
+            new_volume->source.object_idx = (int) model->objects.size() - 1;
+            new_volume->source.volume_idx = (int) new_object->volumes.size() - 1;
+        }
+        BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": reused import cache %1%") % cache_file;
+        return true;
+    } catch (...) {
+        //BBS: stale or truncated cache, drop it and run the real import
+        if (new_object != nullptr)
+            model->delete_object(new_object);
+        boost::filesystem::remove(cache_file, ec);
+        return false;
+    }
+}
+
+static void save_step_import_cache(const std::string &cache_file, const ModelObject &object)
+{
+    boost::system::error_code ec;
+    std::string cache_file_tmp = cache_file + ".tmp";
+    try {
+        {
+            boost::nowide::ofstream ofs(cache_file_tmp, std::ios::binary | std::ios::trunc);
+            cereal::BinaryOutputArchive archive(ofs);
+            archive(STEP_IMPORT_CACHE_VERSION, object.volumes.size());
+            for (const ModelVolume *volume : object.volumes)
+                archive(volume->name, volume->mesh());
+        }
+        //BBS: the rename keeps a concurrent import from seeing a half written cache
+        boost::filesystem::rename(cache_file_tmp, cache_file, ec);
+    } catch (...) {
+        boost::filesystem::remove(cache_file_tmp, ec);
+    }
+}
+
 bool load_step(const char *path, Model *model, bool& is_cancel, ImportStepProgressFn stepFn, StepIsUtf8Fn isUtf8Fn)
 {
     bool cb_cancel = false;
@@ -223,6 +309,12 @@ bool load_step(const char *path, Model *model, bool& is_cancel, ImportStepProgre
 
     if (!StepPreProcessor::isUtf8File(path) && isUtf8Fn)
         isUtf8Fn(false);
+
+    //BBS: identical file content was imported before, reuse its tessellation
+    std::string cache_file = step_import_cache_path(path);
+    if (!cache_file.empty() && load_step_import_cache(cache_file, path, model))
+        return true;
+
     std::string file_after_preprocess = std::string(path);
 
     std::vector<NamedSolid> namedSolids;
@@ -261,11 +353,26 @@ bool load_step(const char *path, Model *model, bool& is_cancel, ImportStepProgre
         getNamedSolids(TopLoc_Location{}, "", id, shapeTool, topLevelShapes.Value(iLabel), namedSolids);
     }
 
+    // BBS: tessellate each distinct part only once; assemblies usually instance the
+    // same solid many times and the instances share the underlying TShape. The
+    // triangulation is stored on the shared faces, so it must not be computed
+    // concurrently from several instances either.
+    std::vector<size_t> unique_solids;
+    {
+        std::map<const void*, size_t> first_of_shape;
+        for (size_t i = 0; i < namedSolids.size(); ++i)
+            if (first_of_shape.emplace(namedSolids[i].solid.TShape().get(), i).second)
+                unique_solids.emplace_back(i);
+    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, unique_solids.size()), [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); i++)
+            BRepMesh_IncrementalMesh mesh(namedSolids[unique_solids[i]].solid, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
+    });
+
     std::vector<stl_file> stl;
     stl.resize(namedSolids.size());
     tbb::parallel_for(tbb::blocked_range<size_t>(0, namedSolids.size()), [&](const tbb::blocked_range<size_t> &range) {
         for (size_t i = range.begin(); i < range.end(); i++) {
-            BRepMesh_IncrementalMesh mesh(namedSolids[i].solid, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
             // BBS: calculate total number of the nodes and triangles
             int aNbNodes     = 0;
             int aNbTriangles = 0;
@@ -379,6 +486,10 @@ bool load_step(const char *path, Model *model, bool& is_cancel, ImportStepProgre
         return false;
     }
 
+    //BBS: remember the tessellation for the next import of the same content
+    if (!cache_file.empty())
+        save_step_import_cache(cache_file, *new_object);
+
     return true;
 }
 
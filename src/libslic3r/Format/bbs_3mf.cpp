@@ -19,6 +19,7 @@
 
 #include "bbs_3mf.hpp"
 
+#include <atomic>
 #include <limits>
 #include <stdexcept>
 #include <iomanip>
@@ -43,12 +44,28 @@
 namespace pt = boost::property_tree;
 
 #include <tbb/parallel_reduce.h>
+// Intel redesigned some TBB interface considerably when merging TBB with their oneAPI set of libraries, see GH #7332.
+// We are using quite an old TBB 2017 U7. Before we update our build servers, let's use the old API, which is deprecated in up to date TBB.
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if ! defined(TBB_VERSION_MAJOR)
+    static_assert(false, "TBB_VERSION_MAJOR not defined");
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
 
 #include <expat.h>
 #include <Eigen/Dense>
 #include "miniz_extension.hpp"
 #include "nlohmann/json.hpp"
 #include <fast_float/fast_float.h>
+#include <charconv>
 
 // Slightly faster than sprintf("%.9g"), but there is an issue with the karma floating point formatter,
 // https://github.com/boostorg/spirit/pull/586
@@ -142,6 +159,8 @@ const std::string MODEL_RELS_FILE = "3D/_rels/3dmodel.model.rels";
 const std::string METADATA_DIR = "Metadata/";
 const std::string ACCESOR_DIR = "accesories/";
 const std::string GCODE_EXTENSION = ".gcode";
+//BBS: binary cache of the processed gcode result, stored next to plate_N.gcode
+const std::string GCODE_RESULT_CACHE_EXTENSION = ".gcode.result";
 const std::string THUMBNAIL_EXTENSION = ".png";
 const std::string CALIBRATION_INFO_EXTENSION = ".json";
 const std::string CONTENT_TYPES_FILE = "[Content_Types].xml";
@@ -1769,6 +1788,10 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                     //load gcode files
                     _extract_file_from_archive(archive, stat);
                 }
+                else if (!dont_load_config && boost::algorithm::istarts_with(name, METADATA_DIR) && boost::algorithm::iends_with(name, GCODE_RESULT_CACHE_EXTENSION)) {
+                    //BBS: binary result cache of a gcode file, extract it next to the gcode
+                    _extract_file_from_archive(archive, stat);
+                }
                 else if (!dont_load_config && boost::algorithm::istarts_with(name, METADATA_DIR) && boost::algorithm::iends_with(name, THUMBNAIL_EXTENSION)) {
                     //BBS parsing pattern thumbnail and plate thumbnails
                     _extract_file_from_archive(archive, stat);
@@ -2961,7 +2984,13 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         bool res = true;
         unsigned int num_attributes = (unsigned int)XML_GetSpecifiedAttributeCount(m_xml_parser);
 
-        if (::strcmp(MODEL_TAG, name) == 0)
+        //BBS: almost all elements of a big model file are vertices and triangles,
+        //test those tags first instead of at the end of the chain
+        if (::strcmp(VERTEX_TAG, name) == 0)
+            res = _handle_start_vertex(attributes, num_attributes);
+        else if (::strcmp(TRIANGLE_TAG, name) == 0)
+            res = _handle_start_triangle(attributes, num_attributes);
+        else if (::strcmp(MODEL_TAG, name) == 0)
             res = _handle_start_model(attributes, num_attributes);
         else if (::strcmp(RESOURCES_TAG, name) == 0)
             res = _handle_start_resources(attributes, num_attributes);
@@ -2975,12 +3004,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             res = _handle_start_mesh(attributes, num_attributes);
         else if (::strcmp(VERTICES_TAG, name) == 0)
             res = _handle_start_vertices(attributes, num_attributes);
-        else if (::strcmp(VERTEX_TAG, name) == 0)
-            res = _handle_start_vertex(attributes, num_attributes);
         else if (::strcmp(TRIANGLES_TAG, name) == 0)
             res = _handle_start_triangles(attributes, num_attributes);
-        else if (::strcmp(TRIANGLE_TAG, name) == 0)
-            res = _handle_start_triangle(attributes, num_attributes);
         else if (::strcmp(COMPONENTS_TAG, name) == 0)
             res = _handle_start_components(attributes, num_attributes);
         else if (::strcmp(COMPONENT_TAG, name) == 0)
@@ -3003,7 +3028,13 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
 
         bool res = true;
 
-        if (::strcmp(MODEL_TAG, name) == 0)
+        //BBS: almost all elements of a big model file are vertices and triangles,
+        //test those tags first instead of at the end of the chain
+        if (::strcmp(VERTEX_TAG, name) == 0)
+            res = _handle_end_vertex();
+        else if (::strcmp(TRIANGLE_TAG, name) == 0)
+            res = _handle_end_triangle();
+        else if (::strcmp(MODEL_TAG, name) == 0)
             res = _handle_end_model();
         else if (::strcmp(RESOURCES_TAG, name) == 0)
             res = _handle_end_resources();
@@ -3017,12 +3048,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             res = _handle_end_mesh();
         else if (::strcmp(VERTICES_TAG, name) == 0)
             res = _handle_end_vertices();
-        else if (::strcmp(VERTEX_TAG, name) == 0)
-            res = _handle_end_vertex();
         else if (::strcmp(TRIANGLES_TAG, name) == 0)
             res = _handle_end_triangles();
-        else if (::strcmp(TRIANGLE_TAG, name) == 0)
-            res = _handle_end_triangle();
         else if (::strcmp(COMPONENTS_TAG, name) == 0)
             res = _handle_end_components();
         else if (::strcmp(COMPONENT_TAG, name) == 0)
@@ -5000,7 +5027,13 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
         bool res = true;
         unsigned int num_attributes = (unsigned int)XML_GetSpecifiedAttributeCount(object_xml_parser);
 
-        if (::strcmp(MODEL_TAG, name) == 0)
+        //BBS: almost all elements of a big model file are vertices and triangles,
+        //test those tags first instead of at the end of the chain
+        if (::strcmp(VERTEX_TAG, name) == 0)
+            res = _handle_object_start_vertex(attributes, num_attributes);
+        else if (::strcmp(TRIANGLE_TAG, name) == 0)
+            res = _handle_object_start_triangle(attributes, num_attributes);
+        else if (::strcmp(MODEL_TAG, name) == 0)
             res = _handle_object_start_model(attributes, num_attributes);
         else if (::strcmp(RESOURCES_TAG, name) == 0)
             res = _handle_object_start_resources(attributes, num_attributes);
@@ -5014,12 +5047,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             res = _handle_object_start_mesh(attributes, num_attributes);
         else if (::strcmp(VERTICES_TAG, name) == 0)
             res = _handle_object_start_vertices(attributes, num_attributes);
-        else if (::strcmp(VERTEX_TAG, name) == 0)
-            res = _handle_object_start_vertex(attributes, num_attributes);
         else if (::strcmp(TRIANGLES_TAG, name) == 0)
             res = _handle_object_start_triangles(attributes, num_attributes);
-        else if (::strcmp(TRIANGLE_TAG, name) == 0)
-            res = _handle_object_start_triangle(attributes, num_attributes);
         else if (::strcmp(COMPONENTS_TAG, name) == 0)
             res = _handle_object_start_components(attributes, num_attributes);
         else if (::strcmp(COMPONENT_TAG, name) == 0)
@@ -5038,7 +5067,13 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
 
         bool res = true;
 
-        if (::strcmp(MODEL_TAG, name) == 0)
+        //BBS: almost all elements of a big model file are vertices and triangles,
+        //test those tags first instead of at the end of the chain
+        if (::strcmp(VERTEX_TAG, name) == 0)
+            res = _handle_object_end_vertex();
+        else if (::strcmp(TRIANGLE_TAG, name) == 0)
+            res = _handle_object_end_triangle();
+        else if (::strcmp(MODEL_TAG, name) == 0)
             res = _handle_object_end_model();
         else if (::strcmp(RESOURCES_TAG, name) == 0)
             res = _handle_object_end_resources();
@@ -5052,12 +5087,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             res = _handle_object_end_mesh();
         else if (::strcmp(VERTICES_TAG, name) == 0)
             res = _handle_object_end_vertices();
-        else if (::strcmp(VERTEX_TAG, name) == 0)
-            res = _handle_object_end_vertex();
         else if (::strcmp(TRIANGLES_TAG, name) == 0)
             res = _handle_object_end_triangles();
-        else if (::strcmp(TRIANGLE_TAG, name) == 0)
-            res = _handle_object_end_triangle();
         else if (::strcmp(COMPONENTS_TAG, name) == 0)
             res = _handle_object_end_components();
         else if (::strcmp(COMPONENT_TAG, name) == 0)
@@ -6206,6 +6237,9 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
 
         bool cb_cancel = false;
         std::vector<std::string> object_paths;
+        //BBS: objects whose meshes still go into this model file; their xml is generated
+        // on worker threads and streamed into the archive in object order below
+        std::vector<ObjectData const *> objects_to_stream;
         // if (!m_skip_model) {
             for (ModelObject* obj : model.objects) {
                 if (sub_model && obj != objects_data.begin()->second.object) continue;
@@ -6275,11 +6309,16 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                     // Store geometry of all ModelVolumes contained in a single ModelObject into a single 3MF indexed triangle set object.
                     // object_it->second.volumes_objectID will contain the offsets of the ModelVolumes in that single indexed triangle set.
                     // object_id will be increased to point to the 1st instance of the next ModelObject.
-                    if (!_add_object_to_model_stream(context, object_it->second)) {
-                        add_error("Unable to add object to archive");
-                        BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", Unable to add object to archive\n");
-                        return false;
+                    if (sub_model) {
+                        if (!_add_object_to_model_stream(context, object_it->second)) {
+                            add_error("Unable to add object to archive");
+                            BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", Unable to add object to archive\n");
+                            return false;
+                        }
                     }
+                    else
+                        //BBS: map nodes are stable, the pointer survives later insertions
+                        objects_to_stream.emplace_back(&object_it->second);
                 }
 
                 if (sub_model) break;
@@ -6297,6 +6336,46 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             }
         // }
 
+        if (!objects_to_stream.empty()) {
+            //BBS: generating the mesh xml (float formatting mostly) costs about as much as
+            // deflating it; run the generation of the objects on worker threads and feed the
+            // staged zip writer in object order, keeping at most a few objects in flight
+            std::atomic<bool> failed{ false };
+            size_t next_object = 0;
+            tbb::parallel_pipeline(std::min(objects_to_stream.size(), size_t(8)),
+                tbb::make_filter<void, size_t>(slic3r_tbb_filtermode::serial_in_order,
+                    [&objects_to_stream, &failed, &next_object](tbb::flow_control &fc) -> size_t {
+                        if (next_object >= objects_to_stream.size() || failed) {
+                            fc.stop();
+                            return 0;
+                        }
+                        return next_object++;
+                    }) &
+                tbb::make_filter<size_t, std::string>(slic3r_tbb_filtermode::parallel,
+                    [this, &objects_to_stream, &failed](size_t i) -> std::string {
+                        CNumericLocalesSetter locales_setter;
+                        std::string buffer;
+                        auto flush = [&buffer](std::string &buf, bool force) {
+                            if (force)
+                                buffer = std::move(buf);
+                            return true;
+                        };
+                        if (!this->_add_mesh_to_object_stream(flush, *objects_to_stream[i]))
+                            failed = true;
+                        return buffer;
+                    }) &
+                tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
+                    [&context, &failed](std::string buffer) {
+                        if (!failed && !buffer.empty() && !mz_zip_writer_add_staged_data(&context, buffer.data(), buffer.size()))
+                            failed = true;
+                    }));
+            if (failed) {
+                add_error("Unable to add object to archive");
+                BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":" << __LINE__ << boost::format(", Unable to add object to archive\n");
+                return false;
+            }
+        }
+
         {
             std::stringstream stream;
             reset_stream(stream);
@@ -6504,6 +6583,11 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
             }
             // Return pointer to the end.
             return ptr;
+#elif defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+            //BBS: shortest round-trippable representation. Usually fewer digits than
+            //"%.9g", which shrinks the model file and speeds up both the export and
+            //the numeric parsing on re-import.
+            return std::to_chars(buf, buf + 32, f).ptr;
 #else
             // Round-trippable float, shortest possible.
             return buf + sprintf(buf, "%.9g", f);
@@ -6574,8 +6658,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                 boost::spirit::karma::generate(ptr, "\" z=\"");
                 ptr = format_coordinate(v.z(), ptr);
                 boost::spirit::karma::generate(ptr, "\"/>\n");
-                *ptr = '\0';
-                output_buffer += buf;
+                //BBS: the end of the formatted data is known, skip the strlen of operator +=
+                output_buffer.append(buf, ptr - buf);
                 if (!flush(output_buffer, false))
                     return false;
             }
@@ -6616,8 +6700,8 @@ void PlateData::parse_filament_info(GCodeProcessorResult *result)
                         idx[is_left_handed ? 2 : 0],
                         idx[1],
                         idx[is_left_handed ? 0 : 2]);
-                    *ptr = '\0';
-                    output_buffer += buf;
+                    //BBS: the end of the formatted data is known, skip the strlen of operator +=
+                    output_buffer.append(buf, ptr - buf);
                 }
 
                 std::string custom_supports_data_string = volume->supported_facets.get_triangle_as_string(i);
@@ -7494,6 +7578,14 @@ bool _BBS_3MF_Exporter::_add_gcode_file_to_archive(mz_zip_archive& archive, cons
             }
             mz_zip_reader_end(&archive);
             BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << ":" <<__LINE__ << boost::format(", store  %1% to 3mf %2%\n") % src_gcode_file % gcode_in_3mf;
+            //BBS: also pack the binary result cache when the processor saved one next to the
+            //gcode, so reopening the project does not have to re-process plate_N.gcode.
+            //Best effort only, the project stays valid without it.
+            std::string result_cache_file = src_gcode_file + GCodeProcessorResult::BinaryCacheExtension;
+            if (boost::filesystem::exists(result_cache_file)) {
+                boost::unique_lock l(mutex);
+                _add_file_to_archive(root_archive, gcode_in_3mf + GCodeProcessorResult::BinaryCacheExtension, result_cache_file);
+            }
         }
     });
     return result;
@@ -7807,19 +7899,24 @@ private:
 
     void push_task(Task const & t) {
         boost::unique_lock lock(m_mutex);
-        if (t.delay && !m_tasks.empty() && m_tasks.back() == t) {
-            auto t2 = m_tasks.back();
-            m_tasks.back() = t;
-            m_tasks.back().delay = t2.delay + 1;
-            m_cond.notify_all();
-            lock.unlock();
-            process_ui_task(t2);
-        }
-        else {
-            m_tasks.push_back(t);
-            ++m_task_seq;
-            m_cond.notify_all();
+        if (t.delay && !m_tasks.empty()) {
+            // BBS: a pending snapshot of the same object is superseded by this one;
+            // replace it in place (not only at the back, editing two objects
+            // alternately must not queue redundant clones & serializations)
+            auto iter = find(m_tasks.begin(), m_tasks.end(), t);
+            if (iter != m_tasks.end()) {
+                auto t2 = *iter;
+                *iter = t;
+                iter->delay = t2.delay + 1;
+                m_cond.notify_all();
+                lock.unlock();
+                process_ui_task(t2);
+                return;
+            }
         }
+        m_tasks.push_back(t);
+        ++m_task_seq;
+        m_cond.notify_all();
     }
 
     void process_ui_task(Task& t, bool canceled = false) {
@@ -8,8 +8,21 @@
 
 #include "libslic3r/LocalesUtils.hpp"
 
+#include <fast_float/fast_float.h>
+
 namespace ObjParser {
 
+// BBS: strtod drags in locale handling and dominates the import time of large
+// files; parse the coordinates with the same fast_float parser used elsewhere.
+// Keeps the strtod contract relied on below: on failure it returns 0 and sets
+// *endptr to the input pointer.
+static double obj_strtod(const char *line, char **endptr)
+{
+	double value = 0.;
+	*endptr = const_cast<char*>(fast_float::from_chars(line, line + strlen(line), value).ptr);
+	return value;
+}
+
 static bool obj_parseline(const char *line, ObjData &data)
 {
 #define EATWS() while (*line == ' ' || *line == '\t') ++ line
@@ -42,14 +55,14 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double u = strtod(line, &endptr);
+			double u = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
 			double v = 0;
 			if (*line != 0) {
-				v = strtod(line, &endptr);
+				v = obj_strtod(line, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -57,7 +70,7 @@ static bool obj_parseline(const char *line, ObjData &data)
 			}
 			double w = 0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = obj_strtod(line, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -79,17 +92,17 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double x = strtod(line, &endptr);
+			double x = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double y = strtod(line, &endptr);
+			double y = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double z = strtod(line, &endptr);
+			double z = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
@@ -109,19 +122,19 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double u = strtod(line, &endptr);
+			double u = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
-			double v = strtod(line, &endptr);
+			double v = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
 			double w = 0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = obj_strtod(line, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
@@ -141,24 +154,24 @@ static bool obj_parseline(const char *line, ObjData &data)
 				return false;
 			EATWS();
 			char *endptr = 0;
-			double x = strtod(line, &endptr);
+			double x = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double y = strtod(line, &endptr);
+			double y = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t'))
 				return false;
 			line = endptr;
 			EATWS();
-			double z = strtod(line, &endptr);
+			double z = obj_strtod(line, &endptr);
 			if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 				return false;
 			line = endptr;
 			EATWS();
 			double w = 1.0;
 			if (*line != 0) {
-				w = strtod(line, &endptr);
+				w = obj_strtod(line, &endptr);
 				if (endptr == 0 || (*endptr != ' ' && *endptr != '\t' && *endptr != 0))
 					return false;
 				line = endptr;
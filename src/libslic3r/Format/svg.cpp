@@ -8,6 +8,7 @@
 #include <string>
 
 #include <boost/log/trivial.hpp>
+#include <tbb/parallel_for.h>
 
 #include "BRepBuilderAPI_MakeWire.hxx"
 #include "BRepBuilderAPI_MakeEdge.hxx"
@@ -308,78 +309,80 @@ bool load_svg(const char *path, Model *model, std::string &message)
 
     std::vector<stl_file> stl;
     stl.resize(namedSolids.size());
-    // todo: zhimin, Can be accelerated in parallel with tbb 
-    for (size_t i = 0 ; i < namedSolids.size(); i++) {
-        BRepMesh_IncrementalMesh mesh(namedSolids[i].shape, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
-        // BBS: calculate total number of the nodes and triangles
-        int aNbNodes     = 0;
-        int aNbTriangles = 0;
-        for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
-            TopLoc_Location aLoc;
-            Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(anExpSF.Current()), aLoc);
-            if (!aTriangulation.IsNull()) {
-                aNbNodes += aTriangulation->NbNodes();
-                aNbTriangles += aTriangulation->NbTriangles();
+    // BBS: each svg shape is an independent extrusion, tessellate them in parallel like STEP import does
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, namedSolids.size()), [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); i++) {
+            BRepMesh_IncrementalMesh mesh(namedSolids[i].shape, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
+            // BBS: calculate total number of the nodes and triangles
+            int aNbNodes     = 0;
+            int aNbTriangles = 0;
+            for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
+                TopLoc_Location aLoc;
+                Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(anExpSF.Current()), aLoc);
+                if (!aTriangulation.IsNull()) {
+                    aNbNodes += aTriangulation->NbNodes();
+                    aNbTriangles += aTriangulation->NbTriangles();
+                }
             }
-        }
-
-        if (aNbTriangles == 0 || aNbNodes == 0)
-            // BBS: No triangulation on the shape.
-            continue;
-
-        stl[i].stats.type                = inmemory;
-        stl[i].stats.number_of_facets    = (uint32_t) aNbTriangles;
-        stl[i].stats.original_num_facets = stl[i].stats.number_of_facets;
-        stl_allocate(&stl[i]);
-
-        std::vector<Vec3f> points;
-        points.reserve(aNbNodes);
-        // BBS: count faces missing triangulation
-        Standard_Integer aNbFacesNoTri = 0;
-        // BBS: fill temporary triangulation
-        Standard_Integer aNodeOffset    = 0;
-        Standard_Integer aTriangleOffet = 0;
-        for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
-            const TopoDS_Shape &aFace = anExpSF.Current();
-            TopLoc_Location     aLoc;
-            Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(aFace), aLoc);
-            if (aTriangulation.IsNull()) {
-                ++aNbFacesNoTri;
+    
+            if (aNbTriangles == 0 || aNbNodes == 0)
+                // BBS: No triangulation on the shape.
                 continue;
+    
+            stl[i].stats.type                = inmemory;
+            stl[i].stats.number_of_facets    = (uint32_t) aNbTriangles;
+            stl[i].stats.original_num_facets = stl[i].stats.number_of_facets;
+            stl_allocate(&stl[i]);
+    
+            std::vector<Vec3f> points;
+            points.reserve(aNbNodes);
+            // BBS: count faces missing triangulation
+            Standard_Integer aNbFacesNoTri = 0;
+            // BBS: fill temporary triangulation
+            Standard_Integer aNodeOffset    = 0;
+            Standard_Integer aTriangleOffet = 0;
+            for (TopExp_Explorer anExpSF(namedSolids[i].shape, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
+                const TopoDS_Shape &aFace = anExpSF.Current();
+                TopLoc_Location     aLoc;
+                Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(aFace), aLoc);
+                if (aTriangulation.IsNull()) {
+                    ++aNbFacesNoTri;
+                    continue;
+                }
+                // BBS: copy nodes
+                gp_Trsf aTrsf = aLoc.Transformation();
+                for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter) {
+                    gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
+                    aPnt.Transform(aTrsf);
+                    points.emplace_back(std::move(Vec3f(aPnt.X(), aPnt.Y(), aPnt.Z())));
+                }
+                // BBS: copy triangles
+                const TopAbs_Orientation anOrientation = anExpSF.Current().Orientation();
+                Standard_Integer         anId[3];
+                for (Standard_Integer aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter) {
+                    Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
+    
+                    aTri.Get(anId[0], anId[1], anId[2]);
+                    if (anOrientation == TopAbs_REVERSED) std::swap(anId[1], anId[2]);
+                    // BBS: save triangles facets
+                    stl_facet facet;
+                    facet.vertex[0] = points[anId[0] + aNodeOffset - 1].cast<float>();
+                    facet.vertex[1] = points[anId[1] + aNodeOffset - 1].cast<float>();
+                    facet.vertex[2] = points[anId[2] + aNodeOffset - 1].cast<float>();
+                    facet.extra[0]  = 0;
+                    facet.extra[1]  = 0;
+                    stl_normal normal;
+                    stl_calculate_normal(normal, &facet);
+                    stl_normalize_vector(normal);
+                    facet.normal                                      = normal;
+                    stl[i].facet_start[aTriangleOffet + aTriIter - 1] = facet;
+                }
+    
+                aNodeOffset += aTriangulation->NbNodes();
+                aTriangleOffet += aTriangulation->NbTriangles();
             }
-            // BBS: copy nodes
-            gp_Trsf aTrsf = aLoc.Transformation();
-            for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter) {
-                gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
-                aPnt.Transform(aTrsf);
-                points.emplace_back(std::move(Vec3f(aPnt.X(), aPnt.Y(), aPnt.Z())));
-            }
-            // BBS: copy triangles
-            const TopAbs_Orientation anOrientation = anExpSF.Current().Orientation();
-            Standard_Integer         anId[3];
-            for (Standard_Integer aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter) {
-                Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
-
-                aTri.Get(anId[0], anId[1], anId[2]);
-                if (anOrientation == TopAbs_REVERSED) std::swap(anId[1], anId[2]);
-                // BBS: save triangles facets
-                stl_facet facet;
-                facet.vertex[0] = points[anId[0] + aNodeOffset - 1].cast<float>();
-                facet.vertex[1] = points[anId[1] + aNodeOffset - 1].cast<float>();
-                facet.vertex[2] = points[anId[2] + aNodeOffset - 1].cast<float>();
-                facet.extra[0]  = 0;
-                facet.extra[1]  = 0;
-                stl_normal normal;
-                stl_calculate_normal(normal, &facet);
-                stl_normalize_vector(normal);
-                facet.normal                                      = normal;
-                stl[i].facet_start[aTriangleOffet + aTriIter - 1] = facet;
-            }
-
-            aNodeOffset += aTriangulation->NbNodes();
-            aTriangleOffet += aTriangulation->NbTriangles();
         }
-    }
+    });
 
     ModelObject *new_object = model->add_object();
     // new_object->name ?
@@ -14,6 +14,7 @@
 #include "ShortestPath.hpp"
 #include "Print.hpp"
 #include "Utils.hpp"
+#include "ChromeTrace.hpp"
 #include "ClipperUtils.hpp"
 #include "libslic3r.h"
 #include "LocalesUtils.hpp"
@@ -64,6 +65,12 @@
 
 #include <Shiny/Shiny.h>
 
+// When defined (together with SLIC3R_PROFILE), the profiler is cleared before and
+// dumped after every G-code export, which also discards the zones recorded by the
+// preceding slicing steps. Keep it off to let the whole pipeline accumulate into
+// a single zone tree, dumped by the --profile-output command line option.
+//#define GCODE_EXPORT_PROFILE
+
 #include "miniz_extension.hpp"
 
 using namespace std::literals::string_view_literals;
@@ -1442,7 +1449,9 @@ bool GCode::is_BBL_Printer()
 
 void GCode::do_export(Print* print, const char* path, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb)
 {
+#ifdef GCODE_EXPORT_PROFILE
     PROFILE_CLEAR();
+#endif
 
     // BBS
     m_curr_print = print;
@@ -1490,7 +1499,7 @@ void GCode::do_export(Print* print, const char* path, GCodeProcessorResult* resu
     path_tmp += ".tmp";
 
     m_processor.initialize(path_tmp);
-    GCodeOutputStream file(boost::nowide::fopen(path_tmp.c_str(), "wb"), m_processor);
+    GCodeOutputStream file(boost::nowide::fopen(path_tmp.c_str(), "wb"), m_processor, m_stream_post_processor_chain.get());
     if (! file.is_open()) {
         BOOST_LOG_TRIVIAL(error) << std::string("G-code export to ") + path + " failed.\nCannot open the file for writing.\n" << std::endl;
         if (!fs::exists(folder)) {
@@ -1559,9 +1568,11 @@ void GCode::do_export(Print* print, const char* path, GCodeProcessorResult* resu
     if(is_BBL_Printer())
         result->label_object_enabled = m_enable_exclude_object;
 
+#ifdef GCODE_EXPORT_PROFILE
     // Write the profiler measurements to file
     PROFILE_UPDATE();
     PROFILE_OUTPUT(debug_out_path("gcode-export-profile.txt").c_str());
+#endif
 }
 
 // free functions called by GCode::_do_export()
@@ -1797,6 +1808,7 @@ static BambuBedType to_bambu_bed_type(BedType type)
 void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGeneratorCallback thumbnail_cb)
 {
     PROFILE_FUNC();
+    ChromeTraceSpan trace_span("GCode::_do_export");
 
     // modifies m_silent_time_estimator_enabled
     DoExport::init_gcode_processor(print.config(), m_processor, m_silent_time_estimator_enabled);
@@ -2109,6 +2121,11 @@ void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGenerato
     m_cooling_buffer = make_unique<CoolingBuffer>(*this);
     m_cooling_buffer->set_current_extruder(initial_extruder_id);
 
+    if (auto pa = make_unique<PerFeaturePressureAdvance>(m_writer, print.config()); pa->enabled()) {
+        m_per_feature_pa = std::move(pa);
+        m_per_feature_pa->set_current_extruder(initial_extruder_id);
+    }
+
     // Emit machine envelope limits for the Marlin firmware.
     this->print_machine_envelope(file, print);
 
@@ -2642,9 +2659,18 @@ void GCode::process_layers(
     GCodeOutputStream                                                   &output_stream)
 {
     // The pipeline is variable: The vase mode filter is optional.
+    // A layer fetched by the serial generator stage, with the avoid crossing perimeters geometry
+    // caches precomputed by the parallel stage running in front of the serial G-code generation stage.
+    struct LayerInFlight {
+        const std::pair<coordf_t, std::vector<LayerToPrint>>  *layer { nullptr };
+        const LayerTools                                      *layer_tools { nullptr };
+        bool                                                   nop { false };
+        bool                                                   last { false };
+        std::vector<std::pair<const Layer*, AvoidCrossingPerimeters::LayerGeometry>> geometries;
+    };
     size_t layer_to_print_idx = 0;
-    const auto generator = tbb::make_filter<void, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &tool_ordering, &print_object_instances_ordering, &layers_to_print, &layer_to_print_idx](tbb::flow_control& fc) -> LayerResult {
+    const auto generator = tbb::make_filter<void, LayerInFlight>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &tool_ordering, &layers_to_print, &layer_to_print_idx](tbb::flow_control& fc) -> LayerInFlight {
             if (layer_to_print_idx >= layers_to_print.size()) {
             	if ((!m_pressure_equalizer && layer_to_print_idx == layers_to_print.size()) || (m_pressure_equalizer && layer_to_print_idx == (layers_to_print.size() + 1))) {
                     fc.stop();
@@ -2653,7 +2679,9 @@ void GCode::process_layers(
                     // Pressure equalizer need insert empty input. Because it returns one layer back.
                     // Insert NOP (no operation) layer;
                     ++layer_to_print_idx;
-                    return LayerResult::make_nop_layer_result();
+                    LayerInFlight nop;
+                    nop.nop = true;
+                    return nop;
                 }
             } else {
                 const std::pair<coordf_t, std::vector<LayerToPrint>>& layer = layers_to_print[layer_to_print_idx++];
@@ -2664,10 +2692,33 @@ void GCode::process_layers(
                 //BBS
                 check_placeholder_parser_failed();
                 print.throw_if_canceled();
-                return this->process_layer(print, layer.second, layer_tools, &layer == &layers_to_print.back(), &print_object_instances_ordering, size_t(-1));
+                LayerInFlight out;
+                out.layer       = &layer;
+                out.layer_tools = &layer_tools;
+                out.last        = &layer == &layers_to_print.back();
+                return out;
             }
         });
-   
+    // Precompute the geometry caches of the avoid crossing perimeters machinery for the layers in flight.
+    // These only depend on the layer geometry, thus they are calculated on many cores ahead of the
+    // serial G-code generation stage, which consumes them through init_layer().
+    const auto precompute = tbb::make_filter<LayerInFlight, LayerInFlight>(slic3r_tbb_filtermode::parallel,
+        [](LayerInFlight in) -> LayerInFlight {
+            if (! in.nop)
+                for (const LayerToPrint &layer_to_print : in.layer->second)
+                    if (const Layer *layer = layer_to_print.layer(); layer != nullptr && layer->object()->config().reduce_crossing_wall)
+                        if (std::none_of(in.geometries.begin(), in.geometries.end(), [layer](const auto &g) { return g.first == layer; }))
+                            in.geometries.emplace_back(layer, AvoidCrossingPerimeters::compute_layer_geometry(*layer));
+            return in;
+        });
+    const auto process = tbb::make_filter<LayerInFlight, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &print_object_instances_ordering](LayerInFlight in) -> LayerResult {
+            if (in.nop)
+                return LayerResult::make_nop_layer_result();
+            m_avoid_crossing_perimeters.seed_layer_geometries(std::move(in.geometries));
+            return this->process_layer(print, in.layer->second, *in.layer_tools, in.last, &print_object_instances_ordering, size_t(-1));
+        });
+
     const auto spiral_mode = tbb::make_filter<LayerResult, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [&spiral_mode = *this->m_spiral_vase.get()](LayerResult in) -> LayerResult {
         	if (in.nop_layer_result)
@@ -2710,15 +2761,22 @@ void GCode::process_layers(
         return in;
     });
 
+    // Inject per feature pressure advance commands at the feature tags. Serial as it keeps
+    // the last pressure advance value emitted across layers, pass-through when not configured.
+    const auto per_feature_pa = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [per_feature_pa = this->m_per_feature_pa.get()](std::string in) -> std::string {
+            return per_feature_pa == nullptr ? in : per_feature_pa->process_layer(std::move(in));
+        });
+
     // The pipeline elements are joined using const references, thus no copying is performed.
     if (m_spiral_vase && m_pressure_equalizer)
-        tbb::parallel_pipeline(12, generator & spiral_mode & pressure_equalizer & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & precompute & process & spiral_mode & pressure_equalizer & cooling & per_feature_pa & fan_mover & output);
     else if (m_spiral_vase)
-    	tbb::parallel_pipeline(12, generator & spiral_mode & cooling & fan_mover & output);
+    	tbb::parallel_pipeline(12, generator & precompute & process & spiral_mode & cooling & per_feature_pa & fan_mover & output);
     else if	(m_pressure_equalizer)
-        tbb::parallel_pipeline(12, generator & pressure_equalizer & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & precompute & process & pressure_equalizer & cooling & per_feature_pa & fan_mover & output);
     else
-    	tbb::parallel_pipeline(12, generator & cooling & fan_mover & output);
+    	tbb::parallel_pipeline(12, generator & precompute & process & cooling & per_feature_pa & fan_mover & output);
 }
 
 // Process all layers of a single object instance (sequential mode) with a parallel pipeline:
@@ -2734,9 +2792,17 @@ void GCode::process_layers(
     const bool                               prime_extruder)
 {
     // The pipeline is variable: The vase mode filter is optional.
+    // A layer fetched by the serial generator stage, with the avoid crossing perimeters geometry
+    // caches precomputed by the parallel stage running in front of the serial G-code generation stage.
+    struct LayerInFlight {
+        LayerToPrint     *layer { nullptr };
+        const LayerTools *layer_tools { nullptr };
+        bool              last { false };
+        std::vector<std::pair<const Layer*, AvoidCrossingPerimeters::LayerGeometry>> geometries;
+    };
     size_t layer_to_print_idx = 0;
-    const auto generator = tbb::make_filter<void, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &tool_ordering, &layers_to_print, &layer_to_print_idx, single_object_idx, prime_extruder](tbb::flow_control& fc) -> LayerResult {
+    const auto generator = tbb::make_filter<void, LayerInFlight>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &tool_ordering, &layers_to_print, &layer_to_print_idx](tbb::flow_control& fc) -> LayerInFlight {
             if (layer_to_print_idx == layers_to_print.size()) {
                 fc.stop();
                 return {};
@@ -2746,9 +2812,26 @@ void GCode::process_layers(
                 //BBS
                 check_placeholder_parser_failed();
                 print.throw_if_canceled();
-                return this->process_layer(print, { std::move(layer) }, tool_ordering.tools_for_layer(layer.print_z()), &layer == &layers_to_print.back(), nullptr, single_object_idx, prime_extruder);
+                LayerInFlight out;
+                out.layer       = &layer;
+                out.layer_tools = &tool_ordering.tools_for_layer(layer.print_z());
+                out.last        = &layer == &layers_to_print.back();
+                return out;
             }
         });
+    // Precompute the geometry caches of the avoid crossing perimeters machinery for the layers in flight,
+    // see the comment in the non-sequential GCode::process_layers() above.
+    const auto precompute = tbb::make_filter<LayerInFlight, LayerInFlight>(slic3r_tbb_filtermode::parallel,
+        [](LayerInFlight in) -> LayerInFlight {
+            if (const Layer *layer = in.layer->layer(); layer != nullptr && layer->object()->config().reduce_crossing_wall)
+                in.geometries.emplace_back(layer, AvoidCrossingPerimeters::compute_layer_geometry(*layer));
+            return in;
+        });
+    const auto process = tbb::make_filter<LayerInFlight, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, single_object_idx, prime_extruder](LayerInFlight in) -> LayerResult {
+            m_avoid_crossing_perimeters.seed_layer_geometries(std::move(in.geometries));
+            return this->process_layer(print, { std::move(*in.layer) }, *in.layer_tools, in.last, nullptr, single_object_idx, prime_extruder);
+        });
     const auto spiral_mode = tbb::make_filter<LayerResult, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [&spiral_mode = *this->m_spiral_vase.get()](LayerResult in)->LayerResult {
             spiral_mode.enable(in.spiral_vase_enable);
@@ -2780,11 +2863,18 @@ void GCode::process_layers(
         return in;
     });
 
+    // Inject per feature pressure advance commands at the feature tags, see the comment
+    // in the non-sequential GCode::process_layers() above.
+    const auto per_feature_pa = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [per_feature_pa = this->m_per_feature_pa.get()](std::string in) -> std::string {
+            return per_feature_pa == nullptr ? in : per_feature_pa->process_layer(std::move(in));
+        });
+
     // The pipeline elements are joined using const references, thus no copying is performed.
     if (m_spiral_vase)
-        tbb::parallel_pipeline(12, generator & spiral_mode & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & precompute & process & spiral_mode & cooling & per_feature_pa & fan_mover & output);
     else
-        tbb::parallel_pipeline(12, generator & cooling & fan_mover & output);
+        tbb::parallel_pipeline(12, generator & precompute & process & cooling & per_feature_pa & fan_mover & output);
 }
 
 std::string GCode::placeholder_parser_process(const std::string &name, const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override)
@@ -3301,6 +3391,9 @@ LayerResult GCode::process_layer(
     // BBS
     const bool                               prime_extruder)
 {
+    PROFILE_FUNC();
+    ChromeTraceSpan trace_span("GCode::process_layer");
+
     assert(! layers.empty());
     // Either printing all copies of all objects, or just a single copy of a single object.
     assert(single_object_instance_idx == size_t(-1) || layers.size() == 1);
@@ -3363,6 +3456,9 @@ LayerResult GCode::process_layer(
     }
 
     std::string gcode;
+    // Neighboring layers emit G-code of a similar size, thus reserving the size of the previous
+    // layer with some slack avoids growing the buffer through repeated reallocations.
+    gcode.reserve(m_last_layer_gcode_size + (m_last_layer_gcode_size >> 3));
     assert(is_decimal_separator_point()); // for the sprintfs
 
     // add tag for processor
@@ -3933,9 +4029,9 @@ LayerResult GCode::process_layer(
                     ExtrusionRole support_extrusion_role = instance_to_print.object_by_extruder.support_extrusion_role;
                     bool is_overridden = support_extrusion_role == erSupportMaterialInterface ? support_intf_overridden : support_overridden;
                     if (is_overridden == (print_wipe_extrusions != 0))
-                        gcode += this->extrude_support(
+                        gcode += this->extrude_support_chained(
                             // support_extrusion_role is erSupportMaterial, erSupportTransition, erSupportMaterialInterface or erMixed for all extrusion paths.
-                            instance_to_print.object_by_extruder.support->chained_path_from(m_last_pos, support_extrusion_role));
+                            *instance_to_print.object_by_extruder.support, support_extrusion_role);
 
                     m_layer = layer_to_print.layer();
                     m_object_layer_over_raft = object_layer_over_raft;
@@ -4043,6 +4139,7 @@ LayerResult GCode::process_layer(
         }
     }
 
+    m_last_layer_gcode_size = gcode.size();
     result.gcode = std::move(gcode);
     result.cooling_buffer_flush = object_layer || raft_layer || last_layer;
     return result;
@@ -4382,6 +4479,56 @@ std::string GCode::extrude_infill(const Print &print, const std::vector<ObjectBy
     return gcode;
 }
 
+// Chain the support extrusions of the given role by shortest travel distance (KD-tree backed greedy
+// chaining) and emit them in that order. In contrast to extruding chained_path_from(), no clone of the
+// layer's support extrusions is made: the chain only stores the visiting order and a flip flag, and the
+// entities are copied one at a time into the extrusion calls, which take them by value anyway.
+std::string GCode::extrude_support_chained(const ExtrusionEntityCollection &support_fills, ExtrusionRole role)
+{
+    if (support_fills.no_sort)
+        // Ordering was fixed by the support generator, emit as stored.
+        return this->extrude_support(support_fills);
+
+    static constexpr const char *support_label            = "support material";
+    static constexpr const char *support_interface_label  = "support material interface";
+    const char* support_transition_label = "support transition";
+
+    std::string gcode;
+    ExtrusionEntitiesPtr entities = filter_by_extrusion_role(support_fills.entities, role);
+    for (const std::pair<size_t, bool> &ec : chain_extrusion_entities(entities, &m_last_pos)) {
+        const ExtrusionEntity *ee = entities[ec.first];
+        ExtrusionRole er = ee->role();
+        assert(er == erSupportMaterial || er == erSupportMaterialInterface || er == erSupportTransition);
+        const char* label = (er == erSupportMaterial) ? support_label :
+            ((er == erSupportMaterialInterface) ? support_interface_label : support_transition_label);
+        // BBS
+        const double speed = -1.0;
+        if (const ExtrusionPath *path = dynamic_cast<const ExtrusionPath*>(ee)) {
+            ExtrusionPath flipped(*path);
+            if (ec.second)
+                flipped.reverse();
+            gcode += this->extrude_path(std::move(flipped), label, speed);
+        } else if (const ExtrusionMultiPath *multipath = dynamic_cast<const ExtrusionMultiPath*>(ee)) {
+            ExtrusionMultiPath flipped(*multipath);
+            if (ec.second)
+                flipped.reverse();
+            gcode += this->extrude_multi_path(std::move(flipped), label, speed);
+        } else if (const ExtrusionLoop *loop = dynamic_cast<const ExtrusionLoop*>(ee)) {
+            gcode += this->extrude_loop(*loop, label, speed);
+        } else if (const ExtrusionEntityCollection *collection = dynamic_cast<const ExtrusionEntityCollection*>(ee)) {
+            if (ec.second) {
+                // The chain asked to flip a nested collection. The stored entities are shared, clone before reversing.
+                std::unique_ptr<ExtrusionEntity> clone(collection->clone());
+                clone->reverse();
+                gcode += this->extrude_support(*static_cast<const ExtrusionEntityCollection*>(clone.get()));
+            } else
+                gcode += this->extrude_support(*collection);
+        } else
+            throw Slic3r::InvalidArgument("Unknown extrusion type");
+    }
+    return gcode;
+}
+
 std::string GCode::extrude_support(const ExtrusionEntityCollection &support_fills)
 {
     static constexpr const char *support_label            = "support material";
@@ -4436,19 +4583,50 @@ void GCode::GCodeOutputStream::flush()
 void GCode::GCodeOutputStream::close()
 {
     if (this->f) {
+        if (m_post_processor_chain)
+            // Process the incomplete last line held by the chain, if any.
+            if (std::string tail = m_post_processor_chain->finalize(); ! tail.empty())
+                this->write_raw(tail.data(), tail.size());
         ::fclose(this->f);
         this->f = nullptr;
     }
 }
 
+void GCode::GCodeOutputStream::write_raw(const char *what, size_t size)
+{
+    fwrite(what, 1, size, this->f);
+    m_processor.process_buffer(what, size);
+}
+
+void GCode::GCodeOutputStream::write(const std::string &what)
+{
+    if (! what.empty()) {
+        if (m_post_processor_chain) {
+            if (std::string processed = m_post_processor_chain->process(what); ! processed.empty())
+                this->write_raw(processed.data(), processed.size());
+        } else {
+            // writes string to file
+            fwrite(what.data(), 1, what.size(), this->f);
+            // The caller already holds a std::string, feed it to the processor without a copy.
+            m_processor.process_buffer(what);
+        }
+    }
+}
+
 void GCode::GCodeOutputStream::write(const char *what)
 {
     if (what != nullptr) {
         const char* gcode = what;
-        // writes string to file
-        fwrite(gcode, 1, ::strlen(gcode), this->f);
-        //FIXME don't allocate a string, maybe process a batch of lines?
-        m_processor.process_buffer(std::string(gcode));
+        size_t len = ::strlen(gcode);
+        if (m_post_processor_chain) {
+            if (std::string processed = m_post_processor_chain->process(gcode, len); ! processed.empty())
+                this->write_raw(processed.data(), processed.size());
+        } else {
+            // writes string to file
+            fwrite(gcode, 1, len, this->f);
+            // The C string is zero terminated, feed it to the processor without allocating a copy.
+            m_processor.process_buffer(gcode, len);
+        }
     }
 }
 
@@ -4902,7 +5080,7 @@ std::string GCode::_extrude(const ExtrusionPath &path, std::string description,
                 for (const Line& line : path.polyline.lines()) {
                     const double line_length = line.length() * SCALING_FACTOR;
                     path_length += line_length;
-                    gcode += m_writer.extrude_to_xy(
+                    m_writer.extrude_to_xy_to(gcode,
                         this->point_to_gcode(line.b),
                         e_per_mm * line_length,
                         GCodeWriter::full_gcode_comment ? description : "", path.is_force_no_extrusion());
@@ -4919,7 +5097,7 @@ std::string GCode::_extrude(const ExtrusionPath &path, std::string description,
                             const Line line = Line(path.polyline.points[point_index - 1], path.polyline.points[point_index]);
                             const double line_length = line.length() * SCALING_FACTOR;
                             path_length += line_length;
-                            gcode += m_writer.extrude_to_xy(
+                            m_writer.extrude_to_xy_to(gcode,
                                 this->point_to_gcode(line.b),
                                 e_per_mm * line_length,
                                 GCodeWriter::full_gcode_comment ? description : "", path.is_force_no_extrusion());
@@ -4932,7 +5110,7 @@ std::string GCode::_extrude(const ExtrusionPath &path, std::string description,
                         const double arc_length = fitting_result[fitting_index].arc_data.length * SCALING_FACTOR;
                         const Vec2d center_offset = this->point_to_gcode(arc.center) - this->point_to_gcode(arc.start_point);
                         path_length += arc_length;
-                        gcode += m_writer.extrude_arc_to_xy(
+                        m_writer.extrude_arc_to_xy_to(gcode,
                             this->point_to_gcode(arc.end_point),
                             center_offset,
                             e_per_mm * arc_length,
@@ -4994,11 +5172,10 @@ std::string GCode::_extrude(const ExtrusionPath &path, std::string description,
             const double line_length = (p - prev).norm();
             double new_speed = std::max((float)EXTRUDER_CONFIG(slow_down_min_speed), pre_processed_point.speed) * 60.0;
             if (last_set_speed != new_speed) {
-                gcode += m_writer.set_speed(new_speed, "", comment);
+                m_writer.set_speed_to(gcode, new_speed, "", comment);
                 last_set_speed = new_speed;
             }
-            gcode +=
-                m_writer.extrude_to_xy(p, e_per_mm * line_length, GCodeWriter::full_gcode_comment ? description : "");
+            m_writer.extrude_to_xy_to(gcode, p, e_per_mm * line_length, GCodeWriter::full_gcode_comment ? description : "");
 
             prev = p;
 
@@ -17,6 +17,8 @@
 #include "GCode/WipeTower.hpp"
 #include "GCode/SeamPlacer.hpp"
 #include "GCode/GCodeProcessor.hpp"
+#include "GCode/PerFeaturePressureAdvance.hpp"
+#include "GCode/PostProcessor.hpp"
 #include "EdgeGrid.hpp"
 #include "GCode/ThumbnailData.hpp"
 #include "libslic3r/ObjectID.hpp"
@@ -187,6 +189,14 @@ public:
     //BBS: set offset for gcode writer
     void set_gcode_offset(double x, double y) { m_writer.set_xy_offset(x, y); m_processor.set_xy_offset(x, y);}
 
+    // Install a chain of in-process post processors, applied to the line stream of the
+    // next do_export() call. Replaces any previously installed chain, an empty vector
+    // uninstalls it.
+    void set_stream_post_processors(GCodeStreamPostProcessorPtrs &&post_processors) {
+        m_stream_post_processor_chain = post_processors.empty() ? nullptr :
+            std::make_unique<GCodeStreamPostProcessorChain>(std::move(post_processors));
+    }
+
     // Exported for the helper classes (OozePrevention, Wipe) and for the Perl binding for unit tests.
     const Vec2d&    origin() const { return m_origin; }
     void            set_origin(const Vec2d &pointf);
@@ -269,7 +279,13 @@ public:
 private:
     class GCodeOutputStream {
     public:
-        GCodeOutputStream(FILE *f, GCodeProcessor &processor) : f(f), m_processor(processor) {}
+        GCodeOutputStream(FILE *f, GCodeProcessor &processor, GCodeStreamPostProcessorChain *post_processor_chain = nullptr)
+            : f(f), m_processor(processor), m_post_processor_chain(post_processor_chain) {
+            // Large stdio buffer, so the G-code leaves in big blocks. Helps considerably
+            // when the output path sits on a network filesystem.
+            if (this->f != nullptr)
+                ::setvbuf(this->f, nullptr, _IOFBF, 1024 * 1024);
+        }
         ~GCodeOutputStream() { this->close(); }
 
         bool is_open() const { return f; }
@@ -279,7 +295,7 @@ private:
         void close();
 
         // Write a string into a file.
-        void write(const std::string& what) { this->write(what.c_str()); }
+        void write(const std::string& what);
         void write(const char* what);
 
         // Write a string into a file.
@@ -291,8 +307,15 @@ private:
         void write_format(const char* format, ...);
 
     private:
+        // Write a string to the file and feed it to the G-code processor,
+        // bypassing the post processor chain.
+        void write_raw(const char *what, size_t size);
+
         FILE *f = nullptr;
         GCodeProcessor &m_processor;
+        // Optional in-process post processors, applied to the line stream before it
+        // is written to the file and fed to the G-code processor.
+        GCodeStreamPostProcessorChain *m_post_processor_chain = nullptr;
     };
     void            _do_export(Print &print, GCodeOutputStream &file, ThumbnailsGeneratorCallback thumbnail_cb);
 
@@ -415,6 +438,7 @@ private:
     std::string     extrude_perimeters(const Print& print, const std::vector<ObjectByExtruder::Island::Region>& by_region);
     std::string     extrude_infill(const Print& print, const std::vector<ObjectByExtruder::Island::Region>& by_region, bool ironing);
     std::string     extrude_support(const ExtrusionEntityCollection& support_fills);
+    std::string     extrude_support_chained(const ExtrusionEntityCollection& support_fills, ExtrusionRole role);
 
     // BBS
     LiftType to_lift_type(ZHopType z_hop_types);
@@ -508,6 +532,9 @@ private:
     float                               m_last_layer_z{ 0.0f };
     float                               m_max_layer_z{ 0.0f };
     float                               m_last_width{ 0.0f };
+    // Size of the G-code emitted for the previous layer, used to reserve the accumulation
+    // buffer of the next layer and avoid repeated reallocations of a multi-megabyte string.
+    size_t                              m_last_layer_gcode_size{ 0 };
 #if ENABLE_GCODE_VIEWER_DATA_CHECKING
     double                              m_last_mm3_per_mm;
 #endif // ENABLE_GCODE_VIEWER_DATA_CHECKING
@@ -516,6 +543,7 @@ private:
     bool                                m_last_pos_defined;
 
     std::unique_ptr<CoolingBuffer>      m_cooling_buffer;
+    std::unique_ptr<PerFeaturePressureAdvance> m_per_feature_pa;
     std::unique_ptr<SpiralVase>         m_spiral_vase;
 
     std::unique_ptr<PressureEqualizer>  m_pressure_equalizer;
@@ -542,6 +570,9 @@ private:
     //some post-processing on the file, with their data class
     std::unique_ptr<FanMover> m_fan_mover;
 
+    // Optional in-process post processors, applied to the exported line stream.
+    std::unique_ptr<GCodeStreamPostProcessorChain> m_stream_post_processor_chain;
+
     // BBS
     Print* m_curr_print = nullptr;
     unsigned int m_toolchange_count;
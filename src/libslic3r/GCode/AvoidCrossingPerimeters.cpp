@@ -13,6 +13,8 @@
 #include "../SVG.hpp"
 #include "AvoidCrossingPerimeters.hpp"
 
+#include <algorithm>
+
 #include <numeric>
 #include <unordered_set>
 #include <boost/range/adaptor/reversed.hpp>
@@ -1244,25 +1246,54 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
 
 // ************************************* AvoidCrossingPerimeters::init_layer() *****************************************
 
-void AvoidCrossingPerimeters::init_layer(const Layer &layer)
+AvoidCrossingPerimeters::LayerGeometry AvoidCrossingPerimeters::compute_layer_geometry(const Layer &layer)
 {
-    m_internal.clear();
-    m_external.clear();
-    m_lslices_offset.clear();
-    m_lslices_offset_bboxes.clear();
+    LayerGeometry geometry;
 
-    float perimeter_offset = -get_external_perimeter_width(layer) / float(2.);
-    m_lslices_offset        = offset_ex(layer.lslices, perimeter_offset);
+    float perimeter_offset    = -get_external_perimeter_width(layer) / float(2.);
+    geometry.lslices_offset   = offset_ex(layer.lslices, perimeter_offset);
 
-    m_lslices_offset_bboxes.reserve(m_lslices_offset.size());
-    for (const ExPolygon &ex_poly : m_lslices_offset)
-        m_lslices_offset_bboxes.emplace_back(get_extents(ex_poly));
+    geometry.lslices_offset_bboxes.reserve(geometry.lslices_offset.size());
+    for (const ExPolygon &ex_poly : geometry.lslices_offset)
+        geometry.lslices_offset_bboxes.emplace_back(get_extents(ex_poly));
 
     BoundingBox bbox_slice(get_extents(layer.lslices));
     bbox_slice.offset(SCALED_EPSILON);
 
-    m_grid_lslices_offset.set_bbox(bbox_slice);
-    m_grid_lslices_offset.create(m_lslices_offset, coord_t(scale_(1.)));
+    geometry.grid_lslices_offset.set_bbox(bbox_slice);
+    geometry.grid_lslices_offset.create(geometry.lslices_offset, coord_t(scale_(1.)));
+
+    // The boundary for travels routed inside the object is a pure function of the layer as well,
+    // thus build it here too instead of lazily inside the first travel_to() call of the layer.
+    init_boundary(&geometry.internal_boundary, to_polygons(get_boundary(layer)));
+    return geometry;
+}
+
+void AvoidCrossingPerimeters::init_layer(const Layer &layer)
+{
+    if (m_initialized_layer == &layer && m_initialized_layer_print_z == layer.print_z)
+        // The caches are still valid: The same layer is initialized again for another instance
+        // of the same object or for the second wiping pass.
+        return;
+
+    m_external.clear();
+
+    LayerGeometry geometry;
+    if (auto it = std::find_if(m_seeded_geometries.begin(), m_seeded_geometries.end(),
+            [&layer](const std::pair<const Layer*, LayerGeometry> &seeded) { return seeded.first == &layer; });
+        it != m_seeded_geometries.end())
+        // Precomputed in parallel ahead of the serial G-code generation, see GCode::process_layers().
+        geometry = std::move(it->second);
+    else
+        geometry = compute_layer_geometry(layer);
+
+    m_internal              = std::move(geometry.internal_boundary);
+    m_lslices_offset        = std::move(geometry.lslices_offset);
+    m_lslices_offset_bboxes = std::move(geometry.lslices_offset_bboxes);
+    m_grid_lslices_offset   = std::move(geometry.grid_lslices_offset);
+
+    m_initialized_layer         = &layer;
+    m_initialized_layer_print_z = layer.print_z;
 }
 
 #if 0
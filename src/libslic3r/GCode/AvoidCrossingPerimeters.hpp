@@ -9,6 +9,9 @@
 #include "../ExPolygon.hpp"
 #include "../EdgeGrid.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace Slic3r {
 
 // Forward declarations.
@@ -27,16 +30,6 @@ public:
     bool        disabled_once() const   { return m_disabled_once; }
     void        reset_once_modifiers()  { m_use_external_mp_once = false; m_disabled_once = false; }
 
-    void        init_layer(const Layer &layer);
-
-    Polyline    travel_to(const GCode& gcodegen, const Point& point)
-    {
-        bool could_be_wipe_disabled;
-        return this->travel_to(gcodegen, point, &could_be_wipe_disabled);
-    }
-
-    Polyline    travel_to(const GCode& gcodegen, const Point& point, bool* could_be_wipe_disabled);
-
     struct Boundary {
         // Collection of boundaries used for detection of crossing perimeters for travels
         Polygons                        boundaries;
@@ -54,6 +47,35 @@ public:
         }
     };
 
+    // Geometry caches built by init_layer(). They are a pure function of the layer geometry, thus they
+    // may be precomputed in parallel ahead of the serial G-code generation pass.
+    struct LayerGeometry {
+        // Lslices offseted by half an external perimeter width. Used for detection if line or polyline is inside of any polygon.
+        ExPolygons               lslices_offset;
+        std::vector<BoundingBox> lslices_offset_bboxes;
+        // Used for detection of line or polyline is inside of any polygon.
+        // Beware: The grid references the points of lslices_offset, thus the struct shall be moved, never copied.
+        EdgeGrid::Grid           grid_lslices_offset;
+        // Boundary for travels routed inside the object, including its edge grid and point parametrization.
+        // The same move-only caveat as above applies.
+        Boundary                 internal_boundary;
+    };
+    static LayerGeometry compute_layer_geometry(const Layer &layer);
+
+    // Hand over geometry caches precomputed for the layers about to be processed, to be consumed by init_layer().
+    void        seed_layer_geometries(std::vector<std::pair<const Layer*, LayerGeometry>> &&geometries)
+        { m_seeded_geometries = std::move(geometries); }
+
+    void        init_layer(const Layer &layer);
+
+    Polyline    travel_to(const GCode& gcodegen, const Point& point)
+    {
+        bool could_be_wipe_disabled;
+        return this->travel_to(gcodegen, point, &could_be_wipe_disabled);
+    }
+
+    Polyline    travel_to(const GCode& gcodegen, const Point& point, bool* could_be_wipe_disabled);
+
 private:
     bool           m_use_external_mp { false };
     // just for the next travel move
@@ -71,6 +93,12 @@ private:
     Boundary m_internal;
     // Store all needed data for travels outside object
     Boundary m_external;
+    // Layer for which the caches above are valid. The same layer is initialized repeatedly when printing
+    // multiple instances or the wiping passes, skip the rebuild then.
+    const Layer   *m_initialized_layer { nullptr };
+    coordf_t       m_initialized_layer_print_z { -1. };
+    // Precomputed geometry caches of the upcoming layers, see seed_layer_geometries().
+    std::vector<std::pair<const Layer*, LayerGeometry>> m_seeded_geometries;
 };
 
 } // namespace Slic3r
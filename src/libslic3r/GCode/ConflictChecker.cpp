@@ -3,7 +3,7 @@
 #include <tbb/parallel_for.h>
 #include <tbb/concurrent_vector.h>
 
-#include <map>
+#include <unordered_map>
 #include <functional>
 #include <atomic>
 
@@ -13,6 +13,15 @@ namespace RasterizationImpl {
 using IndexPair = std::pair<int64_t, int64_t>;
 using Grids     = std::vector<IndexPair>;
 
+struct IndexPairHash
+{
+    size_t operator()(const IndexPair &ip) const
+    {
+        size_t seed = std::hash<int64_t>{}(ip.first);
+        return std::hash<int64_t>{}(ip.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+};
+
 inline constexpr int64_t RasteXDistance = scale_(1);
 inline constexpr int64_t RasteYDistance = scale_(1);
 
@@ -196,28 +205,43 @@ ObjectExtrusions getAllLayersExtrusionPathsFromObject(PrintObject *obj)
 ConflictComputeOpt ConflictChecker::find_inter_of_lines(const LineWithIDs &lines)
 {
     using namespace RasterizationImpl;
-    std::map<IndexPair, std::vector<int>> indexToLine;
+    std::unordered_map<IndexPair, std::vector<int>, IndexPairHash> indexToLine;
+    indexToLine.reserve(lines.size());
 
     for (int i = 0; i < lines.size(); ++i) {
         const LineWithID &l1      = lines[i];
         auto              indexes = line_rasterization(l1._line);
         for (auto index : indexes) {
-            const auto &possibleIntersectIdxs = indexToLine[index];
+            std::vector<int> &possibleIntersectIdxs = indexToLine[index];
             for (auto possibleIntersectIdx : possibleIntersectIdxs) {
                 const LineWithID &l2 = lines[possibleIntersectIdx];
                 if (auto interRes = line_intersect(l1, l2); interRes.has_value()) { return interRes; }
             }
-            indexToLine[index].push_back(i);
+            possibleIntersectIdxs.push_back(i);
         }
     }
     return {};
 }
 
+// XY extents of the extrusions in plate coordinates, used to skip the expensive
+// line checks entirely when the footprints of the buckets do not even touch.
+static BoundingBox extrusion_layers_extents(const ExtrusionLayers &els, const Point &offset)
+{
+    BoundingBox bbox;
+    for (const ExtrusionLayer &el : els)
+        for (const ExtrusionPath &path : el.paths)
+            bbox.merge(get_extents(path.polyline.points));
+    if (bbox.defined)
+        bbox.translate(offset.x(), offset.y());
+    return bbox;
+}
+
 ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(PrintObjectPtrs                      objs,
                                                                     std::optional<const FakeWipeTower *> wtdptr) // find the first intersection point of lines in different objects
 {
     if (objs.size() <= 1 && !wtdptr) { return {}; }
     LinesBucketQueue conflictQueue;
+    std::vector<std::pair<const void *, BoundingBox>> bucketExtents;
     if (wtdptr.has_value()) { // wipe tower at 0 by default
         auto            wtpaths = wtdptr.value()->getFakeExtrusionPathsFromWipeTower();
         ExtrusionLayers wtels;
@@ -229,14 +253,33 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(PrintObjectP
             el.layer    = nullptr;
             wtels.push_back(el);
         }
-        conflictQueue.emplace_back_bucket(std::move(wtels), wtdptr.value(), {wtdptr.value()->plate_origin.x(), wtdptr.value()->plate_origin.y()});
+        Point wtoffset{wtdptr.value()->plate_origin.x(), wtdptr.value()->plate_origin.y()};
+        bucketExtents.emplace_back(wtdptr.value(), extrusion_layers_extents(wtels, wtoffset));
+        conflictQueue.emplace_back_bucket(std::move(wtels), wtdptr.value(), wtoffset);
     }
     for (PrintObject *obj : objs) {
         auto layers = getAllLayersExtrusionPathsFromObject(obj);
+        bucketExtents.emplace_back(obj, extrusion_layers_extents(layers.perimeters, obj->instances().front().shift));
+        bucketExtents.emplace_back(obj, extrusion_layers_extents(layers.support, obj->instances().front().shift));
         conflictQueue.emplace_back_bucket(std::move(layers.perimeters), obj, obj->instances().front().shift);
         conflictQueue.emplace_back_bucket(std::move(layers.support), obj, obj->instances().front().shift);
     }
 
+    // Cheap rejection: if no two buckets of different objects have overlapping XY
+    // footprints, no pair of their extrusion lines can intersect either.
+    bool footprints_overlap = false;
+    for (size_t i = 0; i < bucketExtents.size() && !footprints_overlap; ++i) {
+        if (!bucketExtents[i].second.defined) continue;
+        BoundingBox bbox1 = bucketExtents[i].second;
+        bbox1.offset(SCALED_EPSILON);
+        for (size_t j = i + 1; j < bucketExtents.size(); ++j)
+            if (bucketExtents[i].first != bucketExtents[j].first && bucketExtents[j].second.defined && bbox1.overlap(bucketExtents[j].second)) {
+                footprints_overlap = true;
+                break;
+            }
+    }
+    if (!footprints_overlap) { return {}; }
+
     std::vector<LineWithIDs> layersLines;
     std::vector<float>       bottomZs;
     while (conflictQueue.valid()) {
@@ -260,9 +303,16 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(PrintObjectP
     });
 
     if (find) {
-        const void *ptr1           = conflict[0].first._obj1;
-        const void *ptr2           = conflict[0].first._obj2;
-        float       conflictPrintZ = conflict[0].second;
+        // The parallel loop above fills the vector in a nondeterministic order. Report the
+        // conflict of the lowest layer, so repeated slicing of the same plate yields the
+        // same verdict regardless of the thread schedule.
+        size_t lowest = 0;
+        for (size_t i = 1; i < conflict.size(); ++ i)
+            if (conflict[i].second < conflict[lowest].second)
+                lowest = i;
+        const void *ptr1           = conflict[lowest].first._obj1;
+        const void *ptr2           = conflict[lowest].first._obj2;
+        float       conflictPrintZ = conflict[lowest].second;
         if (wtdptr.has_value()) {
             const FakeWipeTower *wtdp = wtdptr.value();
             if (ptr1 == wtdp || ptr2 == wtdp) {
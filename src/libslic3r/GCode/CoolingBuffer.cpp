@@ -5,6 +5,7 @@
 #include <boost/log/trivial.hpp>
 #include <iostream>
 #include <float.h>
+#include <string_view>
 #include <system_error>
 #include <unordered_map>
 
@@ -345,8 +346,9 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
     {
         while (*line_end != '\n' && *line_end != 0)
             ++ line_end;
-        // sline will not contain the trailing '\n'.
-        std::string sline(line_start, line_end);
+        // sline will not contain the trailing '\n'. A view into the source G-code buffer,
+        // which is null terminated, thus the atof calls below will never run past its end.
+        std::string_view sline(line_start, line_end - line_start);
         // CoolingLine will contain the trailing '\n'.
         if (*line_end == '\n')
             ++ line_end;
@@ -365,11 +367,12 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
             // G0, G1 or G92
             // Parse the G-code line.
             std::vector<float> new_pos(current_pos);
-            const char *c = sline.data() + 3;
+            const char *c          = sline.data() + 3;
+            const char *sline_end  = sline.data() + sline.size();
             for (;;) {
                 // Skip whitespaces.
-                for (; *c == ' ' || *c == '\t'; ++ c);
-                if (*c == 0 || *c == ';')
+                for (; c != sline_end && (*c == ' ' || *c == '\t'); ++ c);
+                if (c == sline_end || *c == ';')
                     break;
 
                 assert(is_decimal_separator_point()); // for atof
@@ -391,7 +394,7 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
                     }
                 }
                 // Skip this word.
-                for (; *c != ' ' && *c != '\t' && *c != 0; ++ c);
+                for (; c != sline_end && *c != ' ' && *c != '\t'; ++ c);
             }
             bool external_perimeter = boost::contains(sline, ";_EXTERNAL_PERIMETER");
             bool wipe               = boost::contains(sline, ";_WIPE");
@@ -496,8 +499,8 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
             size_t pos_P = sline.find('P', 3);
             assert(is_decimal_separator_point()); // for atof
             line.time = line.time_max = float(
-                (pos_S > 0) ? atof(sline.c_str() + pos_S + 1) :
-                (pos_P > 0) ? atof(sline.c_str() + pos_P + 1) * 0.001 : 0.);
+                (pos_S > 0) ? atof(sline.data() + pos_S + 1) :
+                (pos_P > 0) ? atof(sline.data() + pos_P + 1) * 0.001 : 0.);
         } else if (boost::starts_with(sline, ";_FORCE_RESUME_FAN_SPEED")) {
             line.type = CoolingLine::TYPE_FORCE_RESUME_FAN;
         }
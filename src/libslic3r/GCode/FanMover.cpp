@@ -260,7 +260,16 @@ void FanMover::_process_gcode_line(GCodeReader& reader, const GCodeReader::GCode
 {
     // processes 'normal' gcode lines
     bool need_flush = false;
-    std::string cmd(line.cmd());
+    const std::string_view cmd = line.cmd();
+    // Digits following the command letter, with the same semantics as the
+    // previously used ::atoi() (0 when no digit follows). Parsing the view in
+    // place avoids a heap allocated copy of the command for every line.
+    auto cmd_number = [](const std::string_view cmd) {
+        int v = 0;
+        for (size_t i = 1; i < cmd.size() && cmd[i] >= '0' && cmd[i] <= '9'; ++ i)
+            v = v * 10 + (cmd[i] - '0');
+        return v;
+    };
     double time = 0;
     int16_t fan_speed = -1;
     if (cmd.length() > 1) {
@@ -273,7 +282,7 @@ void FanMover::_process_gcode_line(GCodeReader& reader, const GCodeReader::GCode
                 break;
         case 'G':
         {
-            if (::atoi(&cmd[1]) == 1 || ::atoi(&cmd[1]) == 0) {
+            if (int gnum = cmd_number(cmd); gnum == 1 || gnum == 0) {
                 double distx = line.dist_X(reader);
                 double disty = line.dist_Y(reader);
                 double distz = line.dist_Z(reader);
@@ -491,9 +500,14 @@ void FanMover::_process_gcode_line(GCodeReader& reader, const GCodeReader::GCode
             remove_from_buffer(m_buffer.begin());
         }
     }
+#ifndef NDEBUG
+    // Verify the incrementally maintained time window. Summing the whole
+    // buffer after every line is debug-only: in release builds the window is
+    // maintained in O(1) by put_in_buffer() / remove_from_buffer().
     double sum = 0;
     for (auto& data : m_buffer) sum += data.time;
     assert( std::abs(m_buffer_time_size - sum) < 0.01);
+#endif /* NDEBUG */
 }
 
 } // namespace Slic3r
@@ -16,8 +16,19 @@
 
 #include <fast_float/fast_float.h>
 
+#include <Shiny/Shiny.h>
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/array.hpp>
+#include <cereal/types/common.hpp>
+#include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/utility.hpp>
+#include <cereal/types/vector.hpp>
+
 #include <float.h>
 #include <assert.h>
+#include <cstring>
 #include <regex>
 #include <charconv>
 #include <system_error>
@@ -174,18 +185,23 @@ float GCodeProcessor::Trapezoid::cruise_distance() const
 }
 
 void GCodeProcessor::TimeBlock::calculate_trapezoid()
+{
+    calculate_trapezoid(feedrate_profile.exit);
+}
+
+void GCodeProcessor::TimeBlock::calculate_trapezoid(float exit_feedrate)
 {
     trapezoid.cruise_feedrate = feedrate_profile.cruise;
 
     float accelerate_distance = std::max(0.0f, estimated_acceleration_distance(feedrate_profile.entry, feedrate_profile.cruise, acceleration));
-    float decelerate_distance = std::max(0.0f, estimated_acceleration_distance(feedrate_profile.cruise, feedrate_profile.exit, -acceleration));
+    float decelerate_distance = std::max(0.0f, estimated_acceleration_distance(feedrate_profile.cruise, exit_feedrate, -acceleration));
     float cruise_distance = distance - accelerate_distance - decelerate_distance;
 
     // Not enough space to reach the nominal feedrate.
-    // This means no cruising, and we'll have to use intersection_distance() to calculate when to abort acceleration 
+    // This means no cruising, and we'll have to use intersection_distance() to calculate when to abort acceleration
     // and start braking in order to reach the exit_feedrate exactly at the end of this block.
     if (cruise_distance < 0.0f) {
-        accelerate_distance = std::clamp(intersection_distance(feedrate_profile.entry, feedrate_profile.exit, acceleration, distance), 0.0f, distance);
+        accelerate_distance = std::clamp(intersection_distance(feedrate_profile.entry, exit_feedrate, acceleration, distance), 0.0f, distance);
         cruise_distance = 0.0f;
         trapezoid.cruise_feedrate = speed_from_distance(feedrate_profile.entry, accelerate_distance, acceleration);
     }
@@ -235,6 +251,8 @@ void GCodeProcessor::TimeMachine::reset()
     prev.reset();
     gcode_time.reset();
     blocks = std::vector<TimeBlock>();
+    // The planner refreshes once the queue exceeds the threshold, thus this is the capacity the queue settles at.
+    blocks.reserve(TimeProcessor::Planner::refresh_threshold + 1);
     g1_times_cache = std::vector<G1LinesCacheItem>();
     std::fill(moves_time.begin(), moves_time.end(), 0.0f);
     std::fill(roles_time.begin(), roles_time.end(), 0.0f);
@@ -301,10 +319,7 @@ static void recalculate_trapezoids(std::vector<GCodeProcessor::TimeBlock>& block
             // Recalculate if current block entry or exit junction speed has changed.
             if (curr->flags.recalculate || next->flags.recalculate) {
                 // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-                GCodeProcessor::TimeBlock block = *curr;
-                block.feedrate_profile.exit = next->feedrate_profile.entry;
-                block.calculate_trapezoid();
-                curr->trapezoid = block.trapezoid;
+                curr->calculate_trapezoid(next->feedrate_profile.entry);
                 curr->flags.recalculate = false; // Reset current only to ensure next trapezoid is computed
             }
         }
@@ -312,10 +327,7 @@ static void recalculate_trapezoids(std::vector<GCodeProcessor::TimeBlock>& block
 
     // Last/newest block in buffer. Always recalculated.
     if (next != nullptr) {
-        GCodeProcessor::TimeBlock block = *next;
-        block.feedrate_profile.exit = next->safe_feedrate;
-        block.calculate_trapezoid();
-        next->trapezoid = block.trapezoid;
+        next->calculate_trapezoid(next->safe_feedrate);
         next->flags.recalculate = false;
     }
 }
@@ -351,23 +363,20 @@ void GCodeProcessor::TimeMachine::calculate_time(size_t keep_last_n_blocks, floa
         if (!block.flags.prepare_stage || block.move_type != EMoveType::Travel)
             moves_time[static_cast<size_t>(block.move_type)] += block_time;
         roles_time[static_cast<size_t>(block.role)] += block_time;
-        if (block.layer_id >= layers_time.size()) {
-            const size_t curr_size = layers_time.size();
-            layers_time.resize(block.layer_id);
-            for (size_t i = curr_size; i < layers_time.size(); ++i) {
-                layers_time[i] = 0.0f;
-            }
-        }
+        if (block.layer_id >= layers_time.size())
+            layers_time.resize(block.layer_id, 0.0f);
         layers_time[block.layer_id - 1] += block_time;
         //BBS
         if (block.flags.prepare_stage)
             prepare_time += block_time;
         g1_times_cache.push_back({ block.g1_line_id, time });
         // update times for remaining time to printer stop placeholders
-        auto it_stop_time = std::lower_bound(stop_times.begin(), stop_times.end(), block.g1_line_id,
-            [](const StopTime& t, unsigned int value) { return t.g1_line_id < value; });
-        if (it_stop_time != stop_times.end() && it_stop_time->g1_line_id == block.g1_line_id)
-            it_stop_time->elapsed_time = time;
+        if (!stop_times.empty()) {
+            auto it_stop_time = std::lower_bound(stop_times.begin(), stop_times.end(), block.g1_line_id,
+                [](const StopTime& t, unsigned int value) { return t.g1_line_id < value; });
+            if (it_stop_time != stop_times.end() && it_stop_time->g1_line_id == block.g1_line_id)
+                it_stop_time->elapsed_time = time;
+        }
     }
 
     if (keep_last_n_blocks)
@@ -863,6 +872,86 @@ void GCodeProcessorResult::reset() {
 }
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
 
+//BBS: binary cache of the processed result, stored next to the G-code file of a saved project.
+//Bump the version whenever the layout of any serialized field changes.
+static constexpr const char GCodeResultCacheMagic[8] = { 'B', 'B', 'S', 'G', 'P', 'R', 'E', 'S' };
+static constexpr uint32_t   GCodeResultCacheVersion  = 1;
+
+namespace CustomGCode {
+template<class Archive> void serialize(Archive &ar, Item &item) { ar(item.print_z, item.type, item.extruder, item.color, item.extra); }
+} // namespace CustomGCode
+
+template<class Archive> void serialize(Archive &ar, GCodeProcessorResult::MoveVertex &v)
+{
+    ar(v.gcode_id, v.type, v.extrusion_role, v.extruder_id, v.cp_color_id, v.position, v.delta_extruder,
+       v.feedrate, v.width, v.height, v.mm3_per_mm, v.fan_speed, v.temperature, v.time, v.layer_duration,
+       v.move_path_type, v.arc_center_position, v.interpolation_points);
+}
+template<class Archive> void serialize(Archive &ar, GCodeProcessorResult::SettingsIds &s) { ar(s.print, s.filament, s.printer); }
+template<class Archive> void serialize(Archive &ar, GCodeProcessorResult::SliceWarning &w) { ar(w.level, w.msg, w.error_code, w.params); }
+template<class Archive> void serialize(Archive &ar, PrintEstimatedStatistics::Mode &m)
+{
+    ar(m.time, m.prepare_time, m.custom_gcode_times, m.moves_times, m.roles_times, m.layers_times);
+}
+template<class Archive> void serialize(Archive &ar, PrintEstimatedStatistics &s)
+{
+    ar(s.volumes_per_color_change, s.volumes_per_extruder, s.flush_per_filament, s.used_filaments_per_role, s.modes, s.total_filamentchanges);
+}
+
+//Serialize everything the viewer and the statistics panels consume. The transient members
+//(filename, id, conflict_result, the mutex) are owned by the loading side.
+template<class Archive, class Result> static void serialize_result_fields(Archive &ar, Result &result)
+{
+    ar(result.moves, result.lines_ends, result.printable_area, result.bed_exclude_area, result.toolpath_outside,
+       result.label_object_enabled, result.timelapse_warning_code, result.support_traditional_timelapse, result.printable_height,
+       result.settings_ids, result.extruders_count, result.extruder_colors, result.filament_diameters, result.required_nozzle_HRC,
+       result.filament_densities, result.filament_vitrification_temperature, result.print_statistics, result.custom_gcode_per_print_z,
+       result.spiral_vase_layers, result.warnings, result.nozzle_hrc, result.nozzle_type, result.bed_type);
+}
+
+bool GCodeProcessorResult::save_to_binary(const std::string& path) const
+{
+    try {
+        boost::nowide::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.good())
+            return false;
+        file.write(GCodeResultCacheMagic, sizeof(GCodeResultCacheMagic));
+        cereal::BinaryOutputArchive ar(file);
+        ar(GCodeResultCacheVersion);
+        serialize_result_fields(ar, *this);
+        file.flush();
+        return file.good();
+    } catch (const std::exception& ex) {
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": failed to save result cache %1%: %2%") % path % ex.what();
+        return false;
+    }
+}
+
+bool GCodeProcessorResult::load_from_binary(const std::string& path)
+{
+    try {
+        boost::nowide::ifstream file(path, std::ios::binary);
+        if (!file.good())
+            return false;
+        char magic[sizeof(GCodeResultCacheMagic)];
+        file.read(magic, sizeof(magic));
+        if (!file.good() || memcmp(magic, GCodeResultCacheMagic, sizeof(magic)) != 0)
+            return false;
+        cereal::BinaryInputArchive ar(file);
+        uint32_t version = 0;
+        ar(version);
+        if (version != GCodeResultCacheVersion)
+            return false;
+        this->reset();
+        serialize_result_fields(ar, *this);
+        return true;
+    } catch (const std::exception& ex) {
+        BOOST_LOG_TRIVIAL(warning) << __FUNCTION__ << boost::format(": failed to load result cache %1%: %2%") % path % ex.what();
+        this->reset();
+        return false;
+    }
+}
+
 const std::vector<std::pair<GCodeProcessor::EProducer, std::string>> GCodeProcessor::Producers = {
     //BBS: OrcaSlicer is also "bambu". Otherwise the time estimation didn't work.
     //FIXME: Workaround and should be handled when do removing-bambu
@@ -1402,6 +1491,8 @@ static inline const char* remove_eols(const char *begin, const char *end) {
 // throws CanceledException through print->throw_if_canceled() (sent by the caller as callback).
 void GCodeProcessor::process_file(const std::string& filename, std::function<void()> cancel_callback)
 {
+    PROFILE_FUNC();
+
     CNumericLocalesSetter locales_setter;
 
 #if ENABLE_GCODE_VIEWER_STATISTICS
@@ -1467,6 +1558,16 @@ void GCodeProcessor::process_file(const std::string& filename, std::function<voi
     this->finalize(false);
 }
 
+bool GCodeProcessor::load_result_from_binary(const std::string& gcode_filename, const std::string& cache_filename)
+{
+    if (!m_result.load_from_binary(cache_filename))
+        return false;
+    m_result.filename = gcode_filename;
+    m_result.id = ++s_result_id;
+    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": restored result of %1% from cache %2%") % gcode_filename % cache_filename;
+    return true;
+}
+
 void GCodeProcessor::initialize(const std::string& filename)
 {
     assert(is_decimal_separator_point());
@@ -1485,13 +1586,22 @@ void GCodeProcessor::initialize(const std::string& filename)
 void GCodeProcessor::process_buffer(const std::string &buffer)
 {
     //FIXME maybe cache GCodeLine gline to be over multiple parse_buffer() invocations.
-    m_parser.parse_buffer(buffer, [this](GCodeReader&, const GCodeReader::GCodeLine& line) { 
+    m_parser.parse_buffer(buffer, [this](GCodeReader&, const GCodeReader::GCodeLine& line) {
+        this->process_gcode_line(line, false);
+    });
+}
+
+void GCodeProcessor::process_buffer(const char *data, size_t data_length)
+{
+    m_parser.parse_buffer(data, data + data_length, [this](GCodeReader&, const GCodeReader::GCodeLine& line) {
         this->process_gcode_line(line, false);
     });
 }
 
 void GCodeProcessor::finalize(bool post_process)
 {
+    PROFILE_FUNC();
+
     // update width/height of wipe moves
     for (GCodeProcessorResult::MoveVertex& move : m_result.moves) {
         if (move.type == EMoveType::Wipe) {
@@ -1733,6 +1843,8 @@ void GCodeProcessor::apply_config_simplify3d(const std::string& filename)
 
 void GCodeProcessor::process_gcode_line(const GCodeReader::GCodeLine& line, bool producers_enabled)
 {
+    PROFILE_FUNC();
+
 /* std::cout << line.raw() << std::endl; */
 
     ++m_line_id;
@@ -204,6 +204,15 @@ namespace Slic3r {
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
         void reset();
 
+        //BBS: extension of the binary cache of this structure, stored next to the exported
+        //G-code file and inside saved projects (Metadata/plate_N.gcode.result)
+        static constexpr const char* BinaryCacheExtension = ".result";
+        //BBS: binary cache of a fully processed result. Both return false on I/O errors or
+        //on a format/version mismatch, in which case the caller falls back to re-processing
+        //the G-code file.
+        bool save_to_binary(const std::string& path) const;
+        bool load_from_binary(const std::string& path);
+
         //BBS: add mutex for protection of gcode result
         mutable std::mutex result_mutex;
         GCodeProcessorResult& operator=(const GCodeProcessorResult &other)
@@ -359,6 +368,10 @@ namespace Slic3r {
 
             // Calculates this block's trapezoid
             void calculate_trapezoid();
+            // Variant planning against an explicit exit feedrate, used by the planner to refresh
+            // the trapezoid of a queued block against the entry speed of its successor without
+            // modifying the stored feedrate profile.
+            void calculate_trapezoid(float exit_feedrate);
 
             float time() const;
         };
@@ -727,9 +740,17 @@ namespace Slic3r {
         // throws CanceledException through print->throw_if_canceled() (sent by the caller as callback).
         void process_file(const std::string& filename, std::function<void()> cancel_callback = nullptr);
 
+        //BBS: try to restore the result of a previous run of process_file() on gcode_filename
+        //from its binary cache, skipping the whole processing. Returns false when no usable
+        //cache exists, leaving the processor untouched.
+        bool load_result_from_binary(const std::string& gcode_filename, const std::string& cache_filename);
+
         // Streaming interface, for processing G-codes just generated by PrusaSlicer in a pipelined fashion.
         void initialize(const std::string& filename);
         void process_buffer(const std::string& buffer);
+        //BBS: variant for callers which already hold a zero terminated buffer,
+        //avoids allocating a std::string per processed chunk
+        void process_buffer(const char* data, size_t data_length);
         void finalize(bool post_process);
 
         float get_time(PrintEstimatedStatistics::ETimeMode mode) const;
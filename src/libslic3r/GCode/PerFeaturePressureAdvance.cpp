@@ -0,0 +1,112 @@
+#include "PerFeaturePressureAdvance.hpp"
+
+#include "GCodeProcessor.hpp"
+#include "../GCodeWriter.hpp"
+#include "../PrintConfig.hpp"
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <cstring>
+
+namespace Slic3r {
+
+PerFeaturePressureAdvance::PerFeaturePressureAdvance(const GCodeWriter &writer, const PrintConfig &config)
+    : m_writer(writer)
+{
+    const size_t num_extruders = config.pressure_advance.values.size();
+    m_overrides.resize(num_extruders);
+    m_base_pa.assign(num_extruders, -1.);
+    for (size_t extruder_id = 0; extruder_id < num_extruders; ++ extruder_id) {
+        if (! config.enable_pressure_advance.get_at(extruder_id))
+            continue;
+        m_base_pa[extruder_id] = config.pressure_advance.get_at(extruder_id);
+        std::string table = config.pressure_advance_per_feature.get_at(extruder_id);
+        std::vector<std::string> entries;
+        boost::split(entries, table, boost::is_any_of(";\n"), boost::token_compress_on);
+        for (std::string &entry : entries) {
+            boost::trim(entry);
+            if (entry.empty())
+                continue;
+            const size_t pos = entry.rfind(':');
+            if (pos == std::string::npos) {
+                BOOST_LOG_TRIVIAL(warning) << "Invalid per feature pressure advance entry: " << entry;
+                continue;
+            }
+            std::string feature = entry.substr(0, pos);
+            boost::trim(feature);
+            const ExtrusionRole role = ExtrusionEntity::string_to_role(feature);
+            if (role == erNone) {
+                BOOST_LOG_TRIVIAL(warning) << "Unknown feature in per feature pressure advance: " << feature;
+                continue;
+            }
+            double value;
+            try {
+                value = std::stod(entry.substr(pos + 1));
+            } catch (const std::exception &) {
+                BOOST_LOG_TRIVIAL(warning) << "Invalid value in per feature pressure advance entry: " << entry;
+                continue;
+            }
+            m_overrides[extruder_id][role] = value;
+            m_enabled = true;
+        }
+    }
+}
+
+double PerFeaturePressureAdvance::target_pressure_advance(ExtrusionRole role) const
+{
+    if (m_current_extruder >= m_overrides.size())
+        return -1.;
+    const auto &overrides = m_overrides[m_current_extruder];
+    if (auto it = overrides.find(role); it != overrides.end())
+        return it->second;
+    return m_base_pa[m_current_extruder];
+}
+
+std::string PerFeaturePressureAdvance::process_layer(std::string &&gcode)
+{
+    if (! m_enabled)
+        return std::move(gcode);
+
+    const std::string &role_tag = ";" + GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Role);
+
+    std::string out;
+    out.reserve(gcode.size() + 256);
+    const char *begin = gcode.c_str();
+    const char *end   = begin + gcode.size();
+    for (const char *line_start = begin; line_start < end; ) {
+        const char *line_end = static_cast<const char*>(memchr(line_start, '\n', end - line_start));
+        const size_t line_len = (line_end == nullptr ? end : line_end + 1) - line_start;
+        out.append(line_start, line_len);
+        if (size_t(end - line_start) > role_tag.size() && strncmp(line_start, role_tag.c_str(), role_tag.size()) == 0) {
+            // Feature tag. Emit a pressure advance command if the upcoming feature requests
+            // a different value than the one currently active.
+            const char *value_start = line_start + role_tag.size();
+            const char *value_end   = line_end == nullptr ? end : line_end;
+            std::string feature(value_start, value_end);
+            boost::trim(feature);
+            const ExtrusionRole role = ExtrusionEntity::string_to_role(feature);
+            if (const double target = this->target_pressure_advance(role);
+                role != erNone && target >= 0. && target != m_current_pa) {
+                out += m_writer.set_pressure_advance(target);
+                m_current_pa = target;
+            }
+        } else if (line_len > 1 && line_start[0] == 'T' && line_start[1] >= '0' && line_start[1] <= '9') {
+            // Toolchange. Track the active extruder and invalidate the cached pressure
+            // advance value: the toolchange G-code emits the new extruder's base value.
+            m_current_extruder = unsigned(atoi(line_start + 1));
+            m_current_pa = -1.;
+        } else if (strncmp(line_start, "M900", 4) == 0 || strncmp(line_start, "M572", 4) == 0 ||
+                   strncmp(line_start, "SET_PRESSURE_ADVANCE", 20) == 0) {
+            // Foreign pressure advance command (toolchange or start G-code). Invalidate
+            // the cached value, the next feature tag re-emits the desired one.
+            m_current_pa = -1.;
+        }
+        line_start += line_len;
+    }
+    return out;
+}
+
+} // namespace Slic3r
@@ -0,0 +1,53 @@
+#ifndef slic3r_PerFeaturePressureAdvance_hpp_
+#define slic3r_PerFeaturePressureAdvance_hpp_
+
+#include "../libslic3r.h"
+#include "../ExtrusionEntity.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Slic3r {
+
+class GCodeWriter;
+class PrintConfig;
+
+// Assigns pressure advance per extrusion feature from the pressure_advance_per_feature
+// config table. Runs as a filter stage of the G-code export pipeline: each generated
+// layer is scanned for the feature tags emitted by the G-code generator and a firmware
+// specific pressure advance command is injected whenever the value of the upcoming
+// feature differs from the value currently active. Features without an override keep
+// the base pressure_advance value of their extruder. Replaces external post-processing
+// scripts rewriting the exported file for the same purpose.
+class PerFeaturePressureAdvance
+{
+public:
+    PerFeaturePressureAdvance(const GCodeWriter &writer, const PrintConfig &config);
+
+    // False if no extruder has both pressure advance enabled and a valid per feature
+    // table, the filter shall not be engaged.
+    bool        enabled() const { return m_enabled; }
+    void        set_current_extruder(unsigned int extruder_id) { m_current_extruder = extruder_id; }
+    std::string process_layer(std::string &&gcode);
+
+private:
+    // Pressure advance to be active for the given feature, -1 if pressure advance
+    // shall not be touched (disabled for the current extruder).
+    double      target_pressure_advance(ExtrusionRole role) const;
+
+    const GCodeWriter                            &m_writer;
+    // Per extruder map of feature overrides parsed from the config table.
+    std::vector<std::map<ExtrusionRole, double>>  m_overrides;
+    // Per extruder base value of the pressure_advance option, -1 if disabled.
+    std::vector<double>                           m_base_pa;
+    bool                                          m_enabled { false };
+    unsigned int                                  m_current_extruder { 0 };
+    // Pressure advance value last set in the stream, -1 if unknown. Unknown forces
+    // re-emission at the next feature tag.
+    double                                        m_current_pa { -1. };
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_PerFeaturePressureAdvance_hpp_
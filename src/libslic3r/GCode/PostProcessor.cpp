@@ -13,6 +13,7 @@
 #include <boost/nowide/fstream.hpp>
 
 // BBS
+#include <cstring>
 #include <iostream>
 #include <fstream>
 
@@ -194,6 +195,47 @@ namespace Slic3r {
 #define L(s) (s)
 #define _(s) Slic3r::I18N::translate(s)
 
+std::string GCodeStreamPostProcessorChain::process(const char *data, size_t size)
+{
+    std::string out;
+    out.reserve(m_buffer.size() + size);
+    const char *pos = data;
+    const char *end = data + size;
+    while (pos != end) {
+        const char *eol = static_cast<const char*>(memchr(pos, '\n', end - pos));
+        if (eol == nullptr) {
+            // Incomplete line, keep it for the next chunk.
+            m_buffer.append(pos, end);
+            break;
+        }
+        m_line.assign(m_buffer);
+        m_buffer.clear();
+        m_line.append(pos, eol + 1);
+        pos = eol + 1;
+        for (const std::unique_ptr<GCodeStreamPostProcessor> &pp : m_post_processors) {
+            pp->process_line(m_line);
+            if (m_line.empty())
+                break;
+        }
+        out += m_line;
+    }
+    return out;
+}
+
+std::string GCodeStreamPostProcessorChain::finalize()
+{
+    if (m_buffer.empty())
+        return {};
+    m_line = std::move(m_buffer);
+    m_buffer.clear();
+    for (const std::unique_ptr<GCodeStreamPostProcessor> &pp : m_post_processors) {
+        pp->process_line(m_line);
+        if (m_line.empty())
+            break;
+    }
+    return std::move(m_line);
+}
+
 // BBS
 void gcode_add_line_number(const std::string& path, const DynamicPrintConfig& config)
 {
@@ -1,13 +1,59 @@
 #ifndef slic3r_GCode_PostProcessor_hpp_
 #define slic3r_GCode_PostProcessor_hpp_
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "../libslic3r.h"
 #include "../PrintConfig.hpp"
 
 namespace Slic3r {
 
+// In-process G-code post processor, applied to the line stream while the G-code is
+// being exported. Unlike the external post-processing scripts below, the whole chain
+// runs in a single pass over the stream without temp files, and the processed text is
+// also fed to the GCodeProcessor, thus the G-code preview and the time estimates stay
+// consistent with the post-processed output.
+class GCodeStreamPostProcessor
+{
+public:
+    virtual ~GCodeStreamPostProcessor() = default;
+    // Name of the post processor for log messages.
+    virtual const char* name() const = 0;
+    // Process a single G-code line including the trailing newline. The line may be
+    // modified in place, cleared to drop it or extended with additional lines.
+    virtual void process_line(std::string &line) = 0;
+};
+
+using GCodeStreamPostProcessorPtrs = std::vector<std::unique_ptr<GCodeStreamPostProcessor>>;
+
+// Splits an arbitrarily chunked character stream into complete G-code lines and runs
+// each line through a chain of GCodeStreamPostProcessors. An incomplete trailing line
+// is buffered until the rest of it arrives or finalize() is called.
+class GCodeStreamPostProcessorChain
+{
+public:
+    explicit GCodeStreamPostProcessorChain(GCodeStreamPostProcessorPtrs &&post_processors)
+        : m_post_processors(std::move(post_processors)) {}
+
+    bool empty() const { return m_post_processors.empty(); }
+
+    // Feed a chunk of the G-code stream, return the processed text of all the complete
+    // lines of the chunk.
+    std::string process(const char *data, size_t size);
+    std::string process(const std::string &data) { return this->process(data.data(), data.size()); }
+    // Process the buffered incomplete last line, if any.
+    std::string finalize();
+
+private:
+    GCodeStreamPostProcessorPtrs m_post_processors;
+    // Incomplete last line of the previously processed chunk.
+    std::string                  m_buffer;
+    // Reused for processing a single line, to not reallocate for each line.
+    std::string                  m_line;
+};
+
 // Run post processing script / scripts if defined.
 // Returns true if a post-processing script was executed.
 // Returns false if no post-processing script was defined.
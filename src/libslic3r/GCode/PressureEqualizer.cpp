@@ -7,6 +7,7 @@
 #include <cstring>
 #include <cfloat>
 #include <algorithm>
+#include <string_view>
 
 #include "../libslic3r.h"
 #include "../PrintConfig.hpp"
@@ -288,7 +289,7 @@ bool PressureEqualizer::process_line(const char *line, const char *line_end, GCo
     buf.max_volumetric_extrusion_rate_slope_negative = 0.f;
 	buf.extrusion_role = m_current_extrusion_role;
 
-    std::string str_line(line, line_end);
+    std::string_view str_line(line, line_end - line);
     const bool found_extrude_set_speed_tag = boost::contains(str_line, EXTRUDE_SET_SPEED_TAG);
     const bool found_extrude_end_tag = boost::contains(str_line, EXTRUDE_END_TAG);
     assert(!found_extrude_set_speed_tag || !found_extrude_end_tag);
@@ -750,7 +751,7 @@ inline void PressureEqualizer::push_to_output(const char *text, const size_t len
     output_buffer[output_buffer_length] = 0;
 }
 
-inline bool is_just_line_with_extrude_set_speed_tag(const std::string &line)
+inline bool is_just_line_with_extrude_set_speed_tag(const std::string_view line)
 {
     if (line.empty() && !boost::starts_with(line, "G1 ") && !boost::ends_with(line, EXTRUDE_SET_SPEED_TAG))
         return false;
@@ -773,8 +774,9 @@ void PressureEqualizer::push_line_to_output(const size_t line_idx, const float n
 {
     const GCodeLine &line = m_gcode_lines[line_idx];
     if (line_idx > 0 && output_buffer_length > 0) {
-        const std::string prev_line_str = std::string(output_buffer.begin() + int(this->output_buffer_prev_length),
-                                                      output_buffer.begin() + int(this->output_buffer_length) + 1);
+        // A view into the output buffer, which is null terminated behind output_buffer_length.
+        const std::string_view prev_line_str(output_buffer.data() + this->output_buffer_prev_length,
+                                             this->output_buffer_length - this->output_buffer_prev_length + 1);
         if (is_just_line_with_extrude_set_speed_tag(prev_line_str))
             this->output_buffer_length = this->output_buffer_prev_length; // Remove the last line because it only sets the speed for an empty block of g-code lines, so it is useless.
         else
@@ -784,9 +786,9 @@ void PressureEqualizer::push_line_to_output(const size_t line_idx, const float n
 
     GCodeG1Formatter feedrate_formatter;
     feedrate_formatter.emit_f(new_feedrate);
-    feedrate_formatter.emit_string(std::string(EXTRUDE_SET_SPEED_TAG.data(), EXTRUDE_SET_SPEED_TAG.length()));
+    feedrate_formatter.emit_string(EXTRUDE_SET_SPEED_TAG);
     if (line.extrusion_role == GCodeExtrusionRole::ExternalPerimeter)
-        feedrate_formatter.emit_string(std::string(EXTERNAL_PERIMETER_TAG.data(), EXTERNAL_PERIMETER_TAG.length()));
+        feedrate_formatter.emit_string(EXTERNAL_PERIMETER_TAG);
     push_to_output(feedrate_formatter);
 
     GCodeG1Formatter extrusion_formatter;
@@ -796,7 +798,7 @@ void PressureEqualizer::push_line_to_output(const size_t line_idx, const float n
     extrusion_formatter.emit_axis('E', m_use_relative_e_distances ? (line.pos_end[3] - line.pos_start[3]) : line.pos_end[3], GCodeFormatter::E_EXPORT_DIGITS);
 
     if (comment != nullptr)
-        extrusion_formatter.emit_string(std::string(comment));
+        extrusion_formatter.emit_string(comment);
 
     push_to_output(extrusion_formatter);
 }
@@ -11,7 +11,9 @@ bool RetractWhenCrossingPerimeters::travel_inside_internal_regions(const Layer &
     if (m_layer != &layer) {
         // Update cache.
         m_layer = &layer;
+        m_last_island = -1;
         m_internal_islands.clear();
+        m_island_bboxes.clear();
         m_aabbtree_internal_islands.clear();
         // Collect expolygons of internal slices.
         for (const LayerRegion *layerm : layer.regions())
@@ -19,27 +21,47 @@ bool RetractWhenCrossingPerimeters::travel_inside_internal_regions(const Layer &
                 if (surface.is_internal())
                     m_internal_islands.emplace_back(&surface.expolygon);
         // Calculate bounding boxes of internal slices.
+        m_island_bboxes.reserve(m_internal_islands.size());
         std::vector<AABBTreeIndirect::BoundingBoxWrapper> bboxes;
         bboxes.reserve(m_internal_islands.size());
-        for (size_t i = 0; i < m_internal_islands.size(); ++ i)
-            bboxes.emplace_back(i, get_extents(*m_internal_islands[i]));
+        for (size_t i = 0; i < m_internal_islands.size(); ++ i) {
+            m_island_bboxes.emplace_back(get_extents(*m_internal_islands[i]));
+            bboxes.emplace_back(i, m_island_bboxes.back());
+        }
         // Build AABB tree over bounding boxes of internal slices.
         m_aabbtree_internal_islands.build_modify_input(bboxes);
     }
 
-    BoundingBox           bbox_travel = get_extents(travel);
-    AABBTree::BoundingBox bbox_travel_eigen{ bbox_travel.min, bbox_travel.max };
-    int result = -1;
+    const BoundingBox     bbox_travel_exact = get_extents(travel);
+    AABBTree::BoundingBox bbox_travel_eigen{ bbox_travel_exact.min, bbox_travel_exact.max };
+    BoundingBox           bbox_travel = bbox_travel_exact;
     bbox_travel.offset(SCALED_EPSILON);
-    AABBTreeIndirect::traverse(m_aabbtree_internal_islands, 
+
+    // The travel can only be completely inside an island if its bounding box is,
+    // which makes the bounding box test both a cheap reject before the Clipper
+    // diff and a way to re-test the previous winner first: consecutive travels
+    // usually stay inside the same island, skipping the tree walk entirely.
+    auto travel_inside_island = [this, &travel, &bbox_travel](size_t island_idx) {
+        Polygons clipped = ClipperUtils::clip_clipper_polygons_with_subject_bbox(*m_internal_islands[island_idx], bbox_travel);
+        return diff_pl(travel, clipped).empty();
+    };
+    if (m_last_island >= 0 && m_island_bboxes[m_last_island].contains(bbox_travel_exact) &&
+        travel_inside_island(size_t(m_last_island)))
+        return true;
+
+    int result = -1;
+    AABBTreeIndirect::traverse(m_aabbtree_internal_islands,
         [&bbox_travel_eigen](const AABBTree::Node &node) {
             return bbox_travel_eigen.intersects(node.bbox);
         },
-        [&travel, &bbox_travel, &result, &islands = m_internal_islands](const AABBTree::Node &node) {
+        [&bbox_travel_eigen, &result, &travel_inside_island](const AABBTree::Node &node) {
             assert(node.is_leaf());
             assert(node.is_valid());
-            Polygons clipped = ClipperUtils::clip_clipper_polygons_with_subject_bbox(*islands[node.idx], bbox_travel);
-            if (diff_pl(travel, clipped).empty()) {
+            if (! node.bbox.contains(bbox_travel_eigen))
+                // The travel sticks out of this island's bounding box, it cannot
+                // be contained. Continue traversal without clipping.
+                return true;
+            if (travel_inside_island(node.idx)) {
                 // Travel path is completely inside an "internal" island. Don't retract.
                 result = int(node.idx);
                 // Stop traversal.
@@ -48,6 +70,7 @@ bool RetractWhenCrossingPerimeters::travel_inside_internal_regions(const Layer &
             // Continue traversal.
             return true;
         });
+    m_last_island = result;
     return result != -1;
 }
 
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "../AABBTreeIndirect.hpp"
+#include "../BoundingBox.hpp"
 
 namespace Slic3r {
 
@@ -22,6 +23,11 @@ private:
     const Layer                        *m_layer;
     // Internal islands only, referencing data owned by m_layer->regions()->surfaces().
     std::vector<const ExPolygon*>       m_internal_islands;
+    // Bounding boxes of m_internal_islands, used to reject islands that cannot
+    // contain a travel before clipping it against their contours.
+    std::vector<BoundingBox>            m_island_bboxes;
+    // Island the previous travel was found inside, tested first for the next travel.
+    int                                 m_last_island = -1;
     // Search structure over internal islands.
     using AABBTree = AABBTreeIndirect::Tree<2, coord_t>;
     AABBTree                            m_aabbtree_internal_islands;
@@ -8,6 +8,8 @@
 #include <boost/log/trivial.hpp>
 #include <random>
 #include <algorithm>
+#include <deque>
+#include <mutex>
 #include <queue>
 
 #include "libslic3r/AABBTreeLines.hpp"
@@ -615,9 +617,76 @@ std::pair<size_t, size_t> find_previous_and_next_perimeter_point(const std::vect
   return {size_t(prev),size_t(next)};
 }
 
+// The raycasted visibility field is a pure function of the object mesh geometry and its transformation,
+// thus it may be reused between exports as long as the geometry did not change. It is stored process wide,
+// keyed by the shared mesh pointers and transformations of the object volumes, capped to a couple of objects.
+struct VisibilityCacheKey {
+  struct VolumeKey {
+    const TriangleMesh *mesh;
+    Transform3d         trafo;
+    bool                negative;
+  };
+  Transform3d            obj_transform;
+  std::vector<VolumeKey> volumes;
+
+  bool operator==(const VisibilityCacheKey &rhs) const {
+    if (obj_transform.matrix() != rhs.obj_transform.matrix() || volumes.size() != rhs.volumes.size())
+      return false;
+    for (size_t i = 0; i < volumes.size(); ++i)
+      if (volumes[i].mesh != rhs.volumes[i].mesh || volumes[i].negative != rhs.volumes[i].negative ||
+          volumes[i].trafo.matrix() != rhs.volumes[i].trafo.matrix())
+        return false;
+    return true;
+  }
+};
+
+struct VisibilityCacheEntry {
+  VisibilityCacheKey key;
+  TriangleSetSamples mesh_samples;
+  std::vector<float> mesh_samples_visibility;
+  float              mesh_samples_radius;
+};
+
+static std::mutex                       s_visibility_cache_mutex;
+// Most recently used entry first.
+static std::deque<VisibilityCacheEntry> s_visibility_cache;
+static constexpr size_t                 visibility_cache_capacity = 4;
+
+static VisibilityCacheKey visibility_cache_key(const PrintObject *po) {
+  VisibilityCacheKey key;
+  key.obj_transform = po->trafo_centered();
+  key.volumes.reserve(po->model_object()->volumes.size());
+  for (const ModelVolume *model_volume : po->model_object()->volumes)
+    if (model_volume->type() == ModelVolumeType::MODEL_PART
+        || model_volume->type() == ModelVolumeType::NEGATIVE_VOLUME)
+      key.volumes.push_back({ model_volume->mesh_ptr().get(), model_volume->get_matrix(),
+                              model_volume->type() == ModelVolumeType::NEGATIVE_VOLUME });
+  return key;
+}
+
 // Computes all global model info - transforms object, performs raycasting
 void compute_global_occlusion(GlobalModelInfo &result, const PrintObject *po,
                               std::function<void(void)> throw_if_canceled) {
+  VisibilityCacheKey cache_key = visibility_cache_key(po);
+  {
+    std::lock_guard<std::mutex> lock(s_visibility_cache_mutex);
+    auto cache_it = std::find_if(s_visibility_cache.begin(), s_visibility_cache.end(),
+                                 [&cache_key](const VisibilityCacheEntry &entry) { return entry.key == cache_key; });
+    if (cache_it != s_visibility_cache.end()) {
+      BOOST_LOG_TRIVIAL(debug)
+          << "SeamPlacer: reusing cached visibility field";
+      result.mesh_samples            = cache_it->mesh_samples;
+      result.mesh_samples_visibility = cache_it->mesh_samples_visibility;
+      result.mesh_samples_radius     = cache_it->mesh_samples_radius;
+      result.mesh_samples_coordinate_functor = CoordinateFunctor(&result.mesh_samples.positions);
+      result.mesh_samples_tree = KDTreeIndirect<3, float, CoordinateFunctor>(result.mesh_samples_coordinate_functor,
+                                                                             result.mesh_samples.positions.size());
+      if (cache_it != s_visibility_cache.begin())
+        std::rotate(s_visibility_cache.begin(), cache_it, std::next(cache_it));
+      return;
+    }
+  }
+
   BOOST_LOG_TRIVIAL(debug)
       << "SeamPlacer: gather occlusion meshes: start";
   auto obj_transform = po->trafo_centered();
@@ -694,6 +763,14 @@ void compute_global_occlusion(GlobalModelInfo &result, const PrintObject *po,
   result.mesh_samples_visibility = raycast_visibility(raycasting_tree, triangle_set, result.mesh_samples,
                                                       negative_volumes_start_index);
   throw_if_canceled();
+
+  {
+    std::lock_guard<std::mutex> lock(s_visibility_cache_mutex);
+    s_visibility_cache.push_front({ std::move(cache_key), result.mesh_samples, result.mesh_samples_visibility,
+                                    result.mesh_samples_radius });
+    if (s_visibility_cache.size() > visibility_cache_capacity)
+      s_visibility_cache.pop_back();
+  }
 #ifdef DEBUG_FILES
   result.debug_export(triangle_set);
 #endif
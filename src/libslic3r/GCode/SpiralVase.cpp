@@ -27,10 +27,14 @@ std::string SpiralVase::process_layer(const std::string &gcode)
     float z = 0.f;
     
     {
-        //FIXME Performance warning: This copies the GCodeConfig of the reader.
-        GCodeReader r = m_reader;  // clone
+        // Run the measurement pass on m_reader itself and roll its position back
+        // afterwards. Cloning the reader would copy its embedded GCodeConfig for
+        // every layer, which is far more expensive than the parse itself.
+        const float saved_x = m_reader.x(), saved_y = m_reader.y(), saved_z = m_reader.z(),
+                    saved_e = m_reader.e(), saved_f = m_reader.f(),
+                    saved_i = m_reader.i(), saved_j = m_reader.j();
         bool set_z = false;
-        r.parse_buffer(gcode, [&total_layer_length, &layer_height, &z, &set_z]
+        m_reader.parse_buffer(gcode, [&total_layer_length, &layer_height, &z, &set_z]
             (GCodeReader &reader, const GCodeReader::GCodeLine &line) {
             if (line.cmd_is("G1")) {
                 if (line.extruding(reader)) {
@@ -44,12 +48,18 @@ std::string SpiralVase::process_layer(const std::string &gcode)
                 }
             }
         });
+        m_reader.x() = saved_x; m_reader.y() = saved_y; m_reader.z() = saved_z;
+        m_reader.e() = saved_e; m_reader.f() = saved_f;
+        m_reader.i() = saved_i; m_reader.j() = saved_j;
     }
     
     // Remove layer height from initial Z.
     z -= layer_height;
     
     std::string new_gcode;
+    // The transform only rewrites Z (and E on the transition layer) of existing
+    // lines, the output is about the size of the input.
+    new_gcode.reserve(gcode.size() + gcode.size() / 8);
     //FIXME Tapering of the transition layer only works reliably with relative extruder distances.
     // For absolute extruder distances it will be switched off.
     // Tapering the absolute extruder distances requires to process every extrusion value after the first transition
@@ -64,7 +74,7 @@ std::string SpiralVase::process_layer(const std::string &gcode)
                 // If this is the initial Z move of the layer, replace it with a
                 // (redundant) move to the last Z of previous layer.
                 line.set(reader, Z, z);
-                new_gcode += line.raw() + '\n';
+                new_gcode += line.raw(); new_gcode += '\n';
                 return;
             } else {
                 float dist_XY = line.dist_XY(reader);
@@ -76,7 +86,7 @@ std::string SpiralVase::process_layer(const std::string &gcode)
                         if (transition && line.has(E))
                             // Transition layer, modulate the amount of extrusion from zero to the final value.
                             line.set(reader, E, line.value(E) * len / total_layer_length);
-                        new_gcode += line.raw() + '\n';
+                        new_gcode += line.raw(); new_gcode += '\n';
                     }
                     return;
                 
@@ -88,7 +98,7 @@ std::string SpiralVase::process_layer(const std::string &gcode)
                 }
             }
         }
-        new_gcode += line.raw() + '\n';
+        new_gcode += line.raw(); new_gcode += '\n';
     });
     
     return new_gcode;
@@ -7,6 +7,9 @@ void ThumbnailData::set(unsigned int w, unsigned int h)
     if ((w == 0) || (h == 0))
         return;
 
+    //BBS: the caller is about to overwrite the pixels
+    ++version;
+
     if ((width != w) || (height != h))
     {
         width = w;
@@ -22,6 +25,7 @@ void ThumbnailData::reset()
     width = 0;
     height = 0;
     pixels.clear();
+    ++version;
 }
 
 bool ThumbnailData::is_valid() const
@@ -15,6 +15,10 @@ struct ThumbnailData
     unsigned int width;
     unsigned int height;
     std::vector<unsigned char> pixels;
+    //BBS: bumped on every regeneration or reset, so consumers can cache
+    //data derived from the pixels (e.g. GL textures) and refresh it only
+    //when the thumbnail actually changed
+    size_t version{ 0 };
 
     ThumbnailData() { reset(); }
     void set(unsigned int w, unsigned int h);
@@ -14,6 +14,7 @@
 #include <string_view>
 
 #include <boost/beast/core/detail/base64.hpp>
+#include <tbb/parallel_for.h>
 
 namespace Slic3r::GCodeThumbnails {
 
@@ -41,11 +42,18 @@ inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb,
     if (thumbnail_cb != nullptr) {
         static constexpr const size_t max_row_length = 78;
         ThumbnailsList                thumbnails     = thumbnail_cb(ThumbnailsParams{sizes, true, true, true, true, plate_id});
+        // Compress the thumbnails in parallel, the loop below writes them out in their original order.
+        std::vector<std::unique_ptr<CompressedImageBuffer>> compressed_thumbnails(thumbnails.size());
+        tbb::parallel_for(size_t(0), thumbnails.size(), [&thumbnails, &compressed_thumbnails, format](size_t idx) {
+            if (thumbnails[idx].is_valid())
+                compressed_thumbnails[idx] = compress_thumbnail(thumbnails[idx], format);
+        });
         short                         i              = 0;
-        for (const ThumbnailData &data : thumbnails) {
+        for (size_t idx = 0; idx < thumbnails.size(); ++idx) {
+            const ThumbnailData &data = thumbnails[idx];
             if (data.is_valid()) {
                 output("; THUMBNAIL_BLOCK_START\n");
-                auto compressed = compress_thumbnail(data, format);
+                const std::unique_ptr<CompressedImageBuffer> &compressed = compressed_thumbnails[idx];
                 if (compressed->data && compressed->size) {
                     if (format == GCodeThumbnailsFormat::BTT_TFT) {
                         // write BTT_TFT header
@@ -61,14 +69,10 @@ inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb,
                         output((boost::format("\n;\n; %s begin %dx%d %d\n") % compressed->tag() % data.width % data.height % encoded.size())
                                    .str()
                                    .c_str());                        
-                        while (encoded.size() > max_row_length) {
-                            output((boost::format("; %s\n") % encoded.substr(0, max_row_length)).str().c_str());
-                            encoded = encoded.substr(max_row_length);
-                        }
-
-                        // Orca write remaining ecoded data
-                        if (encoded.size() > 0)
-                            output((boost::format("; %s\n") % encoded).str().c_str());
+                        // Orca: write the rows by offset instead of repeatedly shifting the whole
+                        // remainder, which was quadratic in the size of the encoded data
+                        for (size_t pos = 0; pos < encoded.size(); pos += max_row_length)
+                            output((boost::format("; %s\n") % encoded.substr(pos, max_row_length)).str().c_str());
 
                         output((boost::format("; %s end\n") % compressed->tag()).str().c_str());
                     }
@@ -15,6 +15,9 @@
 #include <limits>
 #include <algorithm>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <libslic3r.h>
 
 namespace Slic3r {
@@ -383,20 +386,30 @@ void ToolOrdering::collect_extruders(const PrintObject &object, const std::vecto
         }
     }
 
-    // Extruder overrides are ordered by print_z.
-    std::vector<std::pair<double, unsigned int>>::const_iterator it_per_layer_extruder_override;
-	it_per_layer_extruder_override = per_layer_extruder_switches.begin();
-    unsigned int extruder_override = 0;
+    // Extruder overrides are ordered by print_z. Resolve the active override for each object layer up front,
+    // the per-layer scan below is then independent per layer and may run in parallel: layers of a single object
+    // have strictly increasing print_z, thus each task writes into its own LayerTools.
+    std::vector<unsigned int> extruder_overrides(object.layers().size(), 0);
+    {
+        auto         it_per_layer_extruder_override = per_layer_extruder_switches.begin();
+        unsigned int extruder_override              = 0;
+        for (size_t layer_idx = 0; layer_idx < object.layers().size(); ++ layer_idx) {
+            const Layer *layer = object.layers()[layer_idx];
+            for (; it_per_layer_extruder_override != per_layer_extruder_switches.end() && it_per_layer_extruder_override->first < layer->print_z + EPSILON; ++ it_per_layer_extruder_override)
+                extruder_override = (int)it_per_layer_extruder_override->second;
+            extruder_overrides[layer_idx] = extruder_override;
+        }
+    }
 
     // Collect the object extruders.
-    for (auto layer : object.layers()) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, object.layers().size()),
+        [this, &object, &extruder_overrides](const tbb::blocked_range<size_t> &range) {
+      for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+        const Layer *layer = object.layers()[layer_idx];
         LayerTools &layer_tools = this->tools_for_layer(layer->print_z);
 
-        // Override extruder with the next 
-    	for (; it_per_layer_extruder_override != per_layer_extruder_switches.end() && it_per_layer_extruder_override->first < layer->print_z + EPSILON; ++ it_per_layer_extruder_override)
-    		extruder_override = (int)it_per_layer_extruder_override->second;
-
         // Store the current extruder override (set to zero if no overriden), so that layer_tools.wiping_extrusions().is_overridable_and_mark() will use it.
+        unsigned int extruder_override = extruder_overrides[layer_idx];
         layer_tools.extruder_override = extruder_override;
 
         // What extruders are required to print this object layer?
@@ -449,7 +462,8 @@ void ToolOrdering::collect_extruders(const PrintObject &object, const std::vecto
             if (has_solid_infill || has_infill)
                 layer_tools.has_object = true;
         }
-    }
+      }
+    });
 
     for (auto& layer : m_layer_tools) {
         // Sort and remove duplicates
@@ -1462,30 +1462,28 @@ void WipeTower::plan_tower()
         }
     }
 
-	// Calculate m_wipe_tower_depth (maximum depth for all the layers) and propagate depths downwards
+	// Calculate m_wipe_tower_depth (maximum depth for all the layers) and propagate depths downwards.
+	// A layer must be at least as deep as all the layers above it, so the depths form a running
+	// maximum towards the bottom and each layer derives its depth from the one directly above
+	// in a single reverse pass.
 	m_wipe_tower_depth = 0.f;
-	for (auto& layer : m_plan)
-		layer.depth = 0.f;
-	
+
     float max_depth_for_all = 0;
+    float depth_above = 0.f;
     for (int layer_index = int(m_plan.size()) - 1; layer_index >= 0; --layer_index)
 	{
-		float this_layer_depth = std::max(m_plan[layer_index].depth, m_plan[layer_index].toolchanges_depth());
+		float this_layer_depth = std::max(depth_above, m_plan[layer_index].toolchanges_depth());
         if (m_enable_timelapse_print && this_layer_depth < EPSILON)
             this_layer_depth = min_wipe_tower_depth;
 
 		m_plan[layer_index].depth = this_layer_depth;
-		
+
 		if (this_layer_depth > m_wipe_tower_depth - m_perimeter_width)
 			m_wipe_tower_depth = this_layer_depth + m_perimeter_width;
 
-		for (int i = layer_index - 1; i >= 0 ; i--)
-		{
-			if (m_plan[i].depth - this_layer_depth < 2*m_perimeter_width )
-				m_plan[i].depth = this_layer_depth;
-		}
+		depth_above = this_layer_depth;
 
-        if (m_enable_timelapse_print && layer_index == 0) 
+        if (m_enable_timelapse_print && layer_index == 0)
             max_depth_for_all = m_plan[0].depth;
     }
 
@@ -3,6 +3,8 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <boost/nowide/cstdio.hpp>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -13,6 +15,21 @@
 #include <Shiny/Shiny.h>
 #include <fast_float/fast_float.h>
 
+// We are using quite an old TBB 2017 U7. Before we update our build servers, let's use the old API, which is deprecated in up to date TBB.
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if ! defined(TBB_VERSION_MAJOR)
+    static_assert(false, "TBB_VERSION_MAJOR not defined");
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
+
 namespace Slic3r {
 
 void GCodeReader::apply_config(const GCodeConfig &config)
@@ -25,6 +42,35 @@ void GCodeReader::apply_config(const DynamicPrintConfig &config)
     m_config.apply(config, true);
 }
 
+// Scan for the first end-of-line character reading eight bytes at a time (SWAR).
+// A zero byte inside x makes ((x - 0x0101..) & ~x & 0x8080..) non zero and a particular
+// byte value is matched by XORing x with its broadcast first. Once a word contains a match,
+// the exact position is resolved by the byte-wise tail loop, which keeps the scan portable
+// across endianness. The '\0' sentinel terminating in-memory G-code buffers is only treated
+// as an end of line when include_nul is set, matching the semantics of is_end_of_line().
+template<bool include_nul>
+static inline const char* find_end_of_line(const char *begin, const char *end)
+{
+    constexpr uint64_t ones  = 0x0101010101010101ull;
+    constexpr uint64_t highs = 0x8080808080808080ull;
+    constexpr uint64_t crs   = 0x0d0d0d0d0d0d0d0dull;
+    constexpr uint64_t lfs   = 0x0a0a0a0a0a0a0a0aull;
+    const char *c = begin;
+    for (; end - c >= 8; c += 8) {
+        uint64_t x;
+        memcpy(&x, c, 8);
+        uint64_t m = (((x ^ crs) - ones) & ~(x ^ crs) & highs) |
+                     (((x ^ lfs) - ones) & ~(x ^ lfs) & highs);
+        if (include_nul)
+            m |= (x - ones) & ~x & highs;
+        if (m != 0)
+            break;
+    }
+    for (; c != end && *c != '\r' && *c != '\n' && ! (include_nul && *c == 0); ++ c)
+        ; // silence -Wempty-body
+    return c;
+}
+
 const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, GCodeLine &gline, std::pair<const char*, const char*> &command)
 {
     PROFILE_FUNC();
@@ -85,8 +131,8 @@ const char* GCodeReader::parse_line_internal(const char *ptr, const char *end, G
     if (gline.has(E) && m_config.use_relative_e_distances)
         m_position[E] = 0;
 
-    // Skip the rest of the line.
-    for (; ! is_end_of_line(*c); ++ c);
+    // Skip the rest of the line (the comment), eight bytes at a time.
+    c = find_end_of_line<true>(c, end);
 
     // Copy the raw string including the comment, without the trailing newlines.
     if (c > ptr) {
@@ -126,55 +172,87 @@ bool GCodeReader::parse_file_raw_internal(const std::string &filename, ParseLine
 {
     FilePtr in{ boost::nowide::fopen(filename.c_str(), "rb") };
 
-    // Read the input stream 64kB at a time, extract lines and process them.
-    std::vector<char> buffer(65536 * 10, 0);
-    // Line buffer.
+    // Read the input stream 640kB at a time by a dedicated pipeline stage, so the blocking reads
+    // overlap with extracting and parsing the lines of the preceding chunk. Line parsing remains
+    // strictly sequential: the per-line callbacks mutate the reader state (position, config),
+    // thus both filters are serial and only the read of the next chunk runs ahead.
+    struct Chunk {
+        std::vector<char> buffer;
+        size_t            file_pos { 0 };
+        bool              eof { false };
+    };
+    // Line buffer for lines spanning chunk boundaries.
     std::string gcode_line;
-    size_t file_pos = 0;
+    size_t      file_pos = 0;
+    bool        read_failed = false;
+    bool        eof_reached = false;
     m_parsing = true;
-    for (;;) {
-        size_t cnt_read = ::fread(buffer.data(), 1, buffer.size(), in.f);
-        if (::ferror(in.f))
-            return false;
-        bool eof       = cnt_read == 0;
-        auto it        = buffer.begin();
-        auto it_bufend = buffer.begin() + cnt_read;
-        while (it != it_bufend || (eof && ! gcode_line.empty())) {
-            // Find end of line.
-            bool eol    = false;
-            auto it_end = it;
-            for (; it_end != it_bufend && ! (eol = *it_end == '\r' || *it_end == '\n'); ++ it_end)
-                if (*it_end == '\n')
-                    line_end_callback(file_pos + (it_end - buffer.begin()) + 1);
-            // End of line is indicated also if end of file was reached.
-            eol |= eof && it_end == it_bufend;
-            if (eol) {
-                if (gcode_line.empty())
-                    parse_line_callback(&(*it), &(*it_end));
-                else {
+
+    const auto read_chunk = tbb::make_filter<void, Chunk>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &in, &file_pos, &read_failed, &eof_reached](tbb::flow_control &fc) -> Chunk {
+            Chunk chunk;
+            if (! m_parsing || read_failed || eof_reached) {
+                fc.stop();
+                return chunk;
+            }
+            chunk.buffer.resize(65536 * 10);
+            size_t cnt_read = ::fread(chunk.buffer.data(), 1, chunk.buffer.size(), in.f);
+            if (::ferror(in.f)) {
+                read_failed = true;
+                fc.stop();
+                return chunk;
+            }
+            chunk.buffer.resize(cnt_read);
+            chunk.file_pos = file_pos;
+            chunk.eof      = cnt_read == 0;
+            eof_reached    = chunk.eof;
+            file_pos += cnt_read;
+            return chunk;
+        });
+    const auto parse_chunk = tbb::make_filter<Chunk, void>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &gcode_line, parse_line_callback, line_end_callback](Chunk chunk) {
+            if (! m_parsing)
+                return;
+            bool eof       = chunk.eof;
+            auto it        = chunk.buffer.begin();
+            auto it_bufend = chunk.buffer.end();
+            while (it != it_bufend || (eof && ! gcode_line.empty())) {
+                // Find end of line, eight bytes at a time.
+                bool eol    = false;
+                auto it_end = it;
+                if (it != it_bufend) {
+                    const char *pend = find_end_of_line<false>(&(*it), chunk.buffer.data() + chunk.buffer.size());
+                    it_end = chunk.buffer.begin() + (pend - chunk.buffer.data());
+                    eol    = it_end != it_bufend;
+                }
+                // End of line is indicated also if end of file was reached.
+                eol |= eof && it_end == it_bufend;
+                if (eol) {
+                    if (gcode_line.empty() && it != it_bufend)
+                        parse_line_callback(&(*it), &(*it) + (it_end - it));
+                    else {
+                        gcode_line.insert(gcode_line.end(), it, it_end);
+                        parse_line_callback(gcode_line.c_str(), gcode_line.c_str() + gcode_line.size());
+                        gcode_line.clear();
+                    }
+                    if (! m_parsing)
+                        // The callback wishes to exit.
+                        return;
+                } else
                     gcode_line.insert(gcode_line.end(), it, it_end);
-                    parse_line_callback(gcode_line.c_str(), gcode_line.c_str() + gcode_line.size());
-                    gcode_line.clear();
+                // Skip EOL.
+                it = it_end;
+                if (it != it_bufend && *it == '\r')
+                    ++ it;
+                if (it != it_bufend && *it == '\n') {
+                    line_end_callback(chunk.file_pos + (it - chunk.buffer.begin()) + 1);
+                    ++ it;
                 }
-                if (! m_parsing)
-                    // The callback wishes to exit.
-                    return true;
-            } else
-                gcode_line.insert(gcode_line.end(), it, it_end);
-            // Skip EOL.
-            it = it_end; 
-            if (it != it_bufend && *it == '\r')
-                ++ it;
-            if (it != it_bufend && *it == '\n') {
-                line_end_callback(file_pos + (it - buffer.begin()) + 1);
-                ++ it;
             }
-        }
-        if (eof)
-            break;
-        file_pos += cnt_read;
-    }
-    return true;
+        });
+    // Two tokens: one chunk being parsed, the next one being read from the disk.
+    tbb::parallel_pipeline(2, read_chunk & parse_chunk);
+    return ! read_failed;
 }
 
 template<typename ParseLineCallback, typename LineEndCallback>
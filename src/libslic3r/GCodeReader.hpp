@@ -95,12 +95,18 @@ public:
 
     template<typename Callback>
     void parse_buffer(const std::string &buffer, Callback callback)
+        { this->parse_buffer(buffer.c_str(), buffer.c_str() + buffer.size(), callback); }
+
+    //BBS: variant avoiding the std::string copy for callers which already hold
+    //a zero terminated buffer. The buffer must be terminated by a zero character,
+    //as the line parser uses it as a sentinel.
+    template<typename Callback>
+    void parse_buffer(const char *begin, const char *end, Callback callback)
     {
-        const char *ptr = buffer.c_str();
-        const char *end = ptr + buffer.size();
+        const char *ptr = begin;
         GCodeLine gline;
         m_parsing = true;
-        while (m_parsing && *ptr != 0) {
+        while (m_parsing && ptr != end && *ptr != 0) {
             gline.reset();
             ptr = this->parse_line(ptr, end, gline, callback);
         }
@@ -3,6 +3,7 @@
 
 #include "libslic3r.h"
 #include <string>
+#include <string_view>
 #include <charconv>
 #include "Extruder.hpp"
 #include "Point.hpp"
@@ -64,6 +65,8 @@ public:
     std::string toolchange_prefix() const;
     std::string toolchange(unsigned int extruder_id);
     std::string set_speed(double F, const std::string &comment = std::string(), const std::string &cooling_marker = std::string());
+    // Variant appending directly into an existing buffer, saving a temporary std::string per emitted line.
+    void        set_speed_to(std::string &gcode, double F, const std::string &comment = std::string(), const std::string &cooling_marker = std::string());
     // SoftFever NOTE: the returned speed is mm/minute
     double      get_current_speed() const { return m_current_speed;}
     std::string travel_to_xy(const Vec2d &point, const std::string &comment = std::string());
@@ -71,8 +74,11 @@ public:
     std::string travel_to_z(double z, const std::string &comment = std::string());
     bool        will_move_z(double z) const;
     std::string extrude_to_xy(const Vec2d &point, double dE, const std::string &comment = std::string(), bool force_no_extrusion = false);
+    // Variant appending directly into an existing buffer, saving a temporary std::string per emitted line.
+    void        extrude_to_xy_to(std::string &gcode, const Vec2d &point, double dE, const std::string &comment = std::string(), bool force_no_extrusion = false);
     //BBS: generate G2 or G3 extrude which moves by arc
     std::string extrude_arc_to_xy(const Vec2d &point, const Vec2d &center_offset, double dE, const bool is_ccw, const std::string &comment = std::string(), bool force_no_extrusion = false);
+    void        extrude_arc_to_xy_to(std::string &gcode, const Vec2d &point, const Vec2d &center_offset, double dE, const bool is_ccw, const std::string &comment = std::string(), bool force_no_extrusion = false);
     std::string extrude_to_xyz(const Vec3d &point, double dE, const std::string &comment = std::string(), bool force_no_extrusion = false);
     std::string retract(bool before_wipe = false);
     std::string retract_for_toolchange(bool before_wipe = false);
@@ -241,8 +247,8 @@ public:
         this->emit_axis('J', point.y(), XYZF_EXPORT_DIGITS);
     }
 
-    void emit_string(const std::string &s) {
-        strncpy(ptr_err.ptr, s.c_str(), s.size());
+    void emit_string(const std::string_view s) {
+        memcpy(ptr_err.ptr, s.data(), s.size());
         ptr_err.ptr += s.size();
     }
 
@@ -258,6 +264,13 @@ public:
         return std::string(this->buf, ptr_err.ptr - buf);
     }
 
+    // Append the formatted command directly into an existing buffer, saving the allocation
+    // of a temporary std::string on the hot extrusion path.
+    void string_to(std::string &out) {
+        *ptr_err.ptr ++ = '\n';
+        out.append(this->buf, ptr_err.ptr - buf);
+    }
+
 protected:
     static constexpr const size_t   buflen = 256;
     char                            buf[buflen];
@@ -136,6 +136,15 @@ ExPolygons Layer::merged(float offset_scaled) const
     return out;
 }
 
+const Polygons& Layer::lslices_expanded(coord_t grow) const
+{
+    std::lock_guard<std::mutex> lock(m_lslices_expanded_mutex);
+    auto it = m_lslices_expanded.find(grow);
+    if (it == m_lslices_expanded.end())
+        it = m_lslices_expanded.emplace(grow, offset(this->lslices, float(grow))).first;
+    return it->second;
+}
+
 // Here the perimeters are created cummulatively for all layer regions sharing the same parameters influencing the perimeters.
 // The perimeter paths and the thin fills (ExtrusionEntityCollection) are assigned to the first compatible layer region.
 // The resulting fill surface is split back among the originating regions.
@@ -6,6 +6,9 @@
 #include "SurfaceCollection.hpp"
 #include "ExtrusionEntityCollection.hpp"
 #include "BoundingBox.hpp"
+
+#include <map>
+#include <mutex>
 namespace Slic3r {
 
 class ExPolygon;
@@ -170,6 +173,10 @@ public:
     void                    restore_untyped_slices_no_extra_perimeters();
     // Slices merged into islands, to be used by the elephant foot compensation to trim the individual surfaces with the shrunk merged slices.
     ExPolygons              merged(float offset) const;
+    // Overhang index: lslices of this layer grown by the given scaled offset, lazily computed and cached,
+    // so that overhang classification of all the regions of the layer above shares a single Clipper offset
+    // per distinct grow value instead of re-deriving the lower layer coverage per region.
+    const Polygons&         lslices_expanded(coord_t grow) const;
     template <class T> bool any_internal_region_slice_contains(const T &item) const {
         for (const LayerRegion *layerm : m_regions) if (layerm->slices.any_internal_contains(item)) return true;
         return false;
@@ -258,6 +265,9 @@ private:
     size_t              m_id;
     PrintObject        *m_object;
     LayerRegionPtrs     m_regions;
+    // Cache of lslices_expanded(), guarded by a mutex since the layers above are processed in parallel.
+    mutable std::map<coord_t, Polygons> m_lslices_expanded;
+    mutable std::mutex                  m_lslices_expanded_mutex;
 };
 
 enum SupportInnerType {
@@ -33,6 +33,7 @@
 
 #include "libslic3r/Geometry/ConvexHull.hpp"
 
+#include <atomic>
 #include <float.h>
 
 #include <boost/algorithm/string/predicate.hpp>
@@ -1168,6 +1169,8 @@ ModelVolume* ModelObject::add_volume(const ModelVolume &other, TriangleMesh &&me
 ModelVolume* ModelObject::add_volume_with_shared_mesh(const ModelVolume &other, ModelVolumeType type /*= ModelVolumeType::INVALID*/)
 {
     ModelVolume* v = new ModelVolume(this, other.m_mesh);
+    // The convex hull is derived from the shared mesh, thus it may be shared as well.
+    v->m_convex_hull = other.m_convex_hull;
     if (type != ModelVolumeType::INVALID && v->type() != type)
         v->set_type(type);
     this->volumes.push_back(v);
@@ -1625,9 +1628,9 @@ void ModelObject::convert_units(ModelObjectPtrs& new_objects, ConversionType con
     int vol_idx = 0;
     for (ModelVolume* volume : volumes) {
         if (!volume->mesh().empty()) {
-            TriangleMesh mesh(volume->mesh());
-
-            ModelVolume* vol = new_object->add_volume(mesh);
+            // Share the source volume's immutable mesh and convex hull. scale_geometry_after_creation()
+            // below is copy-on-write, thus only the volumes which are actually converted pay for a copy.
+            ModelVolume* vol = new_object->add_volume_with_shared_mesh(*volume, volume->type());
             vol->name = volume->name;
             vol->set_type(volume->type());
             // Don't copy the config's ID.
@@ -2297,6 +2300,12 @@ bool ModelObject::has_solid_mesh() const
     return false;
 }
 
+uint64_t ModelVolume::next_mesh_revision()
+{
+    static std::atomic<uint64_t> s_mesh_revision_counter{ 0 };
+    return ++ s_mesh_revision_counter;
+}
+
 void ModelVolume::set_material_id(t_model_material_id material_id)
 {
     m_material_id = material_id;
@@ -2663,14 +2672,24 @@ void ModelVolume::mirror(Axis axis)
     set_mirror(mirror);
 }
 
-// This method could only be called before the meshes of this ModelVolumes are not shared!
+// Copy-on-write: if the mesh buffers are shared with another ModelVolume, they are replaced
+// with scaled copies, otherwise they are scaled in place.
 void ModelVolume::scale_geometry_after_creation(const Vec3f& versor)
 {
-	const_cast<TriangleMesh*>(m_mesh.get())->scale(versor);
-    if (m_convex_hull->empty())
+    if (m_mesh.use_count() > 1) {
+        TriangleMesh mesh(*m_mesh);
+        mesh.scale(versor);
+        m_mesh = std::make_shared<const TriangleMesh>(std::move(mesh));
+    } else
+        const_cast<TriangleMesh*>(m_mesh.get())->scale(versor);
+    if (! m_convex_hull || m_convex_hull->empty())
         //BBS: recompute the convex hull if it is null for previous too small
         this->calculate_convex_hull();
-    else
+    else if (m_convex_hull.use_count() > 1) {
+        TriangleMesh convex_hull(*m_convex_hull);
+        convex_hull.scale(versor);
+        m_convex_hull = std::make_shared<const TriangleMesh>(std::move(convex_hull));
+    } else
         const_cast<TriangleMesh*>(m_convex_hull.get())->scale(versor);
 }
 
@@ -3277,7 +3296,12 @@ bool model_custom_supports_data_changed(const ModelObject& mo, const ModelObject
 {
     return model_property_changed(mo, mo_new,
         [](const ModelVolumeType t) { return t == ModelVolumeType::MODEL_PART; },
-        [](const ModelVolume &mv_old, const ModelVolume &mv_new){ return mv_old.supported_facets.timestamp_matches(mv_new.supported_facets); });
+        [](const ModelVolume &mv_old, const ModelVolume &mv_new){
+            // The timestamp is bumped by every edit including one that was undone or that painted
+            // the already present state. Supports are expensive to regenerate, thus fall back to
+            // comparing the painted data before invalidating the support step.
+            return mv_old.supported_facets.timestamp_matches(mv_new.supported_facets) ||
+                   mv_old.supported_facets.equals(mv_new.supported_facets); });
 }
 
 bool model_custom_seam_data_changed(const ModelObject& mo, const ModelObject& mo_new)
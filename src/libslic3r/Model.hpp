@@ -866,13 +866,19 @@ public:
     // The triangular model.
     const TriangleMesh& mesh() const { return *m_mesh.get(); }
     std::shared_ptr<const TriangleMesh> mesh_ptr() const { return m_mesh; }
-    void                set_mesh(const TriangleMesh &mesh) { m_mesh = std::make_shared<const TriangleMesh>(mesh); }
-    void                set_mesh(TriangleMesh &&mesh) { m_mesh = std::make_shared<const TriangleMesh>(std::move(mesh)); }
-    void                set_mesh(const indexed_triangle_set &mesh) { m_mesh = std::make_shared<const TriangleMesh>(mesh); }
-    void                set_mesh(indexed_triangle_set &&mesh) { m_mesh = std::make_shared<const TriangleMesh>(std::move(mesh)); }
-    void                set_mesh(std::shared_ptr<const TriangleMesh> &mesh) { m_mesh = mesh; }
-    void                set_mesh(std::unique_ptr<const TriangleMesh> &&mesh) { m_mesh = std::move(mesh); }
-	void				reset_mesh() { m_mesh = std::make_shared<const TriangleMesh>(); }
+    // Monotonic revision of the volume mesh, bumped whenever a different mesh is assigned.
+    // Caches of data derived from the mesh (ray casters, clippers, slices ...) shall remember
+    // the revision of their source mesh and poll it to detect a change instead of comparing
+    // mesh pointers (a reallocated mesh may reuse the address) or hashing the mesh itself.
+    // Copies of a volume share the revision with their source, as they share the mesh.
+    uint64_t            mesh_revision() const { return m_mesh_revision; }
+    void                set_mesh(const TriangleMesh &mesh) { m_mesh = std::make_shared<const TriangleMesh>(mesh); m_mesh_revision = next_mesh_revision(); }
+    void                set_mesh(TriangleMesh &&mesh) { m_mesh = std::make_shared<const TriangleMesh>(std::move(mesh)); m_mesh_revision = next_mesh_revision(); }
+    void                set_mesh(const indexed_triangle_set &mesh) { m_mesh = std::make_shared<const TriangleMesh>(mesh); m_mesh_revision = next_mesh_revision(); }
+    void                set_mesh(indexed_triangle_set &&mesh) { m_mesh = std::make_shared<const TriangleMesh>(std::move(mesh)); m_mesh_revision = next_mesh_revision(); }
+    void                set_mesh(std::shared_ptr<const TriangleMesh> &mesh) { m_mesh = mesh; m_mesh_revision = next_mesh_revision(); }
+    void                set_mesh(std::unique_ptr<const TriangleMesh> &&mesh) { m_mesh = std::move(mesh); m_mesh_revision = next_mesh_revision(); }
+	void				reset_mesh() { m_mesh = std::make_shared<const TriangleMesh>(); m_mesh_revision = next_mesh_revision(); }
     // Configuration parameters specific to an object model geometry or a modifier volume,
     // overriding the global Slic3r settings and the ModelObject settings.
     ModelConfigObject	config;
@@ -1010,6 +1016,7 @@ protected:
     friend class Model;
 	friend class ModelObject;
     friend void model_volume_list_update_supports(ModelObject& model_object_dst, const ModelObject& model_object_new);
+    friend void model_volume_list_update_modifiers(ModelObject& model_object_dst, const ModelObject& model_object_new);
 
 	// Copies IDs of both the ModelVolume and its config.
 	explicit ModelVolume(const ModelVolume &rhs) = default;
@@ -1045,6 +1052,12 @@ private:
     //      1   ->   is splittable
     mutable int               		m_is_splittable{ -1 };
 
+    // Revision of m_mesh, see mesh_revision(). Every newly constructed or deserialized volume
+    // draws a fresh value, so that caches never confuse it with a previously seen mesh.
+    uint64_t                        m_mesh_revision { next_mesh_revision() };
+    // Draws the next value from a process-wide monotonic counter. Thread safe.
+    static uint64_t next_mesh_revision();
+
 	ModelVolume(ModelObject *object, const TriangleMesh &mesh, ModelVolumeType type = ModelVolumeType::MODEL_PART) : m_mesh(new TriangleMesh(mesh)), m_type(type), object(object)
     {
 		assert(this->id().valid());
@@ -1090,7 +1103,7 @@ private:
         name(other.name), source(other.source), m_mesh(other.m_mesh), m_convex_hull(other.m_convex_hull),
         config(other.config), m_type(other.m_type), object(object), m_transformation(other.m_transformation),
         supported_facets(other.supported_facets), seam_facets(other.seam_facets), mmu_segmentation_facets(other.mmu_segmentation_facets),
-        m_text_info(other.m_text_info)
+        m_text_info(other.m_text_info), m_mesh_revision(other.m_mesh_revision)
     {
 		assert(this->id().valid());
         assert(this->config.id().valid());
@@ -1487,9 +1487,11 @@ static inline std::vector<std::vector<ExPolygons>> mmu_segmentation_top_and_bott
     auto filter_out_small_polygons = [&num_extruders, &num_layers](std::vector<std::vector<Polygons>> &raw_surfaces, double min_area) -> void {
         for (size_t extruder_idx = 0; extruder_idx < num_extruders; ++extruder_idx)
             if (!raw_surfaces[extruder_idx].empty())
-                for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx)
-                    if (!raw_surfaces[extruder_idx][layer_idx].empty())
-                        remove_small(raw_surfaces[extruder_idx][layer_idx], min_area);
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&raw_surfaces, &extruder_idx, &min_area](const tbb::blocked_range<size_t> &range) {
+                    for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx)
+                        if (!raw_surfaces[extruder_idx][layer_idx].empty())
+                            remove_small(raw_surfaces[extruder_idx][layer_idx], min_area);
+                }); // end of parallel_for
     };
 
     // Filter out polygons less than 0.1mm^2, because they are unprintable and causing dimples on outer primers (#7104)
@@ -1688,17 +1690,19 @@ static std::vector<std::vector<ExPolygons>> merge_segmented_layers(
     tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&segmented_regions, &top_and_bottom_layers, &segmented_regions_merged, &num_extruders, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
         for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
             assert(segmented_regions[layer_idx].size() == num_extruders + 1);
+            // Collect the painted top / bottom shells of all the extruders. The collected contours may overlap,
+            // which is fine for a non-zero fill rule clip. This way each segmented region is trimmed by a single
+            // Clipper execution instead of one boolean per extruder.
+            ExPolygons top_and_bottom_trim;
+            for (const std::vector<ExPolygons> &top_and_bottom_by_extruder : top_and_bottom_layers)
+                append(top_and_bottom_trim, top_and_bottom_by_extruder[layer_idx]);
             // Zero is skipped because it is the default color of the volume
             for (size_t extruder_id = 1; extruder_id < num_extruders + 1; ++extruder_id) {
                 throw_on_cancel_callback();
-                if (!segmented_regions[layer_idx][extruder_id].empty()) {
-                    ExPolygons segmented_regions_trimmed = segmented_regions[layer_idx][extruder_id];
-                    for (const std::vector<ExPolygons> &top_and_bottom_by_extruder : top_and_bottom_layers)
-                        if (!top_and_bottom_by_extruder[layer_idx].empty() && !segmented_regions_trimmed.empty())
-                            segmented_regions_trimmed = diff_ex(segmented_regions_trimmed, top_and_bottom_by_extruder[layer_idx]);
-
-                    segmented_regions_merged[layer_idx][extruder_id - 1] = std::move(segmented_regions_trimmed);
-                }
+                if (!segmented_regions[layer_idx][extruder_id].empty())
+                    segmented_regions_merged[layer_idx][extruder_id - 1] = top_and_bottom_trim.empty() ?
+                        segmented_regions[layer_idx][extruder_id] :
+                        diff_ex(segmented_regions[layer_idx][extruder_id], top_and_bottom_trim);
 
                 if (!top_and_bottom_layers[extruder_id][layer_idx].empty()) {
                     bool was_top_and_bottom_empty = segmented_regions_merged[layer_idx][extruder_id - 1].empty();
@@ -1867,25 +1871,33 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - slices preparation in parallel - end";
 
     std::vector<BoundingBox> layer_bboxes(num_layers);
-    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
-        throw_on_cancel_callback();
-        layer_bboxes[layer_idx] = get_extents(layers[layer_idx]->regions());
-        layer_bboxes[layer_idx].merge(get_extents(input_expolygons[layer_idx]));
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layers, &layer_bboxes, &input_expolygons, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+            throw_on_cancel_callback();
+            layer_bboxes[layer_idx] = get_extents(layers[layer_idx]->regions());
+            layer_bboxes[layer_idx].merge(get_extents(input_expolygons[layer_idx]));
+        }
+    }); // end of parallel_for
 
-    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
-        throw_on_cancel_callback();
-        BoundingBox bbox = layer_bboxes[layer_idx];
-        // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
-        // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
-        // every projected triangle will be inside the resulting bounding box.
-        if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
-        if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
-        // Projected triangles may slightly exceed the input polygons.
-        bbox.offset(20 * SCALED_EPSILON);
-        edge_grids[layer_idx].set_bbox(bbox);
-        edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
-    }
+    // Building the edge grids is independent per layer, the only cross-layer input
+    // are the bounding boxes of the neighboring layers computed above.
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - building edge grids in parallel - begin";
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layer_bboxes, &edge_grids, &input_expolygons, &num_layers, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+            throw_on_cancel_callback();
+            BoundingBox bbox = layer_bboxes[layer_idx];
+            // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
+            // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
+            // every projected triangle will be inside the resulting bounding box.
+            if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
+            if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
+            // Projected triangles may slightly exceed the input polygons.
+            bbox.offset(20 * SCALED_EPSILON);
+            edge_grids[layer_idx].set_bbox(bbox);
+            edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
+        }
+    }); // end of parallel_for
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - building edge grids in parallel - end";
 
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - projection of painted triangles - begin";
     for (const ModelVolume *mv : print_object.model_object()->volumes) {
@@ -181,8 +181,23 @@ std::vector<Point> MultiPoint::_douglas_peucker(const std::vector<Point>& pts, c
                 double max_dist_sq  = 0.0;
                 size_t furthest_idx = anchor_idx;
                 // find point furthest from line seg created by (anchor, floater) and note it
+                //BBS: this is the hottest loop of the simplification, inline the segment distance
+                // with the (anchor, floater) dependent terms hoisted out of the loop instead of
+                // rebuilding them per point inside Line::distance_to_squared(). The arithmetic and
+                // its order are kept identical, so the selected points do not change.
+                const Vec2d  seg_vec    = (*floater - *anchor).cast<double>();
+                const double seg_len_sq = seg_vec.squaredNorm();
                 for (size_t i = anchor_idx + 1; i < floater_idx; ++ i) {
-                    double dist_sq = Line::distance_to_squared(pts[i], *anchor, *floater);
+                    const Vec2d  va = (pts[i] - *anchor).cast<double>();
+                    double       dist_sq;
+                    if (seg_len_sq == 0.0)
+                        dist_sq = va.squaredNorm();
+                    else if (const double t = va.dot(seg_vec) / seg_len_sq; t <= 0.0)
+                        dist_sq = va.squaredNorm();
+                    else if (t >= 1.0)
+                        dist_sq = (pts[i] - *floater).cast<double>().squaredNorm();
+                    else
+                        dist_sq = (t * seg_vec - va).squaredNorm();
                     if (dist_sq > max_dist_sq) {
                         max_dist_sq  = dist_sq;
                         furthest_idx = i;
@@ -15,6 +15,10 @@
 #include <openvdb/tools/Composite.h>
 #include <openvdb/tools/LevelSetRebuild.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
 //#include "MTUtils.hpp"
 
 namespace Slic3r {
@@ -61,15 +65,26 @@ openvdb::FloatGrid::Ptr mesh_to_grid(const indexed_triangle_set &    mesh,
 
     meshparts.erase(it, meshparts.end());
 
-    openvdb::FloatGrid::Ptr grid;
-    for (auto &m : meshparts) {
-        auto subgrid = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
-            TriangleMeshDataAdapter{m, voxel_scale}, tr, exteriorBandWidth,
-            interiorBandWidth, flags);
-
-        if (grid && subgrid) openvdb::tools::csgUnion(*grid, *subgrid);
-        else if (subgrid) grid = std::move(subgrid);
-    }
+    // Convert the parts into separate grids concurrently and merge them with a
+    // csgUnion reduction. meshToVolume is threaded internally, but on models
+    // composed of many small parts the per-part conversions and unions dominate.
+    openvdb::FloatGrid::Ptr grid = tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, meshparts.size()), openvdb::FloatGrid::Ptr{},
+        [&](const tbb::blocked_range<size_t> &range, openvdb::FloatGrid::Ptr grid) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                auto subgrid = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
+                    TriangleMeshDataAdapter{meshparts[i], voxel_scale}, tr,
+                    exteriorBandWidth, interiorBandWidth, flags);
+
+                if (grid && subgrid) openvdb::tools::csgUnion(*grid, *subgrid);
+                else if (subgrid) grid = std::move(subgrid);
+            }
+            return grid;
+        },
+        [](openvdb::FloatGrid::Ptr g1, openvdb::FloatGrid::Ptr g2) {
+            if (g1 && g2) { openvdb::tools::csgUnion(*g1, *g2); return g1; }
+            return g1 ? g1 : g2;
+        });
 
     if (grid) {
         grid = openvdb::tools::levelSetRebuild(*grid, 0., exteriorBandWidth,
@@ -106,15 +121,28 @@ indexed_triangle_set grid_to_mesh(const openvdb::FloatGrid &grid,
     }  catch (...) { }
 
     indexed_triangle_set ret;
-    ret.vertices.reserve(points.size());
-    ret.indices.reserve(triangles.size() + quads.size() * 2);
-
-    for (auto &v : points) ret.vertices.emplace_back(to_vec3f(v) / scale);
-    for (auto &v : triangles) ret.indices.emplace_back(to_vec3i(v));
-    for (auto &quad : quads) {
-        ret.indices.emplace_back(quad(0), quad(1), quad(2));
-        ret.indices.emplace_back(quad(2), quad(3), quad(0));
-    }
+    ret.vertices.resize(points.size());
+    ret.indices.resize(triangles.size() + quads.size() * 2);
+
+    // On a fine grid the output of volumeToMesh is large, copy the buffers in parallel.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, points.size()),
+        [&](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++i)
+                ret.vertices[i] = to_vec3f(points[i]) / scale;
+        });
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, triangles.size()),
+        [&](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++i)
+                ret.indices[i] = to_vec3i(triangles[i]);
+        });
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, quads.size()),
+        [&](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                const openvdb::Vec4I &quad = quads[i];
+                ret.indices[triangles.size() + 2 * i]     = Vec3i(quad(0), quad(1), quad(2));
+                ret.indices[triangles.size() + 2 * i + 1] = Vec3i(quad(2), quad(3), quad(0));
+            }
+        });
 
     return ret;
 }
@@ -69,6 +69,11 @@ public:
     Eigen::VectorXf z_mean;  // mean of projected z
     std::vector<Vec3f> face_normals;
     std::vector<Vec3f> face_normals_hull;
+    // Per-facet vertex coordinates in SoA layout (one facet per row), built
+    // once in preprocess() so that every candidate orientation is projected
+    // with dense matrix products instead of a per-facet gather loop.
+    Eigen::MatrixXf vertices0, vertices1, vertices2;
+    Eigen::MatrixXf vertices_hull0, vertices_hull1, vertices_hull2;
     OrientParams params;
 
 
@@ -182,18 +187,24 @@ public:
         int count_apperance = 0;
         {
             int face_count = mesh->facets_count();
-            auto its = mesh->its;
+            auto &its = mesh->its;
             face_normals = its_face_normals(its);
             areas = Eigen::VectorXf::Zero(face_count);
             is_apperance = Eigen::VectorXf::Zero(face_count);
             normals = Eigen::MatrixXf::Zero(face_count, 3);
             normals_quantize = Eigen::MatrixXf::Zero(face_count, 3);
+            vertices0 = Eigen::MatrixXf::Zero(face_count, 3);
+            vertices1 = Eigen::MatrixXf::Zero(face_count, 3);
+            vertices2 = Eigen::MatrixXf::Zero(face_count, 3);
             for (size_t i = 0; i < face_count; i++)
             {
                 float area = its.facet_area(i);
                 normals.row(i) = face_normals[i];
                 normals_quantize.row(i) = quantize_vec3f(face_normals[i]);
                 areas(i) = area;
+                vertices0.row(i) = its.get_vertex(i, 0);
+                vertices1.row(i) = its.get_vertex(i, 1);
+                vertices2.row(i) = its.get_vertex(i, 2);
                 is_apperance(i) = (its.get_property(i).type == EnumFaceTypes::eExteriorAppearance);
                 count_apperance += (is_apperance(i)==1);
             }
@@ -208,12 +219,15 @@ public:
             //mesh_convex_hull.write_binary("convex_hull_debug.stl");
 
             int face_count = mesh_convex_hull.facets_count();
-            auto its = mesh_convex_hull.its;
+            auto &its = mesh_convex_hull.its;
             face_count_hull = mesh_convex_hull.facets_count();
             face_normals_hull = its_face_normals(its);
             areas_hull = Eigen::VectorXf::Zero(face_count);
             normals_hull = Eigen::MatrixXf::Zero(face_count_hull, 3);
             normals_hull_quantize = Eigen::MatrixXf::Zero(face_count_hull, 3);
+            vertices_hull0 = Eigen::MatrixXf::Zero(face_count_hull, 3);
+            vertices_hull1 = Eigen::MatrixXf::Zero(face_count_hull, 3);
+            vertices_hull2 = Eigen::MatrixXf::Zero(face_count_hull, 3);
             for (size_t i = 0; i < face_count; i++)
             {
                 float area = its.facet_area(i);
@@ -221,6 +235,9 @@ public:
                 normals_hull.row(i) = face_normals_hull[i];
                 normals_hull_quantize.row(i) = quantize_vec3f(face_normals_hull[i]);
                 areas_hull(i) = area;
+                vertices_hull0.row(i) = its.get_vertex(i, 0);
+                vertices_hull1.row(i) = its.get_vertex(i, 1);
+                vertices_hull2.row(i) = its.get_vertex(i, 2);
             }
         }
     }
@@ -317,34 +334,24 @@ public:
 
     void project_vertices(Vec3f orientation)
     {
+        // One dense matrix product per vertex slot over the SoA tables built
+        // in preprocess(); the per-facet statistics follow coefficient-wise.
         int face_count = mesh->facets_count();
-        auto its = mesh->its;
+        Eigen::VectorXf z0 = vertices0 * orientation;
+        Eigen::VectorXf z1 = vertices1 * orientation;
+        Eigen::VectorXf z2 = vertices2 * orientation;
         z_projected.resize(face_count, 3);
-        z_max.resize(face_count, 1);
-        z_median.resize(face_count, 1);
-        z_mean.resize(face_count, 1);
-        for (size_t i = 0; i < face_count; i++)
-        {
-            float z0 = its.get_vertex(i,0).dot(orientation);
-            float z1 = its.get_vertex(i,1).dot(orientation);
-            float z2 = its.get_vertex(i,2).dot(orientation);
-            z_projected(i, 0) = z0;
-            z_projected(i, 1) = z1;
-            z_projected(i, 2) = z2;
-            z_max(i) = MAX3(z0,z1,z2);
-            z_median(i) = MEDIAN3(z0,z1,z2);
-            z_mean(i) = (z0 + z1 + z2) / 3;
-        }
-
-        z_max_hull.resize(mesh_convex_hull.facets_count(), 1);
-        its = mesh_convex_hull.its;
-        for (size_t i = 0; i < z_max_hull.rows(); i++)
-        {
-            float z0 = its.get_vertex(i,0).dot(orientation);
-            float z1 = its.get_vertex(i,1).dot(orientation);
-            float z2 = its.get_vertex(i,2).dot(orientation);
-            z_max_hull(i) = MAX3(z0, z1, z2);
-        }
+        z_projected.col(0) = z0;
+        z_projected.col(1) = z1;
+        z_projected.col(2) = z2;
+        z_max  = z0.cwiseMax(z1).cwiseMax(z2);
+        // The median of three values is their sum minus the extremes.
+        z_median = z0 + z1 + z2 - z_max - z0.cwiseMin(z1).cwiseMin(z2);
+        z_mean = (z0 + z1 + z2) / 3.f;
+
+        z_max_hull = (vertices_hull0 * orientation)
+                         .cwiseMax(vertices_hull1 * orientation)
+                         .cwiseMax(vertices_hull2 * orientation);
     }
 
     static Eigen::VectorXi argsort(const Eigen::VectorXf& vec, std::string order="ascend")
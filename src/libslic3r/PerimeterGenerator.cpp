@@ -10,6 +10,7 @@
 #include "BridgeDetector.hpp"
 #include "ClipperUtils.hpp"
 #include "ExtrusionEntity.hpp"
+#include "Layer.hpp"
 #include "ExtrusionEntityCollection.hpp"
 #include "ShortestPath.hpp"
 #include "VariableWidth.hpp"
@@ -21,6 +22,10 @@
 #include <cmath>
 #include <cassert>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+
 static const int overhang_sampling_number = 6;
 static const double narrow_loop_length_threshold = 10;
 //BBS: when the width of expolygon is smaller than
@@ -55,6 +60,28 @@ public:
     bool is_internal_contour() const;
 };
 
+// Batched fuzzy skin kernel: the loop is first resampled into contiguous arrays of base positions
+// and unit segment normals, then the random displacement is applied in one tight sweep over those
+// arrays. Splitting the resampling from the displacement keeps the hot loop branch-free over
+// contiguous memory so the compiler can vectorize it.
+struct FuzzySamples
+{
+    // Resampled base positions along the loop.
+    std::vector<Vec2d> pos;
+    // Unit normal of the segment each sample originated from.
+    std::vector<Vec2d> dir;
+};
+
+// Displace all samples along their segment normals by a random offset within +-fuzzy_skin_thickness.
+static inline void fuzzy_displace(FuzzySamples &samples, double fuzzy_skin_thickness)
+{
+    std::vector<double> r(samples.pos.size());
+    for (double &ri : r)
+        ri = double(rand()) * (fuzzy_skin_thickness * 2.) / double(RAND_MAX) - fuzzy_skin_thickness;
+    for (size_t i = 0; i < samples.pos.size(); ++ i)
+        samples.pos[i] += samples.dir[i] * r[i];
+}
+
 // Thanks Cura developers for this function.
 static void fuzzy_polygon(Polygon &poly, double fuzzy_skin_thickness, double fuzzy_skin_point_distance)
 {
@@ -62,24 +89,32 @@ static void fuzzy_polygon(Polygon &poly, double fuzzy_skin_thickness, double fuz
     const double range_random_point_dist = fuzzy_skin_point_distance / 2.;
     double dist_left_over = double(rand()) * (min_dist_between_points / 2) / double(RAND_MAX); // the distance to be traversed on the line before making the first new point
     Point* p0 = &poly.points.back();
-    Points out;
-    out.reserve(poly.points.size());
+    FuzzySamples samples;
+    samples.pos.reserve(poly.points.size());
+    samples.dir.reserve(poly.points.size());
     for (Point &p1 : poly.points)
     { // 'a' is the (next) new point between p0 and p1
         Vec2d  p0p1      = (p1 - *p0).cast<double>();
         double p0p1_size = p0p1.norm();
         // so that p0p1_size - dist_last_point evaulates to dist_left_over - p0p1_size
         double dist_last_point = dist_left_over + p0p1_size * 2.;
+        const Vec2d base   = p0->cast<double>();
+        const Vec2d normal = perp(p0p1).normalized();
         for (double p0pa_dist = dist_left_over; p0pa_dist < p0p1_size;
             p0pa_dist += min_dist_between_points + double(rand()) * range_random_point_dist / double(RAND_MAX))
         {
-            double r = double(rand()) * (fuzzy_skin_thickness * 2.) / double(RAND_MAX) - fuzzy_skin_thickness;
-            out.emplace_back(*p0 + (p0p1 * (p0pa_dist / p0p1_size) + perp(p0p1).cast<double>().normalized() * r).cast<coord_t>());
+            samples.pos.emplace_back(base + p0p1 * (p0pa_dist / p0p1_size));
+            samples.dir.emplace_back(normal);
             dist_last_point = p0pa_dist;
         }
         dist_left_over = p0p1_size - dist_last_point;
         p0 = &p1;
     }
+    fuzzy_displace(samples, fuzzy_skin_thickness);
+    Points out;
+    out.reserve(samples.pos.size());
+    for (const Vec2d &pt : samples.pos)
+        out.emplace_back(pt.cast<coord_t>());
     while (out.size() < 3) {
         size_t point_idx = poly.size() - 2;
         out.emplace_back(poly[point_idx]);
@@ -101,6 +136,13 @@ static void fuzzy_extrusion_line(Arachne::ExtrusionLine& ext_lines, double fuzzy
     auto* p0 = &ext_lines.front();
     std::vector<Arachne::ExtrusionJunction> out;
     out.reserve(ext_lines.size());
+    // Resample into contiguous sample arrays; the junction positions are patched with the
+    // displaced coordinates after the batched sweep below.
+    FuzzySamples        samples;
+    std::vector<size_t> sample_out_idx;
+    samples.pos.reserve(ext_lines.size());
+    samples.dir.reserve(ext_lines.size());
+    sample_out_idx.reserve(ext_lines.size());
     for (auto& p1 : ext_lines) {
         if (p0->p == p1.p) { // Connect endpoints.
             out.emplace_back(p1.p, p1.w, p1.perimeter_index);
@@ -112,14 +154,21 @@ static void fuzzy_extrusion_line(Arachne::ExtrusionLine& ext_lines, double fuzzy
         double p0p1_size = p0p1.norm();
         // so that p0p1_size - dist_last_point evaulates to dist_left_over - p0p1_size
         double dist_last_point = dist_left_over + p0p1_size * 2.;
+        const Vec2d base   = p0->p.cast<double>();
+        const Vec2d normal = perp(p0p1).normalized();
         for (double p0pa_dist = dist_left_over; p0pa_dist < p0p1_size; p0pa_dist += min_dist_between_points + double(rand()) * range_random_point_dist / double(RAND_MAX)) {
-            double r = double(rand()) * (fuzzy_skin_thickness * 2.) / double(RAND_MAX) - fuzzy_skin_thickness;
-            out.emplace_back(p0->p + (p0p1 * (p0pa_dist / p0p1_size) + perp(p0p1).cast<double>().normalized() * r).cast<coord_t>(), p1.w, p1.perimeter_index);
+            samples.pos.emplace_back(base + p0p1 * (p0pa_dist / p0p1_size));
+            samples.dir.emplace_back(normal);
+            sample_out_idx.emplace_back(out.size());
+            out.emplace_back(p0->p, p1.w, p1.perimeter_index);
             dist_last_point = p0pa_dist;
         }
         dist_left_over = p0p1_size - dist_last_point;
         p0 = &p1;
     }
+    fuzzy_displace(samples, fuzzy_skin_thickness);
+    for (size_t i = 0; i < sample_out_idx.size(); ++ i)
+        out[sample_out_idx[i]].p = samples.pos[i].cast<coord_t>();
 
     while (out.size() < 3) {
         size_t point_idx = ext_lines.size() - 2;
@@ -357,8 +406,8 @@ static ExtrusionEntityCollection traverse_loops(const PerimeterGenerator &perime
                 {
                     Polygons lower_polygons_series_clipped = ClipperUtils::clip_clipper_polygons_with_subject_bbox(it->second, bbox);
 
-                    Polylines inside_polines = (it == lower_polygons_series->begin()) ? intersection_pl({polygon}, lower_polygons_series_clipped) :
-                                                                                        intersection_pl(remain_polines, lower_polygons_series_clipped);
+                    Polylines inside_polines = (it == lower_polygons_series->begin()) ? intersection_pl_2({polygon}, lower_polygons_series_clipped) :
+                                                                                        intersection_pl_2(remain_polines, lower_polygons_series_clipped);
                     extrusion_paths_append(
                         paths,
                         std::move(inside_polines),
@@ -369,8 +418,8 @@ static ExtrusionEntityCollection traverse_loops(const PerimeterGenerator &perime
                         extrusion_width,
                         (float)perimeter_generator.layer_height);
 
-                    remain_polines = (it == lower_polygons_series->begin()) ? diff_pl({polygon}, lower_polygons_series_clipped) :
-                                                                              diff_pl(remain_polines, lower_polygons_series_clipped);
+                    remain_polines = (it == lower_polygons_series->begin()) ? diff_pl_2({polygon}, lower_polygons_series_clipped) :
+                                                                              diff_pl_2(remain_polines, lower_polygons_series_clipped);
 
                     if (remain_polines.size() == 0)
                         break;
@@ -380,7 +429,7 @@ static ExtrusionEntityCollection traverse_loops(const PerimeterGenerator &perime
                 it--;
                 Polygons lower_polygons_series_clipped = ClipperUtils::clip_clipper_polygons_with_subject_bbox(it->second, bbox);
 
-                Polylines inside_polines = intersection_pl({polygon}, lower_polygons_series_clipped);
+                Polylines inside_polines = intersection_pl_2({polygon}, lower_polygons_series_clipped);
                 extrusion_paths_append(
                     paths,
                     std::move(inside_polines),
@@ -391,7 +440,7 @@ static ExtrusionEntityCollection traverse_loops(const PerimeterGenerator &perime
                     extrusion_width,
                     (float)perimeter_generator.layer_height);
 
-                remain_polines = diff_pl({polygon}, lower_polygons_series_clipped);
+                remain_polines = diff_pl_2({polygon}, lower_polygons_series_clipped);
             }
 
             // get 100% overhang paths by checking what parts of this loop fall
@@ -758,9 +807,9 @@ static ExtrusionEntityCollection traverse_extrusions(const PerimeterGenerator& p
                     for (int j = 0; j < overhang_sampling_number; j++) {
                         Polygons  limiton_polygons = offset(lower_slcier_chopped, float(scale_(start_pos + (j + 0.5) * (end_pos - start_pos) / (overhang_sampling_number - 1))));
 
-                        Polylines inside_polines   = j == 0 ? intersection_pl(be_clipped, limiton_polygons) : intersection_pl(remain_polylines, limiton_polygons);
+                        Polylines inside_polines   = j == 0 ? intersection_pl_2(be_clipped, limiton_polygons) : intersection_pl_2(remain_polylines, limiton_polygons);
 
-                        remain_polylines           = j == 0 ? diff_pl(be_clipped, limiton_polygons) : diff_pl(remain_polylines, limiton_polygons);
+                        remain_polylines           = j == 0 ? diff_pl_2(be_clipped, limiton_polygons) : diff_pl_2(remain_polylines, limiton_polygons);
 
                         extrusion_paths_append(paths, std::move(inside_polines), j, int(0), role, it.second.front().mm3_per_mm, it.second.front().width, it.second.front().height);
 
@@ -1374,7 +1423,7 @@ std::tuple<std::vector<ExtrusionPaths>, Polygons> generate_extra_perimeters_over
     return {extra_perims, diff(inset_overhang_area, inset_overhang_area_left_unfilled)};
 }
 
-void PerimeterGenerator::apply_extra_perimeters(ExPolygons &infill_area)
+void PerimeterGenerator::apply_extra_perimeters(ExPolygons &infill_area, ExtrusionEntityCollection &island_perimeters) const
 {
     if (!m_spiral_vase && this->lower_slices != nullptr && this->config->detect_overhang_wall && this->config->extra_perimeters_on_overhangs &&
         this->config->wall_loops > 0 && this->layer_id > this->object_config->raft_layers) {
@@ -1383,22 +1432,18 @@ void PerimeterGenerator::apply_extra_perimeters(ExPolygons &infill_area)
                                                                                         this->config->wall_loops, this->overhang_flow,
                                                                                         this->m_scaled_resolution, *this->object_config,
                                                                                         *this->print_config);
-        if (!extra_perimeters.empty()) {
-            ExtrusionEntityCollection *this_islands_perimeters = static_cast<ExtrusionEntityCollection *>(this->loops->entities.back());
+        if (!extra_perimeters.empty() && !island_perimeters.empty()) {
             ExtrusionEntityCollection  new_perimeters{};
-            new_perimeters.no_sort = this_islands_perimeters->no_sort;
+            new_perimeters.no_sort = island_perimeters.no_sort;
             for (const ExtrusionPaths &paths : extra_perimeters) {
                 new_perimeters.append(paths);
             }
-            new_perimeters.append(this_islands_perimeters->entities);
-            this_islands_perimeters->swap(new_perimeters);
-
-            SurfaceCollection orig_surfaces = *this->fill_surfaces;
-            this->fill_surfaces->clear();
-            for (const auto &surface : orig_surfaces.surfaces) {
-                auto new_surfaces = diff_ex({surface.expolygon}, filled_area);
-                this->fill_surfaces->append(new_surfaces, surface);
-            }
+            new_perimeters.append(std::move(island_perimeters.entities));
+            island_perimeters.swap(new_perimeters);
+
+            // Cut the area covered by the extra perimeters out of this island's infill.
+            // Other islands are disjoint with filled_area, thus they are unaffected.
+            infill_area = diff_ex(infill_area, filled_area);
         }
     }
 }
@@ -1431,6 +1476,20 @@ static void reorient_perimeters(ExtrusionEntityCollection &entities, bool steep_
     }
 }
 
+// Independent output of a single island of process_classic() / process_arachne(),
+// merged into the shared output collections in the original island order.
+struct PerimeterIslandOut
+{
+    // This island's nested perimeter collection, including extra perimeters over overhangs.
+    ExtrusionEntityCollection perimeters;
+    // Gap fill extrusions of this island.
+    ExtrusionEntityCollection gap_fill;
+    // Infill areas, appended to fill_surfaces as stInternal.
+    ExPolygons                fill_expolygons;
+    // Infill areas without the perimeter overlap, appended to fill_no_overlap.
+    ExPolygons                fill_no_overlap;
+};
+
 void PerimeterGenerator::process_classic()
 {
     // other perimeters
@@ -1461,7 +1520,9 @@ void PerimeterGenerator::process_classic()
         // lower layer, so we take lower slices and offset them by half the nozzle diameter used
         // in the current layer
         double nozzle_diameter = this->print_config->nozzle_diameter.get_at(this->config->wall_filament - 1);
-        m_lower_slices_polygons = offset(*this->lower_slices, float(scale_(+nozzle_diameter / 2)));
+        m_lower_slices_polygons = this->lower_layer != nullptr ?
+            this->lower_layer->lslices_expanded(coord_t(scale_(+nozzle_diameter / 2))) :
+            offset(*this->lower_slices, float(scale_(+nozzle_diameter / 2)));
     }
     
     // Calculate the minimum required spacing between two adjacent traces.
@@ -1499,7 +1560,19 @@ void PerimeterGenerator::process_classic()
 
     // BBS: don't simplify too much which influence arc fitting when export gcode if arc_fitting is enabled
     double surface_simplify_resolution = (print_config->enable_arc_fitting && this->config->fuzzy_skin == FuzzySkinType::None) ? 0.2 * m_scaled_resolution : m_scaled_resolution;
-    for (const Surface &surface : this->slices->surfaces) {
+    // Islands are independent of each other, thus they are processed in parallel and their outputs
+    // are merged into the shared collections in the original island order afterwards. This scales
+    // a single huge layer with many small parts across all cores, where the layer level parallel_for
+    // of PrintObject::make_perimeters() has too few tasks. TBB's work stealing scheduler balances
+    // the unevenly sized islands.
+    std::vector<PerimeterIslandOut> islands_out(this->slices->surfaces.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, this->slices->surfaces.size()),
+        [this, perimeter_width, perimeter_spacing, ext_perimeter_width, ext_perimeter_spacing, ext_perimeter_spacing2,
+         solid_infill_spacing, min_spacing, ext_min_spacing, has_gap_fill, ext_min_spacing_smaller, surface_simplify_resolution,
+         &islands_out](const tbb::blocked_range<size_t> &range) {
+    for (size_t surface_idx = range.begin(); surface_idx < range.end(); ++ surface_idx) {
+        const Surface      &surface = this->slices->surfaces[surface_idx];
+        PerimeterIslandOut &island_out = islands_out[surface_idx];
         // detect how many perimeters must be generated for this island
         int        loop_number = this->config->wall_loops + surface.extra_perimeters - 1;  // 0-indexed loops
         if (this->layer_id == 0 && this->config->only_one_wall_first_layer)
@@ -1510,6 +1583,8 @@ void PerimeterGenerator::process_classic()
 
         ExPolygons last        = union_ex(surface.expolygon.simplify_p(surface_simplify_resolution));
         ExPolygons gaps;
+        // Gap fill extrusions of this island, extracted concurrently with the loop traversal.
+        ExtrusionEntityCollection gap_fill;
         ExPolygons top_fills;
         ExPolygons fill_clip;
         if (loop_number >= 0) {
@@ -1538,8 +1613,17 @@ void PerimeterGenerator::process_classic()
                             diff_ex(last, offset(offsets, float(ext_perimeter_width / 2.) + ClipperSafetyOffset)),
                             float(min_width / 2.));
                         // the maximum thickness of our thin wall area is equal to the minimum thickness of a single loop
-                        for (ExPolygon &ex : expp)
-                            ex.medial_axis(min_width, ext_perimeter_width + ext_perimeter_spacing2, &thin_walls);
+                        //BBS: each island constructs its own Voronoi diagram, which dominates the thin wall
+                        // profile. The islands are independent, so build their medial axes in parallel and
+                        // append the results in the original island order.
+                        std::vector<ThickPolylines> thin_walls_per_island(expp.size());
+                        tbb::parallel_for(tbb::blocked_range<size_t>(0, expp.size()),
+                            [&expp, &thin_walls_per_island, min_width, ext_perimeter_width, ext_perimeter_spacing2](const tbb::blocked_range<size_t> &range) {
+                                for (size_t i = range.begin(); i < range.end(); ++ i)
+                                    expp[i].medial_axis(min_width, ext_perimeter_width + ext_perimeter_spacing2, &thin_walls_per_island[i]);
+                            });
+                        for (ThickPolylines &pp : thin_walls_per_island)
+                            append(thin_walls, std::move(pp));
                     } else {
                         coord_t ext_perimeter_smaller_width = this->smaller_ext_perimeter_flow.scaled_width();
                         for (const ExPolygon& expolygon : last) {
@@ -1663,6 +1747,13 @@ void PerimeterGenerator::process_classic()
                 }
             }
 
+            // The gap surface extraction and the loop nesting / traversal below are independent:
+            // the former only consumes the gap set collected by the loop pass above, the latter
+            // only the collected loops. Running them concurrently takes the expensive ClipperLib
+            // shrink / expand / medial axis sequence off the critical path of the wall pass; both
+            // join before the infill boundary is derived from their results.
+            tbb::parallel_invoke(
+            [&]() {
             // nest loops: holes first
             for (int d = 0; d <= loop_number; ++ d) {
                 PerimeterGeneratorLoops &holes_d = holes[d];
@@ -1748,12 +1839,11 @@ void PerimeterGenerator::process_classic()
                 }
             // append perimeters for this slice as a collection
             if (! entities.empty())
-                this->loops->append(entities);
-
-        } // for each loop of an island
-
-        // fill gaps
-        if (! gaps.empty()) {
+                island_out.perimeters = std::move(entities);
+            },
+            [&]() {
+            // detect gaps to fill
+            if (! gaps.empty()) {
             // collapse 
             double min = 0.2 * perimeter_width * (1 - INSET_OVERLAP_TOLERANCE);
             double max = 2. * perimeter_spacing;
@@ -1762,11 +1852,19 @@ void PerimeterGenerator::process_classic()
                 opening_ex(gaps, float(min / 2.)),
                 offset2_ex(gaps, - float(max / 2.), float(max / 2. + ClipperSafetyOffset)));
             ThickPolylines polylines;
-            for (ExPolygon& ex : gaps_ex) {
-                //BBS: Use DP simplify to avoid duplicated points and accelerate medial-axis calculation as well.
-                ex.douglas_peucker(surface_simplify_resolution);
-                ex.medial_axis(min, max, &polylines);
-            }
+            //BBS: the medial axis of each gap island builds a separate Voronoi diagram,
+            // run the islands in parallel and keep the output in the island order.
+            std::vector<ThickPolylines> polylines_per_island(gaps_ex.size());
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, gaps_ex.size()),
+                [&gaps_ex, &polylines_per_island, min, max, surface_simplify_resolution](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i < range.end(); ++ i) {
+                        //BBS: Use DP simplify to avoid duplicated points and accelerate medial-axis calculation as well.
+                        gaps_ex[i].douglas_peucker(surface_simplify_resolution);
+                        gaps_ex[i].medial_axis(min, max, &polylines_per_island[i]);
+                    }
+                });
+            for (ThickPolylines &pp : polylines_per_island)
+                append(polylines, std::move(pp));
 
 #ifdef GAPS_OF_PERIMETER_DEBUG_TO_SVG
             {
@@ -1790,21 +1888,24 @@ void PerimeterGenerator::process_classic()
                 }), polylines.end());
 
 
-            if (! polylines.empty()) {
-				ExtrusionEntityCollection gap_fill;
+            if (! polylines.empty())
 				variable_width(polylines, erGapFill, this->solid_infill_flow, gap_fill.entities);
-                /*  Make sure we don't infill narrow parts that are already gap-filled
-                    (we only consider this surface's gaps to reduce the diff() complexity).
-                    Growing actual extrusions ensures that gaps not filled by medial axis
-                    are not subtracted from fill surfaces (they might be too short gaps
-                    that medial axis skips but infill might join with other infill regions
-                    and use zigzag).  */
-                //FIXME Vojtech: This grows by a rounded extrusion width, not by line spacing,
-                // therefore it may cover the area, but no the volume.
-                last = diff_ex(last, gap_fill.polygons_covered_by_width(10.f));
-                this->gap_fill->append(std::move(gap_fill.entities));
-
-			}
+            }
+            });
+
+        } // for each loop of an island
+
+        if (! gap_fill.empty()) {
+            /*  Make sure we don't infill narrow parts that are already gap-filled
+                (we only consider this surface's gaps to reduce the diff() complexity).
+                Growing actual extrusions ensures that gaps not filled by medial axis
+                are not subtracted from fill surfaces (they might be too short gaps
+                that medial axis skips but infill might join with other infill regions
+                and use zigzag).  */
+            //FIXME Vojtech: This grows by a rounded extrusion width, not by line spacing,
+            // therefore it may cover the area, but no the volume.
+            last = diff_ex(last, gap_fill.polygons_covered_by_width(10.f));
+            island_out.gap_fill = std::move(gap_fill);
         }
 
         // create one more offset to be used as boundary for fill
@@ -1842,9 +1943,8 @@ void PerimeterGenerator::process_classic()
         if (!top_fills.empty()) {
             infill_exp = union_ex(infill_exp, offset_ex(top_infill_exp, double(infill_peri_overlap)));
         }
-        this->fill_surfaces->append(infill_exp, stInternal);
-
-        apply_extra_perimeters(infill_exp);
+        apply_extra_perimeters(infill_exp, island_out.perimeters);
+        island_out.fill_expolygons = std::move(infill_exp);
 
         // BBS: get the no-overlap infill expolygons
         {
@@ -1860,10 +1960,21 @@ void PerimeterGenerator::process_classic()
                     double(-inset - infill_peri_overlap));
             if (!top_fills.empty())
                 polyWithoutOverlap = union_ex(polyWithoutOverlap, top_infill_exp);
-            this->fill_no_overlap->insert(this->fill_no_overlap->end(), polyWithoutOverlap.begin(), polyWithoutOverlap.end());
+            island_out.fill_no_overlap = std::move(polyWithoutOverlap);
         }
 
     } // for each island
+    });
+
+    // Merge the per-island outputs into the shared collections in the original island order.
+    for (PerimeterIslandOut &island_out : islands_out) {
+        if (! island_out.perimeters.empty())
+            this->loops->append(std::move(island_out.perimeters));
+        if (! island_out.gap_fill.empty())
+            this->gap_fill->append(std::move(island_out.gap_fill.entities));
+        this->fill_surfaces->append(std::move(island_out.fill_expolygons), stInternal);
+        append(*this->fill_no_overlap, std::move(island_out.fill_no_overlap));
+    }
 }
 
 // Thanks, Cura developers, for implementing an algorithm for generating perimeters with variable width (Arachne) that is based on the paper
@@ -1891,7 +2002,9 @@ void PerimeterGenerator::process_arachne()
         // lower layer, so we take lower slices and offset them by half the nozzle diameter used
         // in the current layer
         double nozzle_diameter = this->print_config->nozzle_diameter.get_at(this->config->wall_filament - 1);
-        m_lower_slices_polygons = offset(*this->lower_slices, float(scale_(+nozzle_diameter / 2)));
+        m_lower_slices_polygons = this->lower_layer != nullptr ?
+            this->lower_layer->lslices_expanded(coord_t(scale_(+nozzle_diameter / 2))) :
+            offset(*this->lower_slices, float(scale_(+nozzle_diameter / 2)));
     }
 
 
@@ -1899,7 +2012,15 @@ void PerimeterGenerator::process_arachne()
     double surface_simplify_resolution = (print_config->enable_arc_fitting && this->config->fuzzy_skin == FuzzySkinType::None) ? 0.2 * m_scaled_resolution : m_scaled_resolution;
     // we need to process each island separately because we might have different
     // extra perimeters for each one
-    for (const Surface& surface : this->slices->surfaces) {
+    // As in process_classic(), islands are processed in parallel and their outputs are merged
+    // in the original island order below.
+    std::vector<PerimeterIslandOut> islands_out(this->slices->surfaces.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, this->slices->surfaces.size()),
+        [this, perimeter_spacing, ext_perimeter_width, ext_perimeter_spacing, ext_perimeter_spacing2,
+         solid_infill_spacing, surface_simplify_resolution, &islands_out](const tbb::blocked_range<size_t> &range) {
+    for (size_t surface_idx = range.begin(); surface_idx < range.end(); ++ surface_idx) {
+        const Surface      &surface    = this->slices->surfaces[surface_idx];
+        PerimeterIslandOut &island_out = islands_out[surface_idx];
         coord_t bead_width_0 = ext_perimeter_spacing;
         if (config->precise_outer_wall)
             bead_width_0 = ext_perimeter_width + this->perimeter_flow.scaled_width() - perimeter_spacing;
@@ -2244,7 +2365,7 @@ void PerimeterGenerator::process_arachne()
         bool steep_overhang_hole    = false;
         if (ExtrusionEntityCollection extrusion_coll = traverse_extrusions(*this, ordered_extrusions, steep_overhang_contour, steep_overhang_hole); !extrusion_coll.empty()) {
             reorient_perimeters(extrusion_coll, steep_overhang_contour, steep_overhang_hole, this->config->overhang_reverse_internal_only);
-            this->loops->append(extrusion_coll);
+            island_out.perimeters = std::move(extrusion_coll);
         }
 
         ExPolygons    infill_contour = union_ex(wallToolPaths.getInnerContour());
@@ -2281,9 +2402,8 @@ void PerimeterGenerator::process_arachne()
         if (!top_fills.empty()) {
             infill_exp = union_ex(infill_exp, offset_ex(top_fills, double(inset)));
         }
-        this->fill_surfaces->append(infill_exp, stInternal);
-
-        apply_extra_perimeters(infill_exp);
+        apply_extra_perimeters(infill_exp, island_out.perimeters);
+        island_out.fill_expolygons = std::move(infill_exp);
 
         // BBS: get the no-overlap infill expolygons
         {
@@ -2294,9 +2414,18 @@ void PerimeterGenerator::process_arachne()
                 float(+min_perimeter_infill_spacing / 2.));
             if (!top_fills.empty())
                 polyWithoutOverlap = union_ex(polyWithoutOverlap, top_fills);
-            this->fill_no_overlap->insert(this->fill_no_overlap->end(), polyWithoutOverlap.begin(), polyWithoutOverlap.end());
+            island_out.fill_no_overlap = std::move(polyWithoutOverlap);
         }
     }
+    });
+
+    // Merge the per-island outputs into the shared collections in the original island order.
+    for (PerimeterIslandOut &island_out : islands_out) {
+        if (! island_out.perimeters.empty())
+            this->loops->append(std::move(island_out.perimeters));
+        this->fill_surfaces->append(std::move(island_out.fill_expolygons), stInternal);
+        append(*this->fill_no_overlap, std::move(island_out.fill_no_overlap));
+    }
 }
 
 bool PerimeterGeneratorLoop::is_internal_contour() const
@@ -2335,7 +2464,9 @@ std::map<int, Polygons> PerimeterGenerator::generate_lower_polygons_series(float
 
     // offset expolygon to generate series of polygons
     for (int i = 0; i < offset_series.size(); i++) {
-        lower_polygons_series.insert(std::pair<int, Polygons>(i, offset(*this->lower_slices, float(scale_(offset_series[i])))));
+        const coord_t grow = coord_t(scale_(offset_series[i]));
+        lower_polygons_series.insert(std::pair<int, Polygons>(i,
+            this->lower_layer != nullptr ? this->lower_layer->lslices_expanded(grow) : offset(*this->lower_slices, float(grow))));
     }
     return lower_polygons_series;
 }
@@ -10,12 +10,17 @@
 
 namespace Slic3r {
 
+class Layer;
+
 class PerimeterGenerator {
 public:
     // Inputs:
     const SurfaceCollection     *slices;
     const ExPolygons            *upper_slices;
     const ExPolygons            *lower_slices;
+    // Lower layer, if available. Used to share the cached grown lower layer coverage
+    // (Layer::lslices_expanded()) between the regions of this layer.
+    const Layer                 *lower_layer { nullptr };
     double                       layer_height;
     int                          layer_id;
     Flow                         perimeter_flow;
@@ -79,7 +84,7 @@ public:
 private:
     std::map<int, Polygons> generate_lower_polygons_series(float width);
     void split_top_surfaces(const ExPolygons &orig_polygons, ExPolygons &top_fills, ExPolygons &non_top_polygons, ExPolygons &fill_clip) const;
-    void apply_extra_perimeters(ExPolygons& infill_area);
+    void apply_extra_perimeters(ExPolygons& infill_area, ExtrusionEntityCollection& island_perimeters) const;
 
 private:
     bool        m_spiral_vase;
@@ -1703,6 +1703,13 @@ static std::string process_macro(const std::string &templ, client::MyContext &co
 
 std::string PlaceholderParser::process(const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context_data) const
 {
+    // A template without any '{' or '[' contains no macro nor legacy variable expansion,
+    // thus the grammar emits it verbatim (see the "text" rule). Skip the spirit parser
+    // for such templates, which is the common case for per-layer custom G-codes
+    // evaluated once for every layer of an export.
+    if (templ.find_first_of("{[") == std::string::npos)
+        return templ;
+
     client::MyContext context;
     context.external_config 	= this->external_config();
     context.config              = &this->config();
@@ -462,6 +462,17 @@ void Preset::load_info(const std::string& file)
     }
 }
 
+//BBS: bulk saves (user preset sync, exit) run over every user preset; skip
+// rewriting files whose content did not change to avoid the disk churn
+static bool file_content_equals(const std::string &file, const std::string &content)
+{
+    boost::nowide::ifstream ifs(file);
+    if (!ifs.good())
+        return false;
+    std::string existing((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    return existing == content;
+}
+
 void Preset::save_info(std::string file)
 {
     //BBS: add project embedded preset logic
@@ -473,8 +484,7 @@ void Preset::save_info(std::string file)
         file = idx_file.string();
     }
 
-    boost::nowide::ofstream c;
-    c.open(file, std::ios::out | std::ios::trunc);
+    std::ostringstream c;
     std::string sync_info_to_save;
     //BBS: hold is used for stop requesting to server this time
     if (this->sync_info.compare("hold") != 0)
@@ -484,7 +494,13 @@ void Preset::save_info(std::string file)
     c << "setting_id" << " = " << this->setting_id << std::endl;
     c << "base_id" << " = " << this->base_id << std::endl;
     c << "updated_time" << " = " << std::to_string(this->updated_time) << std::endl;
-    c.close();
+
+    if (file_content_equals(file, c.str()))
+        return;
+    boost::nowide::ofstream ofs;
+    ofs.open(file, std::ios::out | std::ios::trunc);
+    ofs << c.str();
+    ofs.close();
 }
 
 void Preset::remove_files()
@@ -519,6 +535,7 @@ void Preset::save(DynamicPrintConfig* parent_config)
         from_str = std::string("Default");
 
     //BBS: only save difference if it has parent
+    std::string content;
     if (parent_config) {
         DynamicPrintConfig temp_config;
         std::vector<std::string> dirty_options = config.diff(*parent_config);
@@ -529,10 +546,18 @@ void Preset::save(DynamicPrintConfig* parent_config)
             ConfigOption *opt_dst = temp_config.option(option, true);
             opt_dst->set(opt_src);
         }
-        temp_config.save_to_json(this->file, this->name, from_str, this->version.to_string(), this->custom_defined);
+        content = temp_config.to_json_string(this->name, from_str, this->version.to_string(), this->custom_defined);
     }
     else
-        this->config.save_to_json(this->file, this->name, from_str, this->version.to_string(), this->custom_defined);
+        content = this->config.to_json_string(this->name, from_str, this->version.to_string(), this->custom_defined);
+
+    //BBS: only rewrite the preset file when its content really changed
+    if (!file_content_equals(this->file, content)) {
+        boost::nowide::ofstream c;
+        c.open(this->file, std::ios::out | std::ios::trunc);
+        c << content;
+        c.close();
+    }
 
     fs::path idx_file(this->file);
     idx_file.replace_extension(".info");
@@ -724,7 +749,7 @@ bool Preset::has_cali_lines(PresetBundle* preset_bundle)
 }
 
 static std::vector<std::string> s_Preset_print_options {
-    "layer_height", "initial_layer_print_height", "wall_loops", "slice_closing_radius", "spiral_mode", "slicing_mode",
+    "layer_height", "initial_layer_print_height", "wall_loops", "slice_closing_radius", "slice_open_loop_gap_closing", "spiral_mode", "slicing_mode",
     "top_shell_layers", "top_shell_thickness", "bottom_shell_layers", "bottom_shell_thickness",
     "extra_perimeters_on_overhangs", "ensure_vertical_shell_thickness", "reduce_crossing_wall", "detect_thin_wall", "detect_overhang_wall", "overhang_reverse", "overhang_reverse_threshold","overhang_reverse_internal_only",
     "seam_position", "staggered_inner_seams", "wall_infill_order", "sparse_infill_density", "sparse_infill_pattern", "top_surface_pattern", "bottom_surface_pattern",
@@ -800,7 +825,7 @@ static std::vector<std::string> s_Preset_filament_options {
     "filament_wipe_distance", "additional_cooling_fan_speed",
     "nozzle_temperature_range_low", "nozzle_temperature_range_high",
     //SoftFever
-    "enable_pressure_advance", "pressure_advance","chamber_temperature", "filament_shrink", "support_material_interface_fan_speed", "filament_notes" /*,"filament_seam_gap"*/,
+    "enable_pressure_advance", "pressure_advance", "pressure_advance_per_feature", "chamber_temperature", "filament_shrink", "support_material_interface_fan_speed", "filament_notes" /*,"filament_seam_gap"*/,
     "filament_loading_speed", "filament_loading_speed_start", "filament_load_time",
     "filament_unloading_speed", "filament_unloading_speed_start", "filament_unload_time", "filament_toolchange_delay", "filament_cooling_moves",
     "filament_cooling_initial_speed", "filament_cooling_final_speed", "filament_ramming_parameters",
@@ -22,6 +22,9 @@
 #include <boost/locale.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 
 // Store the print/filament/printer presets into a "presets" subdirectory of the Slic3rPE config dir.
 // This breaks compatibility with the upstream Slic3r if the --datadir is used to switch between the two versions.
@@ -1066,38 +1069,62 @@ std::pair<PresetsConfigSubstitutions, std::string> PresetBundle::load_system_pre
     boost::filesystem::path     dir = (boost::filesystem::path(data_dir()) / PRESET_SYSTEM_DIR).make_preferred();
     PresetsConfigSubstitutions  substitutions;
     std::string                 errors_cummulative;
-    bool                        first = true;
+
+    // Collect the vendor bundle names first. Sorted, so that the merge order (and with it the
+    // duplicate reporting) is deterministic and independent of the directory iteration order.
+    std::vector<std::string> vendor_names;
     for (auto &dir_entry : boost::filesystem::directory_iterator(dir))
-    {
-        std::string vendor_file = dir_entry.path().string();
-        if (Slic3r::is_json_file(vendor_file)) {
+        if (Slic3r::is_json_file(dir_entry.path().string())) {
             std::string vendor_name = dir_entry.path().filename().string();
             // Remove the .json suffix.
             vendor_name.erase(vendor_name.size() - 5);
-            try {
-                // Load the config bundle, flatten it.
-                if (first) {
-                    // Reset this PresetBundle and load the first vendor config.
-                    append(substitutions, this->load_vendor_configs_from_json(dir.string(), vendor_name, PresetBundle::LoadSystem, compatibility_rule).first);
-                    first = false;
-                } else {
-                    // Load the other vendor configs, merge them with this PresetBundle.
-                    // Report duplicate profiles.
-                    PresetBundle other;
-                    append(substitutions, other.load_vendor_configs_from_json(dir.string(), vendor_name, PresetBundle::LoadSystem, compatibility_rule).first);
-                    std::vector<std::string> duplicates = this->merge_presets(std::move(other));
-                    if (! duplicates.empty()) {
-                        errors_cummulative += "Found duplicated settings in vendor " + vendor_name + "'s json file lists: ";
-                        for (size_t i = 0; i < duplicates.size(); ++ i) {
-                            if (i > 0)
-                                errors_cummulative += ", ";
-                            errors_cummulative += duplicates[i];
-                        }
-                    }
+            vendor_names.emplace_back(std::move(vendor_name));
+        }
+    std::sort(vendor_names.begin(), vendor_names.end());
+
+    // Parse each vendor bundle into its own PresetBundle concurrently. With the full vendor set
+    // the json parsing dominates the cold start and the bundles are completely independent of
+    // each other until they are merged below.
+    std::vector<std::unique_ptr<PresetBundle>> vendor_bundles(vendor_names.size());
+    std::vector<PresetsConfigSubstitutions>    vendor_substitutions(vendor_names.size());
+    std::vector<std::string>                   vendor_errors(vendor_names.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, vendor_names.size()),
+        [&](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                try {
+                    auto bundle = std::make_unique<PresetBundle>();
+                    vendor_substitutions[i] = bundle->load_vendor_configs_from_json(
+                        dir.string(), vendor_names[i], PresetBundle::LoadSystem, compatibility_rule).first;
+                    vendor_bundles[i] = std::move(bundle);
+                } catch (const std::runtime_error &err) {
+                    vendor_errors[i] = err.what();
                 }
-            } catch (const std::runtime_error &err) {
-                errors_cummulative += err.what();
-                errors_cummulative += "\n";
+            }
+        });
+
+    // Merge the vendor bundles into this PresetBundle in deterministic order.
+    // Report duplicate profiles.
+    bool first = true;
+    for (size_t i = 0; i < vendor_names.size(); ++ i) {
+        if (! vendor_errors[i].empty()) {
+            errors_cummulative += vendor_errors[i];
+            errors_cummulative += "\n";
+        }
+        if (! vendor_bundles[i])
+            continue;
+        append(substitutions, std::move(vendor_substitutions[i]));
+        if (first) {
+            // Reset this PresetBundle before merging the first vendor config.
+            this->reset(false);
+            first = false;
+        }
+        std::vector<std::string> duplicates = this->merge_presets(std::move(*vendor_bundles[i]));
+        if (! duplicates.empty()) {
+            errors_cummulative += "Found duplicated settings in vendor " + vendor_names[i] + "'s json file lists: ";
+            for (size_t j = 0; j < duplicates.size(); ++ j) {
+                if (j > 0)
+                    errors_cummulative += ", ";
+                errors_cummulative += duplicates[j];
             }
         }
     }
@@ -32,18 +32,23 @@
 #include "I18N.hpp"
 #include "ShortestPath.hpp"
 #include "SupportMaterial.hpp"
+#include "ChromeTrace.hpp"
 #include "Thread.hpp"
 #include "Time.hpp"
 #include "GCode.hpp"
 #include "GCode/WipeTower.hpp"
 #include "GCode/WipeTower2.hpp"
 #include "Utils.hpp"
+#include "Execution/ExecutionNUMA.hpp"
 #include "PrintConfig.hpp"
 #include "Model.hpp"
 #include <float.h>
 
 #include <algorithm>
+#include <cstring>
+#include <deque>
 #include <limits>
+#include <mutex>
 #include <unordered_set>
 #include <boost/filesystem/path.hpp>
 #include <boost/format.hpp>
@@ -1640,6 +1645,41 @@ std::map<ObjectID, unsigned int> getObjectExtruderMap(const Print& print) {
     return objectExtruderMap;
 }
 
+// After calling the apply() function, set_task() may be called to limit the task to be processed by process().
+// Unlike the SLA counterpart, the FFF pipeline parallelizes over the objects inside process(), therefore only
+// the "process everything up to an object step" subset of the TaskParams interface is supported here:
+// to_object_step limits the per-object milestones and suppresses the print-wide steps (wipe tower,
+// skirt & brim, G-code) altogether. Used by the GUI for speculative pre-slicing while editing.
+void Print::set_task(const TaskParams &params)
+{
+    // Grab the lock for the Print / PrintObject milestones.
+    std::scoped_lock<std::mutex> lock(this->state_mutex());
+    m_task_to_object_step = params.to_object_step;
+}
+
+// Clean up after process() finished, either with success, error or if canceled.
+// The adjustments on the Print data due to set_task() are to be reverted here.
+void Print::finalize()
+{
+    std::scoped_lock<std::mutex> lock(this->state_mutex());
+    m_task_to_object_step = -1;
+}
+
+// Compares the two meshes geometrically, so that instances loaded as independent copies of the same
+// geometry (not sharing the TriangleMesh pointer) may still be mapped onto a shared slicing result.
+// The cheap negative tests (element counts) reject unrelated meshes before the exact bitwise
+// vertex & index comparison is reached.
+static bool is_mesh_geometry_the_same(const TriangleMesh &mesh1, const TriangleMesh &mesh2)
+{
+    const indexed_triangle_set &its1 = mesh1.its;
+    const indexed_triangle_set &its2 = mesh2.its;
+    return its1.indices.size() == its2.indices.size() && its1.vertices.size() == its2.vertices.size() &&
+           (its1.indices.empty() ||
+            memcmp(its1.indices.data(), its2.indices.data(), its1.indices.size() * sizeof(its1.indices.front())) == 0) &&
+           (its1.vertices.empty() ||
+            memcmp(its1.vertices.data(), its2.vertices.data(), its1.vertices.size() * sizeof(its1.vertices.front())) == 0);
+}
+
 // Slicing process, running at a background thread.
 void Print::process(long long *time_cost_with_cache, bool use_cache)
 {
@@ -1649,11 +1689,22 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
 
     name_tbb_thread_pool_threads_set_locale();
 
+    ChromeTraceSpan trace_span("Print::process");
+
     //compute the PrintObject with the same geometries
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": this=%1%, enter, use_cache=%2%, object size=%3%")%this%use_cache%m_objects.size();
     if (m_objects.empty())
         return;
 
+    // If set_task() limited the processing to an object step (speculative pre-slicing while editing),
+    // only the per-object milestones up to that step are calculated and the print-wide steps are skipped.
+    int to_object_step;
+    {
+        std::scoped_lock<std::mutex> lock(this->state_mutex());
+        to_object_step = m_task_to_object_step;
+    }
+    auto object_step_wanted = [to_object_step](PrintObjectStep step) { return to_object_step < 0 || int(step) <= to_object_step; };
+
     for (PrintObject *obj : m_objects)
         obj->clear_shared_object();
 
@@ -1675,7 +1726,10 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
             const ModelVolume &model_volume2 = *model_obj2->volumes[index];
             if (model_volume1.type() != model_volume2.type())
                 return false;
-            if (model_volume1.mesh_ptr() != model_volume2.mesh_ptr())
+            // Copies created by duplicating an object share the mesh pointer. Instances imported
+            // repeatedly from the same file do not, compare their geometry instead.
+            if (model_volume1.mesh_ptr() != model_volume2.mesh_ptr()
+                && ! is_mesh_geometry_the_same(model_volume1.mesh(), model_volume2.mesh()))
                 return false;
             if (!(model_volume1.get_transformation() == model_volume2.get_transformation()))
                 return false;
@@ -1752,50 +1806,45 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
     BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": total object counts %1% in current print, need to slice %2%")%m_objects.size()%need_slicing_objects.size();
     BOOST_LOG_TRIVIAL(info) << "Starting the slicing process." << log_memory_info();
     if (!use_cache) {
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->make_perimeters();
-            }
-            else {
-                if (obj->set_started(posSlice))
-                    obj->set_done(posSlice);
-                if (obj->set_started(posPerimeters))
-                    obj->set_done(posPerimeters);
-            }
-        }
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->estimate_curled_extrusions();
-            }
-            else {
-                if (obj->set_started(posEstimateCurledExtrusions))
-                    obj->set_done(posEstimateCurledExtrusions);
-            }
-        }
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->infill();
-            }
-            else {
-                if (obj->set_started(posPrepareInfill))
-                    obj->set_done(posPrepareInfill);
-                if (obj->set_started(posInfill))
-                    obj->set_done(posInfill);
-            }
-        }
-        for (PrintObject *obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->ironing();
-            }
-            else {
-                if (obj->set_started(posIroning))
-                    obj->set_done(posIroning);
-            }
-        }
+        // The stages up to ironing only depend on each other within a single PrintObject,
+        // thus each object runs its stage chain independently and the objects are processed
+        // concurrently. This keeps the cores busy across the serial joins of the parallel loops
+        // inside each stage: while one object sits in the join of make_perimeters(), another
+        // object is already filling the arena with its infill tasks.
+        // ex_numa spreads the objects over one arena per NUMA node, keeping each object's
+        // layer data on the socket that processes it; on a single socket (or without the
+        // tbbbind runtime) it is equivalent to a flat tbb::parallel_for.
+        execution::for_each(ex_numa, size_t(0), m_objects.size(),
+            [this, &need_slicing_objects, &object_step_wanted](size_t i) {
+                PrintObject* obj = m_objects[i];
+                if (need_slicing_objects.count(obj) != 0) {
+                    obj->make_perimeters();
+                    if (object_step_wanted(posEstimateCurledExtrusions))
+                        obj->estimate_curled_extrusions();
+                    if (object_step_wanted(posInfill))
+                        obj->infill();
+                    if (object_step_wanted(posIroning))
+                        obj->ironing();
+                }
+                else {
+                    if (obj->set_started(posSlice))
+                        obj->set_done(posSlice);
+                    if (obj->set_started(posPerimeters))
+                        obj->set_done(posPerimeters);
+                    if (object_step_wanted(posEstimateCurledExtrusions) && obj->set_started(posEstimateCurledExtrusions))
+                        obj->set_done(posEstimateCurledExtrusions);
+                    if (object_step_wanted(posPrepareInfill) && obj->set_started(posPrepareInfill))
+                        obj->set_done(posPrepareInfill);
+                    if (object_step_wanted(posInfill) && obj->set_started(posInfill))
+                        obj->set_done(posInfill);
+                    if (object_step_wanted(posIroning) && obj->set_started(posIroning))
+                        obj->set_done(posIroning);
+                }
+            }, 1);
 
-        tbb::parallel_for(tbb::blocked_range<int>(0, int(m_objects.size())),
-            [this, need_slicing_objects](const tbb::blocked_range<int>& range) {
-                for (int i = range.begin(); i < range.end(); i++) {
+        if (object_step_wanted(posSupportMaterial))
+            execution::for_each(ex_numa, size_t(0), m_objects.size(),
+                [this, &need_slicing_objects](size_t i) {
                     PrintObject* obj = m_objects[i];
                     if (need_slicing_objects.count(obj) != 0) {
                         obj->generate_support_material();
@@ -1804,19 +1853,23 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
                         if (obj->set_started(posSupportMaterial))
                             obj->set_done(posSupportMaterial);
                     }
+                }, 1);
+
+        if (object_step_wanted(posDetectOverhangsForLift))
+            for (PrintObject* obj : m_objects) {
+                if (need_slicing_objects.count(obj) != 0) {
+                    obj->detect_overhangs_for_lift();
+                }
+                else {
+                    if (obj->set_started(posDetectOverhangsForLift))
+                        obj->set_done(posDetectOverhangsForLift);
                 }
             }
-        );
 
-        for (PrintObject* obj : m_objects) {
-            if (need_slicing_objects.count(obj) != 0) {
-                obj->detect_overhangs_for_lift();
-            }
-            else {
-                if (obj->set_started(posDetectOverhangsForLift))
-                    obj->set_done(posDetectOverhangsForLift);
-            }
-        }
+        if (to_object_step < 0 && this->get_conserve_memory_flag())
+            // All per-object steps are done, only the G-code pipeline will read the layers from now on.
+            for (PrintObject *obj : m_objects)
+                obj->release_fill_intermediates();
     }
     else {
         for (PrintObject *obj : m_objects) {
@@ -1854,6 +1907,12 @@ void Print::process(long long *time_cost_with_cache, bool use_cache)
         }
     }
 
+    if (to_object_step >= 0) {
+        // The task was limited to the early per-object milestones, leave the print-wide steps untouched.
+        BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": processing limited to object step %1%, skipping the print-wide steps")%to_object_step;
+        return;
+    }
+
     if (this->set_started(psWipeTower)) {
         m_wipe_tower_data.clear();
         m_tool_ordering.clear();
@@ -2405,6 +2464,63 @@ bool Print::enable_timelapse_print() const
     return m_config.timelapse_type.value == TimelapseType::tlSmooth;
 }
 
+namespace {
+	// The generated wipe tower toolpaths are a pure function of the tower configuration and the planned
+	// tool change sequence, while the psWipeTower step is invalidated by almost any change of the scene.
+	// Cache the generated toolpaths process wide, so that re-slicing with an unchanged tool change plan
+	// skips the expensive tower generation. Only the WipeTower2 code path is cached.
+	struct WipeTowerCacheKey {
+		// One record per plan_toolchange() call issued while planning the tower.
+		struct PlanRecord {
+			float        print_z;
+			float        layer_height;
+			unsigned int old_tool;
+			unsigned int new_tool;
+			float        wipe_volume;
+			bool operator==(const PlanRecord &rhs) const {
+				return print_z == rhs.print_z && layer_height == rhs.layer_height &&
+					   old_tool == rhs.old_tool && new_tool == rhs.new_tool && wipe_volume == rhs.wipe_volume;
+			}
+		};
+		PrintConfig                     print_config;
+		PrintRegionConfig               region_config;
+		int                             plate_idx;
+		Vec3d                           origin;
+		std::vector<std::vector<float>> wipe_volumes;
+		unsigned int                    first_extruder;
+		// Layer height of the first object, used for planning the final purge.
+		coordf_t                        final_purge_layer_height;
+		std::vector<PlanRecord>         plan;
+
+		bool operator==(const WipeTowerCacheKey &rhs) const {
+			return plate_idx == rhs.plate_idx && origin == rhs.origin && first_extruder == rhs.first_extruder &&
+				   final_purge_layer_height == rhs.final_purge_layer_height && wipe_volumes == rhs.wipe_volumes &&
+				   plan == rhs.plan && print_config.diff(rhs.print_config).empty() &&
+				   region_config.diff(rhs.region_config).empty();
+		}
+	};
+
+	struct WipeTowerCacheEntry {
+		WipeTowerCacheKey                                     key;
+		// Outputs of WipeTower2::generate() and of the final purge.
+		std::vector<std::vector<WipeTower::ToolChangeResult>> tool_changes;
+		float                                                 depth;
+		std::vector<std::pair<float, float>>                  z_and_depth_pairs;
+		float                                                 brim_width;
+		float                                                 height;
+		WipeTower::ToolChangeResult                           final_purge;
+		std::vector<float>                                    used_filament;
+		int                                                   number_of_toolchanges;
+		Vec2f                                                 position;
+		float                                                 width;
+	};
+
+	static std::mutex                       s_wipe_tower_cache_mutex;
+	// Most recently used entry first, one entry per plate being iterated on.
+	static std::deque<WipeTowerCacheEntry>  s_wipe_tower_cache;
+	static constexpr size_t                 wipe_tower_cache_capacity = 4;
+} // namespace
+
 void Print::_make_wipe_tower()
 {
     m_wipe_tower_data.clear();
@@ -2419,6 +2535,14 @@ void Print::_make_wipe_tower()
     for (unsigned int i = 0; i<number_of_extruders; ++i)
         wipe_volumes.push_back(std::vector<float>(flush_matrix.begin()+i*number_of_extruders, flush_matrix.begin()+(i+1)*number_of_extruders));
 
+    // Purge volumes for each extruder pair with the flush multiplier applied, precomputed
+    // once and shared by all the toolchanges planned below. The raw wipe_volumes matrix is
+    // kept around as WipeTower2 and the toolpath cache key consume it without the multiplier.
+    std::vector<std::vector<float>> purge_volumes = wipe_volumes;
+    for (std::vector<float> &row : purge_volumes)
+        for (float &volume : row)
+            volume *= float(m_config.flush_multiplier);
+
     // Let the ToolOrdering class know there will be initial priming extrusions at the start of the print.
     // BBS: priming logic is removed, so don't consider it in tool ordering
     m_wipe_tower_data.tool_ordering = ToolOrdering(*this, (unsigned int)-1, false);
@@ -2496,8 +2620,7 @@ void Print::_make_wipe_tower()
                     // BBS: priming logic is removed, so no need to do toolchange for first extruder
                     if (/*(first_layer && extruder_id == m_wipe_tower_data.tool_ordering.all_extruders().back()) || */ extruder_id !=
                         current_extruder_id) {
-                        float volume_to_purge = wipe_volumes[current_extruder_id][extruder_id];
-                        volume_to_purge *= m_config.flush_multiplier;
+                        float volume_to_purge = purge_volumes[current_extruder_id][extruder_id];
 
                         // Not all of that can be used for infill purging:
                         // volume_to_purge -= (float)m_config.filament_minimal_purge_on_wipe_tower.get_at(extruder_id);
@@ -2575,6 +2698,16 @@ void Print::_make_wipe_tower()
         // m_wipe_tower_data.priming = Slic3r::make_unique<std::vector<WipeTower::ToolChangeResult>>(
         //     wipe_tower.prime((float)this->skirt_first_layer_height(), m_wipe_tower_data.tool_ordering.all_extruders(), false));
 
+        // Record the inputs the generated toolpaths depend on, so an unchanged plan may reuse the cached tower.
+        WipeTowerCacheKey cache_key;
+        cache_key.print_config             = m_config;
+        cache_key.region_config            = m_default_region_config;
+        cache_key.plate_idx                = m_plate_index;
+        cache_key.origin                   = m_origin;
+        cache_key.wipe_volumes             = wipe_volumes;
+        cache_key.first_extruder           = m_wipe_tower_data.tool_ordering.first_extruder();
+        cache_key.final_purge_layer_height = m_objects.front()->config().layer_height.value;
+
         // Lets go through the wipe tower layers and determine pairs of extruder changes for each
         // to pass to wipe_tower (so that it can use it for planning the layout of the tower)
         {
@@ -2585,13 +2718,14 @@ void Print::_make_wipe_tower()
                 bool first_layer = &layer_tools == &m_wipe_tower_data.tool_ordering.front();
                 wipe_tower.plan_toolchange((float) layer_tools.print_z, (float) layer_tools.wipe_tower_layer_height, current_extruder_id,
                                            current_extruder_id, false);
+                cache_key.plan.push_back({ (float) layer_tools.print_z, (float) layer_tools.wipe_tower_layer_height,
+                                           current_extruder_id, current_extruder_id, 0.f });
                 for (const auto extruder_id : layer_tools.extruders) {
                     if (/*(first_layer && extruder_id == m_wipe_tower_data.tool_ordering.all_extruders().back()) || */ extruder_id !=
                         current_extruder_id) {
                         float volume_to_wipe = m_config.prime_volume;
                         if (m_config.purge_in_prime_tower) {
-                            volume_to_wipe = wipe_volumes[current_extruder_id][extruder_id]; // total volume to wipe after this toolchange
-                            volume_to_wipe *= m_config.flush_multiplier;
+                            volume_to_wipe = purge_volumes[current_extruder_id][extruder_id]; // total volume to wipe after this toolchange
                             // Not all of that can be used for infill purging:
                             volume_to_wipe -= (float) m_config.filament_minimal_purge_on_wipe_tower.get_at(extruder_id);
 
@@ -2606,6 +2740,8 @@ void Print::_make_wipe_tower()
                         // request a toolchange at the wipe tower with at least volume_to_wipe purging amount
                         wipe_tower.plan_toolchange((float) layer_tools.print_z, (float) layer_tools.wipe_tower_layer_height,
                                                    current_extruder_id, extruder_id, volume_to_wipe);
+                        cache_key.plan.push_back({ (float) layer_tools.print_z, (float) layer_tools.wipe_tower_layer_height,
+                                                   current_extruder_id, extruder_id, volume_to_wipe });
                         current_extruder_id = extruder_id;
                     }
                 }
@@ -2615,37 +2751,76 @@ void Print::_make_wipe_tower()
             }
         }
 
-        // Generate the wipe tower layers.
-        m_wipe_tower_data.tool_changes.reserve(m_wipe_tower_data.tool_ordering.layer_tools().size());
-        wipe_tower.generate(m_wipe_tower_data.tool_changes);
-        m_wipe_tower_data.depth             = wipe_tower.get_depth();
-        m_wipe_tower_data.z_and_depth_pairs = wipe_tower.get_z_and_depth_pairs();
-        m_wipe_tower_data.brim_width        = wipe_tower.get_brim_width();
-        m_wipe_tower_data.height            = wipe_tower.get_wipe_tower_height();
+        // Reuse the cached tower toolpaths if the plan and the configuration did not change since they were generated.
+        Vec2f tower_position;
+        float tower_width;
+        bool  cache_hit = false;
+        {
+            std::lock_guard<std::mutex> lock(s_wipe_tower_cache_mutex);
+            auto cache_it = std::find_if(s_wipe_tower_cache.begin(), s_wipe_tower_cache.end(),
+                                         [&cache_key](const WipeTowerCacheEntry &entry) { return entry.key == cache_key; });
+            if (cache_it != s_wipe_tower_cache.end()) {
+                BOOST_LOG_TRIVIAL(debug) << "Print::_make_wipe_tower: reusing cached wipe tower toolpaths";
+                m_wipe_tower_data.tool_changes          = cache_it->tool_changes;
+                m_wipe_tower_data.depth                 = cache_it->depth;
+                m_wipe_tower_data.z_and_depth_pairs     = cache_it->z_and_depth_pairs;
+                m_wipe_tower_data.brim_width            = cache_it->brim_width;
+                m_wipe_tower_data.height                = cache_it->height;
+                m_wipe_tower_data.final_purge           = Slic3r::make_unique<WipeTower::ToolChangeResult>(cache_it->final_purge);
+                m_wipe_tower_data.used_filament         = cache_it->used_filament;
+                m_wipe_tower_data.number_of_toolchanges = cache_it->number_of_toolchanges;
+                tower_position                          = cache_it->position;
+                tower_width                             = cache_it->width;
+                if (cache_it != s_wipe_tower_cache.begin())
+                    std::rotate(s_wipe_tower_cache.begin(), cache_it, std::next(cache_it));
+                cache_hit = true;
+            }
+        }
 
-        // Unload the current filament over the purge tower.
-        coordf_t layer_height = m_objects.front()->config().layer_height.value;
-        if (m_wipe_tower_data.tool_ordering.back().wipe_tower_partitions > 0) {
-            // The wipe tower goes up to the last layer of the print.
-            if (wipe_tower.layer_finished()) {
-                // The wipe tower is printed to the top of the print and it has no space left for the final extruder purge.
-                // Lift Z to the next layer.
-                wipe_tower.set_layer(float(m_wipe_tower_data.tool_ordering.back().print_z + layer_height), float(layer_height), 0, false,
-                                     true);
+        if (! cache_hit) {
+            // Generate the wipe tower layers.
+            m_wipe_tower_data.tool_changes.reserve(m_wipe_tower_data.tool_ordering.layer_tools().size());
+            wipe_tower.generate(m_wipe_tower_data.tool_changes);
+            m_wipe_tower_data.depth             = wipe_tower.get_depth();
+            m_wipe_tower_data.z_and_depth_pairs = wipe_tower.get_z_and_depth_pairs();
+            m_wipe_tower_data.brim_width        = wipe_tower.get_brim_width();
+            m_wipe_tower_data.height            = wipe_tower.get_wipe_tower_height();
+
+            // Unload the current filament over the purge tower.
+            coordf_t layer_height = m_objects.front()->config().layer_height.value;
+            if (m_wipe_tower_data.tool_ordering.back().wipe_tower_partitions > 0) {
+                // The wipe tower goes up to the last layer of the print.
+                if (wipe_tower.layer_finished()) {
+                    // The wipe tower is printed to the top of the print and it has no space left for the final extruder purge.
+                    // Lift Z to the next layer.
+                    wipe_tower.set_layer(float(m_wipe_tower_data.tool_ordering.back().print_z + layer_height), float(layer_height), 0, false,
+                                         true);
+                } else {
+                    // There is yet enough space at this layer of the wipe tower for the final purge.
+                }
             } else {
-                // There is yet enough space at this layer of the wipe tower for the final purge.
+                // The wipe tower does not reach the last print layer, perform the pruge at the last print layer.
+                assert(m_wipe_tower_data.tool_ordering.back().wipe_tower_partitions == 0);
+                wipe_tower.set_layer(float(m_wipe_tower_data.tool_ordering.back().print_z), float(layer_height), 0, false, true);
             }
-        } else {
-            // The wipe tower does not reach the last print layer, perform the pruge at the last print layer.
-            assert(m_wipe_tower_data.tool_ordering.back().wipe_tower_partitions == 0);
-            wipe_tower.set_layer(float(m_wipe_tower_data.tool_ordering.back().print_z), float(layer_height), 0, false, true);
+            m_wipe_tower_data.final_purge = Slic3r::make_unique<WipeTower::ToolChangeResult>(wipe_tower.tool_change((unsigned int) (-1)));
+
+            m_wipe_tower_data.used_filament         = wipe_tower.get_used_filament();
+            m_wipe_tower_data.number_of_toolchanges = wipe_tower.get_number_of_toolchanges();
+            tower_position                          = wipe_tower.position();
+            tower_width                             = wipe_tower.width();
+
+            std::lock_guard<std::mutex> lock(s_wipe_tower_cache_mutex);
+            s_wipe_tower_cache.push_front({ std::move(cache_key), m_wipe_tower_data.tool_changes, m_wipe_tower_data.depth,
+                                            m_wipe_tower_data.z_and_depth_pairs, m_wipe_tower_data.brim_width, m_wipe_tower_data.height,
+                                            *m_wipe_tower_data.final_purge, m_wipe_tower_data.used_filament,
+                                            m_wipe_tower_data.number_of_toolchanges, tower_position, tower_width });
+            if (s_wipe_tower_cache.size() > wipe_tower_cache_capacity)
+                s_wipe_tower_cache.pop_back();
         }
-        m_wipe_tower_data.final_purge = Slic3r::make_unique<WipeTower::ToolChangeResult>(wipe_tower.tool_change((unsigned int) (-1)));
 
-        m_wipe_tower_data.used_filament         = wipe_tower.get_used_filament();
-        m_wipe_tower_data.number_of_toolchanges = wipe_tower.get_number_of_toolchanges();
-        const Vec3d origin                      = Vec3d::Zero();
-        m_fake_wipe_tower.set_fake_extrusion_data(wipe_tower.position(), wipe_tower.width(), wipe_tower.get_wipe_tower_height(),
+        const Vec3d origin = Vec3d::Zero();
+        m_fake_wipe_tower.set_fake_extrusion_data(tower_position, tower_width, m_wipe_tower_data.height,
                                                   config().initial_layer_print_height, m_wipe_tower_data.depth,
                                                   m_wipe_tower_data.z_and_depth_pairs, m_wipe_tower_data.brim_width,
                                                   config().wipe_tower_rotation_angle, config().wipe_tower_cone_angle,
@@ -2684,14 +2859,22 @@ void Print::set_gcode_file_invalidated()
 //BBS: add gcode file preload logic
 void Print::export_gcode_from_previous_file(const std::string& file, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb)
 {
+    //BBS: a binary cache of the processed result may have been saved next to the G-code file
+    //(and restored with it from the 3mf); loading it skips re-parsing the whole file.
+    const std::string result_cache_file = file + GCodeProcessorResult::BinaryCacheExtension;
     try {
         GCodeProcessor processor;
         const Vec3d origin = this->get_plate_origin();
         processor.set_xy_offset(origin(0), origin(1));
         //processor.enable_producers(true);
-        processor.process_file(file);
+        bool cache_hit = processor.load_result_from_binary(file, result_cache_file);
+        if (! cache_hit)
+            processor.process_file(file);
 
         *result = std::move(processor.extract_result());
+        if (! cache_hit)
+            //BBS: best effort only, the result cache is re-created on the next occasion
+            result->save_to_binary(result_cache_file);
     } catch (std::exception & /* ex */) {
         BOOST_LOG_TRIVIAL(error) << __FUNCTION__ <<  boost::format(": found errors when process gcode file %1%") %file.c_str();
         throw Slic3r::RuntimeError(
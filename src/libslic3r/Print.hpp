@@ -451,6 +451,29 @@ public:
     void                    config_apply(const ConfigBase &other, bool ignore_nonexistent = false) { m_config.apply(other, ignore_nonexistent); }
     void                    config_apply_only(const ConfigBase &other, const t_config_option_keys &keys, bool ignore_nonexistent = false) { m_config.apply_only(other, keys, ignore_nonexistent); }
     PrintBase::ApplyStatus  set_instances(PrintInstances &&instances);
+    // Incremental re-slice: invalidate the slicing step, remembering the Z interval (unscaled, in the
+    // slicing coordinate space of this PrintObject) overwritten by a localized edit (multi-material paint
+    // stroke, modifier volume edit). PrintObject::slice() tries to keep the layers outside of the interval
+    // intact. Intervals of multiple localized edits before a re-slice accumulate, while any other
+    // invalidation of the slicing step drops the interval, enforcing a full re-slice.
+    bool                    invalidate_slice_step_with_dirty_z_range(const std::pair<float, float> &range) {
+        // invalidate_step() drops the pending incremental re-slice state, save and restore it.
+        std::pair<float, float>        pending_range   = m_dirty_slice_z_range;
+        std::vector<PrintRegionConfig> pending_configs = std::move(m_dirty_slice_region_configs);
+        bool invalidated = this->invalidate_step(posSlice);
+        m_dirty_slice_z_range = pending_range;
+        if (m_dirty_slice_z_range.first > m_dirty_slice_z_range.second)
+            m_dirty_slice_z_range = range;
+        else if (range.first <= range.second)
+            m_dirty_slice_z_range = { std::min(m_dirty_slice_z_range.first, range.first), std::max(m_dirty_slice_z_range.second, range.second) };
+        m_dirty_slice_region_configs = std::move(pending_configs);
+        return invalidated;
+    }
+    // Configurations of the PrintRegions the current layers were sliced with, remembered when Print::apply()
+    // throws the region set away (a modifier volume was edited). If the regenerated regions carry the same
+    // configurations in the same order, PrintObject::slice() re-binds the reused layers to them. Cleared by slice().
+    void                    set_dirty_slice_region_configs(std::vector<PrintRegionConfig> &&configs) { m_dirty_slice_region_configs = std::move(configs); }
+    const std::vector<PrintRegionConfig>& dirty_slice_region_configs() const { return m_dirty_slice_region_configs; }
     // Invalidates the step, and its depending steps in PrintObject and Print.
     bool                    invalidate_step(PrintObjectStep step);
     // Invalidates all PrintObject and Print steps.
@@ -469,11 +492,20 @@ private:
     void prepare_infill();
     void infill();
     void ironing();
+    void release_fill_intermediates();
     void generate_support_material();
     void estimate_curled_extrusions();
     void simplify_extrusion_path();
 
-    void slice_volumes();
+    // If reslice_mask is not empty, only the layers flagged in the mask are sliced,
+    // the remaining layers were reused by PrintObject::slice() and are left intact.
+    void slice_volumes(const std::vector<bool> &reslice_mask = {});
+    // Slicing checkpoints (see --checkpoint-dir): the final state of the posSlice step is serialized
+    // to a file keyed by a fingerprint of the inputs, so a restarted job resumes from it instead of
+    // re-slicing. No-ops while checkpoint_dir() is empty.
+    uint64_t slice_checkpoint_fingerprint() const;
+    bool     load_slice_checkpoint();
+    void     save_slice_checkpoint() const;
     //BBS
     ExPolygons _shrink_contour_holes(double contour_delta, double hole_delta, const ExPolygons& polys) const;
     // BBS
@@ -523,6 +555,11 @@ private:
     // so that next call to make_perimeters() performs a union() before computing loops
     bool                    				m_typed_slices = false;
 
+    // Z interval to be re-sliced incrementally, empty (min > max) = full re-slice.
+    std::pair<float, float>                 m_dirty_slice_z_range { 0.f, -1.f };
+    // See set_dirty_slice_region_configs(). Empty if the region set survived since the last slicing.
+    std::vector<PrintRegionConfig>          m_dirty_slice_region_configs;
+
     std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> m_adaptive_fill_octrees;
     FillLightning::GeneratorPtr m_lightning_generator;
 
@@ -538,7 +575,7 @@ private:
     // 
     // object id
     size_t               m_id;
-    void apply_conical_overhang();
+    void apply_conical_overhang(const std::vector<bool> &reslice_mask = {});
 
  public:
     //BBS: When printing multi-material objects, this settings will make slicer to clip the overlapping object parts one by the other.
@@ -812,6 +849,13 @@ public:
     std::vector<ObjectID> print_object_ids() const override;
 
     ApplyStatus         apply(const Model &model, DynamicPrintConfig config) override;
+    // After calling the apply() function, set_task() may be called to limit the task to be processed by process().
+    // The FFF pipeline only honors the to_object_step limit; it is used by the GUI for speculative
+    // pre-slicing of the early milestones while the model is being edited.
+    void                set_task(const TaskParams &params) override;
+    // Clean up after process() finished, either with success, error or if canceled.
+    // The adjustments on the Print data due to set_task() are reverted here.
+    void                finalize() override;
 
     void                process(long long *time_cost_with_cache = nullptr, bool use_cache = false) override;
     // Exports G-code into a file name based on the path_template, returns the file path of the generated G-code file.
@@ -866,6 +910,10 @@ public:
     //BBS: Function to get m_brimMap;
     std::map<ObjectID, ExtrusionEntityCollection>&
         get_brimMap() { return m_brimMap; }
+    const std::map<ObjectID, ExtrusionEntityCollection>&
+        get_brimMap() const { return m_brimMap; }
+    const std::map<ObjectID, ExtrusionEntityCollection>&
+        get_supportBrimMap() const { return m_supportBrimMap; }
 
     // How many of PrintObject::copies() over all print objects are there?
     // If zero, then the print is empty and the print shall not be executed.
@@ -1001,6 +1049,9 @@ private:
     Vec3d   m_origin;
     //BBS: modified_count
     int     m_modified_count {0};
+    // Limit process() to the given PrintObject step (-1 = no limit). Set by set_task(), reverted by
+    // finalize(). Guarded by state_mutex().
+    int     m_task_to_object_step {-1};
     //BBS
     ConflictResultOpt m_conflict_result;
     FakeWipeTower     m_fake_wipe_tower;
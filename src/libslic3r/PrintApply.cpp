@@ -2,6 +2,7 @@
 #include "Print.hpp"
 
 #include <cfloat>
+#include <climits>
 
 namespace Slic3r {
 
@@ -52,6 +53,48 @@ namespace Slic3r {
             delete mv_with_status.first;
 }
 
+// Synchronize the volume lists after a modifier-only edit: the solid volumes of model_object_dst are kept
+// (they are known to match model_object_new), the modifier volumes are copied / updated from model_object_new,
+// preserving the volume order of the new list.
+/* static */ void model_volume_list_update_modifiers(ModelObject &model_object_dst, const ModelObject &model_object_new)
+{
+    typedef std::pair<const ModelVolume*, bool> ModelVolumeWithStatus;
+    std::vector<ModelVolumeWithStatus> old_volumes;
+    old_volumes.reserve(model_object_dst.volumes.size());
+    for (const ModelVolume *model_volume : model_object_dst.volumes)
+        old_volumes.emplace_back(ModelVolumeWithStatus(model_volume, false));
+    auto model_volume_lower = [](const ModelVolumeWithStatus &mv1, const ModelVolumeWithStatus &mv2){ return mv1.first->id() <  mv2.first->id(); };
+    auto model_volume_equal = [](const ModelVolumeWithStatus &mv1, const ModelVolumeWithStatus &mv2){ return mv1.first->id() == mv2.first->id(); };
+    std::sort(old_volumes.begin(), old_volumes.end(), model_volume_lower);
+    model_object_dst.volumes.clear();
+    model_object_dst.volumes.reserve(model_object_new.volumes.size());
+    for (const ModelVolume *model_volume_src : model_object_new.volumes) {
+        ModelVolumeWithStatus key(model_volume_src, false);
+        auto it = std::lower_bound(old_volumes.begin(), old_volumes.end(), key, model_volume_lower);
+        if (it != old_volumes.end() && model_volume_equal(*it, key)) {
+            // The volume was found in the old list. Just copy it.
+            assert(! it->second); // not consumed yet
+            it->second = true;
+            ModelVolume *model_volume_dst = const_cast<ModelVolume*>(it->first);
+            assert(model_volume_dst->type() == model_volume_src->type());
+            model_object_dst.volumes.emplace_back(model_volume_dst);
+            if (model_volume_dst->is_modifier())
+                // The modifier may have been moved, rotated or scaled.
+                model_volume_dst->set_transformation(model_volume_src->get_transformation());
+            assert(model_volume_dst->get_matrix().isApprox(model_volume_src->get_matrix()));
+        } else {
+            // The volume was not found in the old list, it is a newly added modifier. Create a new copy.
+            assert(model_volume_src->is_modifier());
+            model_object_dst.volumes.emplace_back(new ModelVolume(*model_volume_src));
+            model_object_dst.volumes.back()->set_model_object(&model_object_dst);
+        }
+    }
+    // Release the non-consumed old volumes (modifiers deleted from the new list).
+    for (ModelVolumeWithStatus &mv_with_status : old_volumes)
+        if (! mv_with_status.second)
+            delete mv_with_status.first;
+}
+
 static inline void model_volume_list_copy_configs(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type)
 {
     size_t i_src, i_dst;
@@ -83,6 +126,119 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
     }
 }
 
+// Z interval (in the slicing coordinate space defined by trafo) covered by the facets whose
+// multi-material painting differs between the old and the new ModelObject. The facet lists of
+// FacetsAnnotation are sorted by the facet index, thus the two annotations are merged in a single
+// pass and only the facets with a modified bit stream contribute to the interval.
+// Returns an empty interval (min > max) if the painting did not change.
+static std::pair<float, float> mmu_paint_dirty_z_range(const ModelObject &model_object_old, const ModelObject &model_object_new, const Transform3d &trafo)
+{
+    std::pair<float, float> range { FLT_MAX, -FLT_MAX };
+    size_t i_old, i_new;
+    for (i_old = 0, i_new = 0; i_old < model_object_old.volumes.size() && i_new < model_object_new.volumes.size();) {
+        const ModelVolume &mv_old = *model_object_old.volumes[i_old];
+        const ModelVolume &mv_new = *model_object_new.volumes[i_new];
+        if (mv_old.type() != ModelVolumeType::MODEL_PART) {
+            ++ i_old;
+            continue;
+        }
+        if (mv_new.type() != ModelVolumeType::MODEL_PART) {
+            ++ i_new;
+            continue;
+        }
+        assert(mv_old.id() == mv_new.id());
+        if (! mv_old.mmu_segmentation_facets.timestamp_matches(mv_new.mmu_segmentation_facets)) {
+            const auto                 &data_old = mv_old.mmu_segmentation_facets.get_data();
+            const auto                 &data_new = mv_new.mmu_segmentation_facets.get_data();
+            const indexed_triangle_set &its      = mv_new.mesh().its;
+            const Transform3d           t        = trafo * mv_new.get_matrix();
+            auto extend_by_facet = [&range, &its, &t](int facet_idx) {
+                if (facet_idx >= 0 && facet_idx < int(its.indices.size()))
+                    for (int i = 0; i < 3; ++ i) {
+                        float z = float((t * its.vertices[its.indices[facet_idx](i)].cast<double>()).z());
+                        range.first  = std::min(range.first, z);
+                        range.second = std::max(range.second, z);
+                    }
+            };
+            // Bit stream of a single serialized facet: from its offset up to the offset of the next serialized facet.
+            auto facet_bits_equal = [&data_old, &data_new](size_t entry_old, size_t entry_new) {
+                size_t begin_old = data_old.first[entry_old].second;
+                size_t end_old   = entry_old + 1 < data_old.first.size() ? data_old.first[entry_old + 1].second : data_old.second.size();
+                size_t begin_new = data_new.first[entry_new].second;
+                size_t end_new   = entry_new + 1 < data_new.first.size() ? data_new.first[entry_new + 1].second : data_new.second.size();
+                return end_old - begin_old == end_new - begin_new &&
+                       std::equal(data_old.second.begin() + begin_old, data_old.second.begin() + end_old, data_new.second.begin() + begin_new);
+            };
+            for (size_t entry_old = 0, entry_new = 0; entry_old < data_old.first.size() || entry_new < data_new.first.size();) {
+                int facet_old = entry_old < data_old.first.size() ? data_old.first[entry_old].first : INT_MAX;
+                int facet_new = entry_new < data_new.first.size() ? data_new.first[entry_new].first : INT_MAX;
+                if (facet_old < facet_new) {
+                    // Painting of the facet was erased.
+                    extend_by_facet(facet_old);
+                    ++ entry_old;
+                } else if (facet_new < facet_old) {
+                    // The facet was painted anew.
+                    extend_by_facet(facet_new);
+                    ++ entry_new;
+                } else {
+                    if (! facet_bits_equal(entry_old, entry_new))
+                        extend_by_facet(facet_new);
+                    ++ entry_old;
+                    ++ entry_new;
+                }
+            }
+        }
+        ++ i_old;
+        ++ i_new;
+    }
+    return range;
+}
+
+// Z interval (in the slicing coordinate space defined by trafo) covered by the modifier mesh volumes
+// which were added, removed, transformed or reordered between the old and the new ModelObject.
+// Both the old and the new placement of a changed modifier contribute to the interval.
+// Returns an empty interval (min > max) if the modifier volumes did not change.
+static std::pair<float, float> modifier_dirty_z_range(const ModelObject &model_object_old, const ModelObject &model_object_new, const Transform3d &trafo)
+{
+    std::pair<float, float> range { FLT_MAX, -FLT_MAX };
+    auto extend_by_volume = [&range, &trafo](const ModelVolume &mv) {
+        const Transform3d t = trafo * mv.get_matrix();
+        // Iterating all the mesh vertices including possibly unreferenced ones: those may only enlarge
+        // the interval, which is safe.
+        for (const stl_vertex &vertex : mv.mesh().its.vertices) {
+            float z = float((t * vertex.cast<double>()).z());
+            range.first  = std::min(range.first, z);
+            range.second = std::max(range.second, z);
+        }
+    };
+    std::vector<const ModelVolume*> modifiers_old, modifiers_new;
+    for (const ModelVolume *mv : model_object_old.volumes)
+        if (mv->is_modifier())
+            modifiers_old.emplace_back(mv);
+    for (const ModelVolume *mv : model_object_new.volumes)
+        if (mv->is_modifier())
+            modifiers_new.emplace_back(mv);
+    auto modifier_matches = [](const ModelVolume *l, const ModelVolume *r) {
+        return l->id() == r->id() && l->get_matrix().isApprox(r->get_matrix());
+    };
+    // Match the common prefix and the common suffix of the two lists, everything in between differs
+    // (was added, removed, transformed or reordered) and contributes to the dirty interval.
+    size_t begin = 0;
+    while (begin < modifiers_old.size() && begin < modifiers_new.size() && modifier_matches(modifiers_old[begin], modifiers_new[begin]))
+        ++ begin;
+    size_t end_old = modifiers_old.size();
+    size_t end_new = modifiers_new.size();
+    while (end_old > begin && end_new > begin && modifier_matches(modifiers_old[end_old - 1], modifiers_new[end_new - 1])) {
+        -- end_old;
+        -- end_new;
+    }
+    for (size_t i = begin; i < end_old; ++ i)
+        extend_by_volume(*modifiers_old[i]);
+    for (size_t i = begin; i < end_new; ++ i)
+        extend_by_volume(*modifiers_new[i]);
+    return range;
+}
+
 static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
 {
     assert(lr_dst.size() == lr_src.size());
@@ -1221,13 +1377,20 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
         assert(model_object_status.status == ModelObjectStatus::Old || model_object_status.status == ModelObjectStatus::Moved);
         // Check whether a model part volume was added or removed, their transformations or order changed.
         // Only volume IDs, volume types, transformation matrices and their order are checked, configuration and other parameters are NOT checked.
+        bool mmu_segmentation_differ    = model_mmu_segmentation_data_changed(model_object, model_object_new);
         bool solid_or_modifier_differ   = model_volume_list_changed(model_object, model_object_new, solid_or_modifier_types) ||
-                                          model_mmu_segmentation_data_changed(model_object, model_object_new) ||
+                                          (model_object_new.is_mm_painted() && num_extruders_changed );
+        bool solid_differ               = model_volume_list_changed(model_object, model_object_new, { ModelVolumeType::MODEL_PART, ModelVolumeType::NEGATIVE_VOLUME }) ||
                                           (model_object_new.is_mm_painted() && num_extruders_changed );
         bool supports_differ            = model_volume_list_changed(model_object, model_object_new, ModelVolumeType::SUPPORT_BLOCKER) ||
                                           model_volume_list_changed(model_object, model_object_new, ModelVolumeType::SUPPORT_ENFORCER);
         bool layer_height_ranges_differ = ! layer_height_ranges_equal(model_object.layer_config_ranges, model_object_new.layer_config_ranges, model_object_new.layer_height_profile.empty());
         bool model_origin_translation_differ = model_object.origin_translation != model_object_new.origin_translation;
+        // Did just the modifier mesh volumes change (were added, removed or transformed)? Such an edit only
+        // invalidates the layers the modifiers pass through, there is no need to tear the PrintObjects down.
+        bool modifier_only_differ       = solid_or_modifier_differ && ! solid_differ &&
+                                          ! model_origin_translation_differ && ! layer_height_ranges_differ &&
+                                          model_object.layer_height_profile.timestamp_matches(model_object_new.layer_height_profile);
         auto print_objects_range        = print_object_status_db.get_range(model_object);
         // The list actually can be empty if all instances are out of the print bed.
         //assert(print_objects_range.begin() != print_objects_range.end());
@@ -1236,7 +1399,7 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             model_object_status.print_object_regions = print_objects_range.begin()->print_object->m_shared_regions;
             model_object_status.print_object_regions->ref_cnt_inc();
         }
-        if (solid_or_modifier_differ || model_origin_translation_differ || layer_height_ranges_differ ||
+        if ((solid_or_modifier_differ && ! modifier_only_differ) || model_origin_translation_differ || layer_height_ranges_differ ||
             ! model_object.layer_height_profile.timestamp_matches(model_object_new.layer_height_profile)) {
             // The very first step (the slicing step) is invalidated. One may freely remove all associated PrintObjects.
             model_object_status.print_object_regions_status =
@@ -1258,6 +1421,45 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             model_object.assign_copy(model_object_new);
         } else {
             model_object_status.print_object_regions_status = ModelObjectStatus::PrintObjectRegionsStatus::Valid;
+            if (modifier_only_differ) {
+                // Only the modifier mesh volumes differ. Keep the PrintObjects and their layers, invalidate
+                // just the slicing step and remember the Z band swept by the old and the new modifier
+                // placement, so PrintObject::slice() may reuse the layers outside of it.
+                this->call_cancel_callback();
+                update_apply_status(false);
+                // The region set has to be rebuilt with fresh bounding boxes of the changed modifiers.
+                // Remember the old region configurations, so PrintObject::slice() may re-bind the reused
+                // layers if the regenerated regions come out the same.
+                std::vector<PrintRegionConfig> old_region_configs;
+                if (model_object_status.print_object_regions != nullptr) {
+                    old_region_configs.reserve(model_object_status.print_object_regions->all_regions.size());
+                    for (const std::unique_ptr<PrintRegion> &region : model_object_status.print_object_regions->all_regions)
+                        old_region_configs.emplace_back(region->config());
+                }
+                for (const PrintObjectStatus &print_object_status : print_objects_range) {
+                    update_apply_status(print_object_status.print_object->invalidate_slice_step_with_dirty_z_range(
+                        modifier_dirty_z_range(model_object, model_object_new, print_object_status.print_object->trafo())));
+                    if (print_object_status.print_object->dirty_slice_region_configs().empty())
+                        // If a previous apply() already stored the configurations matching the live layers, keep those.
+                        print_object_status.print_object->set_dirty_slice_region_configs(std::vector<PrintRegionConfig>(old_region_configs));
+                }
+                model_object_status.print_object_regions_status = ModelObjectStatus::PrintObjectRegionsStatus::PartiallyValid;
+                if (model_object_status.print_object_regions != nullptr)
+                    // Drop everything from PrintObjectRegions but those VolumeExtents (of their particular ModelVolumes) that are still valid.
+                    print_objects_regions_invalidate_keep_some_volumes(*model_object_status.print_object_regions, model_object.volumes, model_object_new.volumes);
+                // Copy just the modifier volumes. Their configs are synchronized by model_volume_list_copy_configs() below.
+                model_volume_list_update_modifiers(model_object, model_object_new);
+            }
+            if (mmu_segmentation_differ) {
+                // Only the multi-material painting changed. Invalidate the slicing step and remember
+                // the painted Z band, so PrintObject::slice() may reuse the layers outside of it.
+                // The painting itself is copied by model_volume_list_copy_configs() below.
+                this->call_cancel_callback();
+                update_apply_status(false);
+                for (const PrintObjectStatus &print_object_status : print_objects_range)
+                    update_apply_status(print_object_status.print_object->invalidate_slice_step_with_dirty_z_range(
+                        mmu_paint_dirty_z_range(model_object, model_object_new, print_object_status.print_object->trafo())));
+            }
             if (supports_differ || model_custom_supports_data_changed(model_object, model_object_new)) {
                 // First stop background processing before shuffling or deleting the ModelVolumes in the ModelObject's list.
                 if (supports_differ) {
@@ -1275,7 +1477,7 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                 update_apply_status(this->invalidate_step(psGCodeExport));
             }
         }
-        if (! solid_or_modifier_differ) {
+        if (! solid_or_modifier_differ || modifier_only_differ) {
             // Synchronize Object's config.
             bool object_config_changed = ! model_object.config.timestamp_matches(model_object_new.config);
 			if (object_config_changed)
@@ -3,8 +3,10 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/log/trivial.hpp>
 
 #include "I18N.hpp"
+#include "Utils.hpp"
 
 //! macro used to mark string used at localization,
 //! return same string
@@ -20,6 +22,31 @@ void PrintTryCancel::operator()()
 
 size_t PrintStateBase::g_last_timestamp = 0;
 
+// Warn when the resident memory of the process exceeds this fraction of the physical memory.
+// 3000+ layer jobs are routinely killed by the system OOM killer; warning the user while a step
+// still holds its memory gives a chance to reduce the job before the process disappears silently.
+static constexpr double memory_pressure_warning_ratio = 0.9;
+
+size_t step_memory_snapshot()
+{
+    return current_memory_rss();
+}
+
+std::string step_memory_report(const char *step_kind, int step, size_t rss_before, int64_t &delta_out)
+{
+    size_t rss = current_memory_rss();
+    delta_out = (rss == 0 || rss_before == 0) ? 0 : int64_t(rss) - int64_t(rss_before);
+    if (rss == 0)
+        // Not available on this platform.
+        return std::string();
+    BOOST_LOG_TRIVIAL(debug) << step_kind << " " << step << " done, resident memory " << format_memsize_MB(rss)
+        << " (" << (delta_out < 0 ? "-" : "+") << format_memsize_MB(size_t(delta_out < 0 ? - delta_out : delta_out)) << " by this step)";
+    if (size_t total = total_physical_memory(); total > 0 && double(rss) > memory_pressure_warning_ratio * double(total))
+        return L("Slicing is running out of memory: ") + format_memsize_MB(rss) + L(" of ") + format_memsize_MB(total) +
+               L(" physical memory in use. Reduce the number of objects or the resolution, or slice the plates one by one.");
+    return std::string();
+}
+
 // Update "scale", "input_filename", "input_filename_base" placeholders from the current m_objects.
 void PrintBase::update_object_placeholders(DynamicConfig &config, const std::string &default_ext) const
 {
@@ -13,6 +13,7 @@
 #include "Model.hpp"
 #include "PlaceholderParser.hpp"
 #include "PrintConfig.hpp"
+#include "Telemetry.hpp"
 
 namespace Slic3r {
 
@@ -516,6 +517,10 @@ public:
     void set_plate_index(int index) { m_plate_index = index; }
     bool get_no_check_flag() const { return m_no_check; }
     void set_no_check_flag(bool no_check) { m_no_check = no_check; }
+    //BBS: when set, per-layer intermediate data is released as soon as all processing steps
+    // consumed it. For batch (CLI) slicing only, the print can not be re-processed incrementally then.
+    bool get_conserve_memory_flag() const { return m_conserve_memory; }
+    void set_conserve_memory_flag(bool conserve_memory) { m_conserve_memory = conserve_memory; }
 
     //SoftFever plate name
     std::string get_plate_name() const { return m_plate_name; }
@@ -554,6 +559,7 @@ protected:
     //BBS: add plate id into print base
     int m_plate_index{ 0 };
     bool m_no_check = false;
+    bool m_conserve_memory = false;
 
     // SoftFever: current plate name
     std::string m_plate_name;
@@ -575,6 +581,15 @@ private:
     friend PrintTryCancel;
 };
 
+// Step boundary memory accounting, used by PrintBaseWithState / PrintObjectBaseWithState below.
+// step_memory_snapshot() samples the resident memory of the process when a step starts,
+// step_memory_report() samples it again when the step is done, stores the difference into delta_out
+// (negative if the step released memory), logs it and returns a non-empty localized warning text
+// when the process is dangerously close to exhausting the physical memory, so the caller can
+// attach it to the step as a critical slicing warning before the OOM killer fires.
+size_t      step_memory_snapshot();
+std::string step_memory_report(const char *step_kind, int step, size_t rss_before, int64_t &delta_out);
+
 template<typename PrintStepEnum, const size_t COUNT>
 class PrintBaseWithState : public PrintBase
 {
@@ -583,9 +598,27 @@ public:
 	PrintStateBase::StateWithTimeStamp step_state_with_timestamp(PrintStepEnum step) const { return m_state.state_with_timestamp(step, this->state_mutex()); }
     PrintStateBase::StateWithWarnings  step_state_with_warnings(PrintStepEnum step) const { return m_state.state_with_warnings(step, this->state_mutex()); }
 
+    // Resident memory growth attributed to a processing step, in bytes, negative if the step
+    // released memory. Maintained by the worker thread, valid once the step is done.
+    int64_t         step_memory_delta(PrintStepEnum step) const { return m_step_memory_delta[step]; }
+
 protected:
-    bool            set_started(PrintStepEnum step) { return m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); }); }
+    bool            set_started(PrintStepEnum step) {
+        bool started = m_state.set_started(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
+        if (started) {
+            m_step_memory_before[step] = step_memory_snapshot();
+            m_step_start_time[step]    = telemetry_now_seconds();
+        }
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintStepEnum step) {
+        if (std::string warning = step_memory_report("print step", static_cast<int>(step), m_step_memory_before[step], m_step_memory_delta[step]); ! warning.empty())
+            // Attach the memory pressure warning while the step is still active, so it travels
+            // to the UI / CLI through the SlicingStatus warnings of this step.
+            this->active_step_add_warning(PrintStateBase::WarningLevel::CRITICAL, warning);
+        if (! telemetry_log_path().empty())
+            telemetry_record_step("print step", static_cast<int>(step), telemetry_now_seconds() - m_step_start_time[step],
+                m_step_memory_delta[step], telemetry_config_fingerprint(this->full_print_config()));
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, this->state_mutex(), [this](){ this->throw_if_canceled(); });
         if (status.second)
             this->status_update_warnings(static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
@@ -617,6 +650,9 @@ protected:
 
 private:
     PrintState<PrintStepEnum, COUNT> m_state;
+    size_t          m_step_memory_before[COUNT] = { 0 };
+    int64_t         m_step_memory_delta[COUNT] = { 0 };
+    double          m_step_start_time[COUNT] = { 0. };
 };
 
 template<typename PrintType, typename PrintObjectStepEnum, const size_t COUNT>
@@ -631,12 +667,29 @@ public:
     PrintStateBase::StateWithTimeStamp step_state_with_timestamp(PrintObjectStepEnum step) const { return m_state.state_with_timestamp(step, PrintObjectBase::state_mutex(m_print)); }
     PrintStateBase::StateWithWarnings  step_state_with_warnings(PrintObjectStepEnum step) const { return m_state.state_with_warnings(step, PrintObjectBase::state_mutex(m_print)); }
 
+    // Resident memory growth attributed to a processing step, in bytes, negative if the step
+    // released memory. Maintained by the worker thread, valid once the step is done.
+    int64_t         step_memory_delta(PrintObjectStepEnum step) const { return m_step_memory_delta[step]; }
+
 protected:
 	PrintObjectBaseWithState(PrintType *print, ModelObject *model_object) : PrintObjectBase(model_object), m_print(print) {}
 
-    bool            set_started(PrintObjectStepEnum step)
-        { return m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); }); }
+    bool            set_started(PrintObjectStepEnum step) {
+        bool started = m_state.set_started(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
+        if (started) {
+            m_step_memory_before[step] = step_memory_snapshot();
+            m_step_start_time[step]    = telemetry_now_seconds();
+        }
+        return started;
+    }
 	PrintStateBase::TimeStamp set_done(PrintObjectStepEnum step) {
+        if (std::string warning = step_memory_report("object step", static_cast<int>(step), m_step_memory_before[step], m_step_memory_delta[step]); ! warning.empty())
+            // Attach the memory pressure warning while the step is still active, so it travels
+            // to the UI / CLI through the SlicingStatus warnings of this step.
+            this->active_step_add_warning(PrintStateBase::WarningLevel::CRITICAL, warning);
+        if (! telemetry_log_path().empty())
+            telemetry_record_step("object step", static_cast<int>(step), telemetry_now_seconds() - m_step_start_time[step],
+                m_step_memory_delta[step], telemetry_config_fingerprint(m_print->full_print_config()));
 		std::pair<PrintStateBase::TimeStamp, bool> status = m_state.set_done(step, PrintObjectBase::state_mutex(m_print), [this](){ this->throw_if_canceled(); });
         if (status.second)
             this->status_update_warnings(m_print, static_cast<int>(step), PrintStateBase::WarningLevel::NON_CRITICAL, std::string());
@@ -677,6 +730,9 @@ protected:
 
 private:
     PrintState<PrintObjectStepEnum, COUNT>   m_state;
+    size_t          m_step_memory_before[COUNT] = { 0 };
+    int64_t         m_step_memory_delta[COUNT] = { 0 };
+    double          m_step_start_time[COUNT] = { 0. };
 };
 
 } // namespace Slic3r
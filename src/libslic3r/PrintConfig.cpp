@@ -1403,6 +1403,15 @@ void PrintConfigDef::init_fff_params()
     def->mode = comAdvanced;
     def->set_default_value(new ConfigOptionFloats { 0.02 });
 
+    def = this->add("pressure_advance_per_feature", coStrings);
+    def->label = L("Per feature pressure advance");
+    def->tooltip = L("Override pressure advance per feature type, as \"feature:value\" pairs separated by semicolons, "
+                     "for example \"Outer wall:0.03;Bridge:0.015\". Feature names match the ones shown in the preview. "
+                     "Features not listed here use the pressure advance value above. "
+                     "The override is applied during G-code export, requires pressure advance to be enabled.");
+    def->mode = comAdvanced;
+    def->set_default_value(new ConfigOptionStrings { "" });
+
     def = this->add("line_width", coFloatOrPercent);
     def->label = L("Default");
     def->category = L("Quality");
@@ -3421,6 +3430,17 @@ def = this->add("filament_loading_speed", coFloats);
     def->mode = comAdvanced;
     def->set_default_value(new ConfigOptionFloat(0.049));
 
+    def = this->add("slice_open_loop_gap_closing", coFloat);
+    def->label = L("Open contour gap closing");
+    def->category = L("Quality");
+    def->tooltip = L("Open edges of a non-manifold model shorter than this distance are stitched per layer "
+        "during the triangle mesh slicing, so mildly broken meshes can be sliced without a full mesh repair. "
+        "Larger values may merge contours which should stay separate.");
+    def->sidetext = L("mm");
+    def->min = 0;
+    def->mode = comAdvanced;
+    def->set_default_value(new ConfigOptionFloat(2.));
+
     def = this->add("slicing_mode", coEnum);
     def->label = L("Slicing Mode");
     def->category = L("Other");
@@ -5914,6 +5934,11 @@ CLIActionsConfigDef::CLIActionsConfigDef()
     def->tooltip = L("Export the objects as multiple STL.");
     def->set_default_value(new ConfigOptionBool(false));
 
+    def = this->add("export_gltf", coBool);
+    def->label = L("Export glTF");
+    def->tooltip = L("Export the plated scene as a binary glTF (.glb) with quantized meshes for lightweight preview.");
+    def->set_default_value(new ConfigOptionBool(false));
+
     /*def = this->add("export_gcode", coBool);
     def->label = L("Export G-code");
     def->tooltip = L("Slice the model and export toolpaths as G-code.");
@@ -6228,6 +6253,35 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->tooltip = L("Load custom gcode from json");
     def->cli_params = "custom_gcode_toolchange.json";
     def->set_default_value(new ConfigOptionString());
+
+    def = this->add("trace_output", coString);
+    def->label = L("Pipeline trace output");
+    def->tooltip = L("Record per-thread spans of the slicing and G-code export stages and write "
+                     "a chrome://tracing compatible JSON timeline to the given file at the end of the run.");
+    def->cli_params = "trace.json";
+    def->set_default_value(new ConfigOptionString());
+
+    def = this->add("profile_output", coString);
+    def->label = L("Profiler output");
+    def->tooltip = L("Dump the zone tree of the built-in profiler to the given file after slicing. "
+                     "Only effective in builds configured with SLIC3R_PROFILE.");
+    def->cli_params = "profile.txt";
+    def->set_default_value(new ConfigOptionString());
+
+    def = this->add("checkpoint_dir", coString);
+    def->label = L("Checkpoint directory");
+    def->tooltip = L("Save slicing checkpoints to the given directory and resume from them, "
+                     "so a job restarted after a preemption does not slice from scratch.");
+    def->cli_params = "dir";
+    def->set_default_value(new ConfigOptionString());
+
+    def = this->add("telemetry_log", coString);
+    def->label = L("Telemetry log");
+    def->tooltip = L("Append anonymized per-stage slicing timings to the given local file. "
+                     "Nothing is uploaded, the log only records stage durations, memory deltas "
+                     "and a one-way fingerprint of the configuration.");
+    def->cli_params = "telemetry.jsonl";
+    def->set_default_value(new ConfigOptionString());
 }
 
 const CLIActionsConfigDef    cli_actions_config_def;
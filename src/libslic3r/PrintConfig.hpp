@@ -44,6 +44,8 @@
 #include <boost/preprocessor/tuple/elem.hpp>
 #include <boost/preprocessor/tuple/to_seq.hpp>
 
+#include <unordered_map>
+
 namespace Slic3r {
 
 enum GCodeFlavor : unsigned char {
@@ -481,7 +483,9 @@ protected:
         }
 
     protected:
-        std::map<std::string, ptrdiff_t>    m_map_name_to_offset;
+        // Hashed container: optptr() is called with an option name for every option of every
+        // config diff / apply, thus a single hash is preferred over O(log n) string compares.
+        std::unordered_map<std::string, ptrdiff_t>  m_map_name_to_offset;
     };
 
     // Parametrized by the type of the topmost class owning the options.
@@ -695,6 +699,7 @@ PRINT_CONFIG_CLASS_DEFINE(
     ((ConfigOptionEnum<SeamPosition>,  seam_position))
     ((ConfigOptionBool,                staggered_inner_seams))
     ((ConfigOptionFloat,               slice_closing_radius))
+    ((ConfigOptionFloat,               slice_open_loop_gap_closing))
     ((ConfigOptionEnum<SlicingMode>,   slicing_mode))
     ((ConfigOptionBool,                enable_support))
     // Automatic supports (generated based on support_threshold_angle).
@@ -925,6 +930,7 @@ PRINT_CONFIG_CLASS_DEFINE(
     ((ConfigOptionFloats,              filament_flow_ratio))
     ((ConfigOptionBools,               enable_pressure_advance))
     ((ConfigOptionFloats,              pressure_advance))
+    ((ConfigOptionStrings,             pressure_advance_per_feature))
     ((ConfigOptionFloat,               fan_kickstart))
     ((ConfigOptionBool,                fan_speedup_overhangs))
     ((ConfigOptionFloat,               fan_speedup_time))
@@ -10,6 +10,7 @@
 #include "Exception.hpp"
 #include "Print.hpp"
 #include "BoundingBox.hpp"
+#include "ChromeTrace.hpp"
 #include "ClipperUtils.hpp"
 #include "ElephantFootCompensation.hpp"
 #include "Geometry.hpp"
@@ -31,6 +32,7 @@
 #include "TreeSupport.hpp"
 
 #include <float.h>
+#include <optional>
 #include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/concurrent_vector.h>
 #include <oneapi/tbb/parallel_for.h>
@@ -40,6 +42,7 @@
 #include <boost/log/trivial.hpp>
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
 
 #include <Shiny/Shiny.h>
 
@@ -296,6 +299,9 @@ void PrintObject::_transform_hole_to_polyholes()
 // 3) Generates perimeters, gap fills and fill regions (fill regions of type stInternal).
 void PrintObject::make_perimeters()
 {
+    PROFILE_FUNC();
+    ChromeTraceSpan trace_span("PrintObject::make_perimeters");
+
     // prerequisites
     this->slice();
 
@@ -403,6 +409,9 @@ void PrintObject::make_perimeters()
 
 void PrintObject::prepare_infill()
 {
+    PROFILE_FUNC();
+    ChromeTraceSpan trace_span("PrintObject::prepare_infill");
+
     if (! this->set_started(posPrepareInfill))
         return;
     m_print->set_status(25, L("Generating infill regions"));
@@ -417,6 +426,29 @@ void PrintObject::prepare_infill()
         }
     }
 
+    // Spiral vase fast path. The forced spiral configuration (a single wall, zero top shells,
+    // zero sparse infill density) can only ever produce a solid base of bottom shell layers and
+    // bare single-wall layers above it, so the full surface classification and shell discovery
+    // machinery cannot contribute anything beyond retyping the bottom fill surfaces to solid.
+    // Type them directly instead; the surface passes dominate the slicing time of vase prints.
+    if (m_print->config().spiral_mode && this->num_printing_regions() == 1) {
+        const PrintRegionConfig &region_config = this->printing_region(0).config();
+        // Index of the first layer sliced with SlicingMode::PositiveLargestContour.
+        // This needs to be in sync with slice_volumes() spiral_mode!
+        size_t num_regular_layers = size_t(region_config.bottom_shell_layers.value);
+        for (; num_regular_layers < m_layers.size() && m_layers[num_regular_layers]->slice_z < region_config.bottom_shell_thickness - EPSILON;
+            ++ num_regular_layers);
+        num_regular_layers = std::min(num_regular_layers, m_layers.size());
+        for (size_t layer_idx = 0; layer_idx < num_regular_layers; ++ layer_idx) {
+            for (LayerRegion *layerm : m_layers[layer_idx]->m_regions)
+                for (Surface &surface : layerm->fill_surfaces.surfaces)
+                    surface.surface_type = layer_idx == 0 ? stBottom : stInternalSolid;
+            m_print->throw_if_canceled();
+        }
+        this->set_done(posPrepareInfill);
+        return;
+    }
+
     // This will assign a type (top/bottom/internal) to $layerm->slices.
     // Then the classifcation of $layerm->slices is transfered onto
     // the $layerm->fill_surfaces by clipping $layerm->fill_surfaces
@@ -539,21 +571,31 @@ void PrintObject::prepare_infill()
 
 void PrintObject::infill()
 {
+    PROFILE_FUNC();
+    ChromeTraceSpan trace_span("PrintObject::infill");
+
     // prerequisites
     this->prepare_infill();
 
     if (this->set_started(posInfill)) {
         m_print->set_status(35, L("Generating infill toolpath"));
+        // If the ironing step was invalidated as well, fuse it into the same walk over the layers:
+        // the ironing extrusions of a layer are created right after its fills while the layer's
+        // surfaces are still hot in the caches, instead of a second pass over the whole object.
+        // An invalidation of posIroning alone is still served by the separate ironing() pass.
+        const bool  fuse_ironing = this->set_started(posIroning);
         const auto& adaptive_fill_octree = this->m_adaptive_fill_octrees.first;
         const auto& support_fill_octree = this->m_adaptive_fill_octrees.second;
 
         BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - start";
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, m_layers.size()),
-            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree](const tbb::blocked_range<size_t>& range) {
+            [this, fuse_ironing, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree](const tbb::blocked_range<size_t>& range) {
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                     m_print->throw_if_canceled();
                     m_layers[layer_idx]->make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), this->m_lightning_generator.get());
+                    if (fuse_ironing)
+                        m_layers[layer_idx]->make_ironing();
                 }
             }
         );
@@ -563,11 +605,16 @@ void PrintObject::infill()
         ### $_->fill_surfaces->clear for map @{$_->regions}, @{$object->layers};
         */
         this->set_done(posInfill);
+        if (fuse_ironing)
+            this->set_done(posIroning);
     }
 }
 
 void PrintObject::ironing()
 {
+    PROFILE_FUNC();
+    ChromeTraceSpan trace_span("PrintObject::ironing");
+
     if (this->set_started(posIroning)) {
         BOOST_LOG_TRIVIAL(debug) << "Ironing in parallel - start";
         tbb::parallel_for(
@@ -586,6 +633,26 @@ void PrintObject::ironing()
     }
 }
 
+// Low-memory mode: drop the per-layer intermediate surfaces once every per-object step consumed them.
+// Only the extrusions, the layer outlines (lslices), the untyped slice backups and the region slices
+// needed by the G-code pipeline are kept alive. The caller guarantees the object will not be processed
+// incrementally afterwards (CLI batch mode), as the dropped data would have to be regenerated otherwise.
+void PrintObject::release_fill_intermediates()
+{
+    if (m_shared_object != nullptr)
+        return;
+    m_adaptive_fill_octrees = {};
+    m_lightning_generator.reset();
+    std::vector<VolumeSlices>().swap(firstLayerObjSliceByVolume);
+    for (Layer *layer : m_layers)
+        for (LayerRegion *layerm : layer->regions()) {
+            Surfaces().swap(layerm->fill_surfaces.surfaces);
+            ExPolygons().swap(layerm->fill_expolygons);
+            ExPolygons().swap(layerm->fill_no_overlap_expolygons);
+        }
+    BOOST_LOG_TRIVIAL(debug) << "Released fill intermediates of object " << this->model_object()->name << log_memory_info();
+}
+
 // BBS
 void PrintObject::clear_overhangs_for_lift()
 {
@@ -631,6 +698,9 @@ void PrintObject::detect_overhangs_for_lift()
 
 void PrintObject::generate_support_material()
 {
+    PROFILE_FUNC();
+    ChromeTraceSpan trace_span("PrintObject::generate_support_material");
+
     if (this->set_started(posSupportMaterial)) {
         this->clear_support_layers();
 
@@ -917,12 +987,13 @@ bool PrintObject::invalidate_state_by_config_options(
             || opt_key == "extra_perimeters_on_overhangs"
             || opt_key == "initial_layer_line_width"
             || opt_key == "inner_wall_line_width"
-            || opt_key == "infill_wall_overlap"
-            || opt_key == "seam_gap"
-            || opt_key == "role_based_wipe_speed"
-            || opt_key == "wipe_on_loops"
-            || opt_key == "wipe_speed") {
+            || opt_key == "infill_wall_overlap") {
             steps.emplace_back(posPerimeters);
+        } else if (opt_key == "seam_gap") {
+            // Seam gap is applied as loop clipping when generating the infill loops and otherwise
+            // only when placing seams during the G-code export; the perimeter contours are unchanged.
+            steps.emplace_back(posInfill);
+            invalidated |= m_print->invalidate_step(psGCodeExport);
         } else if (opt_key == "gap_infill_speed"
             || opt_key == "filter_out_gap_fill" ) {
             // Return true if gap-fill speed has changed from zero value to non-zero or from non-zero value to zero.
@@ -948,6 +1019,7 @@ bool PrintObject::invalidate_state_by_config_options(
             || opt_key == "raft_layers"
             || opt_key == "raft_contact_distance"
             || opt_key == "slice_closing_radius"
+            || opt_key == "slice_open_loop_gap_closing"
             || opt_key == "slicing_mode"
             || opt_key == "slowdown_for_curled_perimeters"
             || opt_key == "make_overhang_printable"
@@ -1125,6 +1197,11 @@ bool PrintObject::invalidate_state_by_config_options(
             steps.emplace_back(posSlice);
         } else if (
                opt_key == "seam_position"
+            // Wiping only modifies the travel moves emitted during the G-code export,
+            // the stored extrusions are unchanged.
+            || opt_key == "role_based_wipe_speed"
+            || opt_key == "wipe_on_loops"
+            || opt_key == "wipe_speed"
             || opt_key == "support_speed"
             || opt_key == "support_interface_speed"
             || opt_key == "overhang_1_4_speed"
@@ -1177,6 +1254,10 @@ bool PrintObject::invalidate_step(PrintObjectStep step)
 		invalidated |= this->invalidate_steps({ posPerimeters, posPrepareInfill, posInfill, posIroning, posSupportMaterial, posSimplifyPath, posSimplifyInfill });
         invalidated |= m_print->invalidate_steps({ psSkirtBrim });
         m_slicing_params.valid = false;
+        // A full re-slice was requested: drop any pending incremental re-slice state. Print::apply()
+        // re-establishes it after this call when the invalidation is caused by a localized edit.
+        m_dirty_slice_z_range = { 0.f, -1.f };
+        m_dirty_slice_region_configs.clear();
     } else if (step == posSupportMaterial) {
         invalidated |= this->invalidate_steps({ posSimplifySupportPath });
         invalidated |= m_print->invalidate_steps({ psSkirtBrim });
@@ -1198,6 +1279,8 @@ bool PrintObject::invalidate_all_steps()
     bool result = Inherited::invalidate_all_steps() | m_print->invalidate_all_steps();
 	// Then reset some of the depending values.
 	m_slicing_params.valid = false;
+    m_dirty_slice_z_range = { 0.f, -1.f };
+    m_dirty_slice_region_configs.clear();
 	return result;
 }
 
@@ -1223,6 +1306,20 @@ void PrintObject::detect_surfaces_type()
     bool interface_shells = ! spiral_mode && m_config.interface_shells.value;
     size_t num_layers     = spiral_mode ? std::min(size_t(this->printing_region(0).config().bottom_shell_layers), m_layers.size()) : m_layers.size();
 
+    // Cross-layer pair reuse: the top / bottom diffs below clip against the safety offsetted
+    // islands of the upper / lower layer, so each layer's lslices used to be safety offsetted
+    // inside those diffs by both of its neighbors, and once more per region on multi-region
+    // objects. Apply the safety offset once per layer here and run the diffs without their own.
+    std::vector<ExPolygons> lslices_safety_offsetted(m_layers.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, m_layers.size()),
+        [this, &lslices_safety_offsetted](const tbb::blocked_range<size_t>& range) {
+            for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
+                m_print->throw_if_canceled();
+                lslices_safety_offsetted[idx_layer] = offset_ex(m_layers[idx_layer]->lslices, ClipperSafetyOffset);
+            }
+        });
+
     for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id) {
         BOOST_LOG_TRIVIAL(debug) << "Detecting solid surfaces for region " << region_id << " in parallel - start";
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
@@ -1243,7 +1340,7 @@ void PrintObject::detect_surfaces_type()
             		((num_layers > 1) ? num_layers - 1 : num_layers) :
             		// In non-spiral vase mode, go over all layers.
             		m_layers.size()),
-            [this, region_id, interface_shells, &surfaces_new](const tbb::blocked_range<size_t>& range) {
+            [this, region_id, interface_shells, &surfaces_new, &lslices_safety_offsetted](const tbb::blocked_range<size_t>& range) {
                 // If we have soluble support material, don't bridge. The overhang will be squished against a soluble layer separating
                 // the support from the print.
                 // BBS: the above logic only applys for normal(auto) support. Complete logic:
@@ -1275,7 +1372,8 @@ void PrintObject::detect_surfaces_type()
                     if (upper_layer) {
                         ExPolygons upper_slices = interface_shells ?
                             diff_ex(layerm->slices.surfaces, upper_layer->m_regions[region_id]->slices.surfaces, ApplySafetyOffset::Yes) :
-                            diff_ex(layerm->slices.surfaces, upper_layer->lslices, ApplySafetyOffset::Yes);
+                            // The safety offset of the clip was pre-applied, see lslices_safety_offsetted above.
+                            diff_ex(layerm->slices.surfaces, lslices_safety_offsetted[idx_layer + 1]);
                         surfaces_append(top, opening_ex(upper_slices, offset), stTop);
                     } else {
                         // if no upper layer, all surfaces of this one are solid
@@ -1301,7 +1399,8 @@ void PrintObject::detect_surfaces_type()
                         surfaces_append(
                             bottom,
                             opening_ex(
-                                diff_ex(layerm->slices.surfaces, lower_layer->lslices, ApplySafetyOffset::Yes),
+                                // The safety offset of the clip was pre-applied, see lslices_safety_offsetted above.
+                                diff_ex(layerm->slices.surfaces, lslices_safety_offsetted[idx_layer - 1]),
                                 offset),
                             surface_type_bottom_other);
                         // if user requested internal shells, we need to identify surfaces
@@ -1512,6 +1611,59 @@ void PrintObject::discover_vertical_shells()
         Polygons    bottom_surfaces;
         Polygons    holes;
     };
+    // Sliding window aggregation over the per layer cache entries (the classic two stack queue):
+    // each entry is merged into a running aggregate a bounded number of times no matter how many
+    // layers the projection window spans, thus the boolean work per layer is O(1) amortized
+    // instead of O(window). Both merge operations used below (union_ and intersection) are
+    // associative, which is all the mechanics require. Subtracting the entry leaving the window
+    // would be cheaper still, but neither polygon union nor intersection is invertible, therefore
+    // the oldest entries are retired by flipping the back stack into suffix aggregates instead.
+    struct SlidingWindowAggregator
+    {
+        // The aggregate covers the entries [idx_begin, idx_end) fed by slide().
+        size_t                idx_begin = 0;
+        size_t                idx_end   = 0;
+        // Suffix aggregates of the oldest entries, the next one to retire on top.
+        std::vector<Polygons> front;
+        // Entries pushed since the last flip, together with their running aggregate.
+        std::vector<Polygons> back;
+        Polygons              back_aggregate;
+
+        // Move the window to [new_begin, new_end). Both bounds shall be monotonically
+        // non-decreasing over the lifetime of the aggregator.
+        template<typename MergeFn, typename EntryFn>
+        void slide(size_t new_begin, size_t new_end, MergeFn merge, EntryFn entry)
+        {
+            assert(new_begin >= idx_begin && new_end >= idx_end && new_begin <= new_end);
+            for (; idx_end < new_end; ++ idx_end) {
+                const Polygons &polys = entry(idx_end);
+                back_aggregate = back.empty() ? polys : merge(back_aggregate, polys);
+                back.emplace_back(polys);
+            }
+            for (; idx_begin < new_begin; ++ idx_begin) {
+                if (front.empty()) {
+                    // Flip the back stack into suffix aggregates with the oldest entry on top.
+                    front.reserve(back.size());
+                    for (auto it = back.rbegin(); it != back.rend(); ++ it)
+                        front.emplace_back(front.empty() ? std::move(*it) : merge(*it, front.back()));
+                    back.clear();
+                    back_aggregate.clear();
+                }
+                if (! front.empty())
+                    front.pop_back();
+            }
+        }
+
+        template<typename MergeFn>
+        Polygons aggregate(MergeFn merge) const
+        {
+            if (front.empty())
+                return back_aggregate;
+            if (back.empty())
+                return front.back();
+            return merge(front.back(), back_aggregate);
+        }
+    };
     bool     spiral_mode      = this->print()->config().spiral_mode.value;
     size_t   num_layers       = spiral_mode ? std::min(size_t(this->printing_region(0).config().bottom_shell_layers), m_layers.size()) : m_layers.size();
     std::vector<DiscoverVerticalShellsCacheEntry> cache_top_botom_regions(num_layers, DiscoverVerticalShellsCacheEntry());
@@ -1642,11 +1794,84 @@ void PrintObject::discover_vertical_shells()
             BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - end : cache top / bottom";
         }
 
+        // Precompute the extents of the projection window of each layer. The windows are monotone
+        // in the layer index (both bounds only ever move up), which the sliding window
+        // aggregation below relies on.
+        const PrintRegionConfig &config = region.config();
+        // Exclusive: the cache entries [idx_layer + 1, window_top_end[idx_layer]) are projected from above.
+        std::vector<size_t> window_top_end(num_layers);
+        // Inclusive: the cache entries [window_bottom_begin[idx_layer], idx_layer) are projected from below.
+        std::vector<size_t> window_bottom_begin(num_layers);
+        for (size_t idx_layer = 0; idx_layer < num_layers; ++ idx_layer) {
+            size_t i = idx_layer + 1;
+            if (int n_top_layers = config.top_shell_layers.value; n_top_layers > 0) {
+                coordf_t print_z = m_layers[idx_layer]->print_z;
+                for (; i < num_layers &&
+                       (i < idx_layer + size_t(n_top_layers) || m_layers[i]->print_z - print_z < config.top_shell_thickness - EPSILON);
+                     ++ i) ;
+            }
+            window_top_end[idx_layer] = i;
+            int j = int(idx_layer) - 1;
+            if (int n_bottom_layers = config.bottom_shell_layers.value; n_bottom_layers > 0) {
+                coordf_t bottom_z = m_layers[idx_layer]->bottom_z();
+                for (; j >= 0 &&
+                       (j > int(idx_layer) - n_bottom_layers || bottom_z - m_layers[j]->bottom_z() < config.bottom_shell_thickness - EPSILON);
+                     -- j) ;
+            }
+            window_bottom_begin[idx_layer] = size_t(j + 1);
+        }
+
+        BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - start : project shells";
+        // Project the cached top / bottom surfaces and holes onto each layer. The windows of
+        // neighboring layers overlap almost completely, therefore each range of layers shares
+        // three sliding window aggregators instead of folding every window from scratch, which
+        // would cost O(window) Clipper calls per layer.
+        std::vector<Polygons> shell_cache(num_layers);
+        std::vector<Polygons> holes_cache(num_layers);
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_layers, std::max(num_layers / 16, size_t(1))),
+            [this, &cache_top_botom_regions, &window_top_end, &window_bottom_begin, &shell_cache, &holes_cache]
+            (const tbb::blocked_range<size_t>& range) {
+                // For unions an empty operand is the identity, for intersections it is absorbing.
+                auto merge_union = [](const Polygons &lhs, const Polygons &rhs) -> Polygons {
+                    if (lhs.empty())
+                        return rhs;
+                    if (rhs.empty())
+                        return lhs;
+                    return union_(lhs, rhs);
+                };
+                auto merge_intersection = [](const Polygons &lhs, const Polygons &rhs) -> Polygons {
+                    if (lhs.empty() || rhs.empty())
+                        return Polygons();
+                    return intersection(lhs, rhs);
+                };
+                auto top_entry    = [&cache_top_botom_regions](size_t i) -> const Polygons& { return cache_top_botom_regions[i].top_surfaces; };
+                auto bottom_entry = [&cache_top_botom_regions](size_t i) -> const Polygons& { return cache_top_botom_regions[i].bottom_surfaces; };
+                auto holes_entry  = [&cache_top_botom_regions](size_t i) -> const Polygons& { return cache_top_botom_regions[i].holes; };
+                SlidingWindowAggregator top_window, bottom_window, holes_window;
+                // Prime the aggregators with empty windows at the first layer of this range,
+                // slide() then fills them. The holes window spans both projection directions and
+                // includes the layer itself.
+                top_window.idx_begin    = top_window.idx_end    = range.begin() + 1;
+                bottom_window.idx_begin = bottom_window.idx_end = window_bottom_begin[range.begin()];
+                holes_window.idx_begin  = holes_window.idx_end  = window_bottom_begin[range.begin()];
+                for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
+                    m_print->throw_if_canceled();
+                    top_window.slide(idx_layer + 1, window_top_end[idx_layer], merge_union, top_entry);
+                    bottom_window.slide(window_bottom_begin[idx_layer], idx_layer, merge_union, bottom_entry);
+                    holes_window.slide(window_bottom_begin[idx_layer], window_top_end[idx_layer], merge_intersection, holes_entry);
+                    shell_cache[idx_layer] = merge_union(top_window.aggregate(merge_union), bottom_window.aggregate(merge_union));
+                    holes_cache[idx_layer] = holes_window.aggregate(merge_intersection);
+                }
+            });
+        m_print->throw_if_canceled();
+        BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - end : project shells";
+
         BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - start : ensure vertical wall thickness";
         grain_size = 1;
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, num_layers, grain_size),
-            [this, region_id, &cache_top_botom_regions]
+            [this, region_id, &cache_top_botom_regions, &window_top_end, &window_bottom_begin, &shell_cache, &holes_cache]
             (const tbb::blocked_range<size_t>& range) {
                 // printf("discover_vertical_shells from %d to %d\n", range.begin(), range.end());
                 for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
@@ -1667,9 +1892,10 @@ void PrintObject::discover_vertical_shells()
 
                     Flow         solid_infill_flow   = layerm->flow(frSolidInfill);
                     coord_t      infill_line_spacing = solid_infill_flow.scaled_spacing(); 
-                    // Find a union of perimeters below / above this surface to guarantee a minimum shell thickness.
-                    Polygons shell;
-                    Polygons holes;
+                    // A union of perimeters below / above this surface to guarantee a minimum shell thickness,
+                    // projected onto this layer by the sliding window aggregation above.
+                    Polygons shell = std::move(shell_cache[idx_layer]);
+                    Polygons holes = std::move(holes_cache[idx_layer]);
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
                     ExPolygons shell_ex;
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
@@ -1696,80 +1922,32 @@ void PrintObject::discover_vertical_shells()
                         }
                     }
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
-			        polygons_append(holes, cache_top_botom_regions[idx_layer].holes);
-                    auto combine_holes = [&holes](const Polygons &holes2) {
-                        if (holes.empty() || holes2.empty())
-                            holes.clear();
-                        else
-                            holes = intersection(holes, holes2);
-                    };
-                    auto combine_shells = [&shell](const Polygons &shells2) {
+                    auto combine_shells = [&shell](Polygons &&shells2) {
                         if (shell.empty())
                             shell = std::move(shells2);
                         else if (! shells2.empty()) {
                             polygons_append(shell, shells2);
-                            // Running the union_ using the Clipper library piece by piece is cheaper 
+                            // Running the union_ using the Clipper library piece by piece is cheaper
                             // than running the union_ all at once.
                             shell = union_(shell);
                         }
                     };
-                    static constexpr const bool one_more_layer_below_top_bottom_surfaces = false;
-			        if (int n_top_layers = region_config.top_shell_layers.value; n_top_layers > 0) {
-                        // Gather top regions projected to this layer.
-                        coordf_t print_z = layer->print_z;
-                        int i = int(idx_layer) + 1;
-                        int itop = int(idx_layer) + n_top_layers;
-                        bool at_least_one_top_projected = false;
-	                    for (; i < int(cache_top_botom_regions.size()) &&
-	                         (i < itop || m_layers[i]->print_z - print_z < region_config.top_shell_thickness - EPSILON);
-	                        ++ i) {
-                            at_least_one_top_projected = true;
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-                            combine_holes(cache.holes);
-                            combine_shells(cache.top_surfaces);
-	                    }
-                        if (!at_least_one_top_projected && i < int(cache_top_botom_regions.size())) {
-                            // Lets consider this a special case - with only 1 top solid and minimal shell thickness settings, the
-                            // boundaries of solid layers are not anchored over/under perimeters, so lets fix it by adding at least one
-                            // perimeter width of area
-                            Polygons anchor_area = intersection(expand(cache_top_botom_regions[idx_layer].top_surfaces,
-                                                                       layerm->flow(frExternalPerimeter).scaled_spacing()),
-                                                                to_polygons(m_layers[i]->lslices));
-                            combine_shells(anchor_area);
-                        }
-
-                        if (one_more_layer_below_top_bottom_surfaces)
-                            if (i < int(cache_top_botom_regions.size()) &&
-                                (i <= itop || m_layers[i]->bottom_z() - print_z < region_config.top_shell_thickness - EPSILON))
-                                combine_holes(cache_top_botom_regions[i].holes);
-	                }
-	                if (int n_bottom_layers = region_config.bottom_shell_layers.value; n_bottom_layers > 0) {
-                        // Gather bottom regions projected to this layer.
-                        coordf_t bottom_z = layer->bottom_z();
-                        int i = int(idx_layer) - 1;
-                        int ibottom = int(idx_layer) - n_bottom_layers;
-                        bool at_least_one_bottom_projected = false;
-	                    for (; i >= 0 &&
-	                         (i > ibottom || bottom_z - m_layers[i]->bottom_z() < region_config.bottom_shell_thickness - EPSILON);
-	                        -- i) {
-                                at_least_one_bottom_projected = true;
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-							combine_holes(cache.holes);
-                            combine_shells(cache.bottom_surfaces);
-	                    }
-
-                        if (!at_least_one_bottom_projected && i >= 0) {
-                            Polygons anchor_area = intersection(expand(cache_top_botom_regions[idx_layer].bottom_surfaces,
-                                                                       layerm->flow(frExternalPerimeter).scaled_spacing()),
-                                                                to_polygons(m_layers[i]->lslices));
-                            combine_shells(anchor_area);
-                        }
-
-                        if (one_more_layer_below_top_bottom_surfaces)
-                            if (i >= 0 &&
-                                (i > ibottom || bottom_z - m_layers[i]->print_z < region_config.bottom_shell_thickness - EPSILON))
-                                combine_holes(cache_top_botom_regions[i].holes);
-	                }
+                    if (region_config.top_shell_layers.value > 0 && window_top_end[idx_layer] == idx_layer + 1 &&
+                        idx_layer + 1 < cache_top_botom_regions.size()) {
+                        // Nothing was projected from above. Lets consider this a special case - with only 1 top solid
+                        // and minimal shell thickness settings, the boundaries of solid layers are not anchored
+                        // over/under perimeters, so lets fix it by adding at least one perimeter width of area
+                        combine_shells(intersection(expand(cache_top_botom_regions[idx_layer].top_surfaces,
+                                                           layerm->flow(frExternalPerimeter).scaled_spacing()),
+                                                    to_polygons(m_layers[idx_layer + 1]->lslices)));
+                    }
+                    if (region_config.bottom_shell_layers.value > 0 && window_bottom_begin[idx_layer] == idx_layer &&
+                        idx_layer > 0) {
+                        // Nothing was projected from below, anchor the bottom boundaries the same way.
+                        combine_shells(intersection(expand(cache_top_botom_regions[idx_layer].bottom_surfaces,
+                                                           layerm->flow(frExternalPerimeter).scaled_spacing()),
+                                                    to_polygons(m_layers[idx_layer - 1]->lslices)));
+                    }
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
                     {
         				Slic3r::SVG svg(debug_out_path("discover_vertical_shells-perimeters-before-union-%d.svg", debug_idx), get_extents(shell));
@@ -2071,11 +2249,11 @@ void PrintObject::bridge_over_infill()
             break;
         }
     }
+    // Prepare backup data for the Layer Region infills. Before modfiyng the layer region, we backup its fill surfaces by moving! them into this map.
+    // then a copy is created, modifiyed and passed to lightning infill generator. After generator is created, we restore the original state of the fills
+    // again by moving the data from this map back to the layer regions. This ensures that pointers to surfaces stay valid.
+    std::map<size_t, std::map<const LayerRegion *, SurfaceCollection>> backup_surfaces;
     if (has_lightning_infill) {
-        // Prepare backup data for the Layer Region infills. Before modfiyng the layer region, we backup its fill surfaces by moving! them into this map.
-        // then a copy is created, modifiyed and passed to lightning infill generator. After generator is created, we restore the original state of the fills
-        // again by moving the data from this map back to the layer regions. This ensures that pointers to surfaces stay valid.
-        std::map<size_t, std::map<const LayerRegion *, SurfaceCollection>> backup_surfaces;
         for (size_t lidx = 0; lidx < this->layer_count(); lidx++) {
             backup_surfaces[lidx] = {};
         }
@@ -2138,9 +2316,30 @@ void PrintObject::bridge_over_infill()
             }
         });
 
-        // Use the modified surfaces to generate expanded lightning anchors
-        this->m_lightning_generator = this->prepare_lightning_infill_data();
+    }
+
+    std::vector<std::pair<const Surface *, float>> surfaces_w_bottom_z;
+    for (const auto &pair : surfaces_by_layer) {
+        for (const CandidateSurface &c : pair.second) {
+            surfaces_w_bottom_z.emplace_back(c.original_surface, c.region->m_layer->bottom_z());
+        }
+    }
+
+    // The lightning generator consumes the modified fill surfaces above, while the adaptive
+    // infill octrees are built from the object mesh and the bridging surfaces collected into
+    // surfaces_w_bottom_z. The two pre-passes only read shared state, so run them concurrently
+    // instead of back to back; both are blocking top-down passes over the whole object.
+    tbb::parallel_invoke(
+        [this, has_lightning_infill]() {
+            if (has_lightning_infill)
+                // Use the modified surfaces to generate expanded lightning anchors
+                this->m_lightning_generator = this->prepare_lightning_infill_data();
+        },
+        [this, &surfaces_w_bottom_z]() {
+            this->m_adaptive_fill_octrees = this->prepare_adaptive_infill_data(surfaces_w_bottom_z);
+        });
 
+    if (has_lightning_infill) {
         // And now restore carefully the original surfaces, again using move to avoid reallocation and preserving the validity of the
         // pointers in surface candidates
         for (size_t lidx = 0; lidx < this->layer_count(); lidx++) {
@@ -2156,15 +2355,6 @@ void PrintObject::bridge_over_infill()
     std::map<size_t, Polylines> infill_lines;
     // SECTION to generate infill polylines
     {
-        std::vector<std::pair<const Surface *, float>> surfaces_w_bottom_z;
-        for (const auto &pair : surfaces_by_layer) {
-            for (const CandidateSurface &c : pair.second) {
-                surfaces_w_bottom_z.emplace_back(c.original_surface, c.region->m_layer->bottom_z());
-            }
-        }
-
-        this->m_adaptive_fill_octrees = this->prepare_adaptive_infill_data(surfaces_w_bottom_z);
-
         std::vector<size_t> layers_to_generate_infill;
         for (const auto &pair : surfaces_by_layer) {
             assert(pair.first > 0);
@@ -2910,6 +3100,14 @@ SlicingParameters PrintObject::slicing_parameters(const DynamicPrintConfig& full
 	size_t              filament_extruders = print_config.filament_diameter.size();
 	object_config = object_config_from_model_object(object_config, model_object, filament_extruders);
 
+	// Layer range configs overriding some filament are the same for all volumes, collect them just once.
+	std::vector<const DynamicPrintConfig*> range_configs_with_filaments;
+	for (const std::pair<const t_layer_height_range, ModelConfig> &range_and_config : model_object.layer_config_ranges)
+		if (range_and_config.second.has("wall_filament") ||
+			range_and_config.second.has("sparse_infill_filament") ||
+			range_and_config.second.has("solid_infill_filament"))
+			range_configs_with_filaments.emplace_back(&range_and_config.second.get());
+
 	std::vector<unsigned int> object_extruders;
 	for (const ModelVolume* model_volume : model_object.volumes)
 		if (model_volume->is_model_part()) {
@@ -2918,15 +3116,12 @@ SlicingParameters PrintObject::slicing_parameters(const DynamicPrintConfig& full
 				region_config_from_model_volume(default_region_config, nullptr, *model_volume, filament_extruders),
                 object_config.brim_type != btNoBrim && object_config.brim_width > 0.,
 				object_extruders);
-			for (const std::pair<const t_layer_height_range, ModelConfig> &range_and_config : model_object.layer_config_ranges)
-				if (range_and_config.second.has("wall_filament") ||
-					range_and_config.second.has("sparse_infill_filament") ||
-					range_and_config.second.has("solid_infill_filament"))
-					PrintRegion::collect_object_printing_extruders(
-						print_config,
-						region_config_from_model_volume(default_region_config, &range_and_config.second.get(), *model_volume, filament_extruders),
-                        object_config.brim_type != btNoBrim && object_config.brim_width > 0.,
-						object_extruders);
+			for (const DynamicPrintConfig *range_config : range_configs_with_filaments)
+				PrintRegion::collect_object_printing_extruders(
+					print_config,
+					region_config_from_model_volume(default_region_config, range_config, *model_volume, filament_extruders),
+                    object_config.brim_type != btNoBrim && object_config.brim_width > 0.,
+					object_extruders);
 		}
     sort_remove_duplicates(object_extruders);
     //FIXME add painting extruders
@@ -3347,12 +3542,20 @@ void PrintObject::combine_infill()
             combine[m_layers.size() - 1] = num_layers;
         }
 
-        // loop through layers to which we have assigned layers to combine
-        for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx) {
+        // Collect the uppermost layers of the groups to combine. Each group folds its layers
+        // into a rolling intersection and only modifies the fill surfaces of its own layers,
+        // thus the disjoint groups are processed in parallel.
+        std::vector<size_t> combine_group_end;
+        for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx)
+            if (combine[layer_idx] > 1)
+                combine_group_end.emplace_back(layer_idx);
+
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, combine_group_end.size()),
+            [this, &region, region_id, &combine, &combine_group_end](const tbb::blocked_range<size_t> &range) {
+        for (size_t group_idx = range.begin(); group_idx < range.end(); ++ group_idx) {
             m_print->throw_if_canceled();
+            size_t layer_idx  = combine_group_end[group_idx];
             size_t num_layers = combine[layer_idx];
-			if (num_layers <= 1)
-                continue;
             // Get all the LayerRegion objects to be combined.
             std::vector<LayerRegion*> layerms;
             layerms.reserve(num_layers);
@@ -3361,8 +3564,9 @@ void PrintObject::combine_infill()
             // We need to perform a multi-layer intersection, so let's split it in pairs.
             // Initialize the intersection with the candidates of the lowest layer.
             ExPolygons intersection = to_expolygons(layerms.front()->fill_surfaces.filter_by_type(stInternal));
-            // Start looping from the second layer and intersect the current intersection with it.
-            for (size_t i = 1; i < layerms.size(); ++ i)
+            // Start looping from the second layer and fold it into the rolling intersection.
+            // Once the accumulator went empty, no upper layer may revive it.
+            for (size_t i = 1; i < layerms.size() && ! intersection.empty(); ++ i)
                 intersection = intersection_ex(layerms[i]->fill_surfaces.filter_by_type(stInternal), intersection);
             double area_threshold = layerms.front()->infill_area_threshold();
             if (! intersection.empty() && area_threshold > 0.)
@@ -3411,6 +3615,7 @@ void PrintObject::combine_infill()
                 }
             }
         }
+            });
     }
 }
 
@@ -3446,19 +3651,21 @@ void PrintObject::remove_bridges_from_contacts(
     // Extrusion width accounts for the roundings of the extrudates.
     // It is the maximum widh of the extrudate.
     float fw = extrusion_width;
-    Lines overhang_perimeters = to_lines(*overhang_regions);
     auto layer_regions = current_layer->regions();
     Polygons lower_layer_polygons = to_polygons(lower_layer->lslices);
     const PrintObjectConfig& object_config = current_layer->object()->config();
+    // Surface supporting this layer, expanded by 0.5 * nozzle_diameter, as we consider this kind of overhang to be sufficiently supported.
+    Polygons lower_grown_slices = offset(lower_layer_polygons,
+        //FIXME to mimic the decision in the perimeter generator, we should use half the external perimeter width.
+        0.5f * fw, SUPPORT_SURFACES_OFFSET_PARAMETERS);
+    // Built lazily for testing the bridge end points against the lower layer islands. A single indexed query
+    // replaces a linear scan over all the islands, which hurts on layers with thousands of them.
+    std::optional<AABBTreeLines::LinesDistancer<Line>> lower_layer_contours;
 
     Polygons all_bridges;
     for (LayerRegion* layerm : layer_regions)
     {
         Polygons bridges;
-        // Surface supporting this layer, expanded by 0.5 * nozzle_diameter, as we consider this kind of overhang to be sufficiently supported.
-        Polygons lower_grown_slices = offset(lower_layer_polygons,
-            //FIXME to mimic the decision in the perimeter generator, we should use half the external perimeter width.
-            0.5f * fw, SUPPORT_SURFACES_OFFSET_PARAMETERS);
         Polylines overhang_perimeters = diff_pl(layerm->perimeters.as_polylines(), lower_grown_slices);
         // only consider straight overhangs
             // only consider overhangs having endpoints inside layer's slices
@@ -3474,12 +3681,12 @@ void PrintObject::remove_bridges_from_contacts(
                 polyline.extend_start(fw);
                 polyline.extend_end(fw);
                 // Is the straight perimeter segment supported at both sides?
+                if (! lower_layer_contours)
+                    lower_layer_contours.emplace(to_lines(lower_layer->lslices));
                 Point pts[2] = { polyline.first_point(), polyline.last_point() };
-                bool  supported[2] = { false, false };
-                for (size_t i = 0; i < lower_layer->lslices.size() && !(supported[0] && supported[1]); ++i)
-                    for (int j = 0; j < 2; ++j)
-                        if (!supported[j] && lower_layer->lslices_bboxes[i].contains(pts[j]) && lower_layer->lslices[i].contains(pts[j]))
-                            supported[j] = true;
+                bool  supported[2];
+                for (int j = 0; j < 2; ++j)
+                    supported[j] = lower_layer_contours->outside(pts[j]) <= 0;
                 if (supported[0] && supported[1]) {
                     Polylines lines;
                     if (polyline.length() > max_bridge_length + 10) {
@@ -1,16 +1,31 @@
+#include "ChromeTrace.hpp"
 #include "ElephantFootCompensation.hpp"
 #include "I18N.hpp"
 #include "Layer.hpp"
 #include "MultiMaterialSegmentation.hpp"
 #include "Print.hpp"
 #include "ClipperUtils.hpp"
+#include "Utils.hpp"
 //BBS
 #include "ShortestPath.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/common.hpp>
+#include <cereal/types/vector.hpp>
 
 #include <tbb/parallel_for.h>
 
+#include <Shiny/Shiny.h>
+
 //! macro used to mark string used at localization, return same string
 #define L(s) Slic3r::I18N::translate(s)
 
@@ -135,7 +150,8 @@ static std::vector<VolumeSlices> slice_volumes_inner(
         slicing_ranges.reserve(layer_ranges.size());
 
     MeshSlicingParamsEx params_base;
-    params_base.closing_radius = print_object_config.slice_closing_radius.value;
+    params_base.closing_radius    = print_object_config.slice_closing_radius.value;
+    params_base.open_loop_max_gap = print_object_config.slice_open_loop_gap_closing.value;
     params_base.extra_offset   = 0;
     params_base.trafo          = object_trafo;
     //BBS: 0.0025mm is safe enough to simplify the data to speed slicing up for high-resolution model.
@@ -801,6 +817,9 @@ void groupingVolumesForBrim(PrintObject* object, LayerPtrs& layers, int firstLay
 // Resulting expolygons of layer regions are marked as Internal.
 void PrintObject::slice()
 {
+    PROFILE_FUNC();
+    ChromeTraceSpan trace_span("PrintObject::slice");
+
     if (! this->set_started(posSlice))
         return;
     //BBS: add flag to reload scene for shell rendering
@@ -809,9 +828,85 @@ void PrintObject::slice()
     this->update_layer_height_profile(*this->model_object(), m_slicing_params, layer_height_profile);
     m_print->throw_if_canceled();
     m_typed_slices = false;
+    // Incremental re-slice: if only a narrow Z band was invalidated (e.g. by a multi-material paint stroke),
+    // keep the old layers around and try to reuse those outside of the band.
+    LayerPtrs old_layers;
+    if (m_dirty_slice_z_range.first <= m_dirty_slice_z_range.second && ! m_layers.empty())
+        old_layers = std::move(m_layers);
     this->clear_layers();
     m_layers = new_layers(this, generate_object_layers(m_slicing_params, layer_height_profile));
-    this->slice_volumes();
+    std::vector<bool> reslice_mask;
+    if (! old_layers.empty()) {
+        // Pad the dirty interval with one layer height on each side to be robust against rounding
+        // and against edits right at a slicing plane.
+        const float pad  = float(m_slicing_params.layer_height);
+        const float zmin = m_dirty_slice_z_range.first  - pad;
+        const float zmax = m_dirty_slice_z_range.second + pad;
+        reslice_mask.assign(m_layers.size(), true);
+        // If Print::apply() regenerated the region set (a modifier volume was edited), the old PrintRegions
+        // the reused layers point to are gone. The layers may still be reused if the new regions carry
+        // the configurations the layers were sliced with, in the same order: just re-bind them.
+        const bool regions_rebindable = m_dirty_slice_region_configs.size() == m_shared_regions->all_regions.size() &&
+            std::equal(m_dirty_slice_region_configs.begin(), m_dirty_slice_region_configs.end(), m_shared_regions->all_regions.begin(),
+                [](const PrintRegionConfig &l, const std::unique_ptr<PrintRegion> &r) { return l == r->config(); });
+        size_t num_reused = 0;
+        for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx) {
+            Layer *layer = m_layers[layer_idx];
+            if (layer->slice_z >= zmin && layer->slice_z <= zmax)
+                // Inside the dirty band, has to be re-sliced.
+                continue;
+            if (layer_idx >= old_layers.size())
+                continue;
+            Layer *old_layer = old_layers[layer_idx];
+            if (std::abs(old_layer->slice_z - layer->slice_z) > EPSILON ||
+                std::abs(old_layer->print_z - layer->print_z) > EPSILON ||
+                old_layer->region_count() != m_shared_regions->all_regions.size())
+                // The layer grid or the region set changed, don't reuse.
+                continue;
+            if (m_dirty_slice_region_configs.empty()) {
+                bool regions_match = true;
+                for (size_t region_id = 0; region_id < old_layer->region_count(); ++ region_id)
+                    if (&old_layer->regions()[region_id]->region() != m_shared_regions->all_regions[region_id].get()) {
+                        regions_match = false;
+                        break;
+                    }
+                if (! regions_match)
+                    continue;
+            } else {
+                if (! regions_rebindable)
+                    continue;
+                for (size_t region_id = 0; region_id < old_layer->region_count(); ++ region_id)
+                    old_layer->get_region(int(region_id))->m_region = m_shared_regions->all_regions[region_id].get();
+            }
+            // Reuse the old layer wholesale, including its region slices and lslices.
+            delete m_layers[layer_idx];
+            m_layers[layer_idx] = old_layer;
+            old_layers[layer_idx] = nullptr;
+            old_layer->restore_untyped_slices();
+            reslice_mask[layer_idx] = false;
+            ++ num_reused;
+        }
+        // Re-link the layer chain after the substitutions.
+        for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx) {
+            m_layers[layer_idx]->lower_layer = layer_idx > 0 ? m_layers[layer_idx - 1] : nullptr;
+            m_layers[layer_idx]->upper_layer = layer_idx + 1 < m_layers.size() ? m_layers[layer_idx + 1] : nullptr;
+        }
+        for (Layer *layer : old_layers)
+            delete layer;
+        if (num_reused == 0)
+            reslice_mask.clear();
+        BOOST_LOG_TRIVIAL(info) << "Incremental re-slice: reusing " << num_reused << " of " << m_layers.size() << " layers";
+    }
+    m_dirty_slice_z_range = { 0.f, -1.f };
+    m_dirty_slice_region_configs.clear();
+    // Slicing checkpoint (--checkpoint-dir): a job restarted after a preemption resumes the result
+    // of this step from disk. The checkpoint stores the final state of the step, thus the
+    // post-processing below (polyholes, brim grouping, slice backup) was already applied to it.
+    if (! m_layers.empty() && reslice_mask.empty() && this->load_slice_checkpoint()) {
+        this->set_done(posSlice);
+        return;
+    }
+    this->slice_volumes(reslice_mask);
     m_print->throw_if_canceled();
     int firstLayerReplacedBy = 0;
 
@@ -850,19 +945,318 @@ void PrintObject::slice()
     if (m_layers.empty())
         throw Slic3r::SlicingError(L("No layers were detected. You might want to repair your STL file(s) or check their size or thickness and retry.\n"));
 
+    this->save_slice_checkpoint();
+
     // BBS
     this->set_done(posSlice);
 }
 
+// Slicing checkpoints (--checkpoint-dir): the final state of the posSlice step is serialized to
+// <checkpoint_dir>/slice_<fingerprint>.checkpoint, so a job restarted after a farm preemption
+// resumes from it instead of re-slicing. The fingerprint covers every input of the step; ObjectIDs
+// are session local and thus hashed by content instead.
+static constexpr unsigned int slice_checkpoint_version = 2;
+
+// Compact 32 bit coordinate encoding of the checkpoint geometry. Layer local coordinates fit
+// 32 bits comfortably at our scale factor (+- 2.1 m), which halves the size of the point data
+// and with it the disk bandwidth of the checkpoint round trip. The narrowing is checked at this
+// boundary: if any coordinate of the object is out of the 32 bit range, the whole file falls
+// back to the full width encoding, flagged in the header.
+static inline bool fits_32bits(const Point &pt)
+{
+    return pt.x() >= std::numeric_limits<int32_t>::min() && pt.x() <= std::numeric_limits<int32_t>::max() &&
+           pt.y() >= std::numeric_limits<int32_t>::min() && pt.y() <= std::numeric_limits<int32_t>::max();
+}
+
+static inline bool fits_32bits(const Points &points)
+{
+    return std::all_of(points.begin(), points.end(), [](const Point &pt) { return fits_32bits(pt); });
+}
+
+static inline bool fits_32bits(const ExPolygons &expolygons)
+{
+    for (const ExPolygon &expoly : expolygons) {
+        if (! fits_32bits(expoly.contour.points))
+            return false;
+        for (const Polygon &hole : expoly.holes)
+            if (! fits_32bits(hole.points))
+                return false;
+    }
+    return true;
+}
+
+static inline bool fits_32bits(const Surfaces &surfaces)
+{
+    for (const Surface &surface : surfaces) {
+        if (! fits_32bits(surface.expolygon.contour.points))
+            return false;
+        for (const Polygon &hole : surface.expolygon.holes)
+            if (! fits_32bits(hole.points))
+                return false;
+    }
+    return true;
+}
+
+static void save_points(cereal::BinaryOutputArchive &archive, const Points &points, bool compact)
+{
+    archive(points.size());
+    if (compact)
+        for (const Point &pt : points)
+            archive(int32_t(pt.x()), int32_t(pt.y()));
+    else
+        for (const Point &pt : points)
+            archive(pt.x(), pt.y());
+}
+
+static void load_points(cereal::BinaryInputArchive &archive, Points &points, bool compact)
+{
+    size_t num = 0;
+    archive(num);
+    points.resize(num);
+    if (compact) {
+        int32_t x, y;
+        for (Point &pt : points) {
+            archive(x, y);
+            pt = Point(coord_t(x), coord_t(y));
+        }
+    } else
+        for (Point &pt : points)
+            archive(pt.x(), pt.y());
+}
+
+static void save_expolygons(cereal::BinaryOutputArchive &archive, const ExPolygons &expolygons, bool compact)
+{
+    archive(expolygons.size());
+    for (const ExPolygon &expoly : expolygons) {
+        save_points(archive, expoly.contour.points, compact);
+        archive(expoly.holes.size());
+        for (const Polygon &hole : expoly.holes)
+            save_points(archive, hole.points, compact);
+    }
+}
+
+static void load_expolygons(cereal::BinaryInputArchive &archive, ExPolygons &expolygons, bool compact)
+{
+    size_t num = 0;
+    archive(num);
+    expolygons.resize(num);
+    for (ExPolygon &expoly : expolygons) {
+        load_points(archive, expoly.contour.points, compact);
+        size_t num_holes = 0;
+        archive(num_holes);
+        expoly.holes.resize(num_holes);
+        for (Polygon &hole : expoly.holes)
+            load_points(archive, hole.points, compact);
+    }
+}
+
+static void save_surfaces(cereal::BinaryOutputArchive &archive, const Surfaces &surfaces, bool compact)
+{
+    archive(surfaces.size());
+    for (const Surface &surface : surfaces) {
+        archive(surface.surface_type, surface.thickness, surface.thickness_layers, surface.bridge_angle, surface.extra_perimeters);
+        save_points(archive, surface.expolygon.contour.points, compact);
+        archive(surface.expolygon.holes.size());
+        for (const Polygon &hole : surface.expolygon.holes)
+            save_points(archive, hole.points, compact);
+    }
+}
+
+static void load_surfaces(cereal::BinaryInputArchive &archive, Surfaces &surfaces, bool compact)
+{
+    size_t num = 0;
+    archive(num);
+    surfaces.resize(num);
+    for (Surface &surface : surfaces) {
+        archive(surface.surface_type, surface.thickness, surface.thickness_layers, surface.bridge_angle, surface.extra_perimeters);
+        load_points(archive, surface.expolygon.contour.points, compact);
+        size_t num_holes = 0;
+        archive(num_holes);
+        surface.expolygon.holes.resize(num_holes);
+        for (Polygon &hole : surface.expolygon.holes)
+            load_points(archive, hole.points, compact);
+    }
+}
+
+static inline uint64_t fnv1a_hash(const void *data, size_t size, uint64_t hash)
+{
+    for (const unsigned char *p = static_cast<const unsigned char*>(data); size > 0; ++ p, -- size) {
+        hash ^= uint64_t(*p);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static inline uint64_t fnv1a_hash(const std::string &data, uint64_t hash)
+    { return fnv1a_hash(data.data(), data.size(), hash); }
+
+static inline uint64_t config_hash(const ConfigBase &config, uint64_t hash)
+{
+    for (const std::string &key : config.keys()) {
+        hash = fnv1a_hash(key, hash);
+        hash = fnv1a_hash(config.opt_serialize(key), hash);
+    }
+    return hash;
+}
+
+uint64_t PrintObject::slice_checkpoint_fingerprint() const
+{
+    // FNV-1a offset basis.
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    // The configuration: the full print config with the object overrides and the region set.
+    hash = config_hash(m_print->full_print_config(), hash);
+    hash = config_hash(m_config, hash);
+    for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id)
+        hash = config_hash(this->printing_region(region_id).config(), hash);
+    // The geometry: the meshes of all the volumes (negatives and modifiers included),
+    // their placement inside the object and the placement of the object on the bed.
+    for (const ModelVolume *volume : this->model_object()->volumes) {
+        int type = int(volume->type());
+        hash = fnv1a_hash(&type, sizeof(type), hash);
+        const indexed_triangle_set &its = volume->mesh().its;
+        hash = fnv1a_hash(its.vertices.data(), its.vertices.size() * sizeof(its.vertices.front()), hash);
+        hash = fnv1a_hash(its.indices.data(),  its.indices.size()  * sizeof(its.indices.front()),  hash);
+        const Transform3d &trafo = volume->get_matrix();
+        hash = fnv1a_hash(trafo.data(), sizeof(double) * 16, hash);
+    }
+    hash = fnv1a_hash(this->trafo().data(), sizeof(double) * 16, hash);
+    // The variable layer height profile.
+    const std::vector<coordf_t> profile = this->model_object()->layer_height_profile.get();
+    hash = fnv1a_hash(profile.data(), profile.size() * sizeof(coordf_t), hash);
+    return hash;
+}
+
+static std::string slice_checkpoint_path(uint64_t fingerprint)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "slice_%016llx.checkpoint", (unsigned long long)fingerprint);
+    return (boost::filesystem::path(checkpoint_dir()) / name).string();
+}
+
+bool PrintObject::load_slice_checkpoint()
+{
+    if (checkpoint_dir().empty())
+        return false;
+    const std::string path = slice_checkpoint_path(this->slice_checkpoint_fingerprint());
+    boost::system::error_code ec;
+    if (! boost::filesystem::exists(path, ec))
+        return false;
+    // The content is read and validated into temporary storage first and applied to the layers
+    // only afterwards, so a stale or truncated checkpoint leaves them untouched for the real slicing.
+    struct LayerCheckpoint {
+        coordf_t                slice_z;
+        coordf_t                print_z;
+        ExPolygons              lslices;
+        std::vector<Surfaces>   region_slices;
+        std::vector<ExPolygons> region_raw_slices;
+    };
+    std::vector<LayerCheckpoint> checkpoint;
+    try {
+        boost::nowide::ifstream ifs(path, std::ios::binary);
+        cereal::BinaryInputArchive archive(ifs);
+        unsigned int version     = 0;
+        bool         compact     = false;
+        size_t       num_layers  = 0;
+        size_t       num_regions = 0;
+        archive(version, compact, num_layers, num_regions);
+        if (version != slice_checkpoint_version || num_layers != m_layers.size() || num_regions != this->num_printing_regions())
+            return false;
+        checkpoint.resize(num_layers);
+        for (LayerCheckpoint &layer : checkpoint) {
+            archive(layer.slice_z, layer.print_z);
+            load_expolygons(archive, layer.lslices, compact);
+            layer.region_slices.resize(num_regions);
+            layer.region_raw_slices.resize(num_regions);
+            for (size_t region_id = 0; region_id < num_regions; ++ region_id) {
+                load_surfaces(archive, layer.region_slices[region_id], compact);
+                load_expolygons(archive, layer.region_raw_slices[region_id], compact);
+            }
+        }
+    } catch (...) {
+        // Stale or truncated checkpoint: drop it and run the real slicing.
+        boost::filesystem::remove(path, ec);
+        return false;
+    }
+    for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx) {
+        Layer           &layer = *m_layers[layer_idx];
+        LayerCheckpoint &data  = checkpoint[layer_idx];
+        if (std::abs(data.slice_z - layer.slice_z) > EPSILON || std::abs(data.print_z - layer.print_z) > EPSILON)
+            // The layer grid does not match (e.g. the layer height algorithm changed between builds).
+            return false;
+    }
+    for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx) {
+        Layer           &layer = *m_layers[layer_idx];
+        LayerCheckpoint &data  = checkpoint[layer_idx];
+        layer.lslices = std::move(data.lslices);
+        for (size_t region_id = 0; region_id < data.region_slices.size(); ++ region_id) {
+            LayerRegion *layerm = layer.add_region(&this->printing_region(region_id));
+            layerm->slices.surfaces = std::move(data.region_slices[region_id]);
+            layerm->raw_slices      = std::move(data.region_raw_slices[region_id]);
+        }
+        layer.lslices_bboxes.clear();
+        layer.lslices_bboxes.reserve(layer.lslices.size());
+        for (const ExPolygon &expoly : layer.lslices)
+            layer.lslices_bboxes.emplace_back(get_extents(expoly));
+    }
+    m_typed_slices = false;
+    BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": resumed the slicing step from checkpoint %1%") % path;
+    return true;
+}
+
+void PrintObject::save_slice_checkpoint() const
+{
+    if (checkpoint_dir().empty())
+        return;
+    const std::string path = slice_checkpoint_path(this->slice_checkpoint_fingerprint());
+    boost::system::error_code ec;
+    if (boost::filesystem::exists(path, ec))
+        return;
+    boost::filesystem::create_directories(boost::filesystem::path(checkpoint_dir()), ec);
+    const std::string path_tmp = path + ".tmp";
+    try {
+        {
+            // Checked narrowing at the boundary: the compact 32 bit encoding is only used if all
+            // the coordinates of the object fit it.
+            bool compact = true;
+            for (const Layer *layer : m_layers) {
+                compact = fits_32bits(layer->lslices);
+                for (size_t region_id = 0; compact && region_id < layer->region_count(); ++ region_id) {
+                    const LayerRegion *layerm = layer->get_region(int(region_id));
+                    compact = fits_32bits(layerm->slices.surfaces) && fits_32bits(layerm->raw_slices);
+                }
+                if (! compact)
+                    break;
+            }
+            boost::nowide::ofstream ofs(path_tmp, std::ios::binary | std::ios::trunc);
+            cereal::BinaryOutputArchive archive(ofs);
+            archive(slice_checkpoint_version, compact, m_layers.size(), this->num_printing_regions());
+            for (const Layer *layer : m_layers) {
+                archive(layer->slice_z, layer->print_z);
+                save_expolygons(archive, layer->lslices, compact);
+                for (size_t region_id = 0; region_id < layer->region_count(); ++ region_id) {
+                    const LayerRegion *layerm = layer->get_region(int(region_id));
+                    save_surfaces(archive, layerm->slices.surfaces, compact);
+                    save_expolygons(archive, layerm->raw_slices, compact);
+                }
+            }
+        }
+        // The rename keeps a job preempted half way through the write from leaving a torn checkpoint behind.
+        boost::filesystem::rename(path_tmp, path, ec);
+        BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": saved slicing checkpoint %1%") % path;
+    } catch (...) {
+        boost::filesystem::remove(path_tmp, ec);
+    }
+}
+
 template<typename ThrowOnCancel>
-static inline void apply_mm_segmentation(PrintObject &print_object, ThrowOnCancel throw_on_cancel)
+static inline void apply_mm_segmentation(PrintObject &print_object, const std::vector<bool> &reslice_mask, ThrowOnCancel throw_on_cancel)
 {
     // Returns MMU segmentation based on painting in MMU segmentation gizmo
     std::vector<std::vector<ExPolygons>> segmentation = multi_material_segmentation_by_painting(print_object, throw_on_cancel);
     assert(segmentation.size() == print_object.layer_count());
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, segmentation.size(), std::max(segmentation.size() / 128, size_t(1))),
-        [&print_object, &segmentation, throw_on_cancel](const tbb::blocked_range<size_t> &range) {
+        [&print_object, &segmentation, &reslice_mask, throw_on_cancel](const tbb::blocked_range<size_t> &range) {
             const auto  &layer_ranges   = print_object.shared_regions()->layer_ranges;
             double       z              = print_object.get_layer(range.begin())->slice_z;
             auto         it_layer_range = layer_range_first(layer_ranges, z);
@@ -882,6 +1276,9 @@ static inline void apply_mm_segmentation(PrintObject &print_object, ThrowOnCance
                 throw_on_cancel();
                 Layer *layer = print_object.get_layer(layer_id);
                 it_layer_range = layer_range_next(layer_ranges, it_layer_range, layer->slice_z);
+                if (! reslice_mask.empty() && ! reslice_mask[layer_id])
+                    // The layer was reused by PrintObject::slice(), its region slices are final already.
+                    continue;
                 const PrintObjectRegions::LayerRangeRegions &layer_range = *it_layer_range;
                 // Gather per extruder expolygons.
                 by_extruder.assign(num_extruders, ByExtruder());
@@ -991,14 +1388,19 @@ static inline void apply_mm_segmentation(PrintObject &print_object, ThrowOnCance
 // Resulting expolygons of layer regions are marked as Internal.
 //
 // this should be idempotent
-void PrintObject::slice_volumes()
+void PrintObject::slice_volumes(const std::vector<bool> &reslice_mask)
 {
     BOOST_LOG_TRIVIAL(info) << "Slicing volumes..." << log_memory_info();
     const Print *print                      = this->print();
     const auto   throw_on_cancel_callback   = std::function<void()>([print](){ print->throw_if_canceled(); });
+    // True if the layer has to be sliced, false if it was reused by PrintObject::slice().
+    auto         layer_dirty                = [&reslice_mask](size_t layer_idx) { return reslice_mask.empty() || reslice_mask[layer_idx]; };
 
-    // Clear old LayerRegions, allocate for new PrintRegions.
-    for (Layer* layer : m_layers) {
+    // Clear old LayerRegions, allocate for new PrintRegions. Reused layers keep their regions.
+    for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx) {
+        if (! layer_dirty(layer_idx))
+            continue;
+        Layer *layer = m_layers[layer_idx];
         //BBS: should delete all LayerRegionPtr to avoid memory leak
         while (!layer->m_regions.empty()) {
             if (layer->m_regions.back())
@@ -1010,7 +1412,16 @@ void PrintObject::slice_volumes()
             layer->m_regions.emplace_back(new LayerRegion(layer, pr.get()));
     }
 
-    std::vector<float>                   slice_zs      = zs_from_layers(m_layers);
+    // Zs of the layers to be sliced and their indices into m_layers. Without a mask this is simply all layers.
+    std::vector<float>  slice_zs;
+    std::vector<size_t> slice_layer_ids;
+    slice_zs.reserve(m_layers.size());
+    slice_layer_ids.reserve(m_layers.size());
+    for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx)
+        if (layer_dirty(layer_idx)) {
+            slice_zs.emplace_back(float(m_layers[layer_idx]->slice_z));
+            slice_layer_ids.emplace_back(layer_idx);
+        }
     std::vector<VolumeSlices> objSliceByVolume;
     if (!slice_zs.empty()) {
         objSliceByVolume = slice_volumes_inner(
@@ -1023,7 +1434,9 @@ void PrintObject::slice_volumes()
     //firstLayerObjSliceByVolume = findPartVolumes(objSliceByVolume, this->model_object()->volumes);
     //groupingVolumes(objSliceByVolumeParts, firstLayerObjSliceByGroups, scaled_resolution);
     //applyNegtiveVolumes(this->model_object()->volumes, objSliceByVolume, firstLayerObjSliceByGroups, scaled_resolution);
-    firstLayerObjSliceByVolume = objSliceByVolume;
+    if (m_layers.empty() || layer_dirty(0))
+        // Otherwise the first layer was reused and the cached per-volume slices are still valid.
+        firstLayerObjSliceByVolume = objSliceByVolume;
 
     std::vector<std::vector<ExPolygons>> region_slices =
         slices_to_regions(print->config(), *this, this->model_object()->volumes, *m_shared_regions, slice_zs,
@@ -1031,8 +1444,8 @@ void PrintObject::slice_volumes()
 
     for (size_t region_id = 0; region_id < region_slices.size(); ++ region_id) {
         std::vector<ExPolygons> &by_layer = region_slices[region_id];
-        for (size_t layer_id = 0; layer_id < by_layer.size(); ++ layer_id)
-            m_layers[layer_id]->regions()[region_id]->slices.append(std::move(by_layer[layer_id]), stInternal);
+        for (size_t slice_id = 0; slice_id < by_layer.size(); ++ slice_id)
+            m_layers[slice_layer_ids[slice_id]]->regions()[region_id]->slices.append(std::move(by_layer[slice_id]), stInternal);
     }
     region_slices.clear();
 
@@ -1064,10 +1477,10 @@ void PrintObject::slice_volumes()
         }
 
         BOOST_LOG_TRIVIAL(debug) << "Slicing volumes - MMU segmentation";
-        apply_mm_segmentation(*this, [print]() { print->throw_if_canceled(); });
+        apply_mm_segmentation(*this, reslice_mask, [print]() { print->throw_if_canceled(); });
     }
 
-    this->apply_conical_overhang();
+    this->apply_conical_overhang(reslice_mask);
     m_print->throw_if_canceled();
 
     BOOST_LOG_TRIVIAL(debug) << "Slicing volumes - make_slices in parallel - begin";
@@ -1086,9 +1499,12 @@ void PrintObject::slice_volumes()
         //BBS: this part has been changed a lot to support seperated contour and hole size compensation
 	    tbb::parallel_for(
 	        tbb::blocked_range<size_t>(0, m_layers.size()),
-			[this, xy_hole_scaled, xy_contour_scaled, elephant_foot_compensation_scaled, &lslices_elfoot_uncompensated](const tbb::blocked_range<size_t>& range) {
+			[this, xy_hole_scaled, xy_contour_scaled, elephant_foot_compensation_scaled, &lslices_elfoot_uncompensated, &reslice_mask](const tbb::blocked_range<size_t>& range) {
 	            for (size_t layer_id = range.begin(); layer_id < range.end(); ++ layer_id) {
 	                m_print->throw_if_canceled();
+	                if (! reslice_mask.empty() && ! reslice_mask[layer_id])
+	                    // The layer was reused by PrintObject::slice(), its slices are compensated already.
+	                    continue;
 	                Layer *layer = m_layers[layer_id];
 	                // Apply size compensation and perform clipping of multi-part objects.
 	                float elfoot = elephant_foot_compensation_scaled > 0 && layer_id < m_config.elefant_foot_compensation_layers.value ? 
@@ -1199,6 +1615,8 @@ void PrintObject::slice_volumes()
             //BBS: sort the lslices_elfoot_uncompensated according to shortest path before saving
             //Otherwise the travel of the layer layer would be mess.
             for (int i = 0; i < lslices_elfoot_uncompensated.size(); i++) {
+                if (! reslice_mask.empty() && ! reslice_mask[i])
+                    continue;
                 ExPolygons &expolygons_uncompensated = lslices_elfoot_uncompensated[i];
                 Points ordering_points;
                 ordering_points.reserve(expolygons_uncompensated.size());
@@ -1218,7 +1636,7 @@ void PrintObject::slice_volumes()
     BOOST_LOG_TRIVIAL(debug) << "Slicing volumes - make_slices in parallel - end";
 }
 
-void PrintObject::apply_conical_overhang() {
+void PrintObject::apply_conical_overhang(const std::vector<bool> &reslice_mask) {
     BOOST_LOG_TRIVIAL(info) << "Make overhang printable...";
 
     if (m_layers.empty()) {
@@ -1253,6 +1671,11 @@ void PrintObject::apply_conical_overhang() {
           continue;
         }
 
+        if (! reslice_mask.empty() && ! reslice_mask[layer->id()]) {
+            // The layer was reused by PrintObject::slice(), the overhang was already made printable.
+            continue;
+        }
+
         // Skip if entire layer has this disabled
         if (std::all_of(layer->m_regions.begin(), layer->m_regions.end(),
                         [](const LayerRegion *r) { return  r->slices.empty() || !r->region().config().make_overhang_printable; })) {
@@ -1,4 +1,7 @@
 #include "QuadricEdgeCollapse.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <tuple>
 #include <optional>
 #include "MutablePriorityQueue.hpp"
@@ -134,6 +137,9 @@ namespace QuadricEdgeCollapse {
                           uint32_t vi0, uint32_t vi1, uint32_t vi_top0,
                           const Triangle &t1, CopyEdgeInfos& infos, EdgeInfos &e_infos1);
     void compact(const VertexInfos &v_infos, const TriangleInfos &t_infos, const EdgeInfos &e_infos, indexed_triangle_set &its);
+    // reduce a single connected patch, the serial collapse loop over one priority queue
+    void reduce_patch(indexed_triangle_set &its, uint32_t triangle_count, float *max_error,
+                      ThrowOnCancel throw_on_cancel, StatusFn status_fn);
 
 #ifdef EXPENSIVE_DEBUG_CHECKS
     void store_surround(const char *obj_filename, size_t triangle_index, int depth, const indexed_triangle_set &its,
@@ -171,6 +177,76 @@ void Slic3r::its_quadric_edge_collapse(
     if (throw_on_cancel == nullptr) throw_on_cancel = []() {};
     if (status_fn == nullptr) status_fn = [](int) {};
 
+    if (!its_is_splittable(its)) {
+        reduce_patch(its, triangle_count, max_error, throw_on_cancel, status_fn);
+        return;
+    }
+
+    // Scanned models are often composed of several disconnected patches. Each patch keeps its own
+    // collapse queue and is reduced independently of the others, thus the patches may run
+    // concurrently. The wanted triangle count is distributed between the patches proportionally to
+    // their size and the reduced patches are merged back afterwards. Patch borders are real mesh
+    // borders, therefore no collapse candidate is lost by the decomposition.
+    std::vector<indexed_triangle_set> patches = its_split(its);
+    assert(patches.size() > 1);
+
+    std::vector<uint32_t> targets(patches.size(), 0);
+    if (triangle_count > 0) {
+        double   ratio    = double(triangle_count) / double(its.indices.size());
+        size_t   largest  = 0;
+        uint32_t assigned = 0;
+        for (size_t i = 0; i < patches.size(); ++i) {
+            targets[i] = std::min(uint32_t(patches[i].indices.size()),
+                                  uint32_t(std::floor(patches[i].indices.size() * ratio)));
+            assigned += targets[i];
+            if (patches[i].indices.size() > patches[largest].indices.size())
+                largest = i;
+        }
+        // Put the rounding residue into the largest patch, it has the most room to absorb it.
+        if (triangle_count > assigned)
+            targets[largest] = std::min(uint32_t(patches[largest].indices.size()),
+                                        targets[largest] + (triangle_count - assigned));
+    }
+
+    // Overall progress is the per-patch progress weighted by the patch triangle counts.
+    std::atomic<int64_t> progress_sum{0};
+    const int64_t      total_triangles = int64_t(its.indices.size());
+    std::vector<float> patch_errors(patches.size(), 0.f);
+    tbb::parallel_for(size_t(0), patches.size(), [&](size_t i) {
+        if (targets[i] >= patches[i].indices.size())
+            // Nothing to reduce inside this patch.
+            return;
+        int last_percent = 0;
+        StatusFn patch_status_fn = [&, i, last_percent](int percent) mutable {
+            int64_t sum = progress_sum.fetch_add(int64_t(percent - last_percent) * int64_t(patches[i].indices.size()),
+                                                 std::memory_order_relaxed)
+                        + int64_t(percent - last_percent) * int64_t(patches[i].indices.size());
+            last_percent = percent;
+            status_fn(int(sum / total_triangles));
+        };
+        patch_errors[i] = maximal_error;
+        reduce_patch(patches[i], targets[i], &patch_errors[i], throw_on_cancel, patch_status_fn);
+    });
+
+    its.clear();
+    for (indexed_triangle_set &patch : patches)
+        its_merge(its, patch);
+    if (max_error != nullptr)
+        *max_error = *std::max_element(patch_errors.begin(), patch_errors.end());
+}
+
+void QuadricEdgeCollapse::reduce_patch(
+    indexed_triangle_set &its,
+    uint32_t              triangle_count,
+    float *               max_error,
+    ThrowOnCancel         throw_on_cancel,
+    StatusFn              status_fn)
+{
+    // check input
+    if (triangle_count >= its.indices.size()) return;
+    float maximal_error = (max_error == nullptr)? std::numeric_limits<float>::max() : *max_error;
+    if (maximal_error <= 0.f) return;
+
     StatusFn init_status_fn = [&](int percent) {
         float n_percent = percent * status_init_size / 100.f;
         status_fn(static_cast<int>(std::round(n_percent)));
@@ -1,6 +1,11 @@
 #ifndef AGGRASTER_HPP
 #define AGGRASTER_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <mutex>
+
 #include <libslic3r/SLA/RasterBase.hpp>
 #include "libslic3r/ExPolygon.hpp"
 #include "libslic3r/MTUtils.hpp"
@@ -59,7 +64,49 @@ protected:
     Trafo m_trafo;
     Scanline m_scanlines;
     Rasterizer m_rasterizer;
-    
+
+    TColor m_foreground;
+    // Kept around to configure the per-band rasterizers of the tiled code path.
+    std::function<double(double)> m_gammafn;
+
+    // The raster buffer of a large format printer weighs tens of megabytes and
+    // draw_layers() creates one raster for every layer task. Recycle the
+    // buffers through a process wide free list instead of handing them back to
+    // the allocator between layers.
+    struct BufferPool {
+        ccr::SpinningMutex mutex;
+        std::vector<std::vector<TPixel>> buffers;
+    };
+
+    static BufferPool& buffer_pool()
+    {
+        static BufferPool pool;
+        return pool;
+    }
+
+    static std::vector<TPixel> acquire_buffer(size_t size)
+    {
+        std::vector<TPixel> buf;
+        {
+            BufferPool &pool = buffer_pool();
+            std::lock_guard<ccr::SpinningMutex> lock(pool.mutex);
+            if (! pool.buffers.empty()) {
+                buf = std::move(pool.buffers.back());
+                pool.buffers.pop_back();
+            }
+        }
+        buf.resize(size);
+        return buf;
+    }
+
+    static void recycle_buffer(std::vector<TPixel> &&buf)
+    {
+        BufferPool &pool = buffer_pool();
+        std::lock_guard<ccr::SpinningMutex> lock(pool.mutex);
+        if (pool.buffers.size() < ccr::max_concurreny())
+            pool.buffers.emplace_back(std::move(buf));
+    }
+
     void flipy(agg::path_storage &path) const
     {
         path.flip_y(0, double(m_resolution.height_px));
@@ -111,16 +158,74 @@ protected:
         return path;
     }
     
+    // Do not bother splitting polygons spanning less than this many pixel rows,
+    // the fixed cost of a band (rasterizer setup, path copy) would dominate.
+    static constexpr size_t BandGranularity = 128;
+
     template<class P> void _draw(const P &poly)
     {
-        m_rasterizer.reset();
-        
-        m_rasterizer.add_path(to_path(contour(poly)));
-        for(auto& h : holes(poly)) m_rasterizer.add_path(to_path(h));
-        
-        agg::render_scanlines(m_rasterizer, m_scanlines, m_renderer);
+        // Build the transformed paths once, they are shared by all bands.
+        std::vector<agg::path_storage> paths;
+        paths.reserve(1 + holes(poly).size());
+        paths.emplace_back(to_path(contour(poly)));
+        for(auto& h : holes(poly)) paths.emplace_back(to_path(h));
+
+        // Vertical extent of the polygon on the canvas decides how many bands
+        // are worth rendering concurrently.
+        double ymin = double(m_resolution.height_px), ymax = 0.;
+        for (const agg::path_storage &path : paths)
+            for (unsigned i = 0; i < path.total_vertices(); ++i) {
+                double x, y;
+                path.vertex(i, &x, &y);
+                ymin = std::min(ymin, y);
+                ymax = std::max(ymax, y);
+            }
+
+        size_t band_from = size_t(std::max(0., std::floor(ymin)));
+        size_t band_to   = std::min(m_resolution.height_px, size_t(std::ceil(ymax)) + 1);
+        size_t nbands    = band_from < band_to ?
+            std::min(ccr::max_concurreny(), (band_to - band_from) / BandGranularity) : 0;
+
+        if (nbands < 2) {
+            // Small polygon (or a single thread), rasterize in place.
+            m_rasterizer.reset();
+            for (agg::path_storage &path : paths) m_rasterizer.add_path(path);
+            agg::render_scanlines(m_rasterizer, m_scanlines, m_renderer);
+            return;
+        }
+
+        // Render the bands concurrently. Each band clips both the rasterizer
+        // and its renderer to a distinct range of pixel rows, thus the bands
+        // write disjoint rows of the shared canvas and no compositing pass is
+        // needed. Band boundaries fall on integer rows, where the clipper
+        // produces full coverage, so the output matches the serial rendering.
+        size_t rows_per_band = (band_to - band_from + nbands - 1) / nbands;
+        ccr::for_each(size_t(0), nbands,
+            [this, &paths, band_from, band_to, rows_per_band](size_t band) {
+            size_t from = band_from + band * rows_per_band;
+            size_t to   = std::min(from + rows_per_band, band_to);
+
+            Rasterizer rasterizer;
+            rasterizer.gamma(m_gammafn);
+            rasterizer.clip_box(0., double(from), double(m_resolution.width_px), double(to));
+            // add_path() iterates the path through an embedded cursor, give
+            // each band its own copy.
+            for (const agg::path_storage &path : paths) {
+                agg::path_storage band_path(path);
+                rasterizer.add_path(band_path);
+            }
+
+            PixelRenderer pixrenderer(m_rbuf);
+            agg::renderer_base<PixelRenderer> raw_renderer(pixrenderer);
+            raw_renderer.clip_box(0, int(from), int(m_resolution.width_px) - 1, int(to) - 1);
+            Renderer<agg::renderer_base<PixelRenderer>> renderer(raw_renderer);
+            renderer.color(m_foreground);
+
+            Scanline scanlines;
+            agg::render_scanlines(rasterizer, scanlines, renderer);
+        });
     }
-    
+
 public:
     template<class GammaFn>
     AGGRaster(const Resolution &res,
@@ -131,7 +236,7 @@ public:
               GammaFn &&        gammafn)
         : m_resolution(res)
         , m_pxdim_scaled(SCALING_FACTOR, SCALING_FACTOR)
-        , m_buf(res.pixels())
+        , m_buf(acquire_buffer(res.pixels()))
         , m_rbuf(reinterpret_cast<TValue *>(m_buf.data()),
                  unsigned(res.width_px),
                  unsigned(res.height_px),
@@ -140,6 +245,8 @@ public:
         , m_raw_renderer(m_pixrenderer)
         , m_renderer(m_raw_renderer)
         , m_trafo(trafo)
+        , m_foreground(foreground)
+        , m_gammafn(std::forward<GammaFn>(gammafn))
     {
         // Visual Studio compiler gives warnings about possible division by zero.
         assert(pd.w_mm != 0 && pd.h_mm != 0);
@@ -149,10 +256,12 @@ public:
         }
         m_renderer.color(foreground);
         clear(background);
-        
-        m_rasterizer.gamma(gammafn);
+
+        m_rasterizer.gamma(m_gammafn);
     }
-    
+
+    ~AGGRaster() override { recycle_buffer(std::move(m_buf)); }
+
     Trafo trafo() const override { return m_trafo; }
     Resolution resolution() const override { return m_resolution; }
     PixelDim   pixel_dimensions() const override
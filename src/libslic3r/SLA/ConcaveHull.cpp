@@ -1,14 +1,67 @@
 #include <libslic3r/SLA/ConcaveHull.hpp>
 #include <libslic3r/SLA/SpatIndex.hpp>
+#include <libslic3r/SLA/Concurrency.hpp>
 
 #include <libslic3r/MTUtils.hpp>
 #include <libslic3r/ClipperUtils.hpp>
 
+#include <mutex>
+
 #include <boost/log/trivial.hpp>
 
 namespace Slic3r {
 namespace sla {
 
+// Session-wide cache of merged hulls. The hull depends only on the input
+// contours and the merge distance, while the pad parameters that users tweak
+// most often (brim size, wall thickness) enter the pipeline only in the
+// subsequent offsetting stage. Keeping the last few hulls around lets such
+// tweaks skip the repeated union and connector routing entirely.
+class HullCache {
+    struct Entry {
+        Polygons input;
+        double   mergedist;
+        Polygons result;
+    };
+
+    // A handful of entries covers flipping back and forth between recent
+    // configurations without letting stale contour sets pile up.
+    static const size_t MaxEntries = 4;
+
+    std::vector<Entry> m_entries;
+    std::mutex         m_mtx;
+
+public:
+    static HullCache& instance()
+    {
+        static HullCache cache;
+        return cache;
+    }
+
+    bool lookup(const Polygons &input, double mergedist, Polygons &result)
+    {
+        std::lock_guard<std::mutex> lk{m_mtx};
+
+        for (const Entry &e : m_entries)
+            if (e.mergedist == mergedist && e.input == input) {
+                result = e.result;
+                return true;
+            }
+
+        return false;
+    }
+
+    void store(const Polygons &input, double mergedist, const Polygons &result)
+    {
+        std::lock_guard<std::mutex> lk{m_mtx};
+
+        if (m_entries.size() >= MaxEntries)
+            m_entries.erase(m_entries.begin());
+
+        m_entries.push_back({input, mergedist, result});
+    }
+};
+
 inline Vec3d to_vec3(const Vec2crd &v2) { return {double(v2(X)), double(v2(Y)), 0.}; }
 inline Vec3d to_vec3(const Vec2d &v2) { return {v2(X), v2(Y), 0.}; }
 inline Vec2crd to_vec2(const Vec3d &v3) { return {coord_t(v3(X)), coord_t(v3(Y))}; }
@@ -51,7 +104,35 @@ Points ConcaveHull::calculate_centroids() const
     return centroids;
 }
 
-void ConcaveHull::merge_polygons() { m_polys = get_contours(union_ex(m_polys)); }
+void ConcaveHull::merge_polygons()
+{
+    // Pads around many small supports union thousands of tiny contours. For
+    // such batches the contours are unioned hierarchically: independent
+    // chunks concurrently, then the far fewer partial results in one final
+    // pass. The inputs are plain CCW contours, so chunked unioning produces
+    // the same merged outline as a single global union.
+    constexpr size_t ChunkSize = 64;
+
+    if (m_polys.size() > 2 * ChunkSize) {
+        size_t nchunks = (m_polys.size() + ChunkSize - 1) / ChunkSize;
+        std::vector<Polygons> partials(nchunks);
+
+        ccr::for_each(size_t(0), nchunks, [this, &partials](size_t n) {
+            auto from = m_polys.begin() + n * ChunkSize;
+            auto to   = m_polys.begin() +
+                      std::min((n + 1) * ChunkSize, m_polys.size());
+
+            partials[n] = union_(Polygons(from, to));
+        });
+
+        Polygons merged;
+        for (Polygons &part : partials) append(merged, std::move(part));
+
+        m_polys = std::move(merged);
+    }
+
+    m_polys = get_contours(union_ex(m_polys));
+}
 
 void ConcaveHull::add_connector_rectangles(const Points &centroids,
                                            coord_t       max_dist,
@@ -107,16 +188,20 @@ ConcaveHull::ConcaveHull(const Polygons &polys, double mergedist, ThrowOnCancel
 {
     if(polys.empty()) return;
 
+    if (HullCache::instance().lookup(polys, mergedist, m_polys)) return;
+
     m_polys = polys;
     merge_polygons();
 
-    if(m_polys.size() == 1) return;
+    if(m_polys.size() > 1) {
+        Points centroids = calculate_centroids();
 
-    Points centroids = calculate_centroids();
+        add_connector_rectangles(centroids, scaled(mergedist), thr);
 
-    add_connector_rectangles(centroids, scaled(mergedist), thr);
+        merge_polygons();
+    }
 
-    merge_polygons();
+    HullCache::instance().store(polys, mergedist, m_polys);
 }
 
 ExPolygons ConcaveHull::to_expolygons() const
@@ -1,6 +1,8 @@
 #include <functional>
 #include <optional>
 
+#include <tbb/enumerable_thread_specific.h>
+
 #include <libslic3r/OpenVDBUtils.hpp>
 #include <libslic3r/TriangleMesh.hpp>
 #include <libslic3r/TriangleMeshSlicer.hpp>
@@ -25,7 +27,9 @@ namespace sla {
 struct Interior {
     indexed_triangle_set mesh;
     openvdb::FloatGrid::Ptr gridptr;
-    mutable std::optional<openvdb::FloatGrid::ConstAccessor> accessor;
+    // One accessor (with its own node cache) per thread, so that the distance
+    // queries may run concurrently.
+    mutable std::optional<tbb::enumerable_thread_specific<openvdb::FloatGrid::ConstAccessor>> accessor;
 
     double closing_distance = 0.;
     double thickness = 0.;
@@ -34,11 +38,11 @@ struct Interior {
     double nb_out = 3.; // narrow band width outwards
     // Full narrow band is the sum of the two above values.
 
-    void reset_accessor() const  // This resets the accessor and its cache
+    void reset_accessor() const  // This resets the accessors and their caches
     // Not a thread safe call!
     {
         if (gridptr)
-            accessor = gridptr->getConstAccessor();
+            accessor.emplace([grid = gridptr]() { return grid->getConstAccessor(); });
     }
 };
 
@@ -332,7 +336,7 @@ static double get_distance_raw(const Vec3f &p, const Interior &interior)
     auto grididx = interior.gridptr->transform().worldToIndexCellCentered(
         {v.x(), v.y(), v.z()});
 
-    return interior.accessor->getValue(grididx) ;
+    return interior.accessor->local().getValue(grididx) ;
 }
 
 struct TriangleBubble { Vec3f center; double R; };
@@ -424,8 +428,9 @@ void remove_inside_triangles(TriangleMesh &mesh, const Interior &interior,
         return use_exclude_mask && exclude_mask[face_id];
     };
 
-    // TODO: Parallel mode not working yet
-    using exec_policy = ccr_seq;
+    // The distance queries go through per-thread grid accessors and the removal
+    // flags are stored one byte per face, thus the faces may be processed concurrently.
+    using exec_policy = ccr;
 
     // Info about the needed modifications on the input mesh.
     struct MeshMods {
@@ -449,12 +454,13 @@ void remove_inside_triangles(TriangleMesh &mesh, const Interior &interior,
 
         } new_triangles;
 
-        // A vector of bool for all faces signaling if it needs to be removed
-        // or not.
-        std::vector<bool> to_remove;
+        // A flag for all faces signaling if it needs to be removed or not.
+        // One byte per face instead of std::vector<bool>, as the flags are
+        // raised from multiple threads.
+        std::vector<unsigned char> to_remove;
 
         MeshMods(const TriangleMesh &mesh):
-            to_remove(mesh.its.indices.size(), false) {}
+            to_remove(mesh.its.indices.size(), 0) {}
 
         // Number of triangles that need to be removed.
         size_t to_remove_cnt() const
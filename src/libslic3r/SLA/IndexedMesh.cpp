@@ -314,6 +314,58 @@ double IndexedMesh::squared_distance(const Vec3d &p, int& i, Vec3d& c) const {
     return sqdst;
 }
 
+// Spread the lower 10 bits of the argument apart, leaving two zero bits
+// between each of them.
+static inline uint32_t spread_bits_3d(uint32_t v)
+{
+    v &= 0x3ffu;
+    v = (v | (v << 16)) & 0x30000ffu;
+    v = (v | (v << 8))  & 0x300f00fu;
+    v = (v | (v << 4))  & 0x30c30c3u;
+    v = (v | (v << 2))  & 0x9249249u;
+    return v;
+}
+
+std::vector<Vec3d> IndexedMesh::closest_points(const std::vector<Vec3d> &points) const
+{
+    std::vector<Vec3d> out(points.size());
+
+    if (points.empty()) return out;
+
+    Vec3d pmin = points.front(), pmax = points.front();
+    for (const Vec3d &p : points) {
+        pmin = pmin.cwiseMin(p);
+        pmax = pmax.cwiseMax(p);
+    }
+    Vec3d extent = (pmax - pmin).cwiseMax(EPSILON);
+
+    // Morton codes of the query positions quantized into a 10 bit lattice
+    // over their bounding box.
+    std::vector<uint32_t> codes(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        Vec3d n = (points[i] - pmin).cwiseQuotient(extent);
+        codes[i] = (spread_bits_3d(uint32_t(n.z() * 1023.)) << 2) |
+                   (spread_bits_3d(uint32_t(n.y() * 1023.)) << 1) |
+                    spread_bits_3d(uint32_t(n.x() * 1023.));
+    }
+
+    std::vector<size_t> order(points.size());
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(),
+              [&codes](size_t a, size_t b) { return codes[a] < codes[b]; });
+
+    // The granularity keeps a chunk of spatially coherent queries on one
+    // worker.
+    ccr::for_each(size_t(0), order.size(),
+                  [this, &order, &points, &out](size_t i) {
+                      size_t idx = order[i];
+                      int    face_id;
+                      this->squared_distance(points[idx], face_id, out[idx]);
+                  }, 64);
+
+    return out;
+}
+
 
 static bool point_on_edge(const Vec3d& p, const Vec3d& e1, const Vec3d& e2,
                           double eps = 0.05)
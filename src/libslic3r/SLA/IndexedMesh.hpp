@@ -135,6 +135,13 @@ public:
         return squared_distance(p, i, c);
     }
 
+    // Batched variant of squared_distance(). Computes the closest mesh point
+    // for every query point concurrently, visiting the queries in Morton
+    // order of their positions: queries close in space descend into the same
+    // subtrees and keep the shared tree nodes cached when they are processed
+    // back to back by one worker.
+    std::vector<Vec3d> closest_points(const std::vector<Vec3d> &points) const;
+
     Vec3d normal_by_face_id(int face_id) const;
 
     const indexed_triangle_set * get_triangle_mesh() const { return m_tm; }
@@ -22,9 +22,12 @@ EncodedRaster PNGRasterEncoder::operator()(const void *ptr, size_t w, size_t h,
     std::vector<uint8_t> buf;
     size_t s = 0;
     
-    void *rawdata = tdefl_write_image_to_png_file_in_memory(
-        ptr, int(w), int(h), int(num_components), &s);
-    
+    // The layer masks are large but highly repetitive, the fastest deflate
+    // setting compresses them nearly as well as the default level while being
+    // several times quicker. This encoder runs for every layer of an export.
+    void *rawdata = tdefl_write_image_to_png_file_in_memory_ex(
+        ptr, int(w), int(h), int(num_components), &s, MZ_BEST_SPEED, MZ_FALSE);
+
     // On error, data() will return an empty vector. No other info can be
     // retrieved from miniz anyway...
     if (rawdata == nullptr) return EncodedRaster({}, "png");
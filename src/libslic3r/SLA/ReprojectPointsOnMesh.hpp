@@ -7,8 +7,6 @@
 #include "IndexedMesh.hpp"
 #include "libslic3r/Model.hpp"
 
-#include <tbb/parallel_for.h>
-
 namespace Slic3r { namespace sla {
 
 template<class Pt> Vec3d pos(const Pt &p) { return p.pos.template cast<double>(); }
@@ -17,12 +15,16 @@ template<class Pt> void pos(Pt &p, const Vec3d &pp) { p.pos = pp.cast<float>();
 template<class PointType>
 void reproject_support_points(const IndexedMesh &mesh, std::vector<PointType> &pts)
 {
-    tbb::parallel_for(size_t(0), pts.size(), [&mesh, &pts](size_t idx) {
-        int junk;
-        Vec3d new_pos;
-        mesh.squared_distance(pos(pts[idx]), junk, new_pos);
-        pos(pts[idx], new_pos);
-    });
+    std::vector<Vec3d> query(pts.size());
+    for (size_t idx = 0; idx < pts.size(); ++idx)
+        query[idx] = pos(pts[idx]);
+
+    // The batched query projects the points concurrently with a spatially
+    // coherent tree traversal order.
+    std::vector<Vec3d> projected = mesh.closest_points(query);
+
+    for (size_t idx = 0; idx < pts.size(); ++idx)
+        pos(pts[idx], projected[idx]);
 }
 
 inline void reproject_points_and_holes(ModelObject *object)
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <limits>
+#include <numeric>
 
 #include <libslic3r/SLA/Rotfinder.hpp>
 
@@ -10,6 +12,7 @@
 
 #include "libslic3r/SLAPrint.hpp"
 #include "libslic3r/PrintConfig.hpp"
+#include "libslic3r/QuadricEdgeCollapse.hpp"
 
 #include <libslic3r/Geometry.hpp>
 
@@ -252,17 +255,13 @@ std::vector<XYRotation> get_chull_rotations(const TriangleMesh &mesh, size_t max
     return ret;
 }
 
-// Find the best score from a set of function inputs. Evaluate for every point.
-template<size_t N, class Fn, class It, class StopCond>
-std::array<double, N> find_min_score(Fn &&fn, It from, It to, StopCond &&stopfn)
+// Evaluate the score function for every input concurrently.
+template<class Fn, class It, class StopCond>
+std::vector<double> score_all(Fn &&fn, It from, It to, StopCond &&stopfn)
 {
-    std::array<double, N> ret = {};
-
-    double score = std::numeric_limits<double>::max();
-
     size_t Nthreads = std::thread::hardware_concurrency();
     size_t dist = std::distance(from, to);
-    std::vector<double> scores(dist, score);
+    std::vector<double> scores(dist, std::numeric_limits<double>::max());
 
     execution::for_each(
         ex_tbb, size_t(0), dist, [&stopfn, &scores, &fn, &from](size_t i) {
@@ -272,6 +271,18 @@ std::array<double, N> find_min_score(Fn &&fn, It from, It to, StopCond &&stopfn)
         },
         dist / Nthreads);
 
+    return scores;
+}
+
+// Find the best score from a set of function inputs. Evaluate for every point.
+template<size_t N, class Fn, class It, class StopCond>
+std::array<double, N> find_min_score(Fn &&fn, It from, It to, StopCond &&stopfn)
+{
+    std::array<double, N> ret = {};
+
+    std::vector<double> scores =
+        score_all(std::forward<Fn>(fn), from, to, std::forward<StopCond>(stopfn));
+
     auto it = std::min_element(scores.begin(), scores.end());
 
     if (it != scores.end())
@@ -288,8 +299,15 @@ template<unsigned MAX_ITER>
 struct RotfinderBoilerplate {
     static constexpr unsigned MAX_TRIES = MAX_ITER;
 
+    // Facet count of the decimated proxy used for the coarse search. The
+    // score functions integrate over all facets, a proxy of this resolution
+    // ranks the candidate rotations reliably while being orders of magnitude
+    // cheaper to evaluate than a heavy scanned mesh.
+    static constexpr uint32_t PROXY_FACES = 10000;
+
     int status = 0;
     TriangleMesh mesh;
+    TriangleMesh proxy;
     unsigned max_tries;
     const RotOptimizeParams &params;
 
@@ -317,9 +335,19 @@ struct RotfinderBoilerplate {
         , params{p}
         , max_tries(p.accuracy() * MAX_TRIES)
     {
-
+        if (mesh.its.indices.size() > 2 * size_t(PROXY_FACES)) {
+            indexed_triangle_set its = mesh.its;
+            its_quadric_edge_collapse(its, PROXY_FACES);
+            proxy = TriangleMesh{std::move(its)};
+        }
     }
 
+    // Returns true if a cheaper proxy is available for the coarse search.
+    bool has_proxy() const { return ! proxy.its.indices.empty(); }
+
+    // The mesh the coarse search should be evaluated on.
+    const TriangleMesh & coarse_mesh() const { return has_proxy() ? proxy : mesh; }
+
     void statusfn() { params.statuscb()(++status * 100.0 / max_tries); }
     bool stopcond() { return ! params.statuscb()(-1); }
 };
@@ -329,8 +357,14 @@ Vec2d find_best_misalignment_rotation(const ModelObject &      mo,
 {
     RotfinderBoilerplate<1000> bp{mo, params};
 
+    // Iterations spent on polishing the winner of the coarse search on the
+    // full resolution mesh.
+    constexpr unsigned PolishTries = 100;
+
     // Preparing the optimizer.
     size_t gridsize = std::sqrt(bp.max_tries);
+    if (bp.has_proxy()) bp.max_tries += PolishTries;
+
     opt::Optimizer<opt::AlgBruteForce> solver(
         opt::StopCriteria{}.max_iterations(bp.max_tries)
                            .stop_condition([&bp] { return bp.stopcond(); }),
@@ -346,9 +380,28 @@ Vec2d find_best_misalignment_rotation(const ModelObject &      mo,
         [&bp] (const XYRotation &rot)
         {
             bp.statusfn();
-            return get_misalginment_score(bp.mesh, to_transform3f(rot));
+            return get_misalginment_score(bp.coarse_mesh(), to_transform3f(rot));
         }, opt::initvals({0., 0.}), bounds);
 
+    if (bp.has_proxy()) {
+        // Re-search the grid cell of the coarse winner on the full mesh.
+        double cell = 2 * PI / gridsize;
+        opt::Optimizer<opt::AlgBruteForce> polish_solver(
+            opt::StopCriteria{}.max_iterations(PolishTries)
+                               .stop_condition([&bp] { return bp.stopcond(); }),
+            size_t(std::sqrt(PolishTries))
+        );
+
+        result = polish_solver.to_max().optimize(
+            [&bp] (const XYRotation &rot)
+            {
+                bp.statusfn();
+                return get_misalginment_score(bp.mesh, to_transform3f(rot));
+            }, result.optimum,
+            opt::bounds({{result.optimum[0] - cell, result.optimum[0] + cell},
+                         {result.optimum[1] - cell, result.optimum[1] + cell}}));
+    }
+
     return {result.optimum[0], result.optimum[1]};
 }
 
@@ -371,22 +424,62 @@ Vec2d find_least_supports_rotation(const ModelObject &      mo,
         std::vector<XYRotation> inputs = get_chull_rotations(bp.mesh, bp.max_tries);
         bp.max_tries = inputs.size();
 
+        // Candidates surviving the coarse ranking which get re-scored on the
+        // full resolution mesh.
+        constexpr size_t PolishCandidates = 5;
+
+        size_t polish_cnt = bp.has_proxy() ?
+            std::min(PolishCandidates, inputs.size()) : 0;
+        bp.max_tries += unsigned(polish_cnt);
+
         // If the model can be placed on the bed directly, we only need to
         // check the 3D convex hull face rotations.
 
         auto objfn = [&bp](const XYRotation &rot) {
             bp.statusfn();
             Transform3f tr = to_transform3f(rot);
-            return get_supportedness_onfloor_score(bp.mesh, tr);
+            return get_supportedness_onfloor_score(bp.coarse_mesh(), tr);
         };
 
-        rot = find_min_score<2>(objfn, inputs.begin(), inputs.end(), [&bp] {
-            return bp.stopcond();
-        });
+        auto stopfn = [&bp] { return bp.stopcond(); };
+
+        if (polish_cnt > 0) {
+            // Rank all the candidates on the proxy, then let the full mesh
+            // decide between the best few.
+            std::vector<double> scores =
+                score_all(objfn, inputs.begin(), inputs.end(), stopfn);
+
+            std::vector<size_t> ranking(scores.size());
+            std::iota(ranking.begin(), ranking.end(), size_t(0));
+            std::partial_sort(ranking.begin(), ranking.begin() + polish_cnt,
+                              ranking.end(), [&scores](size_t a, size_t b) {
+                                  return scores[a] < scores[b];
+                              });
+
+            double best_score = std::numeric_limits<double>::max();
+            rot = inputs[ranking.front()];
+            for (size_t r = 0; r < polish_cnt; ++r) {
+                bp.statusfn();
+                double score = get_supportedness_onfloor_score(
+                    bp.mesh, to_transform3f(inputs[ranking[r]]));
+                if (score < best_score) {
+                    best_score = score;
+                    rot = inputs[ranking[r]];
+                }
+            }
+        } else {
+            rot = find_min_score<2>(objfn, inputs.begin(), inputs.end(), stopfn);
+        }
 
     } else {
+        // Iterations spent on polishing the winner of the coarse search on
+        // the full resolution mesh.
+        constexpr unsigned PolishTries = 100;
+
         // Preparing the optimizer.
         size_t gridsize = std::sqrt(bp.max_tries); // 2D grid has gridsize^2 calls
+        if (bp.has_proxy()) bp.max_tries += PolishTries;
+
         opt::Optimizer<opt::AlgBruteForce> solver(
             opt::StopCriteria{}.max_iterations(bp.max_tries)
                                .stop_condition([&bp] { return bp.stopcond(); }),
@@ -402,9 +495,28 @@ Vec2d find_least_supports_rotation(const ModelObject &      mo,
             [&bp] (const XYRotation &rot)
             {
                 bp.statusfn();
-                return get_supportedness_score(bp.mesh, to_transform3f(rot));
+                return get_supportedness_score(bp.coarse_mesh(), to_transform3f(rot));
             }, opt::initvals({0., 0.}), bounds);
 
+        if (bp.has_proxy()) {
+            // Re-search the grid cell of the coarse winner on the full mesh.
+            double cell = 2 * PI / gridsize;
+            opt::Optimizer<opt::AlgBruteForce> polish_solver(
+                opt::StopCriteria{}.max_iterations(PolishTries)
+                                   .stop_condition([&bp] { return bp.stopcond(); }),
+                size_t(std::sqrt(PolishTries))
+            );
+
+            result = polish_solver.to_min().optimize(
+                [&bp] (const XYRotation &rot)
+                {
+                    bp.statusfn();
+                    return get_supportedness_score(bp.mesh, to_transform3f(rot));
+                }, result.optimum,
+                opt::bounds({{result.optimum[0] - cell, result.optimum[0] + cell},
+                             {result.optimum[1] - cell, result.optimum[1] + cell}}));
+        }
+
         // Save the result
         rot = result.optimum;
     }
@@ -272,11 +272,38 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
             }
         }
         // Now iterate over all polygons and append new points if needed.
-        for (Structure &s : layer_top->islands) {
+        // The islands of one layer are analyzed concurrently: every island tests its
+        // candidates against the points of the finished layers in point_grid and
+        // against its own private grid, collecting the new points separately.
+        // The candidates are then merged in island order, keeping the output
+        // deterministic. Islands of one layer are disjoint, therefore the only
+        // cross-island interaction lost is the minimal distance test across a gap
+        // narrower than the Poisson radius.
+        std::vector<std::vector<SupportPoint>> island_new_points(layer_top->islands.size());
+        std::vector<PointGrid3D>               island_grids(layer_top->islands.size());
+        std::vector<std::mt19937::result_type> island_seeds(layer_top->islands.size());
+        // Derive the per-island random generator seeds serially to keep them deterministic.
+        for (std::mt19937::result_type &seed : island_seeds)
+            seed = m_rng();
+        ccr_par::for_each(size_t(0), layer_top->islands.size(),
+            [this, layer_top, &point_grid, &island_new_points, &island_grids, &island_seeds](size_t island_id)
+        {
+            Structure &s = layer_top->islands[island_id];
             // Penalization resulting from large diff from the last layer:
             s.supports_force_inherited /= std::max(1.f, 0.17f * (s.overhangs_area) / s.area);
 
-            add_support_points(s, point_grid);
+            island_grids[island_id].cell_size = point_grid.cell_size;
+            std::mt19937 rng(island_seeds[island_id]);
+            add_support_points(s, point_grid, island_grids[island_id], rng, island_new_points[island_id]);
+        });
+
+        // Merge the per-island candidates in island order.
+        for (size_t island_id = 0; island_id < layer_top->islands.size(); ++ island_id) {
+            Structure &s = layer_top->islands[island_id];
+            for (const SupportPoint &pt : island_new_points[island_id]) {
+                m_output.emplace_back(pt);
+                point_grid.insert(Vec2f(pt.pos.x(), pt.pos.y()), &s);
+            }
         }
 
         m_throw_on_cancel();
@@ -294,7 +321,8 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
     }
 }
 
-void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, SupportPointGenerator::PointGrid3D &grid3d)
+void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, const SupportPointGenerator::PointGrid3D &base_grid,
+    SupportPointGenerator::PointGrid3D &island_grid, std::mt19937 &rng, std::vector<SupportPoint> &out)
 {
     // Select each type of surface (overrhang, dangling, slope), derive the support
     // force deficit for it and call uniformly conver with the right params
@@ -305,12 +333,12 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
     if (s.islands_below.empty()) {
         // completely new island - needs support no doubt
         // deficit is full, there is nothing below that would hold this island
-        uniformly_cover({ *s.polygon }, s, s.area * tp, grid3d, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
+        uniformly_cover({ *s.polygon }, s, s.area * tp, base_grid, island_grid, rng, out, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
         return;
     }
 
     if (! s.overhangs.empty()) {
-        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, grid3d);
+        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, base_grid, island_grid, rng, out);
     }
 
     auto areafn = [](double sum, auto &p) { return sum + p.area() * SCALING_FACTOR * SCALING_FACTOR; };
@@ -321,13 +349,13 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
         // What we now have in polygons needs support, regardless of what the forces are, so we can add them.
 
         double a = std::accumulate(s.dangling_areas.begin(), s.dangling_areas.end(), 0., areafn);
-        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, base_grid, island_grid, rng, out, icfWithBoundary);
     }
 
     current = s.supports_force_total();
     if (! s.overhangs_slopes.empty()) {
         double a = std::accumulate(s.overhangs_slopes.begin(), s.overhangs_slopes.end(), 0., areafn);
-        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, base_grid, island_grid, rng, out, icfWithBoundary);
     }
 }
 
@@ -542,7 +570,9 @@ static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec
 }
 
 
-void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags)
+void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit,
+    const PointGrid3D &base_grid, PointGrid3D &island_grid, std::mt19937 &rng,
+    std::vector<SupportPoint> &out, IslandCoverageFlags flags)
 {
     //int num_of_points = std::max(1, (int)((island.area()*pow(SCALING_FACTOR, 2) * m_config.tear_pressure)/m_config.support_force));
 
@@ -580,14 +610,15 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
     std::vector<Vec2f> raw_samples =
         flags & icfWithBoundary ?
             sample_expolygon_with_boundary(islands, samples_per_mm2,
-                                           5.f / poisson_radius, m_rng) :
-            sample_expolygon(islands, samples_per_mm2, m_rng);
+                                           5.f / poisson_radius, rng) :
+            sample_expolygon(islands, samples_per_mm2, rng);
 
     std::vector<Vec2f>  poisson_samples;
     for (size_t iter = 0; iter < 4; ++ iter) {
         poisson_samples = poisson_disk_from_samples(raw_samples, poisson_radius,
-            [&structure, &grid3d, min_spacing](const Vec2f &pos) {
-                return grid3d.collides_with(pos, structure.layer->print_z, min_spacing);
+            [&structure, &base_grid, &island_grid, min_spacing](const Vec2f &pos) {
+                return base_grid.collides_with(pos, structure.layer->print_z, min_spacing) ||
+                       island_grid.collides_with(pos, structure.layer->print_z, min_spacing);
             });
         if (poisson_samples.size() >= poisson_samples_target || m_config.minimal_distance > poisson_radius-EPSILON)
             break;
@@ -613,13 +644,13 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
 
 //    assert(! poisson_samples.empty());
     if (poisson_samples_target < poisson_samples.size()) {
-        std::shuffle(poisson_samples.begin(), poisson_samples.end(), m_rng);
+        std::shuffle(poisson_samples.begin(), poisson_samples.end(), rng);
         poisson_samples.erase(poisson_samples.begin() + poisson_samples_target, poisson_samples.end());
     }
     for (const Vec2f &pt : poisson_samples) {
-        m_output.emplace_back(float(pt(0)), float(pt(1)), structure.zlevel, m_config.head_diameter/2.f, flags & icfIsNew);
+        out.emplace_back(float(pt(0)), float(pt(1)), structure.zlevel, m_config.head_diameter/2.f, flags & icfIsNew);
         structure.supports_force_this_layer += m_config.support_force();
-        grid3d.insert(pt, &structure);
+        island_grid.insert(pt, &structure);
     }
 }
 
@@ -148,20 +148,20 @@ public:
         Vec3f   cell_size;
         Grid    grid;
         
-        Vec3i cell_id(const Vec3f &pos) {
+        Vec3i cell_id(const Vec3f &pos) const {
             return Vec3i(int(floor(pos.x() / cell_size.x())),
                          int(floor(pos.y() / cell_size.y())),
                          int(floor(pos.z() / cell_size.z())));
         }
-        
+
         void insert(const Vec2f &pos, Structure *island) {
             RichSupportPoint pt;
             pt.position = Vec3f(pos.x(), pos.y(), float(island->layer->print_z));
             pt.island   = island;
             grid.emplace(cell_id(pt.position), pt);
         }
-        
-        bool collides_with(const Vec2f &pos, float print_z, float radius) {
+
+        bool collides_with(const Vec2f &pos, float print_z, float radius) const {
             Vec3f pos3d(pos.x(), pos.y(), print_z);
             Vec3i cell = cell_id(pos3d);
             std::pair<Grid::const_iterator, Grid::const_iterator> it_pair = grid.equal_range(cell);
@@ -180,7 +180,7 @@ public:
         }
         
     private:
-        bool collides_with(const Vec3f &pos, float radius, Grid::const_iterator it_begin, Grid::const_iterator it_end) {
+        bool collides_with(const Vec3f &pos, float radius, Grid::const_iterator it_begin, Grid::const_iterator it_end) const {
             for (Grid::const_iterator it = it_begin; it != it_end; ++ it) {
                 float dist2 = (it->second.position - pos).squaredNorm();
                 if (dist2 < radius * radius)
@@ -206,9 +206,16 @@ public:
 
 private:
 
-    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags = icfNone);
+    // Cover the given areas of the island with support point candidates. Collisions are tested
+    // against the points of the finished layers in base_grid and against the points of this island
+    // in island_grid; new points are appended to out and inserted into island_grid only, so that
+    // the islands of one layer may be processed concurrently.
+    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit,
+        const PointGrid3D &base_grid, PointGrid3D &island_grid, std::mt19937 &rng,
+        std::vector<SupportPoint> &out, IslandCoverageFlags flags = icfNone);
 
-    void add_support_points(Structure& structure, PointGrid3D &grid3d);
+    void add_support_points(Structure& structure, const PointGrid3D &base_grid, PointGrid3D &island_grid,
+        std::mt19937 &rng, std::vector<SupportPoint> &out);
 
     void project_onto_mesh(std::vector<SupportPoint>& points) const;
 
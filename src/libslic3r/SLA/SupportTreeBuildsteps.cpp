@@ -2,11 +2,64 @@
 
 #include <libslic3r/SLA/SpatIndex.hpp>
 #include <libslic3r/Optimize/NLoptOptimizer.hpp>
+#include <libslic3r/OpenVDBUtils.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <tbb/enumerable_thread_specific.h>
+
 namespace Slic3r {
 namespace sla {
 
+// Signed distance grid of the supported model used by is_clear_along() to
+// confirm the clearance of routing candidates without touching the triangle
+// mesh. Only the candidates running near the surface (where the narrow band
+// grid cannot give a conclusive answer) pay for the exact ray casts.
+struct ClearanceField
+{
+    openvdb::FloatGrid::Ptr grid;
+
+    // One accessor (with its own node cache) per thread, so that the
+    // clearance queries may run concurrently.
+    mutable tbb::enumerable_thread_specific<openvdb::FloatGrid::ConstAccessor> accessor;
+
+    // World space bounds of the active voxels. A ray past these bounds cannot
+    // hit the model anymore.
+    Vec3d bb_min = Vec3d::Zero(), bb_max = Vec3d::Zero();
+
+    // Distance value reported outside the exterior narrow band [mm].
+    double background = 0.;
+
+    explicit ClearanceField(openvdb::FloatGrid::Ptr g)
+        : grid(std::move(g))
+        , accessor([gptr = grid]() { return gptr->getConstAccessor(); })
+        , background(grid->background())
+    {
+        auto bbox = grid->evalActiveVoxelBoundingBox();
+        openvdb::Vec3d wmin = grid->transform().indexToWorld(bbox.min());
+        openvdb::Vec3d wmax = grid->transform().indexToWorld(bbox.max());
+        bb_min = Vec3d(wmin.x(), wmin.y(), wmin.z());
+        bb_max = Vec3d(wmax.x(), wmax.y(), wmax.z());
+    }
+
+    double distance(const Vec3d &p) const
+    {
+        auto ijk = grid->transform().worldToIndexCellCentered(
+            {p.x(), p.y(), p.z()});
+        return accessor.local().getValue(ijk);
+    }
+};
+
+void ClearanceFieldDeleter::operator()(ClearanceField *p) { delete p; }
+
+// Meshes below this facet count are cheap to ray cast directly and would not
+// amortize the cost of the distance grid conversion.
+constexpr size_t MinFacesForClearanceField = 50000;
+
+// Width of the exterior narrow band of the distance grid in voxels (== mm, the
+// grid is built unscaled). Also the longest possible sphere tracing step in
+// open space.
+constexpr float ClearanceFieldExtBand = 8.f;
+
 using Slic3r::opt::initvals;
 using Slic3r::opt::bounds;
 using Slic3r::opt::StopCriteria;
@@ -52,6 +105,67 @@ SupportTreeBuildsteps::SupportTreeBuildsteps(SupportTreeBuilder &   builder,
         m_points.row(i)(Z) = double(sp.pos(Z));
         ++i;
     }
+
+    if (m_mesh.get_triangle_mesh() &&
+        m_mesh.get_triangle_mesh()->indices.size() >= MinFacesForClearanceField) {
+        auto grid = mesh_to_grid(*m_mesh.get_triangle_mesh(), {}, 1.f,
+                                 ClearanceFieldExtBand, 1.f);
+        if (grid)
+            m_clearance_field.reset(new ClearanceField(std::move(grid)));
+        else
+            BOOST_LOG_TRIVIAL(warning)
+                << "Could not build the support clearance grid, "
+                   "falling back to exact collision checks.";
+    }
+}
+
+bool SupportTreeBuildsteps::is_clear_along(const Vec3d &s,
+                                           const Vec3d &dir,
+                                           double       r,
+                                           double       sd) const
+{
+    if (!m_clearance_field) return false;
+
+    const ClearanceField &field = *m_clearance_field;
+
+    // Half the diagonal of a voxel, covers the error of sampling the distance
+    // field at cell centers.
+    constexpr double SamplingError = 0.87;
+
+    // The rays of bridge_mesh_intersect() start on a circle of radius r + sd
+    // around the axis and run parallel with it, so they stay inside a cylinder
+    // of this radius. The candidate is provably clear if the distance field
+    // along the axis never drops to the cylinder radius plus the sampling
+    // error.
+    double clearance = r + sd + SamplingError;
+    if (field.background <= clearance + EPSILON)
+        // The narrow band is too tight for this radius, the tracing could
+        // never step forward.
+        return false;
+
+    // Ray parameter of the point where the ray leaves the active voxel
+    // bounds. There is nothing to hit beyond it.
+    double t_exit = std::numeric_limits<double>::max();
+    for (int c = 0; c < 3; ++c) {
+        if (std::abs(dir(c)) > EPSILON)
+            t_exit = std::min(t_exit,
+                              std::max((field.bb_min(c) - s(c)) / dir(c),
+                                       (field.bb_max(c) - s(c)) / dir(c)));
+        else if (s(c) < field.bb_min(c) || s(c) > field.bb_max(c))
+            // The ray runs outside the active bounds entirely.
+            return true;
+    }
+
+    // Sphere tracing: the distance field value is a lower bound of the
+    // distance to the surface, so the ray may safely be advanced by the
+    // value remaining above the required clearance.
+    for (double t = 0.; t <= t_exit;) {
+        double d = field.distance(s + t * dir);
+        if (d <= clearance) return false;
+        t += d - clearance;
+    }
+
+    return true;
 }
 
 bool SupportTreeBuildsteps::execute(SupportTreeBuilder &   builder,
@@ -259,6 +373,11 @@ IndexedMesh::hit_result SupportTreeBuildsteps::pinhead_mesh_intersect(
 IndexedMesh::hit_result SupportTreeBuildsteps::bridge_mesh_intersect(
     const Vec3d &src, const Vec3d &dir, double r, double sd)
 {
+    // Most of the candidates run far from the model surface. Confirm those on
+    // the distance field, only the remaining ones pay for the ray casts.
+    if (is_clear_along(src, dir, r, sd))
+        return IndexedMesh::hit_result(IndexedMesh::hit_result::infty());
+
     static const size_t SAMPLES = 8;
     PointRing<SAMPLES> ring{dir};
 
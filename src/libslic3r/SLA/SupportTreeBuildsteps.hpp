@@ -2,6 +2,7 @@
 #define SLASUPPORTTREEALGORITHM_H
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 
 #include <libslic3r/SLA/SupportTreeBuilder.hpp>
@@ -185,6 +186,15 @@ IntegerOnly<DoubleI> pairhash(I a, I b)
     return (DoubleI(g) << shift) + l;
 }
 
+// Signed distance field of the supported model, built once per support tree
+// generation. Used to cheaply confirm the clearance of bridge and pillar
+// candidates running far from the surface, keeping the exact ray casts for
+// the candidates near the surface. Defined in the cpp so that the openvdb
+// types do not leak into this header.
+struct ClearanceField;
+struct ClearanceFieldDeleter { void operator()(ClearanceField *p); };
+using ClearanceFieldPtr = std::unique_ptr<ClearanceField, ClearanceFieldDeleter>;
+
 class SupportTreeBuildsteps {
     const SupportTreeConfig& m_cfg;
     const IndexedMesh& m_mesh;
@@ -222,12 +232,22 @@ class SupportTreeBuildsteps {
     // When bridging heads to pillars... TODO: find a cleaner solution
     ccr::BlockingMutex m_bridge_mutex;
 
-    inline IndexedMesh::hit_result ray_mesh_intersect(const Vec3d& s, 
+    // Distance field of the model consulted before the exact collision checks.
+    ClearanceFieldPtr m_clearance_field;
+
+    inline IndexedMesh::hit_result ray_mesh_intersect(const Vec3d& s,
                                                       const Vec3d& dir)
     {
         return m_mesh.query_ray_hit(s, dir);
     }
 
+    // Tells whether a bridge of radius r cast from s along dir provably stays
+    // clear of the model along its whole length. Walks the distance field with
+    // sphere tracing, thus it is cheap for candidates far from the surface. A
+    // false return is inconclusive, the caller has to fall back to the exact
+    // ray casts.
+    bool is_clear_along(const Vec3d &s, const Vec3d &dir, double r, double sd) const;
+
     // This function will test if a future pinhead would not collide with the
     // model geometry. It does not take a 'Head' object because those are
     // created after this test. Parameters: s: The touching point on the model
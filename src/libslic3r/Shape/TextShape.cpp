@@ -4,6 +4,8 @@
 
 #include "TextShape.hpp"
 
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -95,18 +97,34 @@ std::vector<std::string> init_occt_fonts()
     return stdFontNames;
 }
 
-static bool TextToBRep(const char* text, const char* font, const float theTextHeight, Font_FontAspect& theFontAspect, TopoDS_Shape& theShape, double& text_width)
+//BBS: the text gizmo regenerates the whole string glyph by glyph on every edit, so both the
+// initialized fonts and the finished per-glyph meshes are cached below. Initializing the font
+// and tessellating the glyph outlines dominates that path (hundreds of milliseconds on CJK
+// fonts) and only the glyphs which actually changed need to pay it.
+static std::mutex g_text_shape_cache_mutex;
+static std::map<std::string, Handle(Font_BRepFont)> g_brep_font_cache;   //map<font_name:height:aspect, font>
+static std::map<std::string, TextResult>            g_glyph_mesh_cache;  //map<font_name:height:thickness:aspect:text, result>
+
+static Handle(Font_BRepFont) find_and_init_font(const char* font, const float theTextHeight, Font_FontAspect theFontAspect)
+{
+    std::string key = std::string(font) + ":" + std::to_string(theTextHeight) + ":" + std::to_string(int(theFontAspect));
+    auto it = g_brep_font_cache.find(key);
+    if (it != g_brep_font_cache.end())
+        return it->second;
+
+    Handle(Font_BRepFont) aFont = new Font_BRepFont();
+    aFont->SetCompositeCurveMode(Standard_False);
+    if (!aFont->FindAndInit(font, theFontAspect, theTextHeight, Font_StrictLevel_Any))
+        return Handle(Font_BRepFont)();
+
+    g_brep_font_cache.emplace(std::move(key), aFont);
+    return aFont;
+}
+
+static bool TextToBRep(const char* text, Font_BRepFont& aFont, TopoDS_Shape& theShape, double& text_width)
 {
-    Standard_Integer anArgIt = 1;
-    Standard_CString aName = "text_shape";
     Standard_CString aText = text;
 
-    Font_BRepFont           aFont;
-    //TCollection_AsciiString aFontName("Courier");
-    TCollection_AsciiString aFontName(font);
-    Standard_Real           aTextHeight = theTextHeight;
-    Font_FontAspect         aFontAspect = theFontAspect;
-    Standard_Boolean        anIsCompositeCurve = Standard_False;
     gp_Ax3                  aPenAx3(gp::XOY());
     gp_Dir                  aNormal(0.0, 0.0, 1.0);
     gp_Dir                  aDirection(1.0, 0.0, 0.0);
@@ -114,11 +132,6 @@ static bool TextToBRep(const char* text, const char* font, const float theTextHe
 
     Graphic3d_HorizontalTextAlignment aHJustification = Graphic3d_HTA_LEFT;
     Graphic3d_VerticalTextAlignment   aVJustification = Graphic3d_VTA_BOTTOM;
-    Font_StrictLevel aStrictLevel = Font_StrictLevel_Any;
-
-    aFont.SetCompositeCurveMode(anIsCompositeCurve);
-    if (!aFont.FindAndInit(aFontName.ToCString(), aFontAspect, aTextHeight, aStrictLevel))
-        return false;
 
     aPenAx3 = gp_Ax3(aPenLoc, aNormal, aDirection);
 
@@ -254,7 +267,21 @@ void load_text_shape(const char*text, const char* font, const float text_height,
     else
         aFontAspect = Font_FontAspect_Regular;
 
-    if (!TextToBRep(text, font, text_height, aFontAspect, aTextBase, text_result.text_width))
+    std::lock_guard<std::mutex> lock(g_text_shape_cache_mutex);
+
+    std::string cache_key = std::string(font) + ":" + std::to_string(text_height) + ":" + std::to_string(thickness)
+        + ":" + std::to_string(int(aFontAspect)) + ":" + text;
+    auto it = g_glyph_mesh_cache.find(cache_key);
+    if (it != g_glyph_mesh_cache.end()) {
+        text_result = it->second;
+        return;
+    }
+
+    Handle(Font_BRepFont) aFont = find_and_init_font(font, text_height, aFontAspect);
+    if (aFont.IsNull())
+        return;
+
+    if (!TextToBRep(text, *aFont, aTextBase, text_result.text_width))
         return;
 
     TopoDS_Shape aTextShape;
@@ -262,6 +289,12 @@ void load_text_shape(const char*text, const char* font, const float text_height,
         return;
 
     MakeMesh(aTextShape, text_result.text_mesh);
+
+    //BBS: the gizmo feeds single glyphs here, so the entries are small, but an unbounded map
+    // would still grow while switching fonts or sizes. Dropping the whole cache is cheap.
+    if (g_glyph_mesh_cache.size() >= 512)
+        g_glyph_mesh_cache.clear();
+    g_glyph_mesh_cache.emplace(std::move(cache_key), text_result);
 }
 
 }; // namespace Slic3r
@@ -31,9 +31,24 @@ std::vector<std::pair<size_t, bool>> chain_segments_closest_point(std::vector<En
 	out.emplace_back(first_point_idx / 2, (first_point_idx & 1) != 0);
 	first_point.chain_id = 1;
 	size_t this_idx = first_point_idx ^ 1;
+	//BBS: the searches below filter out the already consumed end points, which the KD tree cannot
+	// prune against, so they degrade towards linear scans once most points are consumed. Rebuild
+	// the tree from the remaining points whenever half of its population got consumed.
+	size_t tree_population = end_points.size();
+	size_t num_consumed    = 0;
 	for (int iter = (int)num_segments - 2; iter >= 0; -- iter) {
 		EndPointType &this_point = end_points[this_idx];
     	this_point.chain_id = 1;
+		if ((num_consumed += 2) >= std::max(tree_population / 2, size_t(512))) {
+			std::vector<size_t> remaining;
+			remaining.reserve(tree_population - num_consumed);
+			for (size_t i = 0; i < end_points.size(); ++ i)
+				if (end_points[i].chain_id == 0)
+					remaining.emplace_back(i);
+			tree_population = remaining.size();
+			num_consumed    = 0;
+			kdtree.build(remaining);
+		}
     	// Find the closest point to this end_point, which lies on a different extrusion path (filtered by the lambda).
     	// Ignore the starting point as the starting point is considered to be occupied, no end point coud connect to it.
 		size_t next_idx = find_closest_point(kdtree, this_point.pos,
@@ -241,6 +256,14 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 
 	    // Chain the end points: find (num_segments - 1) shortest links not forming bifurcations or loops.
 		assert(num_segments >= 2);
+		//BBS: the link searches filter out the already connected end points, which the KD tree
+		// cannot prune against, thus they degrade towards linear scans once most points are
+		// connected. Rebuild the tree from the not yet connected points whenever half of its
+		// population got connected, which keeps the searches logarithmic at an amortized
+		// O(n log n) rebuild cost.
+		size_t tree_population = end_points.size();
+		size_t num_connected   = 0;
+		bool   tree_rebuilt    = false;
 #ifndef NDEBUG
 		double distance_taken_last = 0.;
 #endif /* NDEBUG */
@@ -289,6 +312,7 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 								equivalent_chain.merge(end_point1_other_chain_id, end_point2_other_chain_id));
 				end_point1.chain_id = chain_id;
 				end_point2.chain_id = chain_id;
+				num_connected += 2;
 				assert(validate_graph_and_queue());
 				if (iter == 0) {
 					// Last iteration. There shall be exactly one or two end points waiting to be connected.
@@ -308,6 +332,17 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 				// This edge forms a loop. Update end_point1 and try another one.
 				++ iter;
 				end_point1.edge_out = nullptr;
+				if (num_connected >= std::max(tree_population / 2, size_t(512))) {
+					std::vector<size_t> remaining;
+					remaining.reserve(tree_population - num_connected);
+					for (size_t i = 0; i < end_points.size(); ++ i)
+						if (end_points[i].chain_id == 0)
+							remaining.emplace_back(i);
+					tree_population = remaining.size();
+					num_connected   = 0;
+					tree_rebuilt    = true;
+					kdtree.build(remaining);
+				}
 		    	// Update edge_out and distance.
 		    	size_t this_idx = &end_point1 - &end_points.front();
 		    	// Find the closest point to this end_point, which lies on a different extrusion path (filtered by the filter lambda).
@@ -381,9 +416,13 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 					} while (first_point != nullptr);
 				}
 			}
-			if (failed)
+			if (failed) {
 				// As a last resort, try a dumb algorithm, which is not sensitive to edge reversal constraints.
+				if (tree_rebuilt)
+					// The KD tree was rebuilt over a subset of the end points, restore the full tree.
+					kdtree.build(end_points.size());
 				out = chain_segments_closest_point<EndPoint, decltype(kdtree), CouldReverseFunc>(end_points, kdtree, could_reverse_func, (initial_point != nullptr) ? *initial_point : end_points.front());
+			}
 		} else {
 			assert(! failed);
 		}
@@ -748,8 +787,25 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 		// required is higher than expected (it would be the number of links, num_segments - 1).
 		// The limit here may not be necessary, but it guards us against an endless loop if something goes wrong.
 		size_t num_iter = num_segments * 16;
+		//BBS: see chain_segments_greedy_constrained_reversals_: rebuild the KD tree from the
+		// still connectable end points once half of its population became interior to a chain,
+		// otherwise the filtered searches degrade towards linear scans on large plates.
+		size_t tree_population = end_points.size();
+		size_t num_connected   = 0;
+		bool   tree_rebuilt    = false;
 		for (size_t num_connections_to_end = num_segments - 1; num_iter > 0; -- num_iter) {
 			assert(validate_graph_and_queue());
+			if (num_connected >= std::max(tree_population / 2, size_t(512))) {
+				std::vector<size_t> remaining;
+				remaining.reserve(end_points.size());
+				for (size_t i = 0; i < end_points.size(); ++ i)
+					if (end_points[i].chain_id == 0 || end_points[i ^ 1].chain_id == 0)
+						remaining.emplace_back(i);
+				tree_population = remaining.size();
+				num_connected   = 0;
+				tree_rebuilt    = true;
+				kdtree.build(remaining);
+			}
 	    	// Take the first end point, for which the link points to the currently closest valid neighbor.
 	    	EndPoint *end_point1       = queue.top();
 	    	assert(end_point1 != first_point);
@@ -819,6 +875,7 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 		    	// Remove the first and second point from the queue.
 				queue.pop();
 		    	queue.remove(end_point2->heap_idx);
+				num_connected += 2;
 		    	assert(end_point1->edge_candidate == end_point2);
 		    	end_point1->edge_candidate = nullptr;
 		    	Chain *chain1 = (end_point1_chain_id == 0) ? nullptr : &chains.chain(end_point1_chain_id);
@@ -960,9 +1017,13 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy_constrained_reversals
 					} while (first_point != nullptr);
 				}
 			}
-			if (failed)
+			if (failed) {
 				// As a last resort, try a dumb algorithm, which is not sensitive to edge reversal constraints.
+				if (tree_rebuilt)
+					// The KD tree was rebuilt over a subset of the end points, restore the full tree.
+					kdtree.build(end_points.size());
 				out = chain_segments_closest_point<EndPoint, decltype(kdtree), CouldReverseFunc>(end_points, kdtree, could_reverse_func, (initial_point != nullptr) ? *initial_point : end_points.front());
+			}
 		} else {
 			assert(! failed);
 		}
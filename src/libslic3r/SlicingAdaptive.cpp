@@ -5,6 +5,7 @@
 
 #include <boost/log/trivial.hpp>
 #include <cfloat>
+#include <mutex>
 
 // Based on the work of Florens Waserfall (@platch on github)
 // and his paper
@@ -69,19 +70,69 @@ static inline float layer_height_from_slope(const SlicingAdaptive::FaceZ &face,
 
 void SlicingAdaptive::clear()
 {
-	m_faces.clear();
+	m_faces.reset();
 }
 
+// Single entry cache of the sorted face table of the object last processed by SlicingAdaptive::prepare().
+// The interactive layer height tool calls layer_height_profile_adaptive() repeatedly on the same geometry
+// while the user drags the quality slider, thus the table is rebuilt only if the object changed.
+namespace {
+	struct FaceZTableCacheKey {
+		// ObjectID of the ModelObject.
+		size_t									object_id = 0;
+		// World transformation of the first instance including its mirroring.
+		Transform3d								instance_matrix = Transform3d::Identity();
+		// Shared mesh pointer and volume transformation of each MODEL_PART volume.
+		std::vector<std::pair<const TriangleMesh*, Transform3d>> volumes;
+
+		bool operator==(const FaceZTableCacheKey &rhs) const {
+			if (object_id != rhs.object_id || instance_matrix.matrix() != rhs.instance_matrix.matrix() ||
+				volumes.size() != rhs.volumes.size())
+				return false;
+			for (size_t i = 0; i < volumes.size(); ++ i)
+				if (volumes[i].first != rhs.volumes[i].first || volumes[i].second.matrix() != rhs.volumes[i].second.matrix())
+					return false;
+			return true;
+		}
+	};
+
+	static std::mutex										   s_face_z_table_cache_mutex;
+	static FaceZTableCacheKey								   s_face_z_table_cache_key;
+	static std::shared_ptr<const std::vector<SlicingAdaptive::FaceZ>> s_face_z_table_cache;
+
+	static FaceZTableCacheKey face_z_table_cache_key(const ModelObject &object)
+	{
+		FaceZTableCacheKey key;
+		key.object_id		= object.id().id;
+		key.instance_matrix = object.instances.front()->get_matrix();
+		key.volumes.reserve(object.volumes.size());
+		for (const ModelVolume *v : object.volumes)
+			if (v->is_model_part())
+				key.volumes.emplace_back(v->mesh_ptr().get(), v->get_matrix());
+		return key;
+	}
+} // namespace
+
 void SlicingAdaptive::prepare(const ModelObject &object)
 {
     this->clear();
 
+	FaceZTableCacheKey key = face_z_table_cache_key(object);
+	{
+		std::lock_guard<std::mutex> lock(s_face_z_table_cache_mutex);
+		if (s_face_z_table_cache && s_face_z_table_cache_key == key) {
+			m_faces = s_face_z_table_cache;
+			return;
+		}
+	}
+
     TriangleMesh		 mesh			= object.raw_mesh();
     const ModelInstance &first_instance = *object.instances.front();
     mesh.transform(first_instance.get_matrix(), first_instance.is_left_handed());
 
     // 1) Collect faces from mesh.
-    m_faces.reserve(mesh.facets_count());
+	auto faces = std::make_shared<std::vector<FaceZ>>();
+	faces->reserve(mesh.facets_count());
 	for (stl_triangle_vertex_indices face : mesh.its.indices) {
 		stl_vertex vertex[3] = { mesh.its.vertices[face[0]], mesh.its.vertices[face[1]], mesh.its.vertices[face[2]] };
 		stl_vertex n         = face_normal_normalized(vertex);
@@ -89,11 +140,18 @@ void SlicingAdaptive::prepare(const ModelObject &object)
 			std::min(std::min(vertex[0].z(), vertex[1].z()), vertex[2].z()),
 			std::max(std::max(vertex[0].z(), vertex[1].z()), vertex[2].z())
 		};
-		m_faces.emplace_back(FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) }));
+		faces->emplace_back(FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) }));
     }
 
 	// 2) Sort faces lexicographically by their Z span.
-	std::sort(m_faces.begin(), m_faces.end(), [](const FaceZ &f1, const FaceZ &f2) { return f1.z_span < f2.z_span; });
+	std::sort(faces->begin(), faces->end(), [](const FaceZ &f1, const FaceZ &f2) { return f1.z_span < f2.z_span; });
+
+	m_faces = faces;
+	{
+		std::lock_guard<std::mutex> lock(s_face_z_table_cache_mutex);
+		s_face_z_table_cache_key = std::move(key);
+		s_face_z_table_cache	 = m_faces;
+	}
 }
 
 // current_facet is in/out parameter, rememebers the index of the last face of m_faces visited, 
@@ -124,11 +182,12 @@ float SlicingAdaptive::next_layer_height(const float print_z, float quality_fact
 	}
 	
 	// find all facets intersecting the slice-layer
+	const std::vector<FaceZ> &faces = *m_faces;
 	size_t ordered_id = current_facet;
 	{
 		bool first_hit = false;
-		for (; ordered_id < m_faces.size(); ++ ordered_id) {
-	        const std::pair<float, float> &zspan = m_faces[ordered_id].z_span;
+		for (; ordered_id < faces.size(); ++ ordered_id) {
+	        const std::pair<float, float> &zspan = faces[ordered_id].z_span;
 	        // facet's minimum is higher than slice_z -> end loop
 			if (zspan.first >= print_z)
 				break;
@@ -143,7 +202,7 @@ float SlicingAdaptive::next_layer_height(const float print_z, float quality_fact
 				if (zspan.second < print_z + EPSILON)
 					continue;
 				// compute cusp-height for this facet and store minimum of all heights
-				height = std::min(height, layer_height_from_slope(m_faces[ordered_id], max_surface_deviation));
+				height = std::min(height, layer_height_from_slope(faces[ordered_id], max_surface_deviation));
 	        }
 		}
 	}
@@ -153,8 +212,8 @@ float SlicingAdaptive::next_layer_height(const float print_z, float quality_fact
 
 	// check for sloped facets inside the determined layer and correct height if necessary
 	if (height > float(m_slicing_params.min_layer_height)) {
-		for (; ordered_id < m_faces.size(); ++ ordered_id) {
-            const std::pair<float, float> &zspan = m_faces[ordered_id].z_span;
+		for (; ordered_id < faces.size(); ++ ordered_id) {
+            const std::pair<float, float> &zspan = faces[ordered_id].z_span;
             // facet's minimum is higher than slice_z + height -> end loop
 			if (zspan.first >= print_z + height)
 				break;
@@ -164,7 +223,7 @@ float SlicingAdaptive::next_layer_height(const float print_z, float quality_fact
 				continue;
 
 			// Compute cusp-height for this facet and check against height.
-            float reduced_height = layer_height_from_slope(m_faces[ordered_id], max_surface_deviation);
+            float reduced_height = layer_height_from_slope(faces[ordered_id], max_surface_deviation);
 
 			float z_diff = zspan.first - print_z;
 			if (reduced_height < z_diff) {
@@ -198,8 +257,9 @@ float SlicingAdaptive::next_layer_height(const float print_z, float quality_fact
 // to consider horizontal object features in slice thickness
 float SlicingAdaptive::horizontal_facet_distance(float z)
 {
-	for (size_t i = 0; i < m_faces.size(); ++ i) {
-        std::pair<float, float> zspan = m_faces[i].z_span;
+	const std::vector<FaceZ> &faces = *m_faces;
+	for (size_t i = 0; i < faces.size(); ++ i) {
+        std::pair<float, float> zspan = faces[i].z_span;
         // facet's minimum is higher than max forward distance -> end loop
 		if (zspan.first > z + m_slicing_params.max_layer_height)
 			break;
@@ -6,6 +6,8 @@
 #include "Slicing.hpp"
 #include "admesh/stl.h"
 
+#include <memory>
+
 namespace Slic3r
 {
 
@@ -34,7 +36,10 @@ public:
 protected:
 	SlicingParameters 		m_slicing_params;
 
-	std::vector<FaceZ>		m_faces;
+	// Sorted table of the object's facets, shared with a global single entry cache,
+	// so that repeated invocations on an unchanged object (the interactive layer height tool)
+	// don't pay for the mesh merge, normal computation and sort again.
+	std::shared_ptr<const std::vector<FaceZ>> m_faces;
 };
 
 }; // namespace Slic3r
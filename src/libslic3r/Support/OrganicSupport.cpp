@@ -308,12 +308,16 @@ void trim_influence_areas_bottom_up(Forest &forest, const float dxy_dlayer)
         }
     };
 
-    for (Tree &tree : forest) {
-        Branch      &root = tree.root();
-        const float  r0   = root.path.back().radius;
-        for (Bifurcation &up : root.up)
-            Trimmer::trim_recursive(*up.branch, r0 - up.branch->path.front().radius, dxy_dlayer);
-    }
+    // The trimming only touches influence areas of a single tree, process the trees in parallel.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, forest.size()),
+        [&forest, dxy_dlayer](const tbb::blocked_range<size_t> &range) {
+            for (size_t tree_idx = range.begin(); tree_idx < range.end(); ++ tree_idx) {
+                Branch      &root = forest[tree_idx].root();
+                const float  r0   = root.path.back().radius;
+                for (Bifurcation &up : root.up)
+                    Trimmer::trim_recursive(*up.branch, r0 - up.branch->path.front().radius, dxy_dlayer);
+            }
+        });
 }
 
 // Straighten up and smooth centerlines inside their influence areas.
@@ -451,9 +455,13 @@ void smooth_trees_inside_influence_areas(Branch &root, bool is_root)
 
 void smooth_trees_inside_influence_areas(Forest &forest)
 {
-    // Parallel for!
-    for (Tree &tree : forest)
-        smooth_trees_inside_influence_areas(tree.root(), true);
+    // Trees are separate connected components with their merge topology fixed by now,
+    // thus each tree may be relaxed independently.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, forest.size()),
+        [&forest](const tbb::blocked_range<size_t> &range) {
+            for (size_t tree_idx = range.begin(); tree_idx < range.end(); ++ tree_idx)
+                smooth_trees_inside_influence_areas(forest[tree_idx].root(), true);
+        });
 }
 
 #if 0
@@ -24,6 +24,7 @@
 #include <boost/container/static_vector.hpp>
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
 #include <tbb/task_group.h>
 
 #define SUPPORT_USE_AGG_RASTERIZER
@@ -316,26 +317,35 @@ void PrintObjectSupportMaterial::generate(PrintObject &object)
             union_ex(layer->polygons));
 #endif
 
-    BOOST_LOG_TRIVIAL(info) << "Support generator - Creating base layers";
+    BOOST_LOG_TRIVIAL(info) << "Support generator - Creating base layers, trimming top contacts by bottom contacts";
 
-    // Fill in intermediate layers between the top / bottom support contact layers, trim them by the object.
-    this->generate_base_layers(object, bottom_contacts, top_contacts, intermediate_layers, layer_support_areas);
+    // Because the top and bottom contacts are thick slabs, they may overlap causing over extrusion
+    // and unwanted strong bonds to the object.
+    // Rather trim the top contacts by their overlapping bottom contacts to leave a gap instead of over extruding
+    // top contacts over the bottom contacts.
+    // The trimming is independent of the intermediate layers, while generate_base_layers() reads the
+    // untrimmed top contact polygons, therefore the trimming is calculated into a side buffer overlapped
+    // with the base layer generation and committed once both finish.
+    std::vector<std::optional<Polygons>> top_contacts_trimmed;
+    tbb::parallel_invoke(
+        [this, &object, &bottom_contacts, &top_contacts, &intermediate_layers, &layer_support_areas] {
+            // Fill in intermediate layers between the top / bottom support contact layers, trim them by the object.
+            this->generate_base_layers(object, bottom_contacts, top_contacts, intermediate_layers, layer_support_areas);
+        },
+        [this, &object, &bottom_contacts, &top_contacts, &top_contacts_trimmed] {
+            top_contacts_trimmed = this->trim_top_contacts_by_bottom_contacts(object, bottom_contacts, top_contacts);
+        });
+    for (size_t idx_top = 0; idx_top < top_contacts.size(); ++ idx_top)
+        if (std::optional<Polygons> &trimmed = top_contacts_trimmed[idx_top]; trimmed)
+            top_contacts[idx_top]->polygons = std::move(*trimmed);
 
 #ifdef SLIC3R_DEBUG
     for (SupportGeneratorLayersPtr::const_iterator it = intermediate_layers.begin(); it != intermediate_layers.end(); ++ it)
         Slic3r::SVG::export_expolygons(
-            debug_out_path("support-base-layers-%d-%lf.svg", iRun, (*it)->print_z), 
+            debug_out_path("support-base-layers-%d-%lf.svg", iRun, (*it)->print_z),
             union_ex((*it)->polygons));
 #endif /* SLIC3R_DEBUG */
 
-    BOOST_LOG_TRIVIAL(info) << "Support generator - Trimming top contacts by bottom contacts";
-
-    // Because the top and bottom contacts are thick slabs, they may overlap causing over extrusion 
-    // and unwanted strong bonds to the object.
-    // Rather trim the top contacts by their overlapping bottom contacts to leave a gap instead of over extruding
-    // top contacts over the bottom contacts.
-    this->trim_top_contacts_by_bottom_contacts(object, bottom_contacts, top_contacts);
-
 
     BOOST_LOG_TRIVIAL(info) << "Support generator - Creating interfaces";
 
@@ -1217,9 +1227,15 @@ static inline std::tuple<Polygons, Polygons, Polygons, float> detect_overhangs(
             // Overhang polygons for this layer and region.
             Polygons diff_polygons;
             Polygons layerm_polygons = to_polygons(layerm->slices.surfaces);
+            // The overhang diffs below only depend on the lower layer within reach of this region,
+            // thus clip the lower layer polygons to the region bounding box inflated by the offset
+            // applied before diffing. On high poly count models the lower layer spans the whole
+            // object while a single region may cover a tiny fraction of it.
+            const Polygons lower_layer_polygons_clipped = ClipperUtils::clip_clipper_polygons_with_subject_bbox(
+                lower_layer_polygons, get_extents(layerm_polygons).inflated(coord_t(lower_layer_offset) + SCALED_EPSILON));
             if (lower_layer_offset == 0.f) {
                 // Support everything.
-                diff_polygons = diff(layerm_polygons, lower_layer_polygons);
+                diff_polygons = diff(layerm_polygons, lower_layer_polygons_clipped);
                 if (buildplate_only) {
                     // Don't support overhangs above the top surfaces.
                     // This step is done before the contact surface is calculated by growing the overhang region.
@@ -1241,9 +1257,9 @@ static inline std::tuple<Polygons, Polygons, Polygons, float> detect_overhangs(
                     // no support at all for not so steep overhangs.
                     0.1f * fw);
 #else
-                diff_polygons = 
+                diff_polygons =
                     diff(layerm_polygons,
-                            expand(lower_layer_polygons, lower_layer_offset, SUPPORT_SURFACES_OFFSET_PARAMETERS));
+                            expand(lower_layer_polygons_clipped, lower_layer_offset, SUPPORT_SURFACES_OFFSET_PARAMETERS));
 #endif
                 if (buildplate_only && ! annotations.buildplate_covered[layer_id].empty()) {
                     // Don't support overhangs above the top surfaces.
@@ -1256,7 +1272,7 @@ static inline std::tuple<Polygons, Polygons, Polygons, float> detect_overhangs(
                     // propagating these contact surfaces downwards.
                     diff_polygons = diff(
                         intersection(expand(diff_polygons, lower_layer_offset, SUPPORT_SURFACES_OFFSET_PARAMETERS), layerm_polygons),
-                        lower_layer_polygons);
+                        lower_layer_polygons_clipped);
                 }
                 //FIXME add user defined filtering here based on minimal area or minimum radius or whatever.
             }
@@ -2087,15 +2103,21 @@ SupportGeneratorLayersPtr PrintObjectSupportMaterial::bottom_contact_layers_and_
 }
 
 // Trim the top_contacts layers with the bottom_contacts layers if they overlap, so there would not be enough vertical space for both of them.
-void PrintObjectSupportMaterial::trim_top_contacts_by_bottom_contacts(
-    const PrintObject &object, const SupportGeneratorLayersPtr &bottom_contacts, SupportGeneratorLayersPtr &top_contacts) const
+// The trimmed polygons are collected into the returned buffer instead of being stored into the top contact
+// layers directly, so that this trimming may run concurrently with generate_base_layers(), which reads
+// the untrimmed top contact polygons. The caller commits the buffer once both phases are finished.
+// Entries with an invalid (null) polygon set mark the top contact layers that were not trimmed at all.
+std::vector<std::optional<Polygons>> PrintObjectSupportMaterial::trim_top_contacts_by_bottom_contacts(
+    const PrintObject &object, const SupportGeneratorLayersPtr &bottom_contacts, const SupportGeneratorLayersPtr &top_contacts) const
 {
+    std::vector<std::optional<Polygons>> trimmed(top_contacts.size());
     tbb::parallel_for(tbb::blocked_range<int>(0, int(top_contacts.size())),
-        [&bottom_contacts, &top_contacts](const tbb::blocked_range<int>& range) {
+        [&bottom_contacts, &top_contacts, &trimmed](const tbb::blocked_range<int>& range) {
             int idx_bottom_overlapping_first = -2;
             // For all top contact layers, counting downwards due to the way idx_higher_or_equal caches the last index to avoid repeated binary search.
             for (int idx_top = range.end() - 1; idx_top >= range.begin(); -- idx_top) {
-                SupportGeneratorLayer &layer_top = *top_contacts[idx_top];
+                const SupportGeneratorLayer &layer_top = *top_contacts[idx_top];
+                std::optional<Polygons> &polygons_trimmed = trimmed[idx_top];
                 // Find the first bottom layer overlapping with layer_top.
                 idx_bottom_overlapping_first = idx_lower_or_equal(bottom_contacts, idx_bottom_overlapping_first, [&layer_top](const SupportGeneratorLayer *layer_bottom){ return layer_bottom->bottom_print_z() - EPSILON <= layer_top.bottom_z; });
                 // For all top contact layers overlapping with the thick bottom contact layer:
@@ -2104,12 +2126,13 @@ void PrintObjectSupportMaterial::trim_top_contacts_by_bottom_contacts(
                     assert(layer_bottom.bottom_print_z() - EPSILON <= layer_top.bottom_z);
                     if (layer_top.print_z < layer_bottom.print_z + EPSILON) {
                         // Layers overlap. Trim layer_top with layer_bottom.
-                        layer_top.polygons = diff(layer_top.polygons, layer_bottom.polygons);
+                        polygons_trimmed = diff(polygons_trimmed ? *polygons_trimmed : layer_top.polygons, layer_bottom.polygons);
                     } else
                         break;
                 }
             }
         });
+    return trimmed;
 }
 
 SupportGeneratorLayersPtr PrintObjectSupportMaterial::raft_and_intermediate_support_layers(
@@ -6,6 +6,8 @@
 #ifndef slic3r_SupportMaterial_hpp_
 #define slic3r_SupportMaterial_hpp_
 
+#include <optional>
+
 #include "../Flow.hpp"
 #include "../PrintConfig.hpp"
 #include "../Slicing.hpp"
@@ -60,7 +62,9 @@ private:
 		SupportGeneratorLayerStorage &layer_storage, std::vector<Polygons> &layer_support_areas) const;
 
 	// Trim the top_contacts layers with the bottom_contacts layers if they overlap, so there would not be enough vertical space for both of them.
-	void trim_top_contacts_by_bottom_contacts(const PrintObject &object, const SupportGeneratorLayersPtr &bottom_contacts, SupportGeneratorLayersPtr &top_contacts) const;
+	// Returns the trimmed polygons per top contact layer (no value for the layers that were not trimmed),
+	// so that the trimming may be overlapped with generate_base_layers() reading the untrimmed polygons.
+	std::vector<std::optional<Polygons>> trim_top_contacts_by_bottom_contacts(const PrintObject &object, const SupportGeneratorLayersPtr &bottom_contacts, const SupportGeneratorLayersPtr &top_contacts) const;
 
 	// Generate raft layers and the intermediate support layers between the bottom contact and top contact surfaces.
 	SupportGeneratorLayersPtr raft_and_intermediate_support_layers(
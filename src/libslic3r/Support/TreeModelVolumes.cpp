@@ -680,11 +680,17 @@ void TreeModelVolumes::calculateAvoidance(const std::vector<RadiusLayerPair> &ke
                 // Merge current layer collisions with shrunk last_avoidance.
                 const Polygons &current_layer_collisions = collision_holefree ? getCollisionHolefree(task.radius, layer_idx) : getCollision(task.radius, layer_idx, true);
                 // For mildly steep branch angles only one step will be taken.
-                for (int istep = 0; istep < move_steps; ++ istep)
+                for (int istep = 0; istep < move_steps; ++ istep) {
+                    if (latest_avoidance == current_layer_collisions)
+                        // The avoidance collapsed onto the collision area. Shrinking a region and
+                        // unioning it with itself is an identity, so the remaining steps (and the
+                        // steps of the following layers with identical collisions) are free.
+                        break;
                     latest_avoidance = union_(current_layer_collisions,
                         offset(latest_avoidance,
                             istep + 1 == move_steps ? - last_move_step : - move_step,
                             ClipperLib::jtRound, m_min_resolution));
+                }
                 if (task.to_model)
                     latest_avoidance = diff(latest_avoidance, getPlaceableAreas(task.radius, layer_idx, throw_on_cancel));
                 latest_avoidance = polygons_simplify(latest_avoidance, m_min_resolution, polygons_strictly_simple);
@@ -145,19 +145,54 @@ float estimate_curled_up_height(
 
 void estimate_malformations(LayerPtrs &layers, const Params &params)
 {
+    //BBS: the estimation is inherently serial across layers, each layer reads the curled
+    // heights computed for the previous one. The lower layer boundary trees only depend on
+    // the slices though, so build them ahead of the serial pass in parallel. Chunked, so
+    // that tall prints do not hold the trees of thousands of layers in memory at once.
+    constexpr size_t boundary_chunk_size = 64;
+    std::vector<AABBTreeLines::LinesDistancer<Linef>> lower_boundaries(std::min(boundary_chunk_size, layers.size()));
+
 	LD prev_layer_lines{};
-	for (Layer *l : layers) {
+	for (size_t layer_idx = 0; layer_idx < layers.size(); ++ layer_idx) {
+        if (layer_idx % boundary_chunk_size == 0) {
+            size_t chunk_end = std::min(layer_idx + boundary_chunk_size, layers.size());
+            tbb::parallel_for(tbb::blocked_range<size_t>(layer_idx, chunk_end),
+                [&layers, &lower_boundaries, layer_idx](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i < range.end(); ++ i)
+                        lower_boundaries[i - layer_idx] = layers[i]->lower_layer != nullptr ?
+                            AABBTreeLines::LinesDistancer<Linef>{to_unscaled_linesf(layers[i]->lower_layer->lslices)} :
+                            AABBTreeLines::LinesDistancer<Linef>{};
+                });
+        }
+        Layer *l = layers[layer_idx];
         l->curled_lines.clear();
-        std::vector<Linef> boundary_lines = l->lower_layer != nullptr ? to_unscaled_linesf(l->lower_layer->lslices) : std::vector<Linef>();
-        AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary{std::move(boundary_lines)};
+        const AABBTreeLines::LinesDistancer<Linef> &prev_layer_boundary = lower_boundaries[layer_idx % boundary_chunk_size];
         std::vector<ExtrusionLine>           current_layer_lines;
+        //BBS: the external perimeters of this layer only query the read-only trees of the
+        // previous layer, process them in parallel and merge the per extrusion results in
+        // the original order to keep the output deterministic.
+        struct ExtrusionJob {
+            const LayerRegion     *layer_region;
+            const ExtrusionEntity *extrusion;
+        };
+        std::vector<ExtrusionJob> jobs;
+        // Keeps the flattened clones alive over the parallel loop below.
+        std::vector<ExtrusionEntityCollection> flattened_perimeters;
+        flattened_perimeters.reserve(l->regions().size());
         for (const LayerRegion *layer_region : l->regions()) {
-			for (const ExtrusionEntity *extrusion : layer_region->perimeters.flatten().entities) {
-			    if (extrusion->role() != Slic3r::erExternalPerimeter)
-                    continue;
+            flattened_perimeters.emplace_back(layer_region->perimeters.flatten());
+            for (const ExtrusionEntity *extrusion : flattened_perimeters.back().entities)
+                if (extrusion->role() == Slic3r::erExternalPerimeter)
+                    jobs.push_back({layer_region, extrusion});
+        }
+        std::vector<std::vector<ExtrusionLine>> lines_per_extrusion(jobs.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, jobs.size()),
+            [&jobs, &lines_per_extrusion, &prev_layer_lines, &prev_layer_boundary, &params, l](const tbb::blocked_range<size_t> &range) {
+            for (size_t job_idx = range.begin(); job_idx < range.end(); ++ job_idx) {
+                const ExtrusionEntity *extrusion = jobs[job_idx].extrusion;
 				Points extrusion_pts;
                 extrusion->collect_points(extrusion_pts);
-				float flow_width       = get_flow_width(layer_region, extrusion->role());
+				float flow_width       = get_flow_width(jobs[job_idx].layer_region, extrusion->role());
 				auto  annotated_points = estimate_points_properties<true, true, false, false>(extrusion_pts, prev_layer_lines, flow_width,
                                                                                              params.bridge_distance);
                 for (size_t i = 0; i < annotated_points.size(); ++i) {
@@ -176,16 +211,18 @@ void estimate_malformations(LayerPtrs &layers, const Params &params)
                     line_out.curled_up_height = estimate_curled_up_height(middle_distance * sign, 0.5 * (a.curvature + b.curvature),
                                                                           l->height, flow_width, bottom_line.curled_up_height, params);
 
-                    current_layer_lines.push_back(line_out);
+                    lines_per_extrusion[job_idx].push_back(line_out);
                 }
 			}
-        }
+        });
+        for (std::vector<ExtrusionLine> &lines : lines_per_extrusion)
+            append(current_layer_lines, std::move(lines));
         for (const ExtrusionLine &line : current_layer_lines) {
             if (line.curled_up_height > params.curling_tolerance_limit) {
                 l->curled_lines.push_back(CurledLine{Point::new_scale(line.a), Point::new_scale(line.b), line.curled_up_height});
             }
         }
-        
+
         prev_layer_lines = LD{current_layer_lines};
     }
 }
@@ -31,47 +31,56 @@ enum SurfaceType {
 class Surface
 {
 public:
-    SurfaceType     surface_type;
+    // Members are ordered by decreasing alignment to pack the struct tightly: surfaces are stored
+    // by value in vectors and walked by nearly every slicing stage, a smaller stride keeps more of
+    // them in a cache line.
     ExPolygon       expolygon;
     double          thickness;          // in mm
-    unsigned short  thickness_layers;   // in layers
     double          bridge_angle;       // in radians, ccw, 0 = East, only 0+ (negative means undefined)
+    SurfaceType     surface_type;
+    unsigned short  thickness_layers;   // in layers
     unsigned short  extra_perimeters;
 
     Surface(SurfaceType _surface_type = stInternal)
-        : surface_type(_surface_type),
-            thickness(-1), thickness_layers(1), bridge_angle(-1), extra_perimeters(0)
+        : thickness(-1), bridge_angle(-1), surface_type(_surface_type),
+            thickness_layers(1), extra_perimeters(0)
         {};
     Surface(const Slic3r::Surface &rhs)
-        : surface_type(rhs.surface_type), expolygon(rhs.expolygon),
-            thickness(rhs.thickness), thickness_layers(rhs.thickness_layers),
-            bridge_angle(rhs.bridge_angle), extra_perimeters(rhs.extra_perimeters)
+        : expolygon(rhs.expolygon), thickness(rhs.thickness),
+            bridge_angle(rhs.bridge_angle), surface_type(rhs.surface_type),
+            thickness_layers(rhs.thickness_layers), extra_perimeters(rhs.extra_perimeters)
         {};
 
     Surface(SurfaceType _surface_type, const ExPolygon &_expolygon)
-        : surface_type(_surface_type), expolygon(_expolygon),
-            thickness(-1), thickness_layers(1), bridge_angle(-1), extra_perimeters(0)
+        : expolygon(_expolygon), thickness(-1), bridge_angle(-1),
+            surface_type(_surface_type), thickness_layers(1), extra_perimeters(0)
         {};
     Surface(const Surface &other, const ExPolygon &_expolygon)
-        : surface_type(other.surface_type), expolygon(_expolygon),
-            thickness(other.thickness), thickness_layers(other.thickness_layers),
-            bridge_angle(other.bridge_angle), extra_perimeters(other.extra_perimeters)
+        : expolygon(_expolygon), thickness(other.thickness),
+            bridge_angle(other.bridge_angle), surface_type(other.surface_type),
+            thickness_layers(other.thickness_layers), extra_perimeters(other.extra_perimeters)
         {};
-    Surface(Surface &&rhs)
-        : surface_type(rhs.surface_type), expolygon(std::move(rhs.expolygon)),
-            thickness(rhs.thickness), thickness_layers(rhs.thickness_layers),
-            bridge_angle(rhs.bridge_angle), extra_perimeters(rhs.extra_perimeters)
+    Surface(Surface &&rhs) noexcept
+        : expolygon(std::move(rhs.expolygon)), thickness(rhs.thickness),
+            bridge_angle(rhs.bridge_angle), surface_type(rhs.surface_type),
+            thickness_layers(rhs.thickness_layers), extra_perimeters(rhs.extra_perimeters)
         {};
-    Surface(SurfaceType _surface_type, const ExPolygon &&_expolygon)
-        : surface_type(_surface_type), expolygon(std::move(_expolygon)),
-            thickness(-1), thickness_layers(1), bridge_angle(-1), extra_perimeters(0)
+    // Rvalue overloads take a mutable rvalue reference: moving from a const rvalue silently
+    // degrades to a deep copy of all the contours.
+    Surface(SurfaceType _surface_type, ExPolygon &&_expolygon)
+        : expolygon(std::move(_expolygon)), thickness(-1), bridge_angle(-1),
+            surface_type(_surface_type), thickness_layers(1), extra_perimeters(0)
         {};
-    Surface(const Surface &other, const ExPolygon &&_expolygon)
-        : surface_type(other.surface_type), expolygon(std::move(_expolygon)),
-            thickness(other.thickness), thickness_layers(other.thickness_layers),
-            bridge_angle(other.bridge_angle), extra_perimeters(other.extra_perimeters)
+    Surface(const Surface &other, ExPolygon &&_expolygon)
+        : expolygon(std::move(_expolygon)), thickness(other.thickness),
+            bridge_angle(other.bridge_angle), surface_type(other.surface_type),
+            thickness_layers(other.thickness_layers), extra_perimeters(other.extra_perimeters)
         {};
 
+    // Serialization through the Cereal library, used by the slicing checkpoints.
+    template<class Archive> void serialize(Archive &archive)
+        { archive(this->surface_type, this->expolygon, this->thickness, this->thickness_layers, this->bridge_angle, this->extra_perimeters); }
+
     Surface& operator=(const Surface &rhs)
     {
         surface_type     = rhs.surface_type;
@@ -83,7 +92,7 @@ public:
         return *this;
     }
 
-    Surface& operator=(Surface &&rhs)
+    Surface& operator=(Surface &&rhs) noexcept
     {
         surface_type     = rhs.surface_type;
         expolygon        = std::move(rhs.expolygon);
@@ -165,8 +174,9 @@ inline ExPolygons to_expolygons(Surfaces &&src)
 {
 	ExPolygons expolygons;
 	expolygons.reserve(src.size());
-	for (Surfaces::const_iterator it = src.begin(); it != src.end(); ++it)
-		expolygons.emplace_back(ExPolygon(std::move(it->expolygon)));
+	// Iterate with a mutable iterator: moving through a const_iterator degrades to a deep copy.
+	for (Surfaces::iterator it = src.begin(); it != src.end(); ++it)
+		expolygons.emplace_back(std::move(it->expolygon));
 	src.clear();
 	return expolygons;
 }
@@ -248,7 +258,8 @@ inline void surfaces_append(Surfaces &dst, const ExPolygons &src, SurfaceType su
 }
 inline void surfaces_append(Surfaces &dst, const ExPolygons &src, const Surface &surfaceTempl)
 {
-    dst.reserve(dst.size() + number_polygons(src));
+    // One surface per expolygon, reserving number_polygons(src) would overallocate by the holes.
+    dst.reserve(dst.size() + src.size());
     for (const ExPolygon &expoly : src)
         dst.emplace_back(Surface(surfaceTempl, expoly));
 }
@@ -267,9 +278,10 @@ inline void surfaces_append(Surfaces &dst, ExPolygons &&src, SurfaceType surface
 
 inline void surfaces_append(Surfaces &dst, ExPolygons &&src, const Surface &surfaceTempl)
 {
-    dst.reserve(dst.size() + number_polygons(src));
-    for (ExPolygons::const_iterator it = src.begin(); it != src.end(); ++ it)
-        dst.emplace_back(Surface(surfaceTempl, std::move(*it)));
+    // One surface per expolygon, reserving number_polygons(src) would overallocate by the holes.
+    dst.reserve(dst.size() + src.size());
+    for (ExPolygon &expoly : src)
+        dst.emplace_back(Surface(surfaceTempl, std::move(expoly)));
     src.clear();
 }
 
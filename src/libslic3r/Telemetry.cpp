@@ -0,0 +1,88 @@
+#include "Telemetry.hpp"
+
+#include "Config.hpp"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+
+namespace Slic3r {
+
+static std::mutex  g_telemetry_mutex;
+static std::string g_telemetry_path;
+static size_t      g_telemetry_max_records = 0;
+static size_t      g_telemetry_num_records = 0;
+
+void telemetry_set_log(const std::string &path, size_t max_records)
+{
+    std::scoped_lock<std::mutex> lock(g_telemetry_mutex);
+    g_telemetry_path        = path;
+    g_telemetry_max_records = max_records;
+    g_telemetry_num_records = 0;
+    if (! path.empty()) {
+        // Continue a pre-existing log where it left off, so a scraper sees one growing file.
+        boost::nowide::ifstream ifs(path);
+        std::string line;
+        while (std::getline(ifs, line))
+            ++ g_telemetry_num_records;
+    }
+}
+
+const std::string& telemetry_log_path()
+{
+    return g_telemetry_path;
+}
+
+double telemetry_now_seconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint64_t telemetry_config_fingerprint(const ConfigBase &config)
+{
+    // FNV-1a over the serialized key / value pairs. keys() is sorted, the fingerprint is
+    // stable across processes and builds as long as the configuration values are.
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto mix = [&hash](const std::string &data) {
+        for (const char c : data) {
+            hash ^= uint64_t((unsigned char)c);
+            hash *= 0x100000001b3ULL;
+        }
+    };
+    for (const std::string &key : config.keys()) {
+        mix(key);
+        mix(config.opt_serialize(key));
+    }
+    return hash;
+}
+
+void telemetry_record_step(const char *step_kind, int step, double duration_seconds, int64_t memory_delta, uint64_t config_fingerprint)
+{
+    std::scoped_lock<std::mutex> lock(g_telemetry_mutex);
+    if (g_telemetry_path.empty())
+        return;
+    boost::system::error_code ec;
+    if (g_telemetry_num_records >= g_telemetry_max_records) {
+        // Ring buffer semantics: rotate the full log away, at most one old generation is kept.
+        boost::filesystem::rename(g_telemetry_path, g_telemetry_path + ".1", ec);
+        g_telemetry_num_records = 0;
+    }
+    char line[256];
+    snprintf(line, sizeof(line),
+        "{\"schema\":1,\"ts\":%lld,\"kind\":\"%s\",\"step\":%d,\"duration_ms\":%.3f,\"rss_delta\":%" PRId64 ",\"config\":\"%016" PRIx64 "\"}\n",
+        (long long)std::time(nullptr), step_kind, step, duration_seconds * 1000., memory_delta, config_fingerprint);
+    boost::nowide::ofstream ofs(g_telemetry_path, std::ios::app);
+    if (ofs) {
+        ofs << line;
+        ++ g_telemetry_num_records;
+    } else
+        BOOST_LOG_TRIVIAL(error) << "telemetry log " << g_telemetry_path << " is not writable, record dropped";
+}
+
+} // namespace Slic3r
@@ -0,0 +1,38 @@
+#ifndef slic3r_Telemetry_hpp_
+#define slic3r_Telemetry_hpp_
+
+#include <cstdint>
+#include <string>
+
+namespace Slic3r {
+
+class ConfigBase;
+
+// Opt-in local performance telemetry (--telemetry-log).
+// Every finished Print / PrintObject step appends one JSON line to the log file:
+//   {"schema":1,"ts":<unix seconds>,"kind":"print step"|"object step","step":<step enum value>,
+//    "duration_ms":<wall clock>,"rss_delta":<bytes, negative when the step released memory>,
+//    "config":"<16 hex digits>"}
+// "config" is a one way fingerprint of the full print configuration, so fleet tooling can
+// correlate pathological stage timings with settings combinations without the settings
+// themselves ever leaving the machine. The log acts as a ring buffer: when it grows past the
+// record limit it is rotated once to "<path>.1", thus a scraper finds at most two generations.
+// The schema version is bumped whenever a field changes meaning; fields are only ever added.
+
+// Enable the telemetry log at the given path, empty path (the default) disables it.
+void               telemetry_set_log(const std::string &path, size_t max_records = 10000);
+const std::string& telemetry_log_path();
+
+// Monotonic wall clock in seconds, used to time the processing steps.
+double             telemetry_now_seconds();
+
+// One way FNV-1a fingerprint of a configuration.
+uint64_t           telemetry_config_fingerprint(const ConfigBase &config);
+
+// Append one record to the log. No-op while the log path is empty.
+void               telemetry_record_step(const char *step_kind, int step, double duration_seconds,
+                                         int64_t memory_delta, uint64_t config_fingerprint);
+
+} // namespace Slic3r
+
+#endif // slic3r_Telemetry_hpp_
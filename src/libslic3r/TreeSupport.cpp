@@ -1893,6 +1893,7 @@ void TreeSupport::generate()
 
     m_ts_data = m_object->alloc_tree_support_preview_cache();
     m_ts_data->is_slim = is_slim;
+    m_ts_data->m_canceled = [this]() { return m_object->print()->canceled(); };
 
     // Generate contact points of tree support
     profiler.stage_start(STAGE_GENERATE_CONTACT_NODES);
@@ -2675,27 +2676,6 @@ void TreeSupport::drop_nodes(std::vector<std::vector<Node*>>& contact_nodes)
         m_object->print()->set_status(60, (boost::format(_L("Support: propagate branches at layer %d")) % layer_nr).str());
 
         Polygons layer_contours = std::move(m_ts_data->get_contours_with_holes(layer_nr));
-        //std::unordered_map<Line, bool, LineHash>& mst_line_x_layer_contour_cache = m_mst_line_x_layer_contour_caches[layer_nr];
-        std::unordered_map<Line, bool, LineHash> mst_line_x_layer_contour_cache;
-        auto is_line_cut_by_contour = [&mst_line_x_layer_contour_cache,&layer_contours](Point a, Point b)
-        {
-            auto iter = mst_line_x_layer_contour_cache.find({ a, b });
-            if (iter != mst_line_x_layer_contour_cache.end()) {
-                if (iter->second)
-                    return true;
-            }
-            else {
-                profiler.tic();
-                Line ln(b, a);
-                Lines pls_intersect = intersection_ln(ln, layer_contours);
-                mst_line_x_layer_contour_cache.insert({ {a, b}, !pls_intersect.empty() });
-                mst_line_x_layer_contour_cache.insert({ ln, !pls_intersect.empty() });
-                profiler.stage_add(STAGE_intersection_ln, true);
-                if (!pls_intersect.empty())
-                    return true;
-            }
-            return false;
-        };
 
         //Group together all nodes for each part.
         const ExPolygons& parts = m_ts_data->get_avoidance(0, layer_nr);
@@ -2777,13 +2757,46 @@ void TreeSupport::drop_nodes(std::vector<std::vector<Node*>>& contact_nodes)
         coordf_t max_y = std::numeric_limits<coordf_t>::min();
         draw_layer_mst(std::to_string(ts_layer->print_z), spanning_trees, m_object->get_layer(layer_nr)->lslices);
 #endif
-        for (size_t group_index = 0; group_index < nodes_per_part.size(); group_index++)
+        // The nodes of each part have their own spanning tree and may only merge with each other,
+        // thus the parts are propagated to the next layer concurrently. Every task collects its
+        // next layer nodes and unsupported leaves locally; they are merged in part order after
+        // the join to keep the result identical to the serial propagation.
+        std::vector<std::vector<Node*>>                    nodes_per_part_next(nodes_per_part.size());
+        std::vector<std::vector<std::pair<size_t, Node*>>> unsupported_per_part(nodes_per_part.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, nodes_per_part.size(), 1),
+            [&, layer_nr, layer_nr_next, print_z_next, height_next](const tbb::blocked_range<size_t> &part_range) {
+        for (size_t group_index = part_range.begin(); group_index < part_range.end(); group_index++)
         {
             const MinimumSpanningTree& mst = spanning_trees[group_index];
+            std::vector<Node*> &next_layer_nodes = nodes_per_part_next[group_index];
+            // The spanning tree edges never connect the parts, so the line/contour intersections
+            // are cached per part.
+            std::unordered_map<Line, bool, LineHash> mst_line_x_layer_contour_cache;
+            auto is_line_cut_by_contour = [&mst_line_x_layer_contour_cache,&layer_contours](Point a, Point b)
+            {
+                auto iter = mst_line_x_layer_contour_cache.find({ a, b });
+                if (iter != mst_line_x_layer_contour_cache.end()) {
+                    if (iter->second)
+                        return true;
+                }
+                else {
+                    Line ln(b, a);
+                    Lines pls_intersect = intersection_ln(ln, layer_contours);
+                    mst_line_x_layer_contour_cache.insert({ {a, b}, !pls_intersect.empty() });
+                    mst_line_x_layer_contour_cache.insert({ ln, !pls_intersect.empty() });
+                    if (!pls_intersect.empty())
+                        return true;
+                }
+                return false;
+            };
             //In the first pass, merge all nodes that are close together.
             std::unordered_set<Node*> to_delete;
             for (const std::pair<const Point, Node*>& entry : nodes_per_part[group_index])
             {
+                // A layer may hold thousands of nodes; poll the cancel state per node to keep
+                // the cancel latency bounded (the flag is an atomic load).
+                if (m_object->print()->canceled())
+                    break;
                 Node* p_node = entry.second;
                 Node& node = *p_node;
                 if (to_delete.find(p_node) != to_delete.end())
@@ -2840,7 +2853,7 @@ void TreeSupport::drop_nodes(std::vector<std::vector<Node*>>& contact_nodes)
                     next_node->movement = next_position - node.position;
                     get_max_move_dist(next_node);
                     next_node->is_merged     = true;
-                    contact_nodes[layer_nr_next].push_back(next_node);
+                    next_layer_nodes.push_back(next_node);
 
 
                     to_delete.insert(neighbour);
@@ -2871,6 +2884,8 @@ void TreeSupport::drop_nodes(std::vector<std::vector<Node*>>& contact_nodes)
             //In the second pass, move all middle nodes.
             for (const std::pair<const Point, Node*>& entry : nodes_per_part[group_index])
             {
+                if (m_object->print()->canceled())
+                    break;
                 Node* p_node = entry.second;
                 const Node& node = *p_node;
                 if (to_delete.find(p_node) != to_delete.end())
@@ -2884,7 +2899,7 @@ void TreeSupport::drop_nodes(std::vector<std::vector<Node*>>& contact_nodes)
                                                p_node, print_z_next, height_next);
                     next_node->max_move_dist = 0;
                     next_node->is_merged     = false;
-                    contact_nodes[layer_nr_next].emplace_back(next_node);
+                    next_layer_nodes.emplace_back(next_node);
                     continue;
                 }
 
@@ -2898,7 +2913,7 @@ void TreeSupport::drop_nodes(std::vector<std::vector<Node*>>& contact_nodes)
                     {
                         if (support_on_buildplate_only)
                         {
-                            unsupported_branch_leaves.push_front({ layer_nr, p_node });
+                            unsupported_per_part[group_index].emplace_back(layer_nr, p_node);
                         }
                         else {
                             Node* pn = p_node;
@@ -3029,9 +3044,17 @@ void TreeSupport::drop_nodes(std::vector<std::vector<Node*>>& contact_nodes)
                 next_node->movement  = movement;
                 get_max_move_dist(next_node);
                 next_node->is_merged     = false;
-                contact_nodes[layer_nr_next].push_back(next_node);
+                next_layer_nodes.push_back(next_node);
             }
         }
+            });
+
+        // Merge the per-part results in part order, matching the serial propagation.
+        for (size_t group_index = 0; group_index < nodes_per_part.size(); group_index++) {
+            append(contact_nodes[layer_nr_next], std::move(nodes_per_part_next[group_index]));
+            for (const std::pair<size_t, Node*> &entry : unsupported_per_part[group_index])
+                unsupported_branch_leaves.push_front(entry);
+        }
 
 #ifdef SUPPORT_TREE_DEBUG_TO_SVG
         if (contact_nodes[layer_nr].empty() == false) {
@@ -3097,6 +3120,8 @@ void TreeSupport::smooth_nodes(std::vector<std::vector<Node *>> &contact_nodes)
     }
 
     for (int layer_nr = 0; layer_nr< contact_nodes.size(); layer_nr++) {
+        if (m_object->print()->canceled())
+            return;
         std::vector<Node *> &curr_layer_nodes = contact_nodes[layer_nr];
         if (curr_layer_nodes.empty()) continue;
         for (Node *node : curr_layer_nodes) {
@@ -3582,19 +3607,24 @@ void TreeSupport::insert_dropped_node(std::vector<Node*>& nodes_layer, Node* p_n
 TreeSupportData::TreeSupportData(const PrintObject &object, coordf_t xy_distance, coordf_t max_move, coordf_t radius_sample_resolution)
     : m_xy_distance(xy_distance), m_max_move(max_move), m_radius_sample_resolution(radius_sample_resolution)
 {
-    for (std::size_t layer_nr  = 0; layer_nr < object.layers().size(); ++layer_nr)
-    {
-        const Layer* layer = object.get_layer(layer_nr);
-        m_layer_outlines.push_back(ExPolygons());
-        ExPolygons& outline = m_layer_outlines.back();
-        for (const ExPolygon& poly : layer->lslices) {
-            poly.simplify(scale_(m_radius_sample_resolution), &outline);
-        }
+    // Simplification of the layer outlines is independent per layer.
+    m_layer_outlines.assign(object.layers().size(), ExPolygons());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, object.layers().size()),
+        [this, &object](const tbb::blocked_range<size_t> &range) {
+            for (size_t layer_nr = range.begin(); layer_nr < range.end(); ++layer_nr) {
+                ExPolygons &outline = m_layer_outlines[layer_nr];
+                for (const ExPolygon &poly : object.get_layer(layer_nr)->lslices)
+                    poly.simplify(scale_(m_radius_sample_resolution), &outline);
+            }
+        });
 
+    // Cumulative union of the outlines of this layer and all the layers below, a serial prefix scan.
+    m_layer_outlines_below.reserve(m_layer_outlines.size());
+    for (std::size_t layer_nr = 0; layer_nr < m_layer_outlines.size(); ++layer_nr) {
         if (layer_nr == 0)
-            m_layer_outlines_below.push_back(outline);
+            m_layer_outlines_below.push_back(m_layer_outlines[layer_nr]);
         else
-            m_layer_outlines_below.push_back(union_ex(m_layer_outlines_below.end()[-1], outline));
+            m_layer_outlines_below.push_back(union_ex(m_layer_outlines_below.end()[-1], m_layer_outlines[layer_nr]));
     }
 }
 
@@ -3624,7 +3654,7 @@ const ExPolygons& TreeSupportData::get_avoidance(coordf_t radius, size_t layer_n
 Polygons TreeSupportData::get_contours(size_t layer_nr) const
 {
     Polygons contours;
-    for (const ExPolygon expoly : m_layer_outlines[layer_nr]) {
+    for (const ExPolygon &expoly : m_layer_outlines[layer_nr]) {
         contours.push_back(expoly.contour);
     }
 
@@ -3634,7 +3664,7 @@ Polygons TreeSupportData::get_contours(size_t layer_nr) const
 Polygons TreeSupportData::get_contours_with_holes(size_t layer_nr) const
 {
     Polygons contours;
-    for (const ExPolygon expoly : m_layer_outlines[layer_nr]) {
+    for (const ExPolygon &expoly : m_layer_outlines[layer_nr]) {
         for(int i=0;i<expoly.num_contours();i++)
             contours.push_back(expoly.contour_or_hole(i));
     }
@@ -3662,6 +3692,12 @@ const ExPolygons& TreeSupportData::calculate_collision(const RadiusLayerPair& ke
 {
     assert(key.layer_nr < m_layer_outlines.size());
 
+    if (m_canceled()) {
+        // Return an empty placeholder without caching it, see m_canceled.
+        static const ExPolygons empty;
+        return empty;
+    }
+
     ExPolygons collision_areas = std::move(offset_ex(m_layer_outlines[key.layer_nr], scale_(key.radius)));
     const auto ret = m_collision_cache.insert({ key, std::move(collision_areas) });
     return ret.first->second;
@@ -3672,10 +3708,23 @@ const ExPolygons& TreeSupportData::calculate_avoidance(const RadiusLayerPair& ke
     const auto& radius = key.radius;
     const auto& layer_nr = key.layer_nr;
     BOOST_LOG_TRIVIAL(debug) << "calculate_avoidance on radius=" << radius << ", layer=" << layer_nr<<", recursion="<<key.recursions;
+    if (m_canceled()) {
+        // The avoidance of a layer recurses through all the layers beneath it, which can run for
+        // many seconds on a cache miss. Unwind the pending recursion with an empty placeholder
+        // without caching it, see m_canceled; the callers poll the cancel state themselves.
+        static const ExPolygons empty;
+        return empty;
+    }
     constexpr auto max_recursion_depth = 100;
     if (key.recursions <= max_recursion_depth*2) {
         if (layer_nr == 0) {
-            m_avoidance_cache[key] = get_collision(radius, 0);
+            const ExPolygons &collision = get_collision(radius, 0);
+            if (m_canceled()) {
+                // The collision may be a truncated placeholder, do not cache it.
+                static const ExPolygons empty;
+                return empty;
+            }
+            m_avoidance_cache[key] = collision;
             return m_avoidance_cache[key];
         }
 
@@ -3698,6 +3747,11 @@ const ExPolygons& TreeSupportData::calculate_avoidance(const RadiusLayerPair& ke
         const ExPolygons &collision       = get_collision(radius, layer_nr);
         avoidance_areas.insert(avoidance_areas.end(), collision.begin(), collision.end());
         avoidance_areas = std::move(union_ex(avoidance_areas));
+        if (m_canceled()) {
+            // The inputs above may already be truncated placeholders, do not cache them.
+            static const ExPolygons empty;
+            return empty;
+        }
         auto ret = m_avoidance_cache.insert({ key, std::move(avoidance_areas) });
         //assert(ret.second);
         return ret.first->second;
@@ -2,6 +2,7 @@
 #define TREESUPPORT_H
 
 #include <forward_list>
+#include <functional>
 #include <unordered_set>
 #include "ExPolygon.hpp"
 #include "Point.hpp"
@@ -102,6 +103,14 @@ public:
 
     std::vector<TreeNode> tree_nodes;
 
+    /*!
+     * \brief Polled by the lazy collision/avoidance calculations to stop early when the
+     * print is canceled. The avoidance recursion can span hundreds of layers, so without
+     * this a cancel request may take many seconds to be honoured. Aborted results are
+     * never inserted into the caches, so a later clean run is not polluted.
+     */
+    std::function<bool()> m_canceled = []() { return false; };
+
 private:
     /*!
      * \brief Convenience typedef for the keys to the caches
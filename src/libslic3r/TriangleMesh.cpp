@@ -41,6 +41,9 @@
 #include <boost/nowide/cstdio.hpp>
 #include <boost/predef/other/endian.h>
 
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Core>
 #include <Eigen/Dense>
 
@@ -59,12 +62,14 @@ static void update_bounding_box(const indexed_triangle_set &its, TriangleMeshSta
 static void fill_initial_stats(const indexed_triangle_set &its, TriangleMeshStats &out)
 {
     out.number_of_facets    = its.indices.size();
-    out.volume              = its_volume(its);
     update_bounding_box(its, out);
 
-    const std::vector<Vec3i> face_neighbors = its_face_neighbors(its);
-    out.number_of_parts = its_number_of_patches(its, face_neighbors);
-    out.open_edges      = its_num_open_edges(face_neighbors);
+    // Fused batch query, this runs on every mesh construction and dominates
+    // the import time of large meshes.
+    ItsTopologyStats stats = its_topology_stats(its);
+    out.volume          = stats.volume;
+    out.number_of_parts = stats.number_of_parts;
+    out.open_edges      = stats.open_edges;
 }
 
 TriangleMesh::TriangleMesh(const std::vector<Vec3f> &vertices, const std::vector<Vec3i> &faces) : its { faces, vertices }
@@ -691,7 +696,8 @@ int its_merge_vertices(indexed_triangle_set &its, bool shrink_to_fit)
     auto sorted = reserve_vector<int>(its.vertices.size());
     for (int i = 0; i < int(its.vertices.size()); ++ i)
         sorted.emplace_back(i);
-    std::sort(sorted.begin(), sorted.end(), [&its](int il, int ir) {
+    // The sort dominates the merge time on large meshes, sort in parallel.
+    tbb::parallel_sort(sorted.begin(), sorted.end(), [&its](int il, int ir) {
         const Vec3f &l = its.vertices[il];
         const Vec3f &r = its.vertices[ir];
         // Sort lexicographically by coordinates AND vertex index.
@@ -1424,20 +1430,38 @@ float its_volume(const indexed_triangle_set &its)
 
     // Choose a point, any point as the reference.
     auto p0 = its.vertices.front();
-    float volume = 0.f;
-    for (size_t i = 0; i < its.indices.size(); ++ i) {
-        // Do dot product to get distance from point to plane.
-        its_triangle triangle = its_triangle_vertices(its, i);
-        Vec3f U = triangle[1] - triangle[0];
-        Vec3f V = triangle[2] - triangle[0];
-        Vec3f C = U.cross(V);
-        Vec3f normal = C.normalized();
-        float area = 0.5 * C.norm();
-        float height = normal.dot(triangle[0] - p0);
-        volume += (area * height) / 3.0f;
-    }
-
-    return volume;
+    // The partial sums of the parallel reduction are merged in a nondeterministic order,
+    // accumulate in double to keep the noise well below the precision of the float result.
+    double volume = execution::accumulate(ex_tbb, size_t(0), its.indices.size(), 0.,
+        [&its, p0](size_t i) -> double {
+            // Do dot product to get distance from point to plane.
+            its_triangle triangle = its_triangle_vertices(its, i);
+            Vec3f U = triangle[1] - triangle[0];
+            Vec3f V = triangle[2] - triangle[0];
+            Vec3f C = U.cross(V);
+            Vec3f normal = C.normalized();
+            float area = 0.5 * C.norm();
+            float height = normal.dot(triangle[0] - p0);
+            return double(area * height) / 3.0;
+        }, 1024);
+
+    return float(volume);
+}
+
+ItsTopologyStats its_topology_stats(const indexed_triangle_set &its)
+{
+    ItsTopologyStats out;
+    if (its.empty())
+        return out;
+    // Both tasks are parallel internally, still run them concurrently so the volume
+    // reduction fills the machine while the neighbor index build is in its serial
+    // merge phase.
+    tbb::parallel_invoke(
+        [&its, &out] { out.volume = its_volume(its); },
+        [&its, &out] { out.face_neighbors = its_face_neighbors_par(its); });
+    out.number_of_parts = its_number_of_patches(its, out.face_neighbors);
+    out.open_edges      = its_num_open_edges(out.face_neighbors);
+    return out;
 }
 
 float its_average_edge_length(const indexed_triangle_set &its)
@@ -1460,6 +1484,11 @@ std::vector<indexed_triangle_set> its_split(const indexed_triangle_set &its)
     return its_split<>(its);
 }
 
+std::vector<indexed_triangle_set> its_split(const indexed_triangle_set &its, std::vector<Vec3i> &face_neighbors)
+{
+    return its_split<>(ItsNeighborsWrapper{ its, face_neighbors });
+}
+
 // Number of disconnected patches (faces are connected if they share an edge, shared edge defined with 2 shared vertex indices).
 size_t its_number_of_patches(const indexed_triangle_set &its)
 {
@@ -332,6 +332,24 @@ inline stl_normal its_unnormalized_normal(const indexed_triangle_set &its,
 float its_volume(const indexed_triangle_set &its);
 float its_average_edge_length(const indexed_triangle_set &its);
 
+// Topology statistics of a mesh computed in one batch, see its_topology_stats().
+struct ItsTopologyStats
+{
+    float              volume          = 0.f;
+    size_t             number_of_parts = 0;
+    size_t             open_edges      = 0;
+    // Face neighbor index built as a by-product. May be fed to its_split(),
+    // its_number_of_patches() etc. to avoid rebuilding it.
+    std::vector<Vec3i> face_neighbors;
+};
+
+// Batch query fusing the full mesh walks performed after import or repair: the volume
+// reduction and the face neighbor index run in parallel over the facets, the patch
+// count and the open edge count are then derived from the shared neighbor index.
+// Cheaper than calling its_volume(), its_face_neighbors() and its_number_of_patches()
+// in sequence, each walking the whole mesh on its own.
+ItsTopologyStats its_topology_stats(const indexed_triangle_set &its);
+
 void its_merge(indexed_triangle_set &A, const indexed_triangle_set &B);
 void its_merge(indexed_triangle_set &A, const std::vector<Vec3f> &triangles);
 void its_merge(indexed_triangle_set &A, const Pointf3s &triangles);
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <cmath>
 #include <deque>
+#include <numeric>
 #include <queue>
 #include <mutex>
 #include <utility>
@@ -21,6 +22,7 @@
 #include <boost/log/trivial.hpp>
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
 #ifndef NDEBUG
 //    #define EXPENSIVE_DEBUG_CHECKS
@@ -336,12 +338,12 @@ void slice_facet_at_zs(
     // find facet extents
     const float min_z = fminf(vertices[0].z(), fminf(vertices[1].z(), vertices[2].z()));
     const float max_z = fmaxf(vertices[0].z(), fmaxf(vertices[1].z(), vertices[2].z()));
-    
+
     // find layer extents
     auto min_layer = std::lower_bound(zs.begin(), zs.end(), min_z); // first layer whose slice_z is >= min_z
     auto max_layer = std::upper_bound(min_layer, zs.end(), max_z); // first layer whose slice_z is > max_z
     int  idx_vertex_lowest = (vertices[1].z() == min_z) ? 1 : ((vertices[2].z() == min_z) ? 2 : 0);
-    
+
     for (auto it = min_layer; it != max_layer; ++ it) {
         IntersectionLine il;
         // Ignore horizontal triangles. Any valid horizontal triangle must have a vertical triangle connected, otherwise the part has zero volume.
@@ -354,6 +356,53 @@ void slice_facet_at_zs(
     }
 }
 
+// Structure of arrays with the Z spans of all facets of a mesh, precomputed once per slicing run.
+// The flat min/max arrays let slice_make_lines() reject facets not crossing any slicing plane
+// without touching the vertex data and with loops simple enough for the compiler to vectorize
+// (8 and more facets per iteration with AVX2 resp. NEON, without any platform specific intrinsics).
+struct FacetZSpans
+{
+    std::vector<float> min_z;
+    std::vector<float> max_z;
+};
+
+template<typename TransformVertex, typename ThrowOnCancel>
+static FacetZSpans make_facet_z_spans(
+    const std::vector<stl_vertex>                   &vertices,
+    const TransformVertex                           &transform_vertex_fn,
+    const std::vector<stl_triangle_vertex_indices>  &indices,
+    const ThrowOnCancel                              throw_on_cancel_fn)
+{
+    FacetZSpans spans;
+    spans.min_z.resize(indices.size());
+    spans.max_z.resize(indices.size());
+    // Transform the vertex Zs once, so the per-facet kernel below is a pure gather / min / max loop.
+    std::vector<float> vertices_z(vertices.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, vertices.size(), 1 << 16),
+        [&vertices, &transform_vertex_fn, &vertices_z](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                vertices_z[i] = transform_vertex_fn(vertices[i]).z();
+        });
+    throw_on_cancel_fn();
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, indices.size(), 1 << 16),
+        [&indices, &vertices_z, &spans](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                const stl_triangle_vertex_indices &tri = indices[i];
+                const float z0 = vertices_z[tri(0)];
+                const float z1 = vertices_z[tri(1)];
+                const float z2 = vertices_z[tri(2)];
+                spans.min_z[i] = fminf(z0, fminf(z1, z2));
+                spans.max_z[i] = fmaxf(z0, fmaxf(z1, z2));
+            }
+        });
+    return spans;
+}
+
+// Above this number of facets slice_make_lines() switches to a chunked schedule, see below.
+static constexpr const size_t slice_chunk_num_facets = 4 * 1024 * 1024;
+
 template<typename TransformVertex, typename ThrowOnCancel>
 static inline std::vector<IntersectionLines> slice_make_lines(
     const std::vector<stl_vertex>                   &vertices,
@@ -365,16 +414,51 @@ static inline std::vector<IntersectionLines> slice_make_lines(
 {
     std::vector<IntersectionLines>  lines(zs.size(), IntersectionLines());
     std::array<std::mutex, 64>      lines_mutex;
-    tbb::parallel_for(
-        tbb::blocked_range<int>(0, int(indices.size())),
-        [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &lines, &lines_mutex, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
-            for (int face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
-                if ((face_idx & 0x0ffff) == 0)
-                    throw_on_cancel_fn();
-                slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], zs, lines, lines_mutex);
+    // Batch pre-pass: Z spans of all facets, used to reject facets not crossing any slicing plane
+    // before entering the scalar slicing kernel.
+    const FacetZSpans              spans  = make_facet_z_spans(vertices, transform_vertex_fn, indices, throw_on_cancel_fn);
+    const float                    z_min  = zs.empty() ? 0.f : zs.front();
+    const float                    z_max  = zs.empty() ? 0.f : zs.back();
+    if (indices.size() <= slice_chunk_num_facets) {
+        tbb::parallel_for(
+            tbb::blocked_range<int>(0, int(indices.size())),
+            [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &lines, &lines_mutex, &spans, z_min, z_max, throw_on_cancel_fn](const tbb::blocked_range<int> &range) {
+                for (int face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
+                    if ((face_idx & 0x0ffff) == 0)
+                        throw_on_cancel_fn();
+                    if (spans.max_z[face_idx] < z_min || spans.min_z[face_idx] > z_max)
+                        continue;
+                    slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], zs, lines, lines_mutex);
+                }
             }
+        );
+    } else {
+        // Huge mesh. Process facets in chunks sorted by their bottom Z, so that each chunk only touches
+        // a narrow band of layers: the per-layer output buffers grow incrementally from bottom to top
+        // and the peak of transient allocations is bounded by the chunk size, not by the mesh size.
+        // Sorting also improves locality of the writes into "lines".
+        std::vector<int> faces_sorted;
+        faces_sorted.reserve(indices.size());
+        for (size_t face_idx = 0; face_idx < indices.size(); ++ face_idx)
+            if (spans.max_z[face_idx] >= z_min && spans.min_z[face_idx] <= z_max)
+                faces_sorted.emplace_back(int(face_idx));
+        tbb::parallel_sort(faces_sorted.begin(), faces_sorted.end(), [&spans](int l, int r) { return spans.min_z[l] < spans.min_z[r]; });
+        for (size_t chunk_begin = 0; chunk_begin < faces_sorted.size(); chunk_begin += slice_chunk_num_facets) {
+            size_t chunk_end = std::min(chunk_begin + slice_chunk_num_facets, faces_sorted.size());
+            tbb::parallel_for(
+                tbb::blocked_range<size_t>(chunk_begin, chunk_end),
+                [&vertices, &transform_vertex_fn, &indices, &face_edge_ids, &zs, &lines, &lines_mutex, &faces_sorted, throw_on_cancel_fn](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i < range.end(); ++ i) {
+                        if ((i & 0x0ffff) == 0)
+                            throw_on_cancel_fn();
+                        int face_idx = faces_sorted[i];
+                        slice_facet_at_zs(vertices, transform_vertex_fn, indices[face_idx], face_edge_ids[face_idx], zs, lines, lines_mutex);
+                    }
+                }
+            );
+            throw_on_cancel_fn();
         }
-    );
+    }
     return lines;
 }
 
@@ -1230,7 +1314,9 @@ static void chain_open_polylines_close_gaps(std::vector<OpenPolyline> &open_poly
 
 static Polygons make_loops(
     // Lines will have their flags modified.
-    IntersectionLines   &lines)
+    IntersectionLines   &lines,
+    // Maximum distance bridged when stitching the remaining open polylines, unscaled.
+    double               max_gap = 2.)
 {
     Polygons loops;
 #if 0
@@ -1304,7 +1390,6 @@ static Polygons make_loops(
         chain_open_polylines_close_gaps(open_polylines, *loops, max_gap, true);
     }
 #else
-    const double max_gap = 2.; //mm
     chain_open_polylines_close_gaps(open_polylines, loops, max_gap, false);
     chain_open_polylines_close_gaps(open_polylines, loops, max_gap, true);
 #endif
@@ -1345,7 +1430,7 @@ static std::vector<Polygons> make_loops(
                     throw_on_cancel();
 
                 Polygons &polygons = layers[line_idx];
-                polygons = make_loops(lines[line_idx]);
+                polygons = make_loops(lines[line_idx], params.open_loop_max_gap);
 
                 auto this_mode = line_idx < params.slicing_mode_normal_below_layer ? params.mode_below : params.mode;
                 if (! polygons.empty()) {
@@ -37,6 +37,9 @@ struct MeshSlicingParams
     SlicingMode   mode_below { SlicingMode::Regular };
     // Transforming faces during the slicing.
     Transform3d   trafo { Transform3d::Identity() };
+    // Maximum distance bridged when stitching the remaining open polylines into loops, unscaled.
+    // Open edges of mildly broken meshes are closed per layer this way without a global mesh repair pass.
+    double        open_loop_max_gap { 2. };
 };
 
 struct MeshSlicingParamsEx : public MeshSlicingParams
@@ -255,6 +255,9 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
     }
 
     const float highlight_angle_limit = -cos(Geometry::deg2rad(highlight_by_angle_deg));
+    //BBS: the normal matrix only depends on the object transformation, compute its
+    //inverse transpose once per stroke instead of once per visited facet
+    const Matrix3f normal_matrix = static_cast<Matrix3f>(trafo_no_translate.matrix().block(0, 0, 3, 3).inverse().transpose().cast<float>());
 
     // BBS
     std::vector<int> start_facets;
@@ -272,11 +275,23 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
     }
 
     // Keep track of facets of the original mesh we already processed.
-    std::vector<bool> visited(m_orig_size_indices, false);
+    //BBS: the visited marks are epoch stamped, so a stroke only touches the facets
+    //it actually covers and does not pay for clearing one flag per facet of the
+    //whole mesh on every application
+    if (m_stroke_visited.size() != size_t(m_orig_size_indices)) {
+        m_stroke_visited.assign(m_orig_size_indices, 0);
+        m_stroke_id = 0;
+    }
+    if (++m_stroke_id == 0) {
+        // The epoch counter wrapped around, all stored stamps are stale.
+        std::fill(m_stroke_visited.begin(), m_stroke_visited.end(), 0);
+        m_stroke_id = 1;
+    }
+    const auto visited = [this](int facet) { return m_stroke_visited[facet] == m_stroke_id; };
 
     for (int i = 0; i < start_facets.size(); i++) {
         int start_facet_id = start_facets[i];
-        if (visited[start_facet_id])
+        if (visited(start_facet_id))
             continue;
 
         // Now start with the facet the pointer points to and check all adjacent facets.
@@ -290,9 +305,8 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
         while (facet_idx < int(facets_to_check.size())) {
             int          facet = facets_to_check[facet_idx];
             const Vec3f& facet_normal = m_face_normals[m_triangles[facet].source_triangle];
-            Matrix3f     normal_matrix = static_cast<Matrix3f>(trafo_no_translate.matrix().block(0, 0, 3, 3).inverse().transpose().cast<float>());
             float        world_normal_z = (normal_matrix* facet_normal).normalized().z();
-            if (!visited[facet] && (highlight_by_angle_deg == 0.f || world_normal_z < highlight_angle_limit)) {
+            if (!visited(facet) && (highlight_by_angle_deg == 0.f || world_normal_z < highlight_angle_limit)) {
                 if (select_triangle(facet, new_state, triangle_splitting)) {
                     // add neighboring facets to list to be processed later
                     for (int neighbor_idx : m_neighbors[facet])
@@ -300,7 +314,7 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
                             facets_to_check.push_back(neighbor_idx);
                 }
             }
-            visited[facet] = true;
+            m_stroke_visited[facet] = m_stroke_id;
             ++facet_idx;
         }
     }
@@ -378,6 +378,12 @@ protected:
     // Zero indicates an uninitialized state.
     float m_old_cursor_radius_sqr = 0;
 
+    //BBS: stamp of the stroke which last visited each original facet. Epoch based,
+    //so select_patch() does not clear one flag per facet of the whole mesh on
+    //every stroke application.
+    std::vector<unsigned int> m_stroke_visited;
+    unsigned int m_stroke_id = 0;
+
     // Private functions:
 private:
     bool select_triangle(int facet_idx, EnforcerBlockerType type, bool triangle_splitting);
@@ -48,6 +48,7 @@
 #define CLI_PRINTABLE_SIZE_REDUCED     -20
 #define CLI_OBJECT_ARRANGE_FAILED      -21
 #define CLI_OBJECT_ORIENT_FAILED       -22
+#define CLI_EXPORT_GLTF_ERROR          -23
 
 
 #define CLI_NO_SUITABLE_OBJECTS     -50
@@ -87,6 +88,8 @@ extern std::string format_memsize_MB(size_t n);
 // Latter is used to get the memory info from SysInfoDialog.
 extern std::string log_memory_info(bool ignore_loglevel = false);
 extern void disable_multi_threading();
+// Returns the current resident memory (working set) of the process in bytes, zero if not available on the platform.
+extern size_t current_memory_rss();
 // Returns the size of physical memory (RAM) in bytes.
 extern size_t total_physical_memory();
 
@@ -106,6 +109,11 @@ const std::string& resources_dir();
 void set_temporary_dir(const std::string &path);
 const std::string& temporary_dir();
 
+// Directory the slicing checkpoints are saved to and restored from (see --checkpoint-dir).
+// Empty (the default) disables checkpointing.
+void set_checkpoint_dir(const std::string &path);
+const std::string& checkpoint_dir();
+
 //BBS: convert 0.1.3.4 version format to 00.01.03.04 format, like AA.BB.CC.DD
 inline std::string convert_to_full_version(std::string short_version)
 {
@@ -51,6 +51,12 @@ public:
     /// This method throws exactly like finish_entry() does.
     void add_entry(const std::string& name, const void* data, size_t bytes);
 
+    /// Same as above but overriding the compression level of the archive for
+    /// this single entry. Useful to store an already compressed payload
+    /// verbatim instead of deflating it a second time.
+    void add_entry(const std::string& name, const void* data, size_t bytes,
+                   e_compression level);
+
     // Writing data to the archive works like with standard streams. The target
     // within the zip file is the entry created with the add_entry method.
 
@@ -180,6 +180,11 @@ std::string CalibPressureAdvance::draw_digit(
         gcode << move_to(p4_5, writer, "Glyph: .");
         gcode << writer.extrude_to_xy(p4_5 + dot_direction, dE);
         break;
+    case '-':
+        // the middle segment in both draw modes
+        gcode << move_to(p3, writer, "Glyph: -");
+        gcode << writer.extrude_to_xy(p2, dE);
+        break;
     default: break;
     }
 
@@ -796,4 +801,139 @@ double CalibPressureAdvancePattern::pattern_shift() const
 {
     return (wall_count() - 1) * line_spacing_first_layer() + line_width_first_layer() + m_glyph_padding_horizontal;
 }
+
+CalibFlowRatePattern::CalibFlowRatePattern(
+    const Calib_Params &params, const DynamicPrintConfig &config, bool is_bbl_machine, Model &model, const Vec3d &origin)
+    : CalibPressureAdvance(config), m_params(params)
+{
+    refresh_setup(config, is_bbl_machine, model, origin);
+};
+
+void CalibFlowRatePattern::generate_custom_gcodes(const DynamicPrintConfig &config,
+                                                  bool                      is_bbl_machine,
+                                                  Model                    &model,
+                                                  const Vec3d              &origin)
+{
+    refresh_setup(config, is_bbl_machine, model, origin);
+
+    const int    pads      = num_pads();
+    const double base_flow = m_config.option<ConfigOptionFloats>("filament_flow_ratio")->get_at(0);
+
+    // draw_line() / draw_box() read the flow ratio from m_config, so the per-pad flow rate
+    // modifier is applied by rewriting it around each pad.
+    auto set_pad_flow = [this, base_flow](int pad_i) {
+        const double modifier = m_params.start + pad_i * m_params.step;
+        m_config.set_key_value("filament_flow_ratio", new ConfigOptionFloats{base_flow * (1. + modifier / 100.)});
+    };
+    auto reset_flow = [this, base_flow]() { m_config.set_key_value("filament_flow_ratio", new ConfigOptionFloats{base_flow}); };
+
+    std::stringstream gcode;
+    gcode << "; start flow rate pattern for layer\n";
+    gcode << move_to(Vec2d(m_starting_point.x(), m_starting_point.y()), m_writer, "Move to start XY position");
+    gcode << m_writer.travel_to_z(height_first_layer(), "Move to start Z position");
+
+    std::vector<CustomGCode::Item> gcode_items;
+
+    for (int i = 0; i < m_num_layers; ++i) {
+        const bool   is_first_layer = i == 0;
+        const double layer_height   = is_first_layer ? height_first_layer() : height_layer();
+
+        if (i > 0) {
+            gcode << "; end flow rate pattern for layer\n";
+            CustomGCode::Item item;
+            item.print_z = height_first_layer() + (i - 1) * height_layer();
+            item.type    = CustomGCode::Type::Custom;
+            item.extra   = gcode.str();
+            gcode_items.push_back(item);
+
+            gcode = std::stringstream(); // reset for next layer contents
+            gcode << "; start flow rate pattern for layer\n";
+            gcode << m_writer.travel_to_z(height_first_layer() + i * height_layer(), "Move to layer height");
+        }
+
+        // label each pad with its flow rate modifier
+        if (i == 1) {
+            const double number_e_per_mm = e_per_mm(line_width(), height_layer(),
+                                                    m_config.option<ConfigOptionFloats>("nozzle_diameter")->get_at(0),
+                                                    m_config.option<ConfigOptionFloats>("filament_diameter")->get_at(0),
+                                                    base_flow);
+            // the glyphs extend downwards from the given Y in Left_To_Right mode
+            const double glyph_start_y = m_starting_point.y() + m_pad_size + m_glyph_padding_vertical + max_numbering_height();
+            for (int j = 0; j < pads; ++j) {
+                gcode << draw_number(pad_start_x(j), glyph_start_y, m_params.start + (j * m_params.step), m_draw_digit_mode,
+                                     line_width(), number_e_per_mm, speed_first_layer(), m_writer);
+            }
+        }
+
+        DrawBoxOptArgs box_opt_args(/* num_perimeters */ 2, layer_height,
+                                    is_first_layer ? line_width_first_layer() : line_width(),
+                                    speed_adjust(is_first_layer ? speed_first_layer() : speed_solid(layer_height)));
+        box_opt_args.is_filled = true;
+
+        for (int j = 0; j < pads; ++j) {
+            set_pad_flow(j);
+            gcode << draw_box(m_writer, pad_start_x(j), m_starting_point.y(), m_pad_size, m_pad_size, box_opt_args);
+        }
+        reset_flow();
+    }
+
+    gcode << "; end flow rate pattern for layer\n";
+    CustomGCode::Item item;
+    item.print_z = max_layer_z();
+    item.type    = CustomGCode::Type::Custom;
+    item.extra   = gcode.str();
+    gcode_items.push_back(item);
+
+    CustomGCode::Info info;
+    info.mode   = CustomGCode::Mode::SingleExtruder;
+    info.gcodes = gcode_items;
+
+    model.plates_custom_gcodes[model.curr_plate_index] = info;
+}
+
+double CalibFlowRatePattern::speed_solid(double layer_height) const
+{
+    const Flow   flow(line_width(), layer_height, m_config.option<ConfigOptionFloats>("nozzle_diameter")->get_at(0));
+    const double max_volumetric_speed = m_config.option<ConfigOptionFloats>("filament_max_volumetric_speed")->get_at(0);
+    double       speed                = m_config.option<ConfigOptionFloat>("internal_solid_infill_speed")->value;
+    if (max_volumetric_speed > 0)
+        speed = std::min(speed, max_volumetric_speed / flow.mm3_per_mm());
+    return std::floor(speed);
+}
+
+void CalibFlowRatePattern::refresh_setup(const DynamicPrintConfig &config,
+                                         bool                      is_bbl_machine,
+                                         const Model              &model,
+                                         const Vec3d              &origin)
+{
+    m_config = config;
+    m_config.apply(model.objects.front()->config.get(), true);
+    m_config.apply(model.objects.front()->volumes.front()->config.get(), true);
+
+    _refresh_starting_point(model);
+    _refresh_writer(is_bbl_machine, model, origin);
+}
+
+void CalibFlowRatePattern::_refresh_starting_point(const Model &model)
+{
+    ModelObject  *obj  = model.objects.front();
+    BoundingBoxf3 bbox = obj->instance_bounding_box(*obj->instances.front(), false);
+
+    m_starting_point = Vec3d(bbox.min.x(), bbox.max.y(), 0);
+    m_starting_point.y() += m_handle_spacing;
+}
+
+void CalibFlowRatePattern::_refresh_writer(bool is_bbl_machine, const Model &model, const Vec3d &origin)
+{
+    PrintConfig print_config;
+    print_config.apply(m_config, true);
+
+    m_writer.apply_print_config(print_config);
+    m_writer.set_xy_offset(origin(0), origin(1));
+    m_writer.set_is_bbl_machine(is_bbl_machine);
+
+    const unsigned int extruder_id = model.objects.front()->volumes.front()->extruder_id();
+    m_writer.set_extruders({extruder_id});
+    m_writer.set_extruder(extruder_id);
+}
 } // namespace Slic3r
@@ -308,4 +308,59 @@ private:
     const double m_glyph_padding_horizontal{1};
     const double m_glyph_padding_vertical{1};
 };
+
+// Flow rate test synthesized directly from a parameterized toolpath template instead of
+// slicing the multi-block test model: a row of filled square pads, each extruded with a
+// different flow rate modifier and labeled with it. Like the pressure advance pattern
+// above, the toolpaths are injected as per-layer custom G-code over a small "handle"
+// object, so generating the test is instant.
+class CalibFlowRatePattern : public CalibPressureAdvance
+{
+public:
+    CalibFlowRatePattern(
+        const Calib_Params &params, const DynamicPrintConfig &config, bool is_bbl_machine, Model &model, const Vec3d &origin);
+
+    double handle_xy_size() const { return m_handle_xy_size; };
+    double handle_spacing() const { return m_handle_spacing; };
+    double print_size_x() const { return object_size_x(); };
+    double print_size_y() const { return object_size_y(); };
+    double max_layer_z() const { return height_first_layer() + ((m_num_layers - 1) * height_layer()); };
+
+    void generate_custom_gcodes(const DynamicPrintConfig &config, bool is_bbl_machine, Model &model, const Vec3d &origin);
+
+protected:
+    double speed_first_layer() const { return m_config.option<ConfigOptionFloat>("initial_layer_speed")->value; };
+    // Solid infill speed limited by the filament's maximum volumetric speed.
+    double speed_solid(double layer_height) const;
+    double line_width_first_layer() const { return m_config.get_abs_value("initial_layer_line_width"); };
+    double line_width() const { return m_config.get_abs_value("line_width"); };
+
+private:
+    void refresh_setup(const DynamicPrintConfig &config, bool is_bbl_machine, const Model &model, const Vec3d &origin);
+    void _refresh_starting_point(const Model &model);
+    void _refresh_writer(bool is_bbl_machine, const Model &model, const Vec3d &origin);
+
+    double    height_first_layer() const { return m_config.option<ConfigOptionFloat>("initial_layer_print_height")->value; };
+    double    height_layer() const { return m_config.option<ConfigOptionFloat>("layer_height")->value; };
+    const int num_pads() const { return std::ceil((m_params.end - m_params.start) / m_params.step + 1); }
+
+    double object_size_x() const { return num_pads() * m_pad_size + (num_pads() - 1) * m_pad_spacing; };
+    double object_size_y() const { return m_pad_size + m_glyph_padding_vertical * 2 + max_numbering_height(); };
+    double max_numbering_height() const { return 2 * m_digit_segment_len; };
+    double pad_start_x(int pad_i) const { return m_starting_point.x() + pad_i * (m_pad_size + m_pad_spacing); };
+
+    // Unlike CalibPressureAdvancePattern, the params are stored by value: the pattern may
+    // outlive the stack frame it was constructed from.
+    Calib_Params m_params;
+
+    GCodeWriter m_writer;
+    Vec3d       m_starting_point;
+
+    const double m_handle_xy_size{5};
+    const double m_handle_spacing{2};
+    const int    m_num_layers{4};
+
+    const double m_pad_size{15.0};
+    const double m_pad_spacing{4.0};
+};
 } // namespace Slic3r
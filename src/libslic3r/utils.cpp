@@ -236,6 +236,17 @@ const std::string& temporary_dir()
     return g_temporary_dir;
 }
 
+static std::string g_checkpoint_dir;
+void set_checkpoint_dir(const std::string &dir)
+{
+    g_checkpoint_dir = dir;
+}
+
+const std::string& checkpoint_dir()
+{
+    return g_checkpoint_dir;
+}
+
 static std::string g_local_dir;
 
 void set_local_dir(const std::string &dir)
@@ -1403,6 +1414,29 @@ std::string log_memory_info(bool ignore_loglevel)
     return out;
 }
 
+// Returns the current resident memory (working set) of the process in bytes,
+// zero if not available. Same sources as log_memory_info(), but cheap enough
+// to be sampled at every processing step boundary for memory accounting.
+size_t current_memory_rss()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return (size_t)pmc.WorkingSetSize;
+#elif defined(__APPLE__)
+    struct mach_task_basic_info info;
+    mach_msg_type_number_t infoCount = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &infoCount) == KERN_SUCCESS)
+        return (size_t)info.resident_size;
+#elif defined(__linux__)
+    size_t tSize = 0, resident = 0;
+    std::ifstream buffer("/proc/self/statm");
+    if (buffer && (buffer >> tSize >> resident))
+        return resident * (size_t)sysconf(_SC_PAGE_SIZE);
+#endif
+    return 0;
+}
+
 // Returns the size of physical memory (RAM) in bytes.
 // http://nadeausoftware.com/articles/2012/09/c_c_tip_how_get_physical_memory_size_system
 size_t total_physical_memory()
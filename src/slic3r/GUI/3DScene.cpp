@@ -614,12 +614,25 @@ bool GLWipeTowerVolume::IsTransparent() {
 std::vector<int> GLVolumeCollection::load_object(
     const ModelObject*      model_object,
     int                     obj_idx,
-    const std::vector<int>& instance_idxs)
+    const std::vector<int>& instance_idxs,
+    bool                    build_raycaster)
 {
     std::vector<int> volumes_idx;
-    for (int volume_idx = 0; volume_idx < int(model_object->volumes.size()); ++volume_idx)
-        for (int instance_idx : instance_idxs)
-            volumes_idx.emplace_back(this->GLVolumeCollection::load_object_volume(model_object, obj_idx, volume_idx, instance_idx));
+    for (int volume_idx = 0; volume_idx < int(model_object->volumes.size()); ++volume_idx) {
+        //BBS: all instances of a volume share the same mesh, build the AABB tree
+        //of the raycaster only once and share it among them
+        std::shared_ptr<GUI::MeshRaycaster> shared_raycaster;
+        for (int instance_idx : instance_idxs) {
+            const int v_idx = this->GLVolumeCollection::load_object_volume(model_object, obj_idx, volume_idx, instance_idx, false, false, build_raycaster && shared_raycaster == nullptr);
+            if (build_raycaster) {
+                if (shared_raycaster == nullptr)
+                    shared_raycaster = this->volumes[v_idx]->mesh_raycaster;
+                else
+                    this->volumes[v_idx]->mesh_raycaster = shared_raycaster;
+            }
+            volumes_idx.emplace_back(v_idx);
+        }
+    }
     return volumes_idx;
 }
 
@@ -629,7 +642,8 @@ int GLVolumeCollection::load_object_volume(
     int                  volume_idx,
     int                  instance_idx,
     bool                 in_assemble_view,
-    bool                 use_loaded_id)
+    bool                 use_loaded_id,
+    bool                 build_raycaster)
 {
     const ModelVolume   *model_volume = model_object->volumes[volume_idx];
     const int            extruder_id  = model_volume->extruder_id();
@@ -644,7 +658,8 @@ int GLVolumeCollection::load_object_volume(
     v.model.init_from(mesh, true);
 #else
     v.model.init_from(*mesh);
-    v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(mesh);
+    if (build_raycaster)
+        v.mesh_raycaster = std::make_unique<GUI::MeshRaycaster>(mesh);
 #endif // ENABLE_SMOOTH_NORMALS
     v.composite_id = GLVolume::CompositeID(obj_idx, volume_idx, instance_idx);
     if (model_volume->is_model_part()) {
@@ -778,6 +793,35 @@ GLVolume* GLVolumeCollection::new_nontoolpath_volume(const ColorRGBA& rgba)
     return out;
 }
 
+//BBS: camera frustum planes extracted from the composed projection * view matrix
+//following Gribb & Hartmann, with the normals pointing into the frustum
+static std::array<Vec4d, 6> extract_frustum_planes(const Transform3d& view_matrix, const Transform3d& projection_matrix)
+{
+    const Eigen::Matrix4d m = projection_matrix.matrix() * view_matrix.matrix();
+    std::array<Vec4d, 6> planes;
+    planes[0] = (m.row(3) + m.row(0)).transpose(); // left
+    planes[1] = (m.row(3) - m.row(0)).transpose(); // right
+    planes[2] = (m.row(3) + m.row(1)).transpose(); // bottom
+    planes[3] = (m.row(3) - m.row(1)).transpose(); // top
+    planes[4] = (m.row(3) + m.row(2)).transpose(); // near
+    planes[5] = (m.row(3) - m.row(2)).transpose(); // far
+    return planes;
+}
+
+//BBS: conservative visibility test of a world space box against the frustum:
+//the box is culled only when it lies entirely behind one of the planes
+static bool frustum_intersects(const std::array<Vec4d, 6>& planes, const BoundingBoxf3& box)
+{
+    for (const Vec4d& plane : planes) {
+        const Vec3d p(plane.x() >= 0.0 ? box.max.x() : box.min.x(),
+                      plane.y() >= 0.0 ? box.max.y() : box.min.y(),
+                      plane.z() >= 0.0 ? box.max.z() : box.min.z());
+        if (plane.head<3>().dot(p) + plane.w() < 0.0)
+            return false;
+    }
+    return true;
+}
+
 GLVolumeWithIdAndZList volumes_to_render(const GLVolumePtrs& volumes, GLVolumeCollection::ERenderType type, const Transform3d& view_matrix, std::function<bool(const GLVolume&)> filter_func)
 {
     GLVolumeWithIdAndZList list;
@@ -828,6 +872,15 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
     std::function<bool(const GLVolume&)> filter_func, bool with_outline) const
 {
     GLVolumeWithIdAndZList to_render = volumes_to_render(volumes, type, view_matrix, filter_func);
+    //BBS: skip the volumes whose world space bounds are completely outside the
+    //camera frustum; when zoomed into a detail most of the plate contents can be
+    //dropped before any draw call is submitted
+    const std::array<Vec4d, 6> frustum = extract_frustum_planes(view_matrix, projection_matrix);
+    to_render.erase(std::remove_if(to_render.begin(), to_render.end(),
+                                   [&frustum](const GLVolumeWithIdAndZ& v) {
+                                       return !frustum_intersects(frustum, v.first->transformed_bounding_box());
+                                   }),
+                    to_render.end());
     if (to_render.empty())
         return;
 
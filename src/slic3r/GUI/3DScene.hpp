@@ -215,7 +215,9 @@ public:
 
     GUI::GLModel            model;
     // raycaster used for picking
-    std::unique_ptr<GUI::MeshRaycaster> mesh_raycaster;
+    //BBS: shared, instances of the same model volume reuse one AABB tree; replacing
+    //the raycaster of a single volume detaches it from the shared one
+    std::shared_ptr<GUI::MeshRaycaster> mesh_raycaster;
     // BBS
     mutable std::vector<GUI::GLModel> mmuseg_models;
     mutable ObjectBase::Timestamp       mmuseg_ts;
@@ -439,10 +441,13 @@ public:
     }
     ~GLVolumeCollection() { clear(); }
 
+    //BBS: build_raycaster may be turned off for volumes which are only rendered and
+    //never picked (e.g. preview shells), skipping the costly AABB tree construction
     std::vector<int> load_object(
         const ModelObject* model_object,
         int                      obj_idx,
-        const std::vector<int>& instance_idxs);
+        const std::vector<int>& instance_idxs,
+        bool                     build_raycaster = true);
 
     int load_object_volume(
         const ModelObject* model_object,
@@ -450,7 +455,8 @@ public:
         int                volume_idx,
         int                instance_idx,
         bool               in_assemble_view = false,
-        bool               use_loaded_id = false);
+        bool               use_loaded_id = false,
+        bool               build_raycaster = true);
 
     // Load SLA auxiliary GLVolumes (for support trees or pad).
     void load_object_auxiliary(
@@ -16,6 +16,7 @@
 #include <miniz.h>
 
 // Print now includes tbb, and tbb includes Windows. This breaks compilation of wxWidgets if included before wx.
+#include "libslic3r/ChromeTrace.hpp"
 #include "libslic3r/Print.hpp"
 #include "libslic3r/SLAPrint.hpp"
 #include "libslic3r/Utils.hpp"
@@ -28,10 +29,13 @@
 #include <stdexcept>
 #include <cctype>
 
+#include <tbb/task_arena.h>
+
 #include <boost/format/format_fwd.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
+#include <boost/nowide/cstdlib.hpp>
 #include "I18N.hpp"
 //#include "RemovableDriveManager.hpp"
 
@@ -196,6 +200,16 @@ void BackgroundSlicingProcess::process_fff()
 {
     assert(m_print == m_fff_print);
     m_fff_print->is_BBL_printer() = wxGetApp().preset_bundle->is_bbl_vendor();
+	if (m_speculative) {
+		// Speculative idle time pre-slicing: calculate the early object milestones at a low scheduler
+		// priority, so that the editor stays responsive. The G-code pipeline is left untouched, the
+		// finished milestones are picked up through the PrintObject step states by the next full run.
+		// Print::set_task() already limited the processing to the slicing & perimeter milestones.
+		BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(" %1%: speculative pre-slicing, running print::process at low priority")%__LINE__;
+		tbb::task_arena arena(tbb::task_arena::automatic, 1, tbb::task_arena::priority::low);
+		arena.execute([this] { m_print->process(); });
+		return;
+	}
 	//BBS: add the logic to process from an existed gcode file
 	if (m_print->finished()) {
 		BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(" %1%: skip slicing, to process previous gcode file")%__LINE__;
@@ -238,6 +252,9 @@ void BackgroundSlicingProcess::process_fff()
 		//BBS: add plate index into render params
 		m_temp_output_path = this->get_current_plate()->get_tmp_gcode_path();
 		m_fff_print->export_gcode(m_temp_output_path, m_gcode_result, [this](const ThumbnailsParams& params) { return this->render_thumbnails(params); });
+		//BBS: refresh the binary result cache next to the temp G-code, both to make saving the
+		//project embed an up to date cache and to overwrite a stale one from a previous slicing
+		m_gcode_result->save_to_binary(m_temp_output_path + GCodeProcessorResult::BinaryCacheExtension);
 		BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": export gcode finished");
 	}
 	if (this->set_step_started(bspsGCodeFinalize)) {
@@ -427,6 +444,11 @@ void BackgroundSlicingProcess::call_process_seh_throw(std::exception_ptr &ex) th
 
 void BackgroundSlicingProcess::call_process(std::exception_ptr &ex) throw()
 {
+	// Trace the background run into a chrome://tracing timeline when requested.
+	// One file per run, overwritten by the next run of the same process.
+	const char *trace_path = boost::nowide::getenv("ORCA_SLICER_TRACE");
+	if (trace_path != nullptr && *trace_path != 0)
+		ChromeTrace::begin();
 	try {
 		assert(m_print != nullptr);
 		switch (m_print->technology()) {
@@ -443,6 +465,10 @@ void BackgroundSlicingProcess::call_process(std::exception_ptr &ex) throw()
 		ex = std::current_exception();
 		BOOST_LOG_TRIVIAL(error) << __FUNCTION__ << ":got other exception" << std::endl;
 	}
+	if (ChromeTrace::enabled() && trace_path != nullptr && *trace_path != 0) {
+		ChromeTrace::end_and_write(trace_path);
+		BOOST_LOG_TRIVIAL(info) << "pipeline trace written to " << trace_path;
+	}
 }
 
 #ifdef _WIN32
@@ -699,6 +725,19 @@ Print::ApplyStatus BackgroundSlicingProcess::apply(const Model &model, const Dyn
 void BackgroundSlicingProcess::set_task(const PrintBase::TaskParams &params)
 {
 	assert(m_print != nullptr);
+	// An explicitly set task supersedes a pending speculative pre-slicing request.
+	m_speculative = false;
+	m_print->set_task(params);
+}
+
+void BackgroundSlicingProcess::set_speculative(bool speculative)
+{
+	assert(m_print != nullptr);
+	m_speculative = speculative;
+	PrintBase::TaskParams params;
+	if (speculative)
+		// Limit the processing to the slicing & perimeter milestones.
+		params.to_object_step = int(posPerimeters);
 	m_print->set_task(params);
 }
 
@@ -709,6 +748,12 @@ void BackgroundSlicingProcess::schedule_export(const std::string &path, bool exp
 	if (! m_export_path.empty())
 		return;
 
+	// A speculative pre-slicing pass must not service the export: stop it and revert to a full task.
+	if (m_speculative) {
+		this->stop();
+		this->set_speculative(false);
+	}
+
 	// Guard against entering the export step before changing the export path.
 	std::scoped_lock<std::mutex> lock(m_print->state_mutex());
 	this->invalidate_step(bspsGCodeFinalize);
@@ -722,6 +767,12 @@ void BackgroundSlicingProcess::schedule_upload(Slic3r::PrintHostJob upload_job)
 	if (! m_export_path.empty())
 		return;
 
+	// A speculative pre-slicing pass must not service the upload: stop it and revert to a full task.
+	if (m_speculative) {
+		this->stop();
+		this->set_speculative(false);
+	}
+
 	// Guard against entering the export step before changing the export path.
 	std::scoped_lock<std::mutex> lock(m_print->state_mutex());
 	this->invalidate_step(bspsGCodeFinalize);
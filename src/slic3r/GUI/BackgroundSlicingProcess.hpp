@@ -140,7 +140,13 @@ public:
     PrintBase::ApplyStatus apply(const Model &model, const DynamicPrintConfig &config);
 	// After calling the apply() function, set_task() may be called to limit the task to be processed by process().
 	// This is useful for calculating SLA supports for a single object only.
+	// Supersedes a pending speculative pre-slicing request.
 	void 		set_task(const PrintBase::TaskParams &params);
+	// Make the next start() speculatively pre-calculate just the early object milestones (slicing & perimeters)
+	// at a low scheduler priority while the model is being edited, so that an explicit "Slice now" finds those
+	// milestones already done. No G-code is produced and no completion UI is to be shown for such a pass.
+	void 		set_speculative(bool speculative);
+	bool 		speculative() const { return m_speculative; }
 	// After calling apply, the empty() call will report whether there is anything to slice.
 	bool 		empty() const;
 	// Validate the print. Returns an empty string if valid, returns an error message if invalid.
@@ -277,6 +283,8 @@ private:
 	GUI::PartPlate* m_current_plate;
 	PrinterTechnology m_printer_tech = ptUnknown;
 	bool m_internal_cancelled = false;
+	// The next run only speculatively pre-calculates the early object milestones, see set_speculative().
+	bool m_speculative = false;
 
     PrintState<BackgroundSlicingProcessStep, bspsCount>   	m_step_state;
 	bool                set_step_started(BackgroundSlicingProcessStep step);
@@ -2861,6 +2861,20 @@ std::string MachineObject::setting_id_to_type(std::string setting_id, std::strin
 }
 
 int MachineObject::parse_json(std::string payload)
+{
+    // Parse the textual payload into a DOM up front. The message callbacks run the parse on the
+    // agent worker thread and pass the DOM to the UI thread, which keeps the costly text parse
+    // of large status pushes off the UI.
+    CNumericLocalesSetter locales_setter;
+    try {
+        return this->parse_json(json::parse(payload));
+    } catch (...) {
+        BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << this->dev_id << ", payload = " << payload;
+        return -1;
+    }
+}
+
+int MachineObject::parse_json(json j_pre)
 {
     CNumericLocalesSetter locales_setter;
 
@@ -2875,7 +2889,6 @@ int MachineObject::parse_json(std::string payload)
     try {
         bool restored_json = false;
         json j;
-        json j_pre = json::parse(payload);
         if (j_pre.empty()) {
             return 0;
         }
@@ -4472,7 +4485,7 @@ int MachineObject::parse_json(std::string payload)
         parse_state_changed_event();
     }
     catch (...) {
-        BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << this->dev_id <<", payload = " << payload;
+        BOOST_LOG_TRIVIAL(trace) << "parse_json failed! dev_id=" << this->dev_id;
     }
 
     std::chrono::system_clock::time_point clock_stop = std::chrono::system_clock::now();
@@ -923,6 +923,8 @@ public:
     int cloud_publish_json(std::string json_str, int qos = 0);
     int local_publish_json(std::string json_str, int qos = 0);
     int parse_json(std::string payload);
+    // Applies an already parsed status DOM; the textual parse can then run on a worker thread.
+    int parse_json(json j_pre);
     int publish_gcode(std::string gcode_str);
 
     std::string setting_id_to_type(std::string setting_id, std::string tray_type);
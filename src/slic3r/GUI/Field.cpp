@@ -644,6 +644,15 @@ bool TextCtrl::value_was_changed()
     }
 }
 
+bool TextCtrl::value_differs(const boost::any &value)
+{
+    if (m_opt.nullable)
+        // The N/A handling in set_value() also refreshes m_last_meaningful_value, do not skip it.
+        return true;
+    const wxString *str = boost::any_cast<wxString>(&value);
+    return str == nullptr || *str != text_ctrl()->GetValue();
+}
+
 void TextCtrl::propagate_value()
 {
     
@@ -1006,6 +1015,12 @@ void SpinCtrl::set_value(const boost::any& value, bool change_event) {
     m_disable_change_event = false;
 }
 
+bool SpinCtrl::value_differs(const boost::any &value)
+{
+    const int *val = boost::any_cast<int>(&value);
+    return val == nullptr || *val != dynamic_cast<SpinInput*>(window)->GetValue();
+}
+
 void SpinCtrl::msw_rescale()
 {
     Field::msw_rescale();
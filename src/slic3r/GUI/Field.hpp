@@ -102,6 +102,11 @@ public:
     /// subclasses should overload with a specific version
     /// Postcondition: Method does not fire the on_change event.
     virtual void		set_value(const boost::any& value, bool change_event) = 0;
+    /// Returns false if the given value (in the representation set_value() expects) is already
+    /// what the control shows, so reload_config() can skip rebinding the widget. The default
+    /// conservatively claims a difference; subclasses override it where the comparison against
+    /// the widget state is cheap and exact.
+    virtual bool        value_differs(const boost::any& /* value */) { return true; }
     virtual void        set_last_meaningful_value() {}
     virtual void        set_na_value() {}
 
@@ -252,6 +257,7 @@ public:
 
     void BUILD() override;
     bool value_was_changed();
+    bool value_differs(const boost::any& value) override;
     // Propagate value from field to the OptionGroupe and Config after kill_focus/ENTER
     void propagate_value();
     wxWindow* window {nullptr};
@@ -323,6 +329,7 @@ public:
 		m_disable_change_event = false;
     }
 	void			set_value(const boost::any& value, bool change_event = false) override;
+	bool			value_differs(const boost::any& value) override;
 
 	boost::any&		get_value() override {
 		int value = static_cast<SpinInput*>(window)->GetValue();
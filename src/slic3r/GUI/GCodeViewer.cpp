@@ -35,6 +35,9 @@
 #include <wx/progdlg.h>
 #include <wx/numformatter.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <array>
 #include <algorithm>
 #include <chrono>
@@ -1203,6 +1206,11 @@ void GCodeViewer::reset()
     m_moves_count = 0;
     m_ssid_to_moveid_map.clear();
     m_ssid_to_moveid_map.shrink_to_fit();
+    m_interpolation_points_prefix.clear();
+    m_interpolation_points_prefix.shrink_to_fit();
+    //BBS: force the next update_moves_slider() to rebuild the value vectors
+    m_moves_slider_first = 1;
+    m_moves_slider_last = 0;
     for (TBuffer& buffer : m_buffers) {
         buffer.reset();
     }
@@ -1723,18 +1731,24 @@ void GCodeViewer::update_moves_slider(bool set_to_max)
     // this should not be needed, but it is here to try to prevent rambling crashes on Mac Asan
     if (view.endpoints.last < view.endpoints.first) return;
 
-    std::vector<double> values(view.endpoints.last - view.endpoints.first + 1);
-    std::vector<double> alternate_values(view.endpoints.last - view.endpoints.first + 1);
-    unsigned int        count = 0;
-    for (unsigned int i = view.endpoints.first; i <= view.endpoints.last; ++i) {
-        values[count] = static_cast<double>(i + 1);
-        if (view.gcode_ids[i] > 0) alternate_values[count] = static_cast<double>(view.gcode_ids[i]);
-        ++count;
+    //BBS: the value vectors only depend on the endpoints, skip rebuilding them
+    //when just the selection changed (view type switches, slider moves)
+    if (view.endpoints.first != m_moves_slider_first || view.endpoints.last != m_moves_slider_last) {
+        std::vector<double> values(view.endpoints.last - view.endpoints.first + 1);
+        std::vector<double> alternate_values(view.endpoints.last - view.endpoints.first + 1);
+        unsigned int        count = 0;
+        for (unsigned int i = view.endpoints.first; i <= view.endpoints.last; ++i) {
+            values[count] = static_cast<double>(i + 1);
+            if (view.gcode_ids[i] > 0) alternate_values[count] = static_cast<double>(view.gcode_ids[i]);
+            ++count;
+        }
+
+        m_moves_slider->SetSliderValues(values);
+        m_moves_slider->SetSliderAlternateValues(alternate_values);
+        m_moves_slider->SetMaxValue(view.endpoints.last - view.endpoints.first);
+        m_moves_slider_first = view.endpoints.first;
+        m_moves_slider_last = view.endpoints.last;
     }
-
-    m_moves_slider->SetSliderValues(values);
-    m_moves_slider->SetSliderAlternateValues(alternate_values);
-    m_moves_slider->SetMaxValue(view.endpoints.last - view.endpoints.first);
     m_moves_slider->SetSelectionSpan(view.current.first - view.endpoints.first, view.current.last - view.endpoints.first);
     if (set_to_max)
         m_moves_slider->SetHigherValue(m_moves_slider->GetMaxValue());
@@ -2419,6 +2433,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
     }
 
     m_sequential_view.gcode_ids.clear();
+    m_sequential_view.gcode_ids.reserve(gcode_result.moves.size());
     for (size_t i = 0; i < gcode_result.moves.size(); ++i) {
         const GCodeProcessorResult::MoveVertex& move = gcode_result.moves[i];
         if (move.type != EMoveType::Seam)
@@ -2474,8 +2489,11 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         }*/
 
         // ensure there is at least one vertex buffer
-        if (v_multibuffer.empty())
+        if (v_multibuffer.empty()) {
             v_multibuffer.push_back(VertexBuffer());
+            //BBS: reserve the size the buffer is split at, to avoid repeated reallocations while filling it
+            v_multibuffer.back().reserve(t_buffer.vertices.max_size_bytes() / sizeof(float));
+        }
 
         // if adding the vertices for the current segment exceeds the threshold size of the current vertex buffer
         // add another vertex buffer
@@ -2484,6 +2502,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         size_t vertices_size_to_add = (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::BatchedModel) ? t_buffer.model.data.vertices_size_bytes() : points_num * t_buffer.max_vertices_per_segment_size_bytes();
         if (v_multibuffer.back().size() * sizeof(float) > t_buffer.vertices.max_size_bytes() - vertices_size_to_add) {
             v_multibuffer.push_back(VertexBuffer());
+            v_multibuffer.back().reserve(t_buffer.vertices.max_size_bytes() / sizeof(float));
             if (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::Triangle) {
                 Path& last_path = t_buffer.paths.back();
                 if (prev.type == curr.type && last_path.matches(curr))
@@ -2530,24 +2549,26 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(":b=%1%, vertex buffer count %2%\n")
             %b %v_multibuffer.size();
     }*/
-    auto extract_move_id = [&biased_seams_ids](size_t id) {
-        size_t new_id = size_t(-1);
-        auto it = std::lower_bound(biased_seams_ids.begin(), biased_seams_ids.end(), id);
-        if (it == biased_seams_ids.end())
-            new_id = id + biased_seams_ids.size();
-        else {
-            if (it == biased_seams_ids.begin() && *it < id)
-                new_id = id;
-            else if (it != biased_seams_ids.begin())
-                new_id = id + std::distance(biased_seams_ids.begin(), it);
-        }
-        return (new_id == size_t(-1)) ? id : new_id;
-    };
     //BBS: generate map from ssid to move id in advance to reduce computation
+    //A sequential id maps to its move id shifted by the number of seam moves in front of it;
+    //both sequences are monotone, thus a single sweep replaces a per-id binary search.
     m_ssid_to_moveid_map.clear();
     m_ssid_to_moveid_map.reserve( m_moves_count - biased_seams_ids.size());
-    for (size_t i = 0; i < m_moves_count - biased_seams_ids.size(); i++)
-        m_ssid_to_moveid_map.push_back(extract_move_id(i));
+    size_t seams_before = 0;
+    for (size_t i = 0; i < m_moves_count - biased_seams_ids.size(); i++) {
+        while (seams_before < biased_seams_ids.size() && biased_seams_ids[seams_before] < i)
+            ++seams_before;
+        m_ssid_to_moveid_map.push_back(i + seams_before);
+    }
+
+    //BBS: cumulative number of arc interpolation points in front of each sequential vertex,
+    //turning the per-vertex backward scans of the corner smoothing below and the
+    //per-range counting loops of refresh_render_paths() into a difference.
+    m_interpolation_points_prefix.assign(m_ssid_to_moveid_map.size() + 1, 0);
+    for (size_t i = 0; i < m_ssid_to_moveid_map.size(); ++i) {
+        const GCodeProcessorResult::MoveVertex& move = gcode_result.moves[m_ssid_to_moveid_map[i]];
+        m_interpolation_points_prefix[i + 1] = m_interpolation_points_prefix[i] + (move.is_arc_move() ? move.interpolation_points.size() : 0);
+    }
 
     //BBS: smooth toolpaths corners for the given TBuffer using triangles
     auto smooth_triangle_toolpaths_corners = [&gcode_result, this](const TBuffer& t_buffer, MultiVertexBuffer& v_multibuffer) {
@@ -2564,11 +2585,8 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
             if (&prev_sub_path == &next_sub_path || is_internal_point) { // previous and next segment are both contained into to the same vertex buffer
                 VertexBuffer& vbuffer = v_multibuffer[prev_sub_path.first.b_id];
                 // offset into the vertex buffer of the next segment 1st vertex
-                size_t temp_offset = prev_sub_path.last.s_id - curr_s_id;
-                for (size_t i = prev_sub_path.last.s_id; i > curr_s_id; i--) {
-                    size_t move_id = m_ssid_to_moveid_map[i];
-                    temp_offset += (gcode_result.moves[move_id].is_arc_move() ? gcode_result.moves[move_id].interpolation_points.size() : 0);
-                }
+                size_t temp_offset = prev_sub_path.last.s_id - curr_s_id
+                    + m_interpolation_points_prefix[prev_sub_path.last.s_id + 1] - m_interpolation_points_prefix[curr_s_id + 1];
                 if (is_internal_point) {
                     size_t move_id = m_ssid_to_moveid_map[curr_s_id];
                     temp_offset += (gcode_result.moves[move_id].interpolation_points.size() - interpolation_point_id);
@@ -2606,11 +2624,8 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
             if (&prev_sub_path == &next_sub_path || is_internal_point) { // previous and next segment are both contained into to the same vertex buffer
                 VertexBuffer& vbuffer = v_multibuffer[prev_sub_path.first.b_id];
                 // offset into the vertex buffer of the next segment 1st vertex
-                size_t temp_offset = prev_sub_path.last.s_id - curr_s_id;
-                for (size_t i = prev_sub_path.last.s_id; i > curr_s_id; i--) {
-                    size_t move_id = m_ssid_to_moveid_map[i];
-                    temp_offset += (gcode_result.moves[move_id].is_arc_move() ? gcode_result.moves[move_id].interpolation_points.size() : 0);
-                }
+                size_t temp_offset = prev_sub_path.last.s_id - curr_s_id
+                    + m_interpolation_points_prefix[prev_sub_path.last.s_id + 1] - m_interpolation_points_prefix[curr_s_id + 1];
                 if (is_internal_point) {
                     size_t move_id = m_ssid_to_moveid_map[curr_s_id];
                     temp_offset += (gcode_result.moves[move_id].interpolation_points.size() - interpolation_point_id);
@@ -2644,7 +2659,11 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         };
 
         size_t vertex_size_floats = t_buffer.vertices.vertex_size_floats();
-        for (const Path& path : t_buffer.paths) {
+        //BBS: each path only updates the vertices generated for its own sub paths,
+        //which are disjoint ranges, thus distinct paths can be smoothed concurrently
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, t_buffer.paths.size()), [&](const tbb::blocked_range<size_t>& range) {
+        for (size_t path_id = range.begin(); path_id < range.end(); ++path_id) {
+            const Path& path = t_buffer.paths[path_id];
             //BBS: the two segments of the path sharing the current vertex may belong
             //to two different vertex buffers
             size_t prev_sub_path_id = 0;
@@ -2732,6 +2751,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
                 }
             }
         }
+        });
     };
 
 #if ENABLE_GCODE_VIEWER_STATISTICS
@@ -2870,6 +2890,8 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         // ensure there is at least one index buffer
         if (i_multibuffer.empty()) {
             i_multibuffer.push_back(IndexBuffer());
+            //BBS: reserve the size the buffer is split at, to avoid repeated reallocations while filling it
+            i_multibuffer.back().reserve(IBUFFER_THRESHOLD_BYTES / sizeof(IBufferType));
             if (!t_buffer.vertices.vbos.empty())
                 vbo_index_list.push_back(t_buffer.vertices.vbos[curr_vertex_buffer.first]);
         }
@@ -2881,6 +2903,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         size_t indiced_size_to_add = (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::BatchedModel) ? t_buffer.model.data.indices_size_bytes() : points_num * t_buffer.max_indices_per_segment_size_bytes();
         if (i_multibuffer.back().size() * sizeof(IBufferType) >= IBUFFER_THRESHOLD_BYTES - indiced_size_to_add) {
             i_multibuffer.push_back(IndexBuffer());
+            i_multibuffer.back().reserve(IBUFFER_THRESHOLD_BYTES / sizeof(IBufferType));
             vbo_index_list.push_back(t_buffer.vertices.vbos[curr_vertex_buffer.first]);
             if (t_buffer.render_primitive_type != TBuffer::ERenderPrimitiveType::BatchedModel) {
                 Path& last_path = t_buffer.paths.back();
@@ -2894,6 +2917,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result, const
         size_t vertices_size_to_add = (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::BatchedModel) ? t_buffer.model.data.vertices_size_bytes() : points_num * t_buffer.max_vertices_per_segment_size_bytes();
         if (curr_vertex_buffer.second * t_buffer.vertices.vertex_size_bytes() > t_buffer.vertices.max_size_bytes() - vertices_size_to_add) {
             i_multibuffer.push_back(IndexBuffer());
+            i_multibuffer.back().reserve(IBUFFER_THRESHOLD_BYTES / sizeof(IBufferType));
 
             ++curr_vertex_buffer.first;
             curr_vertex_buffer.second = 0;
@@ -3125,7 +3149,8 @@ void GCodeViewer::load_shells(const Print& print, bool force_previewing)
         instance_ids.resize(instance_index);
 
         size_t current_volumes_count = m_shells.volumes.volumes.size();
-        m_shells.volumes.load_object(model_obj, object_idx, instance_ids);
+        //BBS: shells are only rendered, never picked, no need to build their raycasters
+        m_shells.volumes.load_object(model_obj, object_idx, instance_ids, false);
 
         // adjust shells' z if raft is present
         const SlicingParameters& slicing_parameters = obj->slicing_parameters();
@@ -3297,6 +3322,10 @@ void GCodeViewer::refresh_render_paths(bool keep_sequential_current_first, bool
     // first pass: collect visible paths and update sequential view data
     std::vector<std::tuple<unsigned char, unsigned int, unsigned int, unsigned int>> paths;
 
+    //BBS: first/last sequential id of the visible layers range
+    const size_t visible_first_s_id = m_layers.get_endpoints_at(m_layers_z_range[0]).first;
+    const size_t visible_last_s_id = m_layers.get_endpoints_at(m_layers_z_range[1]).last;
+
     for (size_t b = 0; b < m_buffers.size(); ++b) {
         TBuffer& buffer = const_cast<TBuffer&>(m_buffers[b]);
         // reset render paths
@@ -3307,25 +3336,38 @@ void GCodeViewer::refresh_render_paths(bool keep_sequential_current_first, bool
 
         if (buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::InstancedModel ||
             buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::BatchedModel) {
-            for (size_t id : buffer.model.instances.s_ids) {
-                if (id < m_layers.get_endpoints_at(m_layers_z_range[0]).first || m_layers.get_endpoints_at(m_layers_z_range[1]).last < id)
-                    continue;
-
-                global_endpoints.first = std::min(global_endpoints.first, id);
-                global_endpoints.last = std::max(global_endpoints.last, id);
+            //BBS: instance ids are stored in move order, binary search the visible range
+            //instead of scanning all instances
+            const std::vector<size_t>& s_ids = buffer.model.instances.s_ids;
+            auto first_it = std::lower_bound(s_ids.begin(), s_ids.end(), visible_first_s_id);
+            auto last_it = std::upper_bound(first_it, s_ids.end(), visible_last_s_id);
+            if (first_it != last_it) {
+                global_endpoints.first = std::min(global_endpoints.first, *first_it);
+                global_endpoints.last = std::max(global_endpoints.last, *std::prev(last_it));
 
                 if (top_layer_only) {
-                    if (id < m_layers.get_endpoints_at(m_layers_z_range[1]).first || m_layers.get_endpoints_at(m_layers_z_range[1]).last < id)
-                        continue;
-
-                    top_layer_endpoints.first = std::min(top_layer_endpoints.first, id);
-                    top_layer_endpoints.last = std::max(top_layer_endpoints.last, id);
+                    auto top_first_it = std::lower_bound(first_it, last_it, m_layers.get_endpoints_at(m_layers_z_range[1]).first);
+                    if (top_first_it != last_it) {
+                        top_layer_endpoints.first = std::min(top_layer_endpoints.first, *top_first_it);
+                        top_layer_endpoints.last = std::max(top_layer_endpoints.last, *std::prev(last_it));
+                    }
                 }
             }
         }
         else {
-            for (size_t i = 0; i < buffer.paths.size(); ++i) {
+            //BBS: paths are stored in move order, thus their first s_id is non decreasing;
+            //binary search the first path which may fall into the visible range and stop as
+            //soon as one starts past it. Travel paths are merged with adjacent ones by
+            //is_travel_in_layers_range(), thus they keep the full scan.
+            const bool is_travel_buffer = (b == buffer_id(EMoveType::Travel));
+            size_t first_path_id = 0;
+            if (!is_travel_buffer)
+                first_path_id = std::lower_bound(buffer.paths.begin(), buffer.paths.end(), visible_first_s_id,
+                    [](const Path& p, size_t s_id) { return p.sub_paths.front().first.s_id < s_id; }) - buffer.paths.begin();
+            for (size_t i = first_path_id; i < buffer.paths.size(); ++i) {
                 const Path& path = buffer.paths[i];
+                if (!is_travel_buffer && path.sub_paths.front().first.s_id > visible_last_s_id)
+                    break;
                 if (path.type == EMoveType::Travel) {
                     if (!is_travel_in_layers_range(i, m_layers_z_range[0], m_layers_z_range[1]))
                         continue;
@@ -3400,25 +3442,13 @@ m_no_render_path = false;
                         unsigned int offset = static_cast<unsigned int>(m_sequential_view.current.last - sub_path.first.s_id);
                         if (offset > 0) {
                             if (buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::Line) {
-                                for (size_t i = sub_path.first.s_id + 1; i < m_sequential_view.current.last + 1; i++) {
-                                    size_t move_id = m_ssid_to_moveid_map[i];
-                                    const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
-                                    if (curr.is_arc_move()) {
-                                        offset += curr.interpolation_points.size();
-                                    }
-                                }
+                                offset += static_cast<unsigned int>(m_interpolation_points_prefix[m_sequential_view.current.last + 1] - m_interpolation_points_prefix[sub_path.first.s_id + 1]);
                                 offset = 2 * offset - 1;
                             }
                             else if (buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::Triangle) {
                                 unsigned int indices_count = buffer.indices_per_segment();
                                 // BBS: modify to support moves which has internal point
-                                for (size_t i = sub_path.first.s_id + 1; i < m_sequential_view.current.last + 1; i++) {
-                                    size_t move_id = m_ssid_to_moveid_map[i];
-                                    const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
-                                    if (curr.is_arc_move()) {
-                                        offset += curr.interpolation_points.size();
-                                    }
-                                }
+                                offset += static_cast<unsigned int>(m_interpolation_points_prefix[m_sequential_view.current.last + 1] - m_interpolation_points_prefix[sub_path.first.s_id + 1]);
                                 offset = indices_count * (offset - 1) + (indices_count - 2);
                                 if (sub_path_id == 0)
                                     offset += 6; // add 2 triangles for starting cap
@@ -3510,13 +3540,7 @@ m_no_render_path = false;
             size_t max_s_id = std::min(m_sequential_view.current.last, sub_path.last.s_id);
             size_t min_s_id = std::max(m_sequential_view.current.first, sub_path.first.s_id);
             unsigned int segments_count = max_s_id - min_s_id;
-            for (size_t i = min_s_id + 1; i < max_s_id + 1; i++) {
-                size_t move_id = m_ssid_to_moveid_map[i];
-                const GCodeProcessorResult::MoveVertex& curr = m_gcode_result->moves[move_id];
-                if (curr.is_arc_move()) {
-                    segments_count += curr.interpolation_points.size();
-                }
-            }
+            segments_count += static_cast<unsigned int>(m_interpolation_points_prefix[max_s_id + 1] - m_interpolation_points_prefix[min_s_id + 1]);
             size_in_indices = buffer.indices_per_segment() * segments_count;
             break;
         }
@@ -740,6 +740,9 @@ private:
     //BBS: add only gcode mode
     bool m_only_gcode_in_preview {false};
     std::vector<size_t> m_ssid_to_moveid_map;
+    //BBS: cumulative number of arc interpolation points in front of each sequential vertex,
+    //the count inside any s_id range is then a difference of two entries
+    std::vector<size_t> m_interpolation_points_prefix;
 
     std::vector<TBuffer> m_buffers{ static_cast<size_t>(EMoveType::Extrude) };
     // bounding box of toolpaths
@@ -765,6 +768,10 @@ private:
     Extrusions m_extrusions;
     SequentialView m_sequential_view;
     IMSlider* m_moves_slider;
+    //BBS: endpoints the moves slider values were last built for, used to skip
+    //rebuilding the O(moves) value vectors when only the selection changed
+    size_t m_moves_slider_first{ 1 };
+    size_t m_moves_slider_last{ 0 };
     IMSlider* m_layers_slider;
     Shells m_shells;
     /*BBS GUI refactor, store displayed items in color scheme combobox */
@@ -142,6 +142,8 @@ void GLCanvas3D::LayersEditing::init()
     glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST));
     glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1));
     glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
+    // The texture object is fresh, its content has to be uploaded again.
+    m_layers_texture.gpu_dirty = true;
 }
 
 void GLCanvas3D::LayersEditing::set_config(const DynamicPrintConfig* config)
@@ -562,17 +564,20 @@ void GLCanvas3D::LayersEditing::render_volumes(const GLCanvas3D& canvas, const G
     const Camera& camera = wxGetApp().plater()->get_camera();
     shader->set_uniform("projection_matrix", camera.get_projection_matrix());
 
-    // Initialize the layer height texture mapping.
-    const GLsizei w = (GLsizei)m_layers_texture.width;
-    const GLsizei h = (GLsizei)m_layers_texture.height;
-    const GLsizei half_w = w / 2;
-    const GLsizei half_h = h / 2;
-    glsafe(::glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
     glsafe(::glBindTexture(GL_TEXTURE_2D, m_z_texture_id));
-    glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
-    glsafe(::glTexImage2D(GL_TEXTURE_2D, 1, GL_RGBA, half_w, half_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
-    glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, m_layers_texture.data.data()));
-    glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 1, 0, 0, half_w, half_h, GL_RGBA, GL_UNSIGNED_BYTE, m_layers_texture.data.data() + m_layers_texture.width * m_layers_texture.height * 4));
+    if (m_layers_texture.gpu_dirty) {
+        // Refresh the layer height texture mapping, only needed when the profile data changed.
+        const GLsizei w = (GLsizei)m_layers_texture.width;
+        const GLsizei h = (GLsizei)m_layers_texture.height;
+        const GLsizei half_w = w / 2;
+        const GLsizei half_h = h / 2;
+        glsafe(::glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        glsafe(::glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+        glsafe(::glTexImage2D(GL_TEXTURE_2D, 1, GL_RGBA, half_w, half_h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0));
+        glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, m_layers_texture.data.data()));
+        glsafe(::glTexSubImage2D(GL_TEXTURE_2D, 1, 0, 0, half_w, half_h, GL_RGBA, GL_UNSIGNED_BYTE, m_layers_texture.data.data() + m_layers_texture.width * m_layers_texture.height * 4));
+        m_layers_texture.gpu_dirty = false;
+    }
     for (GLVolume* glvolume : volumes.volumes) {
         // Render the object using the layer editing shader and texture.
         if (!glvolume->is_active || glvolume->composite_id.object_id != this->last_object_id || glvolume->is_modifier)
@@ -656,6 +661,7 @@ void GLCanvas3D::LayersEditing::generate_layer_height_texture()
         Slic3r::generate_object_layers(*m_slicing_parameters, m_layer_height_profile),
         m_layers_texture.data.data(), m_layers_texture.height, m_layers_texture.width, level_of_detail_2nd_level);
     m_layers_texture.valid = true;
+    m_layers_texture.gpu_dirty = true;
 }
 
 void GLCanvas3D::LayersEditing::accept_changes(GLCanvas3D & canvas)
@@ -2464,6 +2470,9 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
         }
     }
     m_volumes.volumes = std::move(glvolumes_new);
+    //BBS: meshes of the newly loaded volumes; their raycaster AABB trees are built
+    //in parallel after the loading loop instead of serially while loading
+    std::vector<std::pair<size_t, std::shared_ptr<const TriangleMesh>>> deferred_raycasters;
     for (unsigned int obj_idx = 0; obj_idx < (unsigned int)m_model->objects.size(); ++ obj_idx) {
         const ModelObject &model_object = *m_model->objects[obj_idx];
         for (int volume_idx = 0; volume_idx < (int)model_object.volumes.size(); ++ volume_idx) {
@@ -2484,7 +2493,8 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
                     // Note the index of the loaded volume, so that we can reload the main model GLVolume with the hollowed mesh
                     // later in this function.
                     it->volume_idx = m_volumes.volumes.size();
-                    m_volumes.load_object_volume(&model_object, obj_idx, volume_idx, instance_idx, m_canvas_type == ECanvasType::CanvasAssembleView);
+                    m_volumes.load_object_volume(&model_object, obj_idx, volume_idx, instance_idx, m_canvas_type == ECanvasType::CanvasAssembleView, false, false);
+                    deferred_raycasters.emplace_back(m_volumes.volumes.size() - 1, model_volume.mesh_ptr());
                     m_volumes.volumes.back()->geometry_id = key.geometry_id;
                     update_object_list = true;
                 } else {
@@ -2500,6 +2510,28 @@ void GLCanvas3D::reload_scene(bool refresh_immediately, bool force_full_scene_re
             }
         }
     }
+    if (!deferred_raycasters.empty()) {
+        //BBS: build the raycaster AABB trees of the newly loaded volumes in parallel,
+        //building them one by one while loading used to block the UI thread for
+        //seconds on large models. Instances of the same volume share a single tree.
+        std::vector<std::pair<std::shared_ptr<const TriangleMesh>, std::vector<size_t>>> builds;
+        {
+            std::map<const TriangleMesh*, size_t> build_of_mesh;
+            for (auto& [volume_id, mesh] : deferred_raycasters) {
+                auto [it, inserted] = build_of_mesh.emplace(mesh.get(), builds.size());
+                if (inserted)
+                    builds.emplace_back(std::move(mesh), std::vector<size_t>());
+                builds[it->second].second.emplace_back(volume_id);
+            }
+        }
+        std::vector<std::shared_ptr<GUI::MeshRaycaster>> raycasters(builds.size());
+        tbb::parallel_for(size_t(0), builds.size(), [&builds, &raycasters](size_t i) {
+            raycasters[i] = std::make_shared<GUI::MeshRaycaster>(builds[i].first);
+        });
+        for (size_t i = 0; i < builds.size(); ++i)
+            for (size_t volume_id : builds[i].second)
+                m_volumes.volumes[volume_id]->mesh_raycaster = raycasters[i];
+    }
     if (printer_technology == ptSLA) {
         size_t idx = 0;
         const SLAPrint *sla_print = this->sla_print();
@@ -4355,7 +4387,20 @@ void GLCanvas3D::on_mouse(wxMouseEvent& evt)
         if (m_selection.is_empty())
             m_gizmos.reset_all_states();
 
-        m_dirty = true;
+        //BBS: picking is CPU side ray casting, so the hover state can be refreshed
+        //here without drawing a frame. Only schedule a re-render when the move
+        //actually changed something visible, otherwise idly sweeping the mouse
+        //across the scene redraws it at full cost for identical output.
+        if (m_gizmos.get_current_type() != GLGizmosManager::Undefined)
+            // gizmos may render mouse position dependent visuals (e.g. the painting cursor)
+            m_dirty = true;
+        else {
+            const std::vector<int> old_hover_volume_idxs = m_hover_volume_idxs;
+            const std::vector<int> old_hover_plate_idxs  = m_hover_plate_idxs;
+            _picking_pass();
+            if (m_hover_volume_idxs != old_hover_volume_idxs || m_hover_plate_idxs != old_hover_plate_idxs)
+                m_dirty = true;
+        }
     }
     else
         evt.Skip();
@@ -6187,9 +6232,23 @@ bool GLCanvas3D::_update_imgui_select_plate_toolbar()
 
     _update_select_plate_toolbar_stats_item();
 
+    PartPlateList& plate_list = wxGetApp().plater()->get_partplate_list();
+
+    //BBS: rebuilding the items copies the thumbnail pixels and regenerates one GL
+    //texture per plate. This runs on every idle event, so skip the rebuild when
+    //no plate thumbnail has changed since the items were last generated.
+    std::vector<size_t> thumbnail_versions(plate_list.get_plate_count(), 0);
+    for (int i = 0; i < plate_list.get_plate_count(); i++) {
+        const PartPlate* plate = plate_list.get_plate(i);
+        if (plate != nullptr)
+            thumbnail_versions[i] = plate->thumbnail_data.version;
+    }
+    if (thumbnail_versions == m_sel_plate_toolbar_thumbnail_versions)
+        return true;
+    m_sel_plate_toolbar_thumbnail_versions = std::move(thumbnail_versions);
+
     m_sel_plate_toolbar.del_all_item();
 
-    PartPlateList& plate_list = wxGetApp().plater()->get_partplate_list();
     for (int i = 0; i < plate_list.get_plate_count(); i++) {
         IMToolbarItem* item = new IMToolbarItem();
         PartPlate* plate = plate_list.get_plate(i);
@@ -252,6 +252,8 @@ class GLCanvas3D
             size_t              cells{ 0 };
             // Does it need to be refreshed?
             bool                valid{ false };
+            // Does the GPU copy need to be refreshed?
+            bool                gpu_dirty{ true };
         };
         LayersTexture   m_layers_texture;
 
@@ -522,6 +524,9 @@ private:
     mutable GLToolbar m_main_toolbar;
     mutable GLToolbar m_separator_toolbar;
     mutable IMToolbar m_sel_plate_toolbar;
+    //BBS: thumbnail versions the select plate toolbar items were last generated from,
+    //used to skip the per-idle rebuild of the items when nothing changed
+    std::vector<size_t> m_sel_plate_toolbar_thumbnail_versions;
     mutable GLToolbar m_assemble_view_toolbar;
     mutable IMReturnToolbar m_return_toolbar;
     mutable float m_paint_toolbar_width;
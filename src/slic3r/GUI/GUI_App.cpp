@@ -18,6 +18,7 @@
 #include <iterator>
 #include <exception>
 #include <cstdlib>
+#include <mutex>
 #include <regex>
 #include <thread>
 #include <string_view>
@@ -49,6 +50,7 @@
 #include <wx/fontutil.h>
 #include <wx/glcanvas.h>
 
+#include "libslic3r/LocalesUtils.hpp"
 #include "libslic3r/Utils.hpp"
 #include "libslic3r/Model.hpp"
 #include "libslic3r/I18N.hpp"
@@ -1922,50 +1924,88 @@ void GUI_App::init_networking_callbacks()
             }
         );
 
-        auto message_arrive_fn = [this](std::string dev_id, std::string msg) {
-            if (m_is_closing) {
+        // The status payloads are parsed into a DOM on the agent worker thread, so only the cheap
+        // state application runs on the UI thread. Bursts are coalesced: messages pile up in a
+        // shared queue and a single CallAfter drains all of them in one event loop pass, updating
+        // the AMS list at most once per device per pass instead of once per message.
+        struct DeviceMessage {
+            std::string dev_id;
+            json        dom;
+            bool        lan;
+        };
+        struct DeviceMessageQueue {
+            std::mutex                 mutex;
+            std::vector<DeviceMessage> pending;
+        };
+        auto message_queue = std::make_shared<DeviceMessageQueue>();
+        auto drain_message_queue = [this, message_queue] {
+            if (m_is_closing)
                 return;
+            std::vector<DeviceMessage> messages;
+            {
+                std::lock_guard<std::mutex> lock(message_queue->mutex);
+                messages.swap(message_queue->pending);
             }
-            CallAfter([this, dev_id, msg] {
-                if (m_is_closing)
-                    return;
-                MachineObject* obj = this->m_device_manager->get_user_machine(dev_id);
-                if (obj) {
-                    obj->is_ams_need_update = false;
-                    obj->parse_json(msg);
-
-                    auto sel = this->m_device_manager->get_selected_machine();
-                    if ((sel == obj || sel == nullptr) && obj->is_ams_need_update) {
-                        GUI::wxGetApp().sidebar().load_ams_list(obj->dev_id, obj);
+            std::vector<std::pair<MachineObject*, bool /* lan */>> ams_update_candidates;
+            auto seen = [&ams_update_candidates](MachineObject *obj) {
+                return std::find_if(ams_update_candidates.begin(), ams_update_candidates.end(),
+                    [obj](const std::pair<MachineObject*, bool> &candidate) { return candidate.first == obj; }) != ams_update_candidates.end();
+            };
+            for (DeviceMessage &message : messages) {
+                MachineObject *obj;
+                if (message.lan) {
+                    obj = m_device_manager->get_my_machine(message.dev_id);
+                    if (!obj || !obj->is_lan_mode_printer()) {
+                        obj = m_device_manager->get_local_machine(message.dev_id);
                     }
+                } else {
+                    obj = m_device_manager->get_user_machine(message.dev_id);
+                    if (obj && !seen(obj))
+                        obj->is_ams_need_update = false;
                 }
-            });
+                if (obj) {
+                    if (!seen(obj))
+                        ams_update_candidates.emplace_back(obj, message.lan);
+                    obj->parse_json(std::move(message.dom));
+                }
+            }
+            auto sel = m_device_manager->get_selected_machine();
+            for (const std::pair<MachineObject*, bool> &candidate : ams_update_candidates) {
+                MachineObject *obj = candidate.first;
+                if ((sel == obj || (sel == nullptr && !candidate.second)) && obj->is_ams_need_update) {
+                    GUI::wxGetApp().sidebar().load_ams_list(obj->dev_id, obj);
+                }
+            }
         };
-
-        m_agent->set_on_message_fn(message_arrive_fn);
-
-        auto lan_message_arrive_fn = [this](std::string dev_id, std::string msg) {
+        auto enqueue_message_fn = [this, message_queue, drain_message_queue](std::string dev_id, std::string &msg, bool lan) {
             if (m_is_closing) {
                 return;
             }
-            CallAfter([this, dev_id, msg] {
-                if (m_is_closing)
-                    return;
-
-                MachineObject* obj = m_device_manager->get_my_machine(dev_id);
-                if (!obj || !obj->is_lan_mode_printer()) {
-                    obj = m_device_manager->get_local_machine(dev_id);
-                }
-
-                if (obj) {
-                    obj->parse_json(msg);
-                    if (this->m_device_manager->get_selected_machine() == obj && obj->is_ams_need_update) {
-                        GUI::wxGetApp().sidebar().load_ams_list(obj->dev_id, obj);
-                    }
-                }
-                });
+            // Parse on the agent worker thread, off the UI.
+            json dom;
+            try {
+                CNumericLocalesSetter locales_setter;
+                dom = json::parse(msg);
+            } catch (...) {
+                BOOST_LOG_TRIVIAL(trace) << "message_arrive: json parse failed, dev_id=" << dev_id;
+                return;
+            }
+            bool schedule_drain;
+            {
+                std::lock_guard<std::mutex> lock(message_queue->mutex);
+                schedule_drain = message_queue->pending.empty();
+                message_queue->pending.push_back({ std::move(dev_id), std::move(dom), lan });
+            }
+            if (schedule_drain)
+                CallAfter(drain_message_queue);
         };
-        m_agent->set_on_local_message_fn(lan_message_arrive_fn);
+
+        m_agent->set_on_message_fn([enqueue_message_fn](std::string dev_id, std::string msg) {
+            enqueue_message_fn(std::move(dev_id), msg, false);
+        });
+        m_agent->set_on_local_message_fn([enqueue_message_fn](std::string dev_id, std::string msg) {
+            enqueue_message_fn(std::move(dev_id), msg, true);
+        });
         m_agent->set_queue_on_main_fn([this](std::function<void()> callback) {
             CallAfter(callback);
         });
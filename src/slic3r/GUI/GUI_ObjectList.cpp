@@ -1113,11 +1113,15 @@ void ObjectList::paste_objects_into_list(const std::vector<size_t>& object_idxs)
         return;
 
     wxDataViewItemArray items;
+    // Freeze the control over the batch, a pasted selection can span many objects.
+    Freeze();
     for (const size_t object : object_idxs)
     {
-        add_object_to_list(object);
+        // The selection is applied once below, skip the per-object selection change.
+        add_object_to_list(object, false);
         items.Add(m_objects_model->GetItemById(object));
     }
+    Thaw();
 
     wxGetApp().plater()->changed_objects(object_idxs);
 
@@ -3617,9 +3621,15 @@ void ObjectList::add_objects_to_list(std::vector<size_t> obj_idxs, bool call_sel
 #ifdef __WXOSX__
     AssociateModel(nullptr);
 #endif
-    for (const size_t idx : obj_idxs) {
-        add_object_to_list(idx, call_selection_changed, notify_partplate, do_info_update);
-    }
+    // Batched insertion: layouting is frozen for the whole batch and the selection is changed
+    // only for the last added object. Without this every object of a multi-file import pays a
+    // full relayout plus a sidebar refresh through selection_changed() and large imports spend
+    // tens of seconds in pure UI churn.
+    Freeze();
+    for (size_t i = 0; i < obj_idxs.size(); ++ i) {
+        add_object_to_list(obj_idxs[i], call_selection_changed && i + 1 == obj_idxs.size(), notify_partplate, do_info_update);
+    }
+    Thaw();
 #ifdef __WXOSX__
     AssociateModel(m_objects_model);
 #endif
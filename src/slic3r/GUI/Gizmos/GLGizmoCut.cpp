@@ -12,6 +12,7 @@
 #include "slic3r/GUI/GUI_App.hpp"
 #include "slic3r/GUI/Plater.hpp"
 #include "slic3r/GUI/Gizmos/GizmoObjectManipulation.hpp"
+#include "slic3r/GUI/Jobs/CutJob.hpp"
 #include "slic3r/GUI/format.hpp"
 #include "slic3r/Utils/UndoRedo.hpp"
 #include "libslic3r/AppConfig.hpp"
@@ -3342,8 +3343,6 @@ void GLGizmoCut3D::perform_cut(const Selection& selection)
 
     // perform cut
     {
-        Plater::TakeSnapshot snapshot(wxGetApp().plater(), _u8L("Cut by Plane"));
-
         // This shall delete the part selection class and deallocate the memory.
         ScopeGuard part_selection_killer([this]() { m_part_selection = PartSelection(); });
 
@@ -3361,9 +3360,7 @@ void GLGizmoCut3D::perform_cut(const Selection& selection)
         // update connectors pos as offset of its center before cut performing
         apply_connectors_in_model(cut_mo , dowels_count);
 
-        wxBusyCursor wait;
-
-        ModelObjectCutAttributes attributes = only_if(has_connectors ? true : m_keep_upper, ModelObjectCutAttribute::KeepUpper) |
+        ModelObjectCutAttributes attributes =only_if(has_connectors ? true : m_keep_upper, ModelObjectCutAttribute::KeepUpper) |
                                               only_if(has_connectors ? true : m_keep_lower, ModelObjectCutAttribute::KeepLower) |
                                               only_if(has_connectors ? false : m_keep_as_parts, ModelObjectCutAttribute::KeepAsParts) |
                                               only_if(m_place_on_cut_upper, ModelObjectCutAttribute::PlaceOnCutUpper) |
@@ -3376,20 +3373,44 @@ void GLGizmoCut3D::perform_cut(const Selection& selection)
         // update cut_id for the cut object in respect to the attributes
         update_object_cut_id(cut_mo->cut_id, attributes, dowels_count);
 
-        Cut cut(cut_mo, instance_idx, get_cut_matrix(selection), attributes);
-        const ModelObjectPtrs& new_objects = cut_by_contour    ? cut.perform_by_contour(m_part_selection.get_cut_parts(), dowels_count):
-                                             cut_with_groove   ? cut.perform_with_groove(m_groove, m_rotation_m) :
-                                                                 cut.perform_with_plane();
-
-        check_objects_after_cut(new_objects);
+        // Schedule the cut as a cancellable background job. The Cut holds its own copy of the
+        // object, so the scene stays interactive while the boolean runs on the worker thread
+        // and a canceled job leaves the model untouched.
+        CutJobParams params;
+        params.cut        = std::make_unique<Cut>(cut_mo, instance_idx, get_cut_matrix(selection), attributes);
+        params.by_contour = cut_by_contour;
+        if (cut_by_contour) {
+            params.parts        = m_part_selection.get_cut_parts();
+            params.dowels_count = dowels_count;
+        }
+        params.with_groove = cut_with_groove;
+        if (cut_with_groove) {
+            params.groove     = m_groove;
+            params.rotation_m = m_rotation_m;
+        }
 
         // save cut_id to post update synchronization
         const CutObjectBase cut_id = cut_mo->cut_id;
 
-        // update cut results on plater and in the model 
-        plater->apply_cut_object_to_model(object_idx, new_objects);
+        params.on_finished = [plater, object_id = mo->id(), cut_id](const ModelObjectPtrs& new_objects) {
+            // The model may have changed while the cut was running, resolve the object by its id.
+            const ModelObjectPtrs& objects = plater->model().objects;
+            auto it = std::find_if(objects.begin(), objects.end(), [&object_id](const ModelObject* object) { return object->id() == object_id; });
+            if (it == objects.end())
+                // The object was deleted in the meantime.
+                return;
+
+            Plater::TakeSnapshot snapshot(plater, _u8L("Cut by Plane"));
+
+            check_objects_after_cut(new_objects);
+
+            // update cut results on plater and in the model
+            plater->apply_cut_object_to_model(it - objects.begin(), new_objects);
+
+            synchronize_model_after_cut(plater->model(), cut_id);
+        };
 
-        synchronize_model_after_cut(plater->model(), cut_id);
+        plater->cut_async(std::move(params));
     }
 }
 
@@ -151,18 +151,18 @@ void InstancesHider::on_update()
         canvas->set_clipping_plane(1, ClippingPlane(-Vec3d::UnitZ(), std::numeric_limits<double>::max()));
 
 
-        std::vector<const TriangleMesh*> meshes;
+        std::vector<uint64_t> mesh_revisions;
         for (const ModelVolume* mv : mo->volumes)
-            meshes.push_back(&mv->mesh());
+            mesh_revisions.push_back(mv->mesh_revision());
 
-        if (meshes != m_old_meshes) {
+        if (mesh_revisions != m_old_mesh_revisions) {
             m_clippers.clear();
-            for (const TriangleMesh* mesh : meshes) {
+            for (const ModelVolume* mv : mo->volumes) {
                 m_clippers.emplace_back(new MeshClipper);
                 m_clippers.back()->set_plane(ClippingPlane(-Vec3d::UnitZ(), z_min));
-                m_clippers.back()->set_mesh(mesh->its);
+                m_clippers.back()->set_mesh(mv->mesh().its);
             }
-            m_old_meshes = meshes;
+            m_old_mesh_revisions = std::move(mesh_revisions);
         }
     }
     else
@@ -173,7 +173,7 @@ void InstancesHider::on_release()
 {
     get_pool()->get_canvas()->toggle_model_objects_visibility(true);
     get_pool()->get_canvas()->set_use_clipping_planes(false);
-    m_old_meshes.clear();
+    m_old_mesh_revisions.clear();
     m_clippers.clear();
 }
 
@@ -219,25 +219,26 @@ void Raycaster::on_update()
     if (mo == nullptr)
         return;
 
-    std::vector<const TriangleMesh*> meshes;
+    std::vector<uint64_t> mesh_revisions;
     const std::vector<ModelVolume*>& mvs = mo->volumes;
     for (const ModelVolume* mv : mvs) {
         if (mv->is_model_part())
-            meshes.push_back(&mv->mesh());
+            mesh_revisions.push_back(mv->mesh_revision());
     }
 
-    if (meshes != m_old_meshes) {
+    if (mesh_revisions != m_old_mesh_revisions) {
         m_raycasters.clear();
-        for (const TriangleMesh* mesh : meshes)
-            m_raycasters.emplace_back(new MeshRaycaster(std::make_shared<const TriangleMesh>(*mesh)));
-        m_old_meshes = meshes;
+        for (const ModelVolume* mv : mvs)
+            if (mv->is_model_part())
+                m_raycasters.emplace_back(new MeshRaycaster(mv->mesh_ptr()));
+        m_old_mesh_revisions = std::move(mesh_revisions);
     }
 }
 
 void Raycaster::on_release()
 {
     m_raycasters.clear();
-    m_old_meshes.clear();
+    m_old_mesh_revisions.clear();
 }
 
 std::vector<const MeshRaycaster*> Raycaster::raycasters() const
@@ -256,20 +257,17 @@ void ObjectClipper::on_update()
         return;
 
     // which mesh should be cut?
-    std::vector<const TriangleMesh*> meshes;
-    std::vector<Geometry::Transformation> trafos;
-    for (const ModelVolume* mv : mo->volumes) {
-        meshes.emplace_back(&mv->mesh());
-        trafos.emplace_back(mv->get_transformation());
-    }
+    std::vector<uint64_t> mesh_revisions;
+    for (const ModelVolume* mv : mo->volumes)
+        mesh_revisions.push_back(mv->mesh_revision());
 
-    if (meshes != m_old_meshes) {
+    if (mesh_revisions != m_old_mesh_revisions) {
         m_clippers.clear();
-        for (size_t i = 0; i < meshes.size(); ++i) {
-            m_clippers.emplace_back(new MeshClipper, trafos[i]);
-            m_clippers.back().first->set_mesh(meshes[i]->its);
+        for (const ModelVolume* mv : mo->volumes) {
+            m_clippers.emplace_back(new MeshClipper, mv->get_transformation());
+            m_clippers.back().first->set_mesh(mv->mesh().its);
         }
-        m_old_meshes = std::move(meshes);
+        m_old_mesh_revisions = std::move(mesh_revisions);
 
         m_active_inst_bb_radius =
             mo->instance_bounding_box(get_pool()->selection_info()->get_active_instance()).radius();
@@ -280,7 +278,7 @@ void ObjectClipper::on_update()
 void ObjectClipper::on_release()
 {
     m_clippers.clear();
-    m_old_meshes.clear();
+    m_old_mesh_revisions.clear();
     m_clp.reset();
     m_clp_ratio = 0.;
 
@@ -502,21 +500,19 @@ void ModelObjectsClipper::on_update()
         return;
 
     // which mesh should be cut?
-    std::vector<const TriangleMesh*> meshes;
-
-    if (meshes.empty())
-        for (auto mo : model_objects) {
-            for (const ModelVolume* mv : mo->volumes)
-                meshes.push_back(&mv->mesh());
-        }
+    std::vector<uint64_t> mesh_revisions;
+    for (auto mo : model_objects)
+        for (const ModelVolume* mv : mo->volumes)
+            mesh_revisions.push_back(mv->mesh_revision());
 
-    if (meshes != m_old_meshes) {
+    if (mesh_revisions != m_old_mesh_revisions) {
         m_clippers.clear();
-        for (const TriangleMesh* mesh : meshes) {
-            m_clippers.emplace_back(new MeshClipper);
-            m_clippers.back()->set_mesh(mesh->its);
-        }
-        m_old_meshes = meshes;
+        for (auto mo : model_objects)
+            for (const ModelVolume* mv : mo->volumes) {
+                m_clippers.emplace_back(new MeshClipper);
+                m_clippers.back()->set_mesh(mv->mesh().its);
+            }
+        m_old_mesh_revisions = std::move(mesh_revisions);
 
         m_active_inst_bb_radius = get_pool()->get_canvas()->volumes_bounding_box().radius();
     }
@@ -526,7 +522,7 @@ void ModelObjectsClipper::on_update()
 void ModelObjectsClipper::on_release()
 {
     m_clippers.clear();
-    m_old_meshes.clear();
+    m_old_mesh_revisions.clear();
     m_clp.reset();
     m_clp_ratio = 0.;
 
@@ -198,7 +198,8 @@ protected:
     void on_release() override;
 
 private:
-    std::vector<const TriangleMesh*> m_old_meshes;
+    // Revisions of the volume meshes the cached clippers were built from.
+    std::vector<uint64_t> m_old_mesh_revisions;
     std::vector<std::unique_ptr<MeshClipper>> m_clippers;
 };
 
@@ -222,7 +223,8 @@ protected:
 
 private:
     std::vector<std::unique_ptr<MeshRaycaster>> m_raycasters;
-    std::vector<const TriangleMesh*> m_old_meshes;
+    // Revisions of the volume meshes the cached raycasters were built from.
+    std::vector<uint64_t> m_old_mesh_revisions;
 };
 
 
@@ -254,7 +256,8 @@ protected:
     void on_release() override;
 
 private:
-    std::vector<const TriangleMesh*> m_old_meshes;
+    // Revisions of the volume meshes the cached clippers were built from.
+    std::vector<uint64_t> m_old_mesh_revisions;
     std::vector<std::pair<std::unique_ptr<MeshClipper>, Geometry::Transformation>> m_clippers;
     std::unique_ptr<ClippingPlane> m_clp;
     double m_clp_ratio = 0.;
@@ -372,7 +375,8 @@ protected:
     void on_release() override;
 
 private:
-    std::vector<const TriangleMesh*> m_old_meshes;
+    // Revisions of the volume meshes the cached clippers were built from.
+    std::vector<uint64_t> m_old_mesh_revisions;
     std::vector<std::unique_ptr<MeshClipper>> m_clippers;
     std::unique_ptr<ClippingPlane> m_clp;
     double m_clp_ratio = 0.;
@@ -0,0 +1,43 @@
+#include "CutJob.hpp"
+
+#include "libslic3r/Model.hpp"
+#include "slic3r/GUI/Plater.hpp"
+
+namespace Slic3r { namespace GUI {
+
+// Thrown out of the Cut internals when the user canceled the job.
+struct CutJobCanceled {};
+
+void CutJob::process()
+{
+    m_new_objects = nullptr;
+    if (!m_params.cut)
+        return;
+
+    update_status(0, _L("Cutting"));
+    m_params.cut->set_throw_on_cancel([this]() { if (was_canceled()) throw CutJobCanceled{}; });
+    try {
+        m_new_objects = m_params.by_contour  ? &m_params.cut->perform_by_contour(std::move(m_params.parts), m_params.dowels_count) :
+                        m_params.with_groove ? &m_params.cut->perform_with_groove(m_params.groove, m_params.rotation_m, m_params.keep_as_parts) :
+                                               &m_params.cut->perform_with_plane();
+    }
+    catch (const CutJobCanceled&) {
+        // The Cut released its temporary clones, the live Model was never touched.
+    }
+
+    update_status(100, was_canceled() ? _L("Cut canceled") : _L("Cut done"));
+}
+
+void CutJob::finalize()
+{
+    if (m_new_objects != nullptr && !was_canceled() && m_params.on_finished)
+        m_params.on_finished(*m_new_objects);
+
+    // Release the model copy held by the Cut.
+    m_params = CutJobParams{};
+    m_new_objects = nullptr;
+
+    Job::finalize();
+}
+
+}} // namespace Slic3r::GUI
@@ -0,0 +1,51 @@
+#ifndef CUTJOB_HPP
+#define CUTJOB_HPP
+
+#include "PlaterJob.hpp"
+
+#include "libslic3r/CutUtils.hpp"
+
+namespace Slic3r { namespace GUI {
+
+// Everything the worker thread needs to carve an object. Filled by the Cut gizmo
+// right before the job is started.
+struct CutJobParams
+{
+    std::unique_ptr<Cut>   cut;
+    // perform_by_contour() inputs
+    std::vector<Cut::Part> parts;
+    int                    dowels_count { 0 };
+    bool                   by_contour { false };
+    // perform_with_groove() inputs
+    Cut::Groove            groove;
+    Transform3d            rotation_m { Transform3d::Identity() };
+    bool                   with_groove { false };
+    bool                   keep_as_parts { false };
+    // Executed on the UI thread when the cut succeeded.
+    std::function<void(const ModelObjectPtrs&)> on_finished;
+};
+
+// Runs the CutUtils boolean on a worker thread, so that dense meshes do not block the UI.
+// The Cut class works on its own copy of the model object, therefore the worker never touches
+// the live Model; the results are applied on the UI thread in finalize() and the scene stays
+// interactive while the job runs. Canceling the job between the per-volume cuts leaves the
+// Model as is.
+class CutJob : public PlaterJob
+{
+public:
+    CutJob(std::shared_ptr<ProgressIndicator> pri, Plater *plater) : PlaterJob{std::move(pri), plater} {}
+
+    void set_params(CutJobParams &&params) { m_params = std::move(params); }
+
+protected:
+    void process() override;
+    void finalize() override;
+
+private:
+    CutJobParams           m_params;
+    const ModelObjectPtrs *m_new_objects { nullptr };
+};
+
+}} // namespace Slic3r::GUI
+
+#endif // CUTJOB_HPP
@@ -2259,6 +2259,9 @@ void MainFrame::init_menubar_as_editor()
         append_menu_item(export_menu, wxID_ANY, _L("Export G-code") + dots/* + "\tCtrl+G"*/, _L("Export current plate as G-code"),
             [this](wxCommandEvent&) { if (m_plater) m_plater->export_gcode(false); }, "menu_export_gcode", nullptr,
             [this]() {return can_export_gcode(); }, this);
+        append_menu_item(export_menu, wxID_ANY, _L("Export first layer image") + dots, _L("Export the first layer of the current plate as a high resolution image"),
+            [this](wxCommandEvent&) { if (m_plater) m_plater->export_first_layer_raster(); }, "menu_export_gcode", nullptr,
+            [this]() {return can_export_gcode(); }, this);
         append_menu_item(
             export_menu, wxID_ANY, _L("Export &Configs") + dots /* + "\tCtrl+E"*/, _L("Export current configuration to files"),
             [this](wxCommandEvent &) { export_config(); },
@@ -2709,6 +2712,18 @@ void MainFrame::init_menubar_as_editor()
     append_menu_item(flowrate_menu, wxID_ANY, _L("Pass 2"), _L("Flow rate test - Pass 2"),
         [this](wxCommandEvent&) { if (m_plater) m_plater->calib_flowrate(2); }, "", nullptr,
         [this]() {return m_plater->is_view3D_shown();; }, this);
+    append_menu_item(flowrate_menu, wxID_ANY, _L("Pattern"), _L("Flow rate test - Pattern"),
+        [this](wxCommandEvent&) {
+            if (m_plater) {
+                Calib_Params params;
+                params.mode  = CalibMode::Calib_Flow_Rate;
+                params.start = -20;
+                params.end   = 20;
+                params.step  = 5;
+                m_plater->calib_flowrate_pattern(params);
+            }
+        }, "", nullptr,
+        [this]() {return m_plater->is_view3D_shown();; }, this);
     m_topbar->GetCalibMenu()->AppendSubMenu(flowrate_menu, _L("Flow rate"));
     append_menu_item(m_topbar->GetCalibMenu(), wxID_ANY, _L("Pressure advance"), _L("Pressure advance"),
         [this](wxCommandEvent&) {
@@ -2796,6 +2811,18 @@ void MainFrame::init_menubar_as_editor()
     append_menu_item(flowrate_menu, wxID_ANY, _L("Pass 2"), _L("Flow rate test - Pass 2"),
         [this](wxCommandEvent&) { if (m_plater) m_plater->calib_flowrate(2); }, "", nullptr,
         [this]() {return m_plater->is_view3D_shown();; }, this);
+    append_menu_item(flowrate_menu, wxID_ANY, _L("Pattern"), _L("Flow rate test - Pattern"),
+        [this](wxCommandEvent&) {
+            if (m_plater) {
+                Calib_Params params;
+                params.mode  = CalibMode::Calib_Flow_Rate;
+                params.start = -20;
+                params.end   = 20;
+                params.step  = 5;
+                m_plater->calib_flowrate_pattern(params);
+            }
+        }, "", nullptr,
+        [this]() {return m_plater->is_view3D_shown();; }, this);
     append_submenu(calib_menu,flowrate_menu,wxID_ANY,_L("Flow rate"),_L("Flow rate"),"",
                    [this]() {return m_plater->is_view3D_shown();; });
 
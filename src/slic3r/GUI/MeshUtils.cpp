@@ -538,6 +538,22 @@ bool MeshRaycaster::closest_hit(const Vec2d& mouse_pos, const Transform3d& trafo
     Vec3d direction;
     line_from_mouse_pos(mouse_pos, trafo, camera, point, direction);
 
+    if (clipping_plane == nullptr) {
+        // Without a clipping plane only the closest hit matters, no need to collect,
+        // sort and deduplicate all the intersections along the ray.
+        const AABBMesh::hit_result hit = m_emesh.query_ray_hit(point, direction.normalized());
+        if (!hit.is_hit())
+            return false; // no intersection found
+
+        position = hit.position().cast<float>();
+        normal = hit.normal().cast<float>();
+
+        if (facet_idx != nullptr)
+            *facet_idx = hit.face();
+
+        return true;
+    }
+
     const std::vector<AABBMesh::hit_result> hits = m_emesh.query_ray_hits(point, direction.normalized());
 
     if (hits.empty())
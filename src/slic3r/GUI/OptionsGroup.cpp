@@ -741,7 +741,13 @@ void ConfigOptionsGroup::reload_config()
         if ((opt_id == "bed_temperature" || opt_id == "bed_temperature_initial_layer") && bed_type_field != nullptr)
             opt_index = default_bed_type;
 #endif
-		this->set_value(opt_id, config_value(opt_key, opt_index, option.gui_flags == "serialized"));
+		boost::any value = config_value(opt_key, opt_index, option.gui_flags == "serialized");
+		// Only rebind the widgets whose value actually changed. A preset switch shares most of
+		// the values with the previously shown preset and blindly pushing every value into its
+		// widget makes the switch crawl on pages with many options.
+		Field *field = this->get_field(opt_id);
+		if (field == nullptr || field->value_differs(value))
+			this->set_value(opt_id, value);
 	}
 }
 
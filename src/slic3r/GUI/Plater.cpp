@@ -68,6 +68,7 @@
 //#include "libslic3r/Format/3mf.hpp"
 #include "libslic3r/Format/bbs_3mf.hpp"
 #include "libslic3r/GCode/ThumbnailData.hpp"
+#include "libslic3r/FirstLayerRaster.hpp"
 #include "libslic3r/Model.hpp"
 #include "libslic3r/SLA/Hollowing.hpp"
 #include "libslic3r/SLA/SupportPoint.hpp"
@@ -105,6 +106,7 @@
 #include "Jobs/OrientJob.hpp"
 #include "Jobs/ArrangeJob.hpp"
 #include "Jobs/FillBedJob.hpp"
+#include "Jobs/CutJob.hpp"
 #include "Jobs/RotoptimizeJob.hpp"
 #include "Jobs/SLAImportJob.hpp"
 #include "Jobs/PrintJob.hpp"
@@ -1857,6 +1859,8 @@ struct Plater::priv
     {
         priv *m;
         size_t m_arrange_id, m_fill_bed_id, m_rotoptimize_id, m_sla_import_id, m_orient_id;
+        size_t m_cut_id;
+        CutJob *m_cut_job { nullptr };
         std::shared_ptr<NotificationProgressIndicator> m_pri;
         //BBS
         size_t m_print_id;
@@ -1873,6 +1877,11 @@ struct Plater::priv
             m_fill_bed_id = add_job(std::make_unique<FillBedJob>(m_pri, m->q));
             m_rotoptimize_id = add_job(std::make_unique<RotoptimizeJob>(m_pri, m->q));
             m_sla_import_id = add_job(std::make_unique<SLAImportJob>(m_pri, m->q));
+            {
+                auto cut_job = std::make_unique<CutJob>(m_pri, m->q);
+                m_cut_job = cut_job.get();
+                m_cut_id  = add_job(std::move(cut_job));
+            }
             //BBS add print id
             m_print_id = add_job(std::make_unique<PrintJob>(m_pri, m->q));
         }
@@ -1907,6 +1916,14 @@ struct Plater::priv
             start(m_sla_import_id);
         }
 
+        // The undo/redo snapshot is taken by the finish callback right before the results
+        // are applied to the model, the worker itself does not touch the live Model.
+        void cut(CutJobParams &&params)
+        {
+            m_cut_job->set_params(std::move(params));
+            start(m_cut_id);
+        }
+
         //BBS bbl printing job
         void print()
         {
@@ -2119,6 +2136,11 @@ struct Plater::priv
         return false;
 #endif
     }
+    // Speculative pre-slicing of the early milestones (slicing & perimeters) while the model is being
+    // edited, so that an explicit "Slice now" finds them already calculated. On by default.
+    bool background_pre_slicing_enabled() const {
+        return this->get_config("background_pre_slicing") != "0";
+    }
     void update_print_volume_state();
     void schedule_background_process();
     // Update background processing thread from the current config and Model.
@@ -4649,7 +4671,8 @@ bool Plater::priv::restart_background_process(unsigned int state)
         BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(", Line %1%: print is valid, try to start it now")%__LINE__;
         // The print is valid and it can be started.
         if (this->background_process.start()) {
-            if (!show_warning_dialog)
+            // A speculative pre-slicing pass runs silently, without the slicing progress UI.
+            if (!show_warning_dialog && !this->background_process.speculative())
                 on_slicing_began();
             BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(", Line %1%: start successfully")%__LINE__;
             return true;
@@ -4752,6 +4775,18 @@ unsigned int Plater::priv::update_restart_background_process(bool force_update_s
 
     if (force_update_preview)
         this->preview->reload_print();
+    // Without full background processing, speculatively pre-calculate the slicing & perimeter milestones
+    // at a low priority while the user keeps editing. The PrintApply diff above has already invalidated
+    // just the affected milestones, so the pass only recalculates what the last edit touched.
+    if ((state & (UPDATE_BACKGROUND_PROCESS_INVALID | UPDATE_BACKGROUND_PROCESS_RESTART)) == 0 &&
+        this->printer_technology == ptFFF && background_pre_slicing_enabled() &&
+        ! partplate_list.get_curr_plate()->is_apply_result_invalid() &&
+        ! background_process.empty() && ! background_process.finished() && ! background_process.running() &&
+        ! background_process.is_export_scheduled() && ! background_process.is_upload_scheduled() &&
+        ! m_ui_jobs.is_any_running()) {
+        background_process.set_speculative(true);
+        state |= UPDATE_BACKGROUND_PROCESS_RESTART;
+    }
     this->restart_background_process(state);
     return state;
 }
@@ -5756,6 +5791,10 @@ void Plater::priv::on_select_preset(wxCommandEvent &evt)
 void Plater::priv::on_slicing_update(SlicingStatusEvent &evt)
 {
     BOOST_LOG_TRIVIAL(debug) << __FUNCTION__ << boost::format(": event_type %1%, percent %2%, text %3%") % evt.GetEventType() % evt.status.percent % evt.status.text;
+    if (this->background_process.speculative())
+        // Speculative idle time pre-slicing is invisible to the user, do not touch the slicing progress UI.
+        // Any warnings will be reported again by the explicit slicing run.
+        return;
     //BBS: add slice project logic
     std::string title_text = _u8L("Slicing");
     evt.status.text = title_text + evt.status.text;
@@ -5957,6 +5996,14 @@ void Plater::priv::on_process_completed(SlicingProcessCompletedEvent &evt)
         BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": ignore this event %1%") % evt.status();
         return;
     }
+    if (this->background_process.speculative()) {
+        // A speculative pre-slicing pass ended. No G-code was produced and the user did not ask for a
+        // slice, so leave the plate state, the preview and the action buttons untouched. The finished
+        // milestones are picked up by the next explicit slicing run; errors are reported there as well.
+        this->background_process.stop();
+        BOOST_LOG_TRIVIAL(info) << __FUNCTION__ << boost::format(": speculative pre-slicing pass ended, status %1%") % evt.status();
+        return;
+    }
     //BBS: add project slice logic
     bool is_finished = !m_slice_all || (m_cur_slice_plate == (partplate_list.get_plate_count() - 1));
 
@@ -8589,6 +8636,65 @@ void Plater::calib_flowrate(int pass) {
     wxGetApp().get_tab(Preset::TYPE_PRINTER)->reload_config();
 }
 
+void Plater::calib_flowrate_pattern(const Calib_Params& params)
+{
+    // Flow rate test from a toolpath template: the pads are emitted as custom per-layer
+    // G-code by CalibFlowRatePattern, only the small "handle" cube gets sliced.
+    const auto calib_name = wxString::Format(L"Flow rate test - Pattern");
+    new_project(false, false, calib_name);
+    wxGetApp().mainframe->select_tab(size_t(MainFrame::tp3DEditor));
+
+    if (params.mode != CalibMode::Calib_Flow_Rate)
+        return;
+
+    // add "handle" cube
+    sidebar().obj_list()->load_generic_subobject("Cube", ModelVolumeType::INVALID);
+    orient();
+    changed_objects({ 0 });
+    _calib_pa_select_added_objects();
+
+    auto print_config = &wxGetApp().preset_bundle->prints.get_edited_preset().config;
+    auto printer_config = &wxGetApp().preset_bundle->printers.get_edited_preset().config;
+    const double nozzle_diameter = printer_config->option<ConfigOptionFloats>("nozzle_diameter")->get_at(0);
+
+    // match the scaling rules of the sliced flow rate test
+    double layer_height = nozzle_diameter / 2.0;
+    double first_layer_height = std::max(print_config->option<ConfigOptionFloat>("initial_layer_print_height")->value, layer_height);
+
+    print_config->set_key_value("layer_height", new ConfigOptionFloat(layer_height));
+    print_config->set_key_value("initial_layer_print_height", new ConfigOptionFloat(first_layer_height));
+    print_config->set_key_value("line_width", new ConfigOptionFloatOrPercent(nozzle_diameter * 1.2, false));
+    print_config->set_key_value("skirt_loops", new ConfigOptionInt(0));
+    print_config->set_key_value("brim_type", new ConfigOptionEnum<BrimType>(BrimType::btNoBrim));
+
+    wxGetApp().get_tab(Preset::TYPE_PRINT)->update_dirty();
+    wxGetApp().get_tab(Preset::TYPE_PRINT)->reload_config();
+
+    const DynamicPrintConfig full_config = wxGetApp().preset_bundle->full_config();
+    PresetBundle* preset_bundle = wxGetApp().preset_bundle;
+    const bool is_bbl_machine = preset_bundle->is_bbl_vendor();
+    const Vec3d plate_origin = get_partplate_list().get_current_plate_origin();
+    CalibFlowRatePattern pattern(params, full_config, is_bbl_machine, model(), plate_origin);
+
+    // scale cube to suit test
+    GizmoObjectManipulation& giz_obj_manip = p->view3D->get_canvas3d()->
+        get_gizmos_manager().get_object_manipulation();
+    giz_obj_manip.set_uniform_scaling(true);
+    giz_obj_manip.on_change("size", 0, pattern.handle_xy_size());
+    giz_obj_manip.set_uniform_scaling(false);
+    giz_obj_manip.on_change("size", 2, pattern.max_layer_z());
+    // start with pattern centered on plate
+    center_selection();
+    const Vec3d plate_center = get_partplate_list().get_curr_plate()->get_center_origin();
+    giz_obj_manip.on_change("position", 0, plate_center.x() - (pattern.print_size_x() / 2));
+    giz_obj_manip.on_change("position", 1, plate_center.y() - (pattern.print_size_y() / 2) - pattern.handle_spacing());
+
+    pattern.generate_custom_gcodes(full_config, is_bbl_machine, model(), plate_origin);
+    changed_objects({ 0 });
+
+    p->background_process.fff_print()->set_calib_params(params);
+}
+
 void Plater::calib_temp(const Calib_Params& params) {
     const auto calib_temp_name = wxString::Format(L"Nozzle temperature test");
     new_project(false, false, calib_temp_name);
@@ -9890,6 +9996,11 @@ void Plater::convert_unit(ConversionType conv_type)
     }
 }
 
+void Plater::cut_async(CutJobParams &&params)
+{
+    p->m_ui_jobs.cut(std::move(params));
+}
+
 void Plater::apply_cut_object_to_model(size_t obj_idx, const ModelObjectPtrs& new_objects)
 {
     model().delete_object(obj_idx);
@@ -10595,6 +10706,29 @@ void Plater::export_toolpaths_to_obj() const
     p->preview->get_canvas3d()->export_toolpaths_to_obj(into_u8(path).c_str());
 }
 
+void Plater::export_first_layer_raster() const
+{
+    if (printer_technology() != ptFFF)
+        return;
+
+    fs::path output_file = p->get_export_file_path(FT_GCODE);
+    output_file.replace_extension("png");
+    wxFileDialog dlg(p->preview, _L("Export first layer image:"),
+        from_path(output_file.parent_path()), from_path(output_file.filename()),
+        "PNG files (*.png)|*.png", wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+    if (dlg.ShowModal() != wxID_OK)
+        return;
+
+    wxBusyCursor wait;
+    sla::EncodedRaster raster = rasterize_first_layer(this->fff_print());
+    if (raster.size() == 0) {
+        show_error(p->preview, _L("Nothing to export, the first layer of the current plate is empty."));
+        return;
+    }
+    fs::fstream file(into_path(dlg.GetPath()), std::ios::out | std::ios::binary | std::ios::trunc);
+    file.write(static_cast<const char*>(raster.data()), raster.size());
+}
+
 //BBS: add multiple plate reslice logic
 void Plater::reslice()
 {
@@ -90,6 +90,7 @@ struct Camera;
 class GLToolbar;
 class PlaterPresetComboBox;
 class PartPlateList;
+struct CutJobParams;
 
 using t_optgroups = std::vector <std::shared_ptr<ConfigOptionsGroup>>;
 
@@ -252,6 +253,7 @@ public:
     // SoftFever
     void calib_pa(const Calib_Params& params);
     void calib_flowrate(int pass);
+    void calib_flowrate_pattern(const Calib_Params& params);
     void calib_temp(const Calib_Params& params);
     void calib_max_vol_speed(const Calib_Params& params);
     void calib_retraction(const Calib_Params& params);
@@ -339,6 +341,8 @@ public:
     void convert_unit(ConversionType conv_type);
 
     void apply_cut_object_to_model(size_t init_obj_idx, const ModelObjectPtrs& cut_objects);
+    // Run a cut as a cancellable background job; the params' finish callback applies the results.
+    void cut_async(CutJobParams &&params);
 
     void send_to_printer(bool isall = false);
     void export_gcode(bool prefer_removable);
@@ -361,6 +365,7 @@ public:
     void reload_all_from_disk();
     bool has_toolpaths_to_export() const;
     void export_toolpaths_to_obj() const;
+    void export_first_layer_raster() const;
     void reslice();
     void record_slice_preset(std::string action);
     void reslice_SLA_supports(const ModelObject &object, bool postpone_error_messages = false);
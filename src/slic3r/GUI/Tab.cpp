@@ -1863,6 +1863,7 @@ void TabPrint::build()
 
         optgroup = page->new_optgroup(L("Precision"), L"param_precision");
         optgroup->append_single_option_line("slice_closing_radius");
+        optgroup->append_single_option_line("slice_open_loop_gap_closing");
         optgroup->append_single_option_line("resolution");
         optgroup->append_single_option_line("enable_arc_fitting");
         optgroup->append_single_option_line("xy_hole_compensation");
@@ -2718,6 +2719,7 @@ void TabFilament::build()
 
         optgroup->append_single_option_line("enable_pressure_advance");
         optgroup->append_single_option_line("pressure_advance");
+        optgroup->append_single_option_line("pressure_advance_per_feature");
 
         optgroup->append_single_option_line("filament_density");
         optgroup->append_single_option_line("filament_shrink");
@@ -3005,6 +3007,7 @@ void TabFilament::toggle_options()
     {
         bool pa = m_config->opt_bool("enable_pressure_advance", 0);
         toggle_option("pressure_advance", pa);
+        toggle_option("pressure_advance_per_feature", pa);
 
         toggle_line("cool_plate_temp_initial_layer", is_BBL_printer);
         toggle_line("eng_plate_temp_initial_layer", is_BBL_printer);
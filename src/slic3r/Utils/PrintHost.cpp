@@ -1,6 +1,7 @@
 #include "PrintHost.hpp"
 
 #include <vector>
+#include <chrono>
 #include <thread>
 #include <exception>
 #include <boost/optional.hpp>
@@ -83,6 +84,11 @@ struct PrintHostJobQueue::priv
     size_t job_id = 0;
     int prev_progress = -1;
     fs::path source_to_remove;
+    // Set while a failed upload attempt is going to be retried: errors are logged instead of
+    // emitted to the queue dialog, only the error of the final attempt is surfaced.
+    bool retry_pending = false;
+    // Set when the running job was cancelled from the dialog, to suppress the retries.
+    bool current_job_cancelled = false;
 
     std::thread bg_thread;
     bool bg_exit = false;
@@ -221,6 +227,7 @@ void PrintHostJobQueue::priv::progress_fn(Http::Progress progress, bool &cancel)
         for (size_t cancel_id : *cancels) {
             if (cancel_id == job_id) {
                 cancel = true;
+                current_job_cancelled = true;
             } else if (cancel_id > job_id) {
                 const size_t idx = cancel_id - job_id - 1;
                 if (idx < jobs->size()) {
@@ -255,6 +262,7 @@ void PrintHostJobQueue::priv::error_fn(wxString error)
         for (size_t cancel_id : *cancels) {
             if (cancel_id == job_id) {
                 do_emit_err = false;
+                current_job_cancelled = true;
                 emit_cancel(job_id);
             }
             else if (cancel_id > job_id) {
@@ -268,8 +276,13 @@ void PrintHostJobQueue::priv::error_fn(wxString error)
         }
         cancels->clear();
     }
-    if (do_emit_err)
-        emit_error(std::move(error));
+    if (do_emit_err) {
+        if (retry_pending)
+            // Another attempt is coming, do not bother the queue dialog with this error.
+            BOOST_LOG_TRIVIAL(warning) << boost::format("PrintHostJobQueue: Upload error, going to retry: %1%") % error.ToUTF8().data();
+        else
+            emit_error(std::move(error));
+    }
 }
 
 void PrintHostJobQueue::priv::info_fn(wxString tag, wxString status)
@@ -298,11 +311,32 @@ void PrintHostJobQueue::priv::perform_job(PrintHostJob the_job)
 {
     emit_progress(0);   // Indicate the upload is starting
 
-    bool success = the_job.printhost->upload(std::move(the_job.upload_data),
-        [this](Http::Progress progress, bool &cancel)   { this->progress_fn(std::move(progress), cancel); },
-        [this](wxString error)                          { this->error_fn(std::move(error)); },
-        [this](wxString tag, wxString host)             { this->info_fn(std::move(tag), std::move(host)); }
-    );
+    // The upload APIs of the supported hosts are single multipart POSTs without a ranged or
+    // resumable variant, so a dropped connection cannot resume mid-file. The queue at least
+    // retries the whole upload a few times with a short backoff, which removes the manual
+    // restart round trip on flaky links. Only the error of the final attempt reaches the
+    // queue dialog.
+    static constexpr int max_attempts = 3;
+    bool success = false;
+    current_job_cancelled = false;
+    for (int attempt = 1; attempt <= max_attempts && ! success; ++ attempt) {
+        retry_pending = attempt < max_attempts;
+        success = the_job.printhost->upload(PrintHostUpload(the_job.upload_data),
+            [this](Http::Progress progress, bool &cancel)   { this->progress_fn(std::move(progress), cancel); },
+            [this](wxString error)                          { this->error_fn(std::move(error)); },
+            [this](wxString tag, wxString host)             { this->info_fn(std::move(tag), std::move(host)); }
+        );
+        if (! success) {
+            if (current_job_cancelled || bg_exit)
+                break;
+            if (attempt < max_attempts) {
+                BOOST_LOG_TRIVIAL(warning) << boost::format("PrintHostJobQueue: Upload attempt %1% of %2% failed, retrying")
+                    % attempt % max_attempts;
+                std::this_thread::sleep_for(std::chrono::seconds(attempt));
+            }
+        }
+    }
+    retry_pending = false;
 
     if (success) {
         emit_progress(100);
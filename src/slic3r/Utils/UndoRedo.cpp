@@ -23,6 +23,7 @@
 
 #include "slic3r/GUI/3DScene.hpp"
 #include <boost/foreach.hpp>
+#include <miniz.h>
 
 #ifndef NDEBUG
 // #define SLIC3R_UNDOREDO_DEBUG
@@ -335,6 +336,16 @@ private:
 	std::string 				m_serialized;
 };
 
+// Snapshot blobs above this size are stored deflated. Smaller blobs rarely shrink and their
+// contribution to the total Undo / Redo stack memory is negligible anyway.
+static constexpr size_t snapshot_compression_threshold = 4096;
+
+static bool uncompress_snapshot_data(const char *src, size_t src_size, char *dst, size_t dst_size)
+{
+	mz_ulong len = mz_ulong(dst_size);
+	return mz_uncompress((unsigned char*)dst, &len, (const unsigned char*)src, mz_ulong(src_size)) == MZ_OK && len == mz_ulong(dst_size);
+}
+
 struct MutableHistoryInterval
 {
 private:
@@ -343,14 +354,30 @@ private:
 		// Reference counter of this data chunk. We may have used shared_ptr, but the shared_ptr is thread safe
 		// with the associated cost of CPU cache invalidation on refcount change.
 		size_t		refcnt;
+		// Number of bytes stored at data (the deflated size if the blob is stored compressed).
 		size_t		size;
+		// Size of the original serialized blob. Equal to this->size if the blob is stored raw.
+		size_t		uncompressed_size;
+		// Copy of the first 8 bytes of the serialized blob: objects providing a reliable timestamp
+		// serialize it first and the timestamp has to stay accessible when the rest of the blob
+		// is stored compressed.
+		uint64_t	timestamp_prefix;
 		char 		data[1];
 
+		bool 		compressed() const { return this->size != this->uncompressed_size; }
+
 		// The serialized data matches the data stored here.
-		bool 		matches(const std::string& rhs) { return this->size == rhs.size() && memcmp(this->data, rhs.data(), this->size) == 0; }
+		bool 		matches(const std::string& rhs) {
+			if (this->uncompressed_size != rhs.size())
+				return false;
+			if (! this->compressed())
+				return memcmp(this->data, rhs.data(), this->size) == 0;
+			std::string buf(this->uncompressed_size, 0);
+			return uncompress_snapshot_data(this->data, this->size, buf.data(), buf.size()) && memcmp(buf.data(), rhs.data(), buf.size()) == 0;
+		}
 
 		// The timestamp matches the timestamp serialized in the data stored here.
-		bool 		matches_timestamp(uint64_t timestamp) { assert(timestamp > 0);  assert(this->size > 8); return memcmp(this->data, &timestamp, 8) == 0; }
+		bool 		matches_timestamp(uint64_t timestamp) { assert(timestamp > 0);  assert(this->uncompressed_size > 8); return this->timestamp_prefix == timestamp; }
 	};
 
 	Interval    m_interval;
@@ -358,10 +385,28 @@ private:
 
 public:
 	MutableHistoryInterval(const Interval &interval, const std::string &input_data) : m_interval(interval), m_data(nullptr) {
-		m_data = (Data*)new char[offsetof(Data, data) + input_data.size()];
+		// Large serialized blobs are kept deflated: the retained snapshot stack dominates the
+		// application memory in long editing sessions and the cereal output compresses well.
+		// The blobs are inflated transparently by MutableObjectHistory::load().
+		std::string        compressed_data;
+		const std::string *stored = &input_data;
+		if (input_data.size() >= snapshot_compression_threshold) {
+			mz_ulong compressed_size = mz_compressBound(mz_ulong(input_data.size()));
+			compressed_data.resize(size_t(compressed_size));
+			if (mz_compress2((unsigned char*)compressed_data.data(), &compressed_size, (const unsigned char*)input_data.data(), mz_ulong(input_data.size()), MZ_BEST_SPEED) == MZ_OK
+				&& size_t(compressed_size) < input_data.size()) {
+				compressed_data.resize(size_t(compressed_size));
+				stored = &compressed_data;
+			}
+		}
+		m_data = (Data*)new char[offsetof(Data, data) + stored->size()];
 		m_data->refcnt = 1;
-		m_data->size = input_data.size();
-		memcpy(m_data->data, input_data.data(), input_data.size());
+		m_data->size = stored->size();
+		m_data->uncompressed_size = input_data.size();
+		m_data->timestamp_prefix = 0;
+		if (input_data.size() >= 8)
+			memcpy(&m_data->timestamp_prefix, input_data.data(), 8);
+		memcpy(m_data->data, stored->data(), stored->size());
 	}
 
 	MutableHistoryInterval(const Interval &interval, MutableHistoryInterval &other) : m_interval(interval), m_data(other.m_data) {
@@ -392,6 +437,8 @@ public:
 
 	const char* data() const { return m_data->data; }
 	size_t  	size() const { return m_data->size; }
+	size_t		uncompressed_size() const { return m_data->uncompressed_size; }
+	bool		compressed() const { return m_data->compressed(); }
 	size_t		refcnt() const { return m_data->refcnt; }
 	bool		matches(const std::string& data) { return m_data->matches(data); }
 	bool		matches_timestamp(uint64_t timestamp) { return m_data->matches_timestamp(timestamp); }
@@ -485,7 +532,12 @@ public:
 				--it;
 		}
 		//assert(timestamp >= it->begin() && timestamp < it->end());
-		return std::string(it->data(), it->data() + it->size());
+		if (! it->compressed())
+			return std::string(it->data(), it->data() + it->size());
+		std::string data(it->uncompressed_size(), 0);
+		if (! uncompress_snapshot_data(it->data(), it->size(), data.data(), data.size()))
+			throw Slic3r::RuntimeError("Undo / Redo stack: failed to decompress a snapshot.");
+		return data;
 	}
 
 	// Currently all mutable snapshots are mandatory.
@@ -543,6 +595,29 @@ bool MutableObjectHistory<T>::valid()
 }
 #endif /* NDEBUG */
 
+// Minimalistic output stream buffer writing into an externally owned std::string,
+// so that the serialization buffers may be pooled and reused between snapshots
+// instead of allocating a fresh std::ostringstream per serialized object.
+class StringStreamBuf : public std::streambuf
+{
+public:
+	StringStreamBuf(std::string &buffer) : m_buffer(buffer) {}
+
+protected:
+	int_type overflow(int_type c) override {
+		if (c != traits_type::eof())
+			m_buffer.push_back(char(c));
+		return c;
+	}
+	std::streamsize xsputn(const char *s, std::streamsize n) override {
+		m_buffer.append(s, size_t(n));
+		return n;
+	}
+
+private:
+	std::string &m_buffer;
+};
+
 class StackImpl
 {
 public:
@@ -696,6 +771,9 @@ private:
 	// Last selection serialized or deserialized.
 	Selection 												m_selection;
 	std::vector<ObjectBase*> 								m_reusable_objects;
+	// Serialization buffers reused between snapshots, pooled by the recursion depth of save_mutable_object().
+	std::vector<std::unique_ptr<std::string>>				m_serialization_buffers;
+	size_t 													m_serialization_depth { 0 };
 };
 
 using InputArchive  = cereal::UserDataAdapter<StackImpl, cereal::BinaryInputArchive>;
@@ -846,13 +924,20 @@ template<typename T> ObjectID StackImpl::save_mutable_object(const T &object)
 			needs_to_save = ! object_history->try_save_timestamp(m_active_snapshot_time, m_current_time, timestamp);
 	}
 	if (needs_to_save) {
-		// Serialize the object into a string.
-		std::ostringstream oss;
+		// Serialize the object into a string. save_mutable_object() recurses (Model -> ModelObject -> ModelVolume ...),
+		// therefore the serialization buffers are pooled by recursion depth and their allocations reused between snapshots.
+		if (m_serialization_depth == m_serialization_buffers.size())
+			m_serialization_buffers.emplace_back(std::make_unique<std::string>());
+		std::string &buffer = *m_serialization_buffers[m_serialization_depth ++];
+		buffer.clear();
 		{
-			Slic3r::UndoRedo::OutputArchive archive(*this, oss);
+			StringStreamBuf streambuf(buffer);
+			std::ostream    os(&streambuf);
+			Slic3r::UndoRedo::OutputArchive archive(*this, os);
 			archive(object);
 		}
-		object_history->save(m_active_snapshot_time, m_current_time, oss.str());
+		-- m_serialization_depth;
+		object_history->save(m_active_snapshot_time, m_current_time, buffer);
 	}
 	return object.id();
 }
@@ -0,0 +1,220 @@
+// Microbenchmarks for the hot geometry primitives: Clipper offsets and
+// booleans, Douglas-Peucker, point-in-polygon, convex hull and the AABB line
+// tree. The input corpus is not synthetic: a reference sphere is sliced
+// through the real pipeline and the layer islands are used as operands, so
+// the polygon vertex distribution matches what the slicing stages feed these
+// primitives. The mesh and the configuration are pinned, thus the corpus is
+// identical between runs and the numbers are comparable across commits.
+//
+// Each benchmark is re-run until it accumulates enough wall clock time for a
+// stable average and reported as nanoseconds per operation as JSON, so an
+// optimization PR can attach before/after output of this tool.
+//
+// Usage: geometry_benchmarks [output.json]
+// Without an argument the report is written to stdout.
+
+#include "fff_print/test_data.hpp"
+
+#include "libslic3r/AABBTreeLines.hpp"
+#include "libslic3r/ClipperUtils.hpp"
+#include "libslic3r/ExPolygon.hpp"
+#include "libslic3r/Geometry/ConvexHull.hpp"
+#include "libslic3r/Layer.hpp"
+#include "libslic3r/Model.hpp"
+#include "libslic3r/Print.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Slic3r;
+
+namespace {
+
+struct BenchmarkResult {
+    std::string name;
+    size_t      iterations = 0;
+    double      ns_per_op  = 0.;
+    // Folded result of the benchmarked primitive: keeps the optimizer from
+    // discarding the work and doubles as a cheap cross-run sanity value.
+    uint64_t    checksum   = 0;
+};
+
+// Repeat fn until at least min_duration of wall clock time is accumulated
+// (after one untimed warm-up call) and return the average time per call.
+BenchmarkResult run_benchmark(const std::string &name, const std::function<uint64_t()> &fn)
+{
+    static constexpr double min_duration_seconds = 0.25;
+    static constexpr size_t max_iterations       = 1000000;
+    BenchmarkResult result;
+    result.name = name;
+    result.checksum = fn();
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.;
+    while (elapsed < min_duration_seconds && result.iterations < max_iterations) {
+        result.checksum ^= fn();
+        ++ result.iterations;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    result.ns_per_op = 1e9 * elapsed / double(result.iterations);
+    std::fprintf(stderr, "%-28s %12.0f ns/op  (%zu iterations)\n", name.c_str(), result.ns_per_op, result.iterations);
+    return result;
+}
+
+uint64_t expolygons_checksum(const ExPolygons &expolygons)
+{
+    uint64_t sum = 0;
+    for (const ExPolygon &expoly : expolygons)
+        sum += expoly.contour.points.size() + expoly.holes.size();
+    return sum;
+}
+
+// Slice the pinned reference model and return the islands of every layer.
+std::vector<ExPolygons> build_corpus()
+{
+    Print print;
+    Model model;
+    Test::init_print({ Test::TestMesh::sphere_50mm }, print, model);
+    print.set_status_silent();
+    for (PrintObject *object : print.objects())
+        object->slice();
+    std::vector<ExPolygons> corpus;
+    for (const PrintObject *object : print.objects())
+        for (const Layer *layer : object->layers())
+            corpus.emplace_back(layer->lslices);
+    return corpus;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    std::cerr << "slicing the input corpus..." << std::endl;
+    const std::vector<ExPolygons> corpus = build_corpus();
+    if (corpus.size() < 3) {
+        std::cerr << "corpus is unexpectedly small, aborting" << std::endl;
+        return 1;
+    }
+    // Two adjacent mid-height layers: the typical operands of the overhang
+    // and support detection booleans.
+    const ExPolygons &layer_a  = corpus[corpus.size() / 2];
+    const ExPolygons &layer_b  = corpus[corpus.size() / 2 + 1];
+    const Polygons    polys_a  = to_polygons(layer_a);
+    const Lines       lines_a  = to_lines(layer_a);
+    Points            all_points;
+    for (const Polygon &polygon : polys_a)
+        append(all_points, polygon.points);
+    // A grid of query points spanning the layer bounding box, for the
+    // point-in-polygon and distance queries.
+    const BoundingBox bbox = get_extents(layer_a);
+    Points query_points;
+    for (int ix = 0; ix < 32; ++ ix)
+        for (int iy = 0; iy < 32; ++ iy)
+            query_points.emplace_back(
+                bbox.min.x() + coord_t((bbox.max.x() - bbox.min.x()) * int64_t(ix) / 31),
+                bbox.min.y() + coord_t((bbox.max.y() - bbox.min.y()) * int64_t(iy) / 31));
+    const AABBTreeLines::LinesDistancer<Line> distancer(Lines(lines_a));
+
+    const float small_delta = float(scale_(0.05));
+    const float large_delta = float(scale_(0.5));
+
+    std::vector<BenchmarkResult> report;
+    report.emplace_back(run_benchmark("offset_expand", [&layer_a, large_delta] {
+        return expolygons_checksum(offset_ex(layer_a, large_delta));
+    }));
+    report.emplace_back(run_benchmark("offset_shrink", [&layer_a, large_delta] {
+        return expolygons_checksum(offset_ex(layer_a, - large_delta));
+    }));
+    report.emplace_back(run_benchmark("offset2_opening", [&layer_a, small_delta] {
+        return expolygons_checksum(offset2_ex(layer_a, - small_delta, small_delta));
+    }));
+    report.emplace_back(run_benchmark("union", [&layer_a, &layer_b] {
+        return expolygons_checksum(union_ex(layer_a, layer_b));
+    }));
+    report.emplace_back(run_benchmark("intersection", [&layer_a, &layer_b] {
+        return expolygons_checksum(intersection_ex(layer_a, layer_b));
+    }));
+    report.emplace_back(run_benchmark("difference", [&layer_a, &layer_b] {
+        return expolygons_checksum(diff_ex(layer_a, layer_b));
+    }));
+    report.emplace_back(run_benchmark("simplify_polygons", [&polys_a] {
+        uint64_t sum = 0;
+        for (const Polygon &polygon : simplify_polygons(polys_a))
+            sum += polygon.points.size();
+        return sum;
+    }));
+    report.emplace_back(run_benchmark("douglas_peucker", [&polys_a, small_delta] {
+        uint64_t sum = 0;
+        for (Polygon polygon : polys_a) {
+            polygon.douglas_peucker(small_delta);
+            sum += polygon.points.size();
+        }
+        return sum;
+    }));
+    report.emplace_back(run_benchmark("point_in_expolygon", [&layer_a, &query_points] {
+        uint64_t inside = 0;
+        for (const Point &pt : query_points)
+            for (const ExPolygon &expoly : layer_a)
+                if (expoly.contains(pt))
+                    ++ inside;
+        return inside;
+    }));
+    report.emplace_back(run_benchmark("convex_hull", [&all_points] {
+        return uint64_t(Geometry::convex_hull(all_points).points.size());
+    }));
+    report.emplace_back(run_benchmark("get_extents", [&layer_a] {
+        uint64_t sum = 0;
+        for (const ExPolygon &expoly : layer_a)
+            sum += uint64_t(get_extents(expoly).size().x() > 0);
+        return sum;
+    }));
+    report.emplace_back(run_benchmark("polygon_area", [&polys_a] {
+        double area = 0.;
+        for (const Polygon &polygon : polys_a)
+            area += polygon.area();
+        return uint64_t(area > 0.);
+    }));
+    report.emplace_back(run_benchmark("aabb_tree_build", [&lines_a] {
+        AABBTreeLines::LinesDistancer<Line> tree{ Lines(lines_a) };
+        return uint64_t(tree.get_lines().size());
+    }));
+    report.emplace_back(run_benchmark("aabb_signed_distance", [&distancer, &query_points] {
+        double sum = 0.;
+        for (const Point &pt : query_points)
+            sum += distancer.distance_from_lines<true>(pt);
+        return uint64_t(sum < 0.);
+    }));
+    report.emplace_back(run_benchmark("aabb_lines_in_radius", [&lines_a, &query_points] {
+        AABBTreeLines::LinesDistancer<Line> tree{ Lines(lines_a) };
+        uint64_t sum = 0;
+        for (const Point &pt : query_points)
+            sum += tree.all_lines_in_radius(pt, scale_(1.)).size();
+        return sum;
+    }));
+
+    std::ostream *out = &std::cout;
+    std::ofstream file;
+    if (argc > 1) {
+        file.open(argv[1]);
+        if (! file) {
+            std::cerr << "cannot open output file " << argv[1] << std::endl;
+            return 1;
+        }
+        out = &file;
+    }
+    *out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < report.size(); ++ i) {
+        char buf[256];
+        std::snprintf(buf, sizeof(buf),
+            "    { \"name\": \"%s\", \"iterations\": %zu, \"ns_per_op\": %.1f, \"checksum\": %llu }%s\n",
+            report[i].name.c_str(), report[i].iterations, report[i].ns_per_op,
+            (unsigned long long)report[i].checksum, i + 1 < report.size() ? "," : "");
+        *out << buf;
+    }
+    *out << "  ]\n}\n";
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Slicing benchmark harness. Slices a curated set of reference models through
+// the print pipeline and reports per stage wall clock time, CPU time and peak
+// resident memory as JSON, one run per model. The output is meant to be stored
+// next to a release and diffed against the previous one, so performance
+// regressions show up as numbers instead of bisection sessions.
+//
+// Usage: benchmarks [output.json]
+// Without an argument the report is written to stdout.
+
+#include "fff_print/test_data.hpp"
+
+#include "libslic3r/Print.hpp"
+#include "libslic3r/Model.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace Slic3r;
+
+namespace {
+
+// Peak resident set size of the process in megabytes. Monotone, so the per
+// stage values show which stage first touched the high water mark. Allocation
+// counts would need a malloc hook; the peak RSS is the portable proxy.
+double peak_rss_mb()
+{
+#ifndef _WIN32
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) == 0)
+#ifdef __APPLE__
+        return double(ru.ru_maxrss) / (1024. * 1024.);
+#else
+        return double(ru.ru_maxrss) / 1024.;
+#endif
+#endif
+    return 0.;
+}
+
+struct StageSample {
+    std::string name;
+    double      wall_ms    = 0.;
+    double      cpu_ms     = 0.;
+    double      peak_rss   = 0.;
+};
+
+struct BenchmarkCase {
+    std::string                                          name;
+    std::initializer_list<Test::TestMesh>                meshes;
+    std::vector<Slic3r::ConfigBase::SetDeserializeItem>  config;
+};
+
+StageSample run_stage(const std::string &name, const std::function<void()> &fn)
+{
+    StageSample sample;
+    sample.name   = name;
+    auto   wall0  = std::chrono::steady_clock::now();
+    clock_t cpu0  = std::clock();
+    fn();
+    sample.cpu_ms   = 1000. * double(std::clock() - cpu0) / CLOCKS_PER_SEC;
+    sample.wall_ms  = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall0).count();
+    sample.peak_rss = peak_rss_mb();
+    return sample;
+}
+
+void emit_json(std::ostream &out, const std::vector<std::pair<std::string, std::vector<StageSample>>> &report)
+{
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < report.size(); ++ i) {
+        out << "    {\n      \"model\": \"" << report[i].first << "\",\n      \"stages\": [\n";
+        const std::vector<StageSample> &stages = report[i].second;
+        for (size_t j = 0; j < stages.size(); ++ j) {
+            char buf[256];
+            std::snprintf(buf, sizeof(buf),
+                "        { \"stage\": \"%s\", \"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"peak_rss_mb\": %.1f }%s\n",
+                stages[j].name.c_str(), stages[j].wall_ms, stages[j].cpu_ms, stages[j].peak_rss,
+                j + 1 < stages.size() ? "," : "");
+            out << buf;
+        }
+        out << "      ]\n    }" << (i + 1 < report.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+std::vector<StageSample> benchmark_model(const BenchmarkCase &bcase)
+{
+    Print model_print;
+    Model model;
+    DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+    for (const ConfigBase::SetDeserializeItem &item : bcase.config)
+        config.set_deserialize_strict(item.opt_key, item.opt_value);
+    Test::init_print(bcase.meshes, model_print, model, config);
+    model_print.set_status_silent();
+
+    std::vector<StageSample> stages;
+    stages.emplace_back(run_stage("slice", [&model_print] {
+        for (PrintObject *object : model_print.objects())
+            object->slice();
+    }));
+    stages.emplace_back(run_stage("perimeters", [&model_print] {
+        for (PrintObject *object : model_print.objects())
+            object->make_perimeters();
+    }));
+    stages.emplace_back(run_stage("infill", [&model_print] {
+        for (PrintObject *object : model_print.objects())
+            object->infill();
+    }));
+    stages.emplace_back(run_stage("support", [&model_print] {
+        for (PrintObject *object : model_print.objects())
+            object->generate_support_material();
+    }));
+    // Finishes the remaining print steps (skirt, brim, ...) and exports the
+    // G-code; the already processed object steps are skipped by their state.
+    stages.emplace_back(run_stage("export", [&model_print] {
+        Test::gcode(model_print);
+    }));
+    return stages;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    // A small spread of geometry characters: a trivial prism, a smooth solid
+    // with many short perimeter segments, bridging, and a support heavy shape.
+    std::vector<BenchmarkCase> cases = {
+        { "cube_20x20x20", { Test::TestMesh::cube_20x20x20 }, {} },
+        { "sphere_50mm",   { Test::TestMesh::sphere_50mm },   {} },
+        { "bridge",        { Test::TestMesh::bridge },        {} },
+        { "overhang_supported", { Test::TestMesh::overhang }, { { "support_material", 1 } } },
+    };
+
+    std::vector<std::pair<std::string, std::vector<StageSample>>> report;
+    report.reserve(cases.size());
+    for (const BenchmarkCase &bcase : cases) {
+        std::cerr << "benchmarking " << bcase.name << "..." << std::endl;
+        report.emplace_back(bcase.name, benchmark_model(bcase));
+    }
+
+    if (argc > 1) {
+        std::ofstream out(argv[1]);
+        if (! out) {
+            std::cerr << "cannot open output file " << argv[1] << std::endl;
+            return 1;
+        }
+        emit_json(out, report);
+    } else
+        emit_json(std::cout, report);
+
+    return 0;
+}
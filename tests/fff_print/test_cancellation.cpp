@@ -0,0 +1,64 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "libslic3r/libslic3r.h"
+#include "libslic3r/Print.hpp"
+#include "libslic3r/Model.hpp"
+
+#include "test_data.hpp"
+
+using namespace Slic3r;
+using namespace Slic3r::Test;
+
+// Measures how long Print::cancel() takes to actually stop a running slice.
+// The pipeline polls the cancel flag at checkpoints; if a stage loses its
+// checkpoints (deep avoidance recursion in tree support used to run for many
+// seconds without one), canceling blocks the next job on a farm. The bound
+// here is deliberately loose compared to the 200 ms design target, so the
+// test stays reliable on loaded CI machines while still catching a stage
+// that runs away for seconds.
+static double cancel_latency_ms(std::initializer_list<TestMesh> meshes,
+                                std::initializer_list<ConfigBase::SetDeserializeItem> config_items,
+                                std::chrono::milliseconds delay_before_cancel)
+{
+    Slic3r::Print print;
+    Slic3r::Model model;
+    Slic3r::Test::init_print(meshes, print, model, config_items);
+    print.set_status_silent();
+
+    std::thread worker([&print] {
+        try {
+            print.process();
+        } catch (const CanceledException &) {
+            // Expected when the cancel wins the race against completion.
+        }
+    });
+    std::this_thread::sleep_for(delay_before_cancel);
+    auto cancel_issued = std::chrono::steady_clock::now();
+    print.cancel();
+    worker.join();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cancel_issued).count();
+}
+
+SCENARIO("Print::cancel() stops a running slice with bounded latency", "[Cancellation]") {
+    GIVEN("an overhang sliced with tree support") {
+        THEN("canceling mid-slice returns promptly") {
+            double latency = cancel_latency_ms({TestMesh::overhang}, {
+                { "support_material", 1 },
+                { "support_type",     "tree(auto)" }
+            }, std::chrono::milliseconds(200));
+            INFO("cancel latency: " << latency << " ms");
+            REQUIRE(latency < 2000.);
+        }
+    }
+    GIVEN("a cube sliced with default config") {
+        THEN("canceling mid-slice returns promptly") {
+            double latency = cancel_latency_ms({TestMesh::cube_20x20x20}, {}, std::chrono::milliseconds(50));
+            INFO("cancel latency: " << latency << " ms");
+            REQUIRE(latency < 2000.);
+        }
+    }
+}
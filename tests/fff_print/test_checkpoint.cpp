@@ -0,0 +1,52 @@
+#include <catch2/catch.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include "libslic3r/libslic3r.h"
+#include "libslic3r/Utils.hpp"
+
+#include "test_data.hpp"
+
+using namespace Slic3r;
+using namespace Slic3r::Test;
+
+// The G-code header carries a timestamp, drop it before comparing runs.
+static std::string strip_volatile_header(const std::string &gcode)
+{
+    std::string out;
+    out.reserve(gcode.size());
+    size_t pos = 0;
+    while (pos < gcode.size()) {
+        size_t eol  = gcode.find('\n', pos);
+        size_t next = (eol == std::string::npos) ? gcode.size() : eol + 1;
+        if (gcode.compare(pos, 14, "; generated by") != 0)
+            out.append(gcode, pos, next - pos);
+        pos = next;
+    }
+    return out;
+}
+
+SCENARIO("Slicing checkpoints round-trip", "[Checkpoint]") {
+    GIVEN("a cube sliced with checkpointing enabled") {
+        auto dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("slice-checkpoint-%%%%-%%%%");
+        set_checkpoint_dir(dir.string());
+        std::string first  = Slic3r::Test::slice({ TestMesh::cube_20x20x20 }, { { "fill_density", 20 } });
+        // The second run resumes the slicing step from the checkpoint the first run saved.
+        std::string second = Slic3r::Test::slice({ TestMesh::cube_20x20x20 }, { { "fill_density", 20 } });
+        set_checkpoint_dir(std::string());
+        // Reference run with checkpointing disabled.
+        std::string reference = Slic3r::Test::slice({ TestMesh::cube_20x20x20 }, { { "fill_density", 20 } });
+        THEN("a checkpoint file was saved") {
+            boost::system::error_code ec;
+            REQUIRE(boost::filesystem::exists(dir, ec));
+            REQUIRE(! boost::filesystem::is_empty(dir, ec));
+        }
+        THEN("the resumed run produces the same G-code as a clean run") {
+            REQUIRE(! first.empty());
+            REQUIRE(strip_volatile_header(second) == strip_volatile_header(first));
+            REQUIRE(strip_volatile_header(second) == strip_volatile_header(reference));
+        }
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(dir, ec);
+    }
+}